@@ -28,8 +28,9 @@ int main() {
         ctx_settings
     );
 
-    // FPS limit
-    window->setFramerateLimit(60);
+    // Run loop, only redraws when something happens and sleeps otherwise
+    Application app(window);
+    app.set_clear_color(sf::Color(30, 30, 30)); // Dark background
 
     // ========== CREATE WIDGETS ==========
 
@@ -46,8 +47,6 @@ int main() {
     button->set_color(sf::Color(70, 130, 180));
     button->set_border_thickness(2.0f);
     button->set_border_color(sf::Color::White);
-    // IMPORTANT!!!! Do text settings for a push button last so it can
-    // correctly center and adjust its text size
     button->set_text_string("Click Me!");
     button->set_text_color(sf::Color::White);
 
@@ -168,30 +167,33 @@ int main() {
         window->setMouseCursor(sf::Cursor(sf::Cursor::Type::Arrow));
     });
 
-    // ========== MAIN LOOP ==========
-
-    while (window->isOpen()) {
+    // ========== REGISTER WIDGETS ==========
 
-        while (const std::optional event = window->pollEvent()) {
+    // Registered widgets receive every event and are drawn in this order
+    app.add_widget(*title);
+    app.add_widget(*button);
+    app.add_widget(*counter_label);
+    app.add_widget(*text_input);
+    app.add_widget(*echo_label);
+    app.add_widget(*status_label);
+    app.add_widget(*instructions);
 
-            // Close window: exit
-            if (event->is<sf::Event::Closed>()) window->close();
+    // ESC key to exit (closing the window is handled by the application)
+    app.set_event_callback([&](sf::Event const& event) {
 
-            // ESC key to exit
-            if (const auto* key_pressed = event->getIf<sf::Event::KeyPressed>()) {
+        if (const auto* key_pressed = event.getIf<sf::Event::KeyPressed>()) {
 
-                if (key_pressed->code == sf::Keyboard::Key::Escape) {
+            if (key_pressed->code == sf::Keyboard::Key::Escape) {
 
-                    window->close();
-                }
+                window->close();
             }
-
-            // Handle widget events
-            button->handle_events(*event);
-            text_input->handle_events(*event);
         }
+    });
+
+    // ========== UPDATE ==========
 
-        // ========== UPDATE ==========
+    // Runs before every frame that is drawn
+    app.set_frame_callback([&](sf::Time) {
 
         // Check if approaching character limit
         std::size_t const typed_length = text_input->get_typing_text_string().getSize();
@@ -204,22 +206,11 @@ int main() {
 
             status_label->set_text_color(sf::Color::Red);
         }
+    });
 
-        // ========== RENDER ==========
-
-        window->clear(sf::Color(30, 30, 30)); // Dark background
-
-        // Draw all widgets
-        title->draw();
-        button->draw();
-        counter_label->draw();
-        text_input->draw();
-        echo_label->draw();
-        status_label->draw();
-        instructions->draw();
+    // ========== MAIN LOOP ==========
 
-        window->display();
-    }
+    app.run();
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,364 @@
+/// @file application.h
+/// @brief Event driven run loop that owns event dispatch and drawing of registered widgets
+
+#ifndef APPLICATION_H
+#define APPLICATION_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/compositor.h"
+#include "widgets/frame_pipeline.h"
+#include "widgets/render_queue.h"
+#include "widgets/signals_slots.h"
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Id of a timer added with Application::add_timer()
+    using Timer_id = std::uint64_t;
+
+    /// @brief Event driven run loop that owns event dispatch and drawing of registered widgets
+    ///
+    /// @details Replaces the usual poll / update / draw loop that redraws at the frame
+    ///          cap even when nothing changes. A frame is only drawn when something
+    ///          could have changed what is on screen:
+    ///
+    ///          - an event was dispatched (signals run their slots from here)
+    ///          - a timer fired
+    ///          - a task posted with post() ran
+    ///          - request_redraw() was called
+    ///          - a registered widget's poll() took work finished in the background
+    ///          - the application is animating (set_animating(true))
+    ///
+    ///          Otherwise the loop sleeps until the next event or timer deadline, with
+    ///          no deadline when there are no timers. post(), request_redraw() and
+    ///          quit() wake it at once from any thread. Window events and the widgets'
+    ///          poll() are checked every 10 milliseconds while sleeping, the interval
+    ///          SFML's own waitEvent() polls at, so an idle screen uses almost no CPU.
+    ///
+    ///          Widgets registered with add_widget() receive every event (if they
+    ///          derive from Signals_slots) and are drawn each frame in registration
+    ///          order, or through a Render_queue if enabled.
+    ///
+    ///          Quick usage:
+    ///
+    ///          @code
+    ///          widgets::Application app(window);
+    ///          app.add_widget(*button);
+    ///          app.add_widget(*label);
+    ///          app.add_timer(sf::seconds(1.0f), [&]() { label->set_text_string(clock_str()); });
+    ///          app.run();
+    ///          @endcode
+    ///
+    /// @warning Widgets are stored as non owning pointers, remove them before they are
+    ///          destroyed. Everything except post(), request_redraw() and quit() must be
+    ///          called from the thread running run().
+    class Application final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - an application requires a window
+        Application() = delete;
+
+        /// @brief Construct an application driving a window
+        /// @details Default values:
+        ///          - Frame limit: 60 frames per second
+        ///          - Clear color: Black
+        ///          - Render queue: Disabled
+        ///
+        ///          Do not also call setFramerateLimit() on the window, it would make
+        ///          display() sleep even when the loop has work waiting.
+        /// @param window The window to dispatch events from and draw to
+        explicit Application(std::shared_ptr<sf::RenderWindow> window);
+
+        /// @brief Default destructor
+        ~Application() = default;
+
+    private:
+        /// @brief A registered widget
+        struct Registered_widget {
+
+            /// @brief The widget, nullptr if it was removed while dispatching
+            Widget*                       widget  = nullptr;
+
+            /// @brief The widget's event handling, nullptr if it has none
+            signals_slots::Signals_slots* signals = nullptr;
+        };
+
+        /// @brief A timer added with add_timer()
+        struct Timer {
+
+            Timer_id              id           = 0u;
+            sf::Time              interval     = sf::Time::Zero;
+            sf::Time              deadline     = sf::Time::Zero;
+            bool                  is_repeating = false;
+            std::function<void()> callback;
+        };
+
+        /// @brief The window events come from and frames are drawn to
+        std::shared_ptr<sf::RenderWindow> _window;
+
+        /// @brief Registered widgets in drawing order
+        std::vector<Registered_widget> _widgets;
+
+        /// @brief true while events are dispatched, removals are deferred until done
+        bool _is_dispatching;
+
+        /// @brief Active timers
+        std::vector<Timer> _timers;
+
+        /// @brief Id given to the next timer
+        Timer_id _next_timer_id;
+
+        /// @brief Guards `_posted_tasks` and `_is_wake_requested`
+        std::mutex _posted_tasks_mutex;
+
+        /// @brief Tasks posted from any thread, run on the loop thread
+        std::vector<std::function<void()>> _posted_tasks;
+
+        /// @brief Set by any thread to end the current wait of the loop
+        bool _is_wake_requested;
+
+        /// @brief Notified when a task is posted or a wake up is requested
+        std::condition_variable _wake_condition;
+
+        /// @brief Set when a frame must be drawn, may be set from any thread
+        std::atomic<bool> _is_redraw_requested;
+
+        /// @brief Set to leave run(), may be set from any thread
+        std::atomic<bool> _is_quit_requested;
+
+        /// @brief true to draw every frame up to the frame limit
+        bool _is_animating;
+
+        /// @brief true to draw registered widgets through `_render_queue`
+        bool _is_render_queue_enabled;
+
+        /// @brief Queue used when the render queue is enabled
+        Render_queue _render_queue;
+
+        /// @brief Pipeline that records widgets in parallel, nullptr to record on this thread
+        Frame_pipeline* _frame_pipeline;
+
+        /// @brief Registered widgets handed to `_frame_pipeline`, reused between frames
+        std::vector<Widget*> _pipeline_widgets;
+
+        /// @brief Compositor that draws instead of the registered widgets, nullptr if none
+        Compositor* _compositor;
+
+        /// @brief Shortest time between two frames
+        sf::Time _frame_interval;
+
+        /// @brief Color the window is cleared with each frame
+        sf::Color _clear_color;
+
+        /// @brief Called for every event before the widgets get it
+        std::function<void(sf::Event const&)> _event_callback;
+
+        /// @brief Called before each frame is drawn with the time since the last frame
+        std::function<void(sf::Time)> _frame_callback;
+
+        /// @brief Called after the widgets are drawn, for custom drawing
+        std::function<void(sf::RenderWindow&)> _draw_callback;
+
+        /// @brief Measures time for timers and frames
+        sf::Clock _clock;
+
+        /// @brief Number of frames drawn since construction
+        std::uint64_t _num_frames_drawn;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Application           (Application const&) = delete; ///< Copy constructor deleted
+        Application& operator=(Application const&) = delete; ///< Copy assignment deleted
+        Application           (Application&&     ) = delete; ///< Move constructor deleted
+        Application& operator=(Application&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Run the loop until the window is closed or quit() is called
+        /// @details An sf::Event::Closed event closes the window.
+        void run();
+
+        /// @brief Leave run() after the current iteration
+        /// @details Safe to call from any thread.
+        void quit();
+
+        /// @brief Register a widget for event dispatch and drawing
+        /// @warning Adding a widget that is already registered does nothing
+        /// @param widget The widget to register
+        void add_widget(Widget& widget);
+
+        /// @brief Unregister a widget
+        /// @details Safe to call from a slot while events are being dispatched.
+        /// @param widget The widget to unregister
+        void remove_widget(Widget& widget);
+
+        /// @brief Call a function after a delay, optionally repeating
+        /// @param interval Time until the callback runs, and between runs if repeating
+        /// @param callback Function called on the loop thread
+        /// @param is_repeating true to keep running every `interval`
+        /// @return Timer_id Id used to remove the timer
+        Timer_id add_timer(
+            sf::Time              const  interval,
+            std::function<void()> const& callback,
+            bool                  const  is_repeating = true
+            );
+
+        /// @brief Remove a timer
+        /// @param id Id returned by add_timer()
+        void remove_timer(Timer_id const id);
+
+        /// @brief Run a task on the loop thread and redraw afterwards
+        /// @details Safe to call from any thread. Wakes the loop, the task runs on
+        ///          its next iteration.
+        /// @param task The task to run
+        void post(std::function<void()> task);
+
+        /// @brief Draw a frame on the next loop iteration
+        /// @details Safe to call from any thread, wakes the loop. Only needed when
+        ///          widgets change outside of events, timers and posted tasks.
+        void request_redraw();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Draw every frame up to the frame limit instead of only on changes
+        /// @param is_animating true while an animation is running
+        void set_animating(bool const is_animating);
+
+        /// @brief Set the most frames drawn per second
+        /// @param frame_limit Frames per second, 0 removes the limit
+        void set_frame_limit(unsigned int const frame_limit);
+
+        /// @brief Set the color the window is cleared with each frame
+        /// @param color Clear color
+        void set_clear_color(sf::Color const color);
+
+        /// @brief Draw registered widgets through a Render_queue
+        /// @param is_enabled true to use Widget::queue_draw(), false to use Widget::draw()
+        void set_render_queue_enabled(bool const is_enabled);
+
+        /// @brief Record registered widgets in parallel through a frame pipeline
+        /// @details Takes precedence over set_render_queue_enabled().
+        /// @param frame_pipeline The pipeline to record with, must outlive the
+        ///                       application, nullptr to record on the loop thread
+        void set_frame_pipeline(Frame_pipeline* const frame_pipeline);
+
+        /// @brief Draw a compositor's layers instead of the registered widgets
+        /// @details Takes precedence over set_frame_pipeline() and
+        ///          set_render_queue_enabled(). Widgets still have to be registered
+        ///          to receive events.
+        /// @param compositor The compositor to draw, must outlive the application,
+        ///                   nullptr to draw the registered widgets
+        void set_compositor(Compositor* const compositor);
+
+        /// @brief Set the function called for every event before the widgets get it
+        /// @param callback Event callback
+        void set_event_callback(std::function<void(sf::Event const&)> const& callback);
+
+        /// @brief Set the function called before each frame is drawn
+        /// @param callback Frame callback, receives the time since the last frame
+        void set_frame_callback(std::function<void(sf::Time)> const& callback);
+
+        /// @brief Set the function called after the widgets are drawn
+        /// @param callback Draw callback, receives the window to draw to
+        void set_draw_callback(std::function<void(sf::RenderWindow&)> const& callback);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Check if the application draws every frame
+        /// @return true if animating, false otherwise
+        bool is_animating() const;
+
+        /// @brief Get the number of frames drawn since construction
+        /// @return std::uint64_t Number of frames drawn
+        std::uint64_t get_num_frames_drawn() const;
+
+        /// @brief Get the number of registered widgets
+        /// @return std::size_t Number of registered widgets
+        std::size_t get_num_widgets() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Dispatch an event to the event callback and every registered widget
+        /// @param event The event to dispatch
+        void _dispatch(sf::Event const& event);
+
+        /// @brief Run every posted task
+        /// @return true if any task ran, false otherwise
+        bool _run_posted_tasks();
+
+        /// @brief Call poll() on every registered widget
+        /// @return true if any widget changed, false otherwise
+        bool _poll_widgets();
+
+        /// @brief Run every timer whose deadline has passed
+        /// @param now Current time of `_clock`
+        /// @return true if any timer ran, false otherwise
+        bool _run_due_timers(sf::Time const now);
+
+        /// @brief Get the earliest timer deadline
+        /// @return sf::Time Earliest deadline, or sf::Time::Zero if there are no timers
+        sf::Time _get_next_deadline() const;
+
+        /// @brief Sleep until a window event arrives, the loop is woken or a timeout passes
+        /// @details A window event is dispatched before returning.
+        /// @param timeout Longest time to sleep, sf::Time::Zero to sleep until woken
+        void _wait(sf::Time const timeout);
+
+        /// @brief Wake _wait() from any thread
+        void _wake();
+
+        /// @brief Clear, draw every registered widget and display
+        /// @param delta_time Time since the last frame
+        void _draw_frame(sf::Time const delta_time);
+
+        /// @brief Remove entries of widgets removed while dispatching
+        void _compact_widgets();
+
+    }; // class Application
+
+} // namespace widgets
+
+#endif // APPLICATION_H
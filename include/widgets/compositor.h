@@ -0,0 +1,226 @@
+/// @file compositor.h
+/// @brief Draws widgets in named z-layers, optionally caching static layers in render textures
+
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/render_queue.h"
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Draws widgets in named z-layers, optionally caching static layers in render textures
+    ///
+    /// @details Widgets are attached to named layers. draw() draws the layers in
+    ///          ascending z-order, and inside a layer the widgets are pushed through
+    ///          a Render_queue in attach order.
+    ///
+    ///          A cached layer is recorded into its own sf::RenderTexture and only
+    ///          recorded again when it is dirty. Every other frame costs one
+    ///          textured quad, no matter how many widgets are on it. A layer becomes
+    ///          dirty when:
+    ///
+    ///          - One of its widgets changes (see Widget::_mark_dirty())
+    ///          - A widget is attached to or detached from it
+    ///          - The target's view or size changes
+    ///          - invalidate() is called, e.g. after a texture or font it uses changed
+    ///
+    ///          Typical use keeps a large static background cached and puts the
+    ///          widgets that change every frame (hover highlights, tooltips) on an
+    ///          uncached layer above it:
+    ///
+    ///          @code
+    ///          widgets::Compositor compositor(window);
+    ///          compositor.add_layer("background", 0, true);
+    ///          compositor.add_layer("overlay",    1);
+    ///
+    ///          compositor.attach(*panel,   "background");
+    ///          compositor.attach(*tooltip, "overlay");
+    ///
+    ///          window->clear();
+    ///          compositor.draw();
+    ///          window->display();
+    ///          @endcode
+    ///
+    /// @warning A widget can only be attached to one layer and one compositor.
+    ///          Detach widgets before destroying them.
+    class Compositor final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - a compositor requires a render target
+        Compositor() = delete;
+
+        /// @brief Construct a compositor for a render target
+        /// @param parent_target The target the attached widgets are bound to
+        explicit Compositor(std::shared_ptr<sf::RenderTarget> parent_target);
+
+        /// @brief Detach every widget
+        ~Compositor();
+
+    private:
+        /// @brief A named layer and its cache
+        struct Layer {
+
+            std::string          name;
+            int                  z_order    = 0;
+            bool                 is_cached  = false;
+            bool                 is_visible = true;
+
+            /// @brief Set by the layer's widgets through Widget::_mark_dirty()
+            bool                 is_dirty   = true;
+
+            std::vector<Widget*> widgets;
+
+            /// @brief Cached picture of the layer, created on first use
+            std::unique_ptr<sf::RenderTexture> cache;
+
+            /// @brief View the cache was recorded with
+            sf::View             cache_view;
+        };
+
+        /// @brief Target the layers are drawn to
+        std::weak_ptr<sf::RenderTarget> _parent_target;
+
+        /// @brief Layers sorted by z-order, equal z-orders keep their add order
+        std::vector<std::unique_ptr<Layer>> _layers;
+
+        /// @brief The layer every attached widget is on
+        std::unordered_map<Widget*, Layer*> _widget_layers;
+
+        /// @brief Queue layers are recorded through
+        Render_queue _render_queue;
+
+        /// @brief Cached layers recorded again by the last draw()
+        std::size_t _num_cache_updates;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Compositor           (Compositor const&) = delete; ///< Copy constructor deleted
+        Compositor& operator=(Compositor const&) = delete; ///< Copy assignment deleted
+        Compositor           (Compositor&&     ) = delete; ///< Move constructor deleted
+        Compositor& operator=(Compositor&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Add a named layer
+        /// @param name Unique name of the layer
+        /// @param z_order Lower layers are drawn first
+        /// @param is_cached true to keep the layer in a render texture between changes
+        /// @return true if the layer was added, false if the name is taken
+        bool add_layer(std::string const& name, int const z_order, bool const is_cached = false);
+
+        /// @brief Remove a layer and detach its widgets
+        /// @param name Name of the layer
+        void remove_layer(std::string const& name);
+
+        /// @brief Attach a widget to a layer, moving it if it is on another one
+        /// @param widget The widget to attach, must stay alive until it is detached
+        /// @param layer_name Name of the layer
+        void attach(Widget& widget, std::string const& layer_name);
+
+        /// @brief Detach a widget from its layer
+        /// @param widget The widget to detach
+        void detach(Widget& widget);
+
+        /// @brief Force a layer to be recorded again on the next draw()
+        /// @param name Name of the layer
+        void invalidate(std::string const& name);
+
+        /// @brief Force every layer to be recorded again on the next draw()
+        void invalidate_all();
+
+        /// @brief Draw every visible layer to the target
+        void draw();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set whether a layer is kept in a render texture
+        /// @param name Name of the layer
+        /// @param is_cached true to cache the layer
+        void set_layer_cached(std::string const& name, bool const is_cached);
+
+        /// @brief Show or hide a whole layer
+        /// @param name Name of the layer
+        /// @param is_visible true to draw the layer
+        void set_layer_visible(std::string const& name, bool const is_visible);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get whether a layer exists
+        /// @param name Name of the layer
+        /// @return bool true if the layer exists
+        bool has_layer(std::string const& name) const;
+
+        /// @brief Get the number of layers
+        /// @return std::size_t Number of layers
+        std::size_t get_num_layers() const;
+
+        /// @brief Get the number of cached layers recorded again by the last draw()
+        /// @details 0 on frames where only uncached layers changed.
+        /// @return std::size_t Number of cache updates
+        std::size_t get_num_cache_updates() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Find a layer by name
+        /// @param name Name of the layer
+        /// @return Layer* The layer, nullptr (with a warning) if there is none
+        Layer* _find_layer(std::string const& name) const;
+
+        /// @brief Record a cached layer into its render texture if it is out of date
+        /// @param layer The layer to update
+        /// @param target The target the cache is composited onto
+        /// @return bool true if the cache can be drawn, false to draw the layer directly
+        bool _update_cache(Layer& layer, sf::RenderTarget& target);
+
+        /// @brief Record a layer's widgets and submit them to a target
+        /// @param layer The layer to record
+        /// @param target The target to submit to
+        void _record_layer(Layer const& layer, sf::RenderTarget& target);
+
+    }; // class Compositor
+
+} // namespace widgets
+
+#endif // COMPOSITOR_H
@@ -0,0 +1,227 @@
+/// @file edit_history.h
+/// @brief Undo and redo for text widgets, storing only what each edit inserted or erased
+
+#ifndef EDIT_HISTORY_H
+#define EDIT_HISTORY_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Undo and redo for text widgets, storing only what each edit inserted or erased
+    ///
+    /// @details The widget records every insert and erase with its offset and text,
+    ///          never the whole string. Undoing hands back the edits of the last
+    ///          step, the widget reverts them, so undo and redo cost the size of the
+    ///          edit whatever the size of the text.
+    ///
+    ///          Steps are what one undo reverts. The widget calls begin_step() once
+    ///          per user action, so replacing a selection (erase then insert) is one
+    ///          step. Typing and deleting single characters next to the previous
+    ///          ones are merged into the previous edit instead, so a typed word is
+    ///          one edit of a few bytes. Merging stops at a space after a word, after
+    ///          break_coalescing() (the cursor moved) and at MAX_COALESCE units.
+    ///
+    ///          Once the recorded text exceeds the memory cap, the oldest steps are
+    ///          dropped until it is back under three quarters of it, so the cost of
+    ///          dropping is spread over many edits.
+    ///
+    ///          Instantiated for std::string (UTF-8 bytes, Text_editor) and
+    ///          std::u32string (characters, Line_edit). Offsets are in the units of
+    ///          the string type.
+    ///
+    /// @tparam String std::string or std::u32string
+    template <typename String>
+    class Edit_history final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief View of the recorded string type
+        using View = std::basic_string_view<typename String::value_type>;
+
+        /// @brief One recorded insert or erase
+        struct Edit {
+
+            String      text;              ///< Text inserted, or erased
+            std::size_t offset    = 0u;    ///< Offset of the first unit of `text`
+            std::size_t step      = 0u;    ///< Step the edit belongs to
+            bool        is_insert = false; ///< Whether `text` was inserted, otherwise erased
+        };
+
+        /// @brief Length in units past which typed or deleted characters stop merging
+        static std::size_t constexpr MAX_COALESCE = 256u;
+
+        /// @brief Construct an empty history
+        /// @param max_bytes Memory cap for the recorded edits
+        explicit Edit_history(std::size_t const max_bytes = 4u * 1024u * 1024u);
+
+        /// @brief Default destructor
+        ~Edit_history() = default;
+
+    private:
+        /// @brief Edits that can be undone, oldest first
+        std::vector<Edit> _undo_edits;
+
+        /// @brief Edits that can be redone, the next one to redo last
+        std::vector<Edit> _redo_edits;
+
+        /// @brief Memory cap for both stacks
+        std::size_t _max_bytes;
+
+        /// @brief Bytes used by both stacks
+        std::size_t _num_bytes;
+
+        /// @brief Step the next unmerged edit gets
+        std::size_t _step;
+
+        /// @brief Whether the next edit starts a new step
+        bool _is_step_pending;
+
+        /// @brief Whether the next single character edit may merge into the last one
+        bool _can_coalesce;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Edit_history           (Edit_history const&) = delete; ///< Copy constructor deleted
+        Edit_history& operator=(Edit_history const&) = delete; ///< Copy assignment deleted
+        Edit_history           (Edit_history&&     ) = delete; ///< Move constructor deleted
+        Edit_history& operator=(Edit_history&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Start a new undo step with the next recorded edit
+        void begin_step();
+
+        /// @brief Stop the next edit from merging into the last one
+        /// @details Call when the cursor moves, typing elsewhere is a new edit.
+        void break_coalescing();
+
+        /// @brief Record text inserted into the widget
+        /// @details Clears the redo edits.
+        /// @param offset Offset the text was inserted at
+        /// @param text The inserted text
+        void record_insert(std::size_t const offset, View const text);
+
+        /// @brief Record text erased from the widget
+        /// @details Clears the redo edits.
+        /// @param offset Offset of the first erased unit
+        /// @param text The erased text
+        void record_erase(std::size_t const offset, View const text);
+
+        /// @brief Move the last step to the redo edits
+        /// @details The widget reverts the returned edits from last to first:
+        ///          inserts are erased again and erases inserted again.
+        /// @return std::span<Edit const> Edits of the step, empty if there is none,
+        ///         valid until the history is changed
+        std::span<Edit const> undo();
+
+        /// @brief Move the last undone step back to the undo edits
+        /// @details The widget applies the returned edits again from first to last.
+        /// @return std::span<Edit const> Edits of the step, empty if there is none,
+        ///         valid until the history is changed
+        std::span<Edit const> redo();
+
+        /// @brief Forget every edit, for example after the whole text was replaced
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the memory cap, dropping the oldest steps if it is exceeded
+        /// @param max_bytes Bytes the recorded edits may use, 0 disables the history
+        void set_max_bytes(std::size_t const max_bytes);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get whether there is a step to undo
+        /// @return bool True if undo() would revert something
+        bool can_undo() const;
+
+        /// @brief Get whether there is a step to redo
+        /// @return bool True if redo() would apply something
+        bool can_redo() const;
+
+        /// @brief Get the memory cap
+        /// @return std::size_t Bytes the recorded edits may use
+        std::size_t get_max_bytes() const;
+
+        /// @brief Get the memory used
+        /// @return std::size_t Bytes used by the recorded edits
+        std::size_t get_num_bytes() const;
+
+        /// @brief Get the number of recorded edits
+        /// @details Merged typing counts once, use it to check coalescing works.
+        /// @return std::size_t Number of edits that can be undone or redone
+        std::size_t get_num_edits() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Record an edit, merging it into the last one when possible
+        /// @param offset Offset of the first unit of `text`
+        /// @param text The inserted or erased text
+        /// @param is_insert Whether `text` was inserted
+        void _record(std::size_t const offset, View const text, bool const is_insert);
+
+        /// @brief Move the last step of one stack to the end of the other
+        /// @param from Stack to take the step from
+        /// @param to Stack to append the step to
+        /// @return std::span<Edit const> The moved edits in `to`
+        std::span<Edit const> _move_step(std::vector<Edit>& from, std::vector<Edit>& to);
+
+        /// @brief Get whether text is one character, one UTF-8 sequence for std::string
+        /// @param text The text
+        /// @return bool True if the text may merge into a typing run
+        static bool _is_single_char(View const text);
+
+        /// @brief Get the bytes an edit uses
+        /// @param edit The edit
+        /// @return std::size_t Size of the edit plus the size of its text
+        static std::size_t _get_edit_bytes(Edit const& edit);
+
+        /// @brief Drop the oldest steps until under the cap
+        void _enforce_cap();
+
+    }; // class Edit_history
+
+    extern template class Edit_history<std::string>;
+    extern template class Edit_history<std::u32string>;
+
+} // namespace widgets
+
+#endif // EDIT_HISTORY_H
@@ -0,0 +1,145 @@
+/// @file frame_pipeline.h
+/// @brief Records widget draw commands in parallel and submits them from one thread
+
+#ifndef FRAME_PIPELINE_H
+#define FRAME_PIPELINE_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/render_queue.h"
+#include "widgets/thread_pool.h"
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Records widget draw commands in parallel and submits them from one thread
+    ///
+    /// @details record() splits the widgets into contiguous chunks and runs
+    ///          Widget::queue_draw() for each chunk on the thread pool, so culling,
+    ///          _update_widget() and bounds computation are spread over all cores.
+    ///          Every chunk records into its own Render_queue, no locking is needed
+    ///          between chunks.
+    ///
+    ///          submit() runs on the calling thread (the one owning the render
+    ///          target). It appends the chunk queues in widget order and submits
+    ///          the merged queue, so the result is identical to recording on one
+    ///          thread.
+    ///
+    ///          Text widgets look glyphs up through their font's Glyph_cache, which
+    ///          only locks resources::FONT_MUTEX for glyphs no thread looked up
+    ///          before, so text records in parallel too once its glyphs are known.
+    ///
+    ///          Typical frame:
+    ///
+    ///          @code
+    ///          pipeline.record(widgets);
+    ///          window->clear();
+    ///          pipeline.submit(*window);
+    ///          window->display();
+    ///          @endcode
+    ///
+    /// @warning Widgets must not be changed by other threads between record() and
+    ///          submit(), and each widget may only appear once per record().
+    class Frame_pipeline final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - a pipeline requires a thread pool
+        Frame_pipeline() = delete;
+
+        /// @brief Construct a pipeline that records on a thread pool
+        /// @param pool The pool to record on, must outlive the pipeline
+        explicit Frame_pipeline(Thread_pool& pool);
+
+        /// @brief Default destructor
+        ~Frame_pipeline() = default;
+
+    private:
+        /// @brief The pool chunks are recorded on
+        Thread_pool& _pool;
+
+        /// @brief One queue per chunk, reused between frames
+        std::vector<std::unique_ptr<Render_queue>> _chunk_queues;
+
+        /// @brief Chunk queues merged in order, submitted to the target
+        Render_queue _merged_queue;
+
+        /// @brief Fewest widgets worth sending to another thread
+        std::size_t _min_widgets_per_chunk;
+
+        /// @brief Number of chunks used by the last record()
+        std::size_t _num_chunks;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Frame_pipeline           (Frame_pipeline const&) = delete; ///< Copy constructor deleted
+        Frame_pipeline& operator=(Frame_pipeline const&) = delete; ///< Copy assignment deleted
+        Frame_pipeline           (Frame_pipeline&&     ) = delete; ///< Move constructor deleted
+        Frame_pipeline& operator=(Frame_pipeline&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Record the draw commands of widgets in parallel
+        /// @details Returns once every widget has been recorded.
+        /// @param widgets The widgets to record, in drawing order
+        void record(std::vector<Widget*> const& widgets);
+
+        /// @brief Merge the recorded commands in order and draw them
+        /// @param target The render target to draw to
+        void submit(sf::RenderTarget& target);
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the fewest widgets worth sending to another thread
+        /// @details Chunks smaller than this cost more in scheduling than they
+        ///          save. Default is 32.
+        /// @param min_widgets_per_chunk Fewest widgets per chunk, at least 1
+        void set_min_widgets_per_chunk(std::size_t const min_widgets_per_chunk);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of chunks used by the last record()
+        /// @return std::size_t Number of chunks
+        std::size_t get_num_chunks() const;
+
+        /// @brief Get the queue submit() draws from, for its statistics
+        /// @return Render_queue const& The merged queue
+        Render_queue const& get_merged_queue() const;
+
+    }; // class Frame_pipeline
+
+} // namespace widgets
+
+#endif // FRAME_PIPELINE_H
@@ -0,0 +1,171 @@
+/// @file gap_buffer.h
+/// @brief Text storage with a movable cursor, edits at the cursor cost O(edit size)
+
+#ifndef GAP_BUFFER_H
+#define GAP_BUFFER_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Text storage with a movable cursor, edits at the cursor cost O(edit size)
+    ///
+    /// @details The characters live in one array with an unused gap at the cursor:
+    ///
+    ///          [h e l l o _ _ _ _ w o r l d]
+    ///                     ^gap    ^
+    ///
+    ///          Inserting fills the gap and deleting widens it, so neither moves any
+    ///          other character. Moving the cursor moves only the characters between
+    ///          the old and the new position across the gap, and typing in one place
+    ///          moves nothing at all. The array doubles when the gap runs out.
+    class Gap_buffer final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty buffer
+        /// @param capacity Number of characters to reserve room for
+        explicit Gap_buffer(std::size_t const capacity = 64u);
+
+        /// @brief Default destructor
+        ~Gap_buffer() = default;
+
+    private:
+        /// @brief Characters before the gap, the gap, then characters after it
+        std::vector<char32_t> _buffer;
+
+        /// @brief Index of the first unused slot, also the cursor
+        std::size_t _gap_begin;
+
+        /// @brief Index one past the last unused slot
+        std::size_t _gap_end;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Gap_buffer           (Gap_buffer const&) = delete; ///< Copy constructor deleted
+        Gap_buffer& operator=(Gap_buffer const&) = delete; ///< Copy assignment deleted
+        Gap_buffer           (Gap_buffer&&     ) = delete; ///< Move constructor deleted
+        Gap_buffer& operator=(Gap_buffer&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Insert characters at the cursor, the cursor ends up after them
+        /// @param text The characters to insert
+        void insert(std::u32string_view const text);
+
+        /// @brief Delete characters before the cursor, like backspace
+        /// @param count Number of characters to delete
+        /// @return std::size_t Number of characters deleted, fewer at the start
+        std::size_t erase_before(std::size_t const count = 1u);
+
+        /// @brief Delete characters after the cursor, like the delete key
+        /// @param count Number of characters to delete
+        /// @return std::size_t Number of characters deleted, fewer at the end
+        std::size_t erase_after(std::size_t const count = 1u);
+
+        /// @brief Remove every character
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Move the cursor
+        /// @param index Character index to move before, clamped to the size
+        void set_cursor(std::size_t const index);
+
+        /// @brief Replace every character, the cursor ends up at the end
+        /// @param text The new characters
+        void set_text(std::u32string_view const text);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the cursor
+        /// @return std::size_t Index of the character after the cursor
+        std::size_t get_cursor() const;
+
+        /// @brief Get the number of characters
+        /// @return std::size_t Number of characters
+        std::size_t get_size() const;
+
+        /// @brief Get whether there are no characters
+        /// @return bool true if empty
+        bool is_empty() const;
+
+        /// @brief Get a character
+        /// @param index Character index, must be below the size
+        /// @return char32_t The character
+        char32_t get_char(std::size_t const index) const;
+
+        /// @brief Get every character
+        /// @return std::u32string The characters in order
+        std::u32string get_text() const;
+
+        /// @brief Get a range of characters
+        /// @param index First character, clamped to the size
+        /// @param count Number of characters, clamped to the end
+        /// @return std::u32string The characters in order
+        std::u32string get_text(std::size_t const index, std::size_t const count) const;
+
+        /// @brief Get the characters before the cursor without copying them
+        /// @details They sit before the gap, so they are contiguous.
+        /// @return std::u32string_view The characters, valid until the next edit or cursor move
+        std::u32string_view get_text_before_cursor() const;
+
+        /// @brief Get the characters after the cursor without copying them
+        /// @return std::u32string_view The characters, valid until the next edit or cursor move
+        std::u32string_view get_text_after_cursor() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Get the number of unused slots
+        /// @return std::size_t Size of the gap
+        std::size_t _get_gap_size() const;
+
+        /// @brief Move the gap so it starts at a character index
+        /// @param index Character index, at most the size
+        void _move_gap(std::size_t const index);
+
+        /// @brief Grow the array so the gap holds at least `count` characters
+        /// @param count Number of characters about to be inserted
+        void _reserve_gap(std::size_t const count);
+
+    }; // class Gap_buffer
+
+} // namespace widgets
+
+#endif // GAP_BUFFER_H
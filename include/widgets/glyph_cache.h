@@ -0,0 +1,392 @@
+/// @file glyph_cache.h
+/// @brief Bounds the character sizes a font rasterizes, warms them up and caps their memory
+
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/resources.h"
+#include "SFML/Graphics.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Bounds the character sizes a font rasterizes, warms them up and caps their memory
+    ///
+    /// @details sf::Font keeps one page texture per character size it has ever
+    ///          drawn and never frees it. Every new size also stalls the frame that
+    ///          first uses it while its glyphs are rasterized. The cache tackles
+    ///          both:
+    ///
+    ///          - Quantization: request_size() snaps a size down to the nearest of
+    ///            a bounded set of steps, so text widgets and the fit loop of
+    ///            Push_button only ever touch those sizes. Widgets hand the size
+    ///            back with release_size() when they change it or are destroyed.
+    ///          - Warm-up: (size, charset) sets added with add_warm_up_set() are
+    ///            rasterized by warm_up_async() on a worker thread before the UI
+    ///            needs them. The worker locks the font per glyph, so text keeps
+    ///            being laid out and drawn in between. sf::Font rasterizes a glyph
+    ///            and uploads it to its page in one call, so the upload happens on
+    ///            the worker too, under resources::FONT_MUTEX.
+    ///          - Memory: get_memory_usage() reports the page textures the font
+    ///            has made. sf::Font cannot free a single size, so when trim() finds
+    ///            the usage above the budget it reopens the font, which frees every
+    ///            page, and starts warming up the configured sets again on the
+    ///            worker. Sizes still in use are rasterized again the next time they
+    ///            are drawn.
+    ///
+    ///          - Lookups: sf::Font rasterizes lazily and is not thread safe, even
+    ///            finding a glyph it already has can race with another thread
+    ///            rasterizing one. get_glyph(), get_kerning() and get_metrics() keep
+    ///            a copy of everything looked up. Hits only take a shared lock, so
+    ///            text laid out on many threads at once only waits on the others
+    ///            for what nobody looked up before. Misses ask the font under
+    ///            resources::FONT_MUTEX.
+    ///
+    ///          The widget library routes every character size of the default font
+    ///          through resources::DEFAULT_GLYPH_CACHE. Text laid out in any other
+    ///          font gets its lookups from get(), which makes a cache for the font
+    ///          on first use.
+    ///
+    /// @warning Call trim() between frames from the thread that draws, or from the
+    ///          logic thread when frames are recorded into a Snapshot_buffer, never
+    ///          while text is being laid out. A glyph rasterized on the worker may
+    ///          grow its page, so while is_warming_up() is true draw text through a
+    ///          Render_queue or Snapshot_buffer, which sample pages under
+    ///          resources::FONT_MUTEX, or call wait_for_warm_up() first.
+    class Glyph_cache final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - a glyph cache requires a font
+        Glyph_cache() = delete;
+
+        /// @brief Construct a cache for a font
+        /// @param font The font to manage, must outlive the cache
+        /// @param font_path File the font was opened from, used to reopen it on eviction
+        Glyph_cache(sf::Font& font, std::filesystem::path const& font_path);
+
+        /// @brief Construct a cache that only looks glyphs up, it never evicts
+        /// @param font The font to look glyphs up in, must outlive the cache
+        explicit Glyph_cache(sf::Font const& font);
+
+        /// @brief Stop a running warm-up and unregister the cache from get()
+        ~Glyph_cache();
+
+        /// @brief Line metrics and page texture of one character size
+        struct Metrics {
+
+            sf::Texture const* texture             = nullptr; ///< Page the glyphs of the size are on
+            float              line_spacing        = 0.0f;
+            float              underline_position  = 0.0f;
+            float              underline_thickness = 0.0f;
+        };
+
+    private:
+        /// @brief Characters to rasterize ahead of time at one size
+        struct Warm_up_set {
+
+            unsigned int char_size = 0u;
+            sf::String   charset;
+        };
+
+        /// @brief A glyph as sf::Font::getGlyph() takes it
+        struct Glyph_key {
+
+            char32_t     code_point        = 0u;
+            unsigned int char_size         = 0u;
+            bool         is_bold           = false;
+            float        outline_thickness = 0.0f;
+
+            bool operator==(Glyph_key const&) const = default;
+        };
+
+        /// @brief Hash for Glyph_key
+        struct Glyph_key_hash {
+
+            std::size_t operator()(Glyph_key const& key) const;
+        };
+
+        /// @brief A kerning pair as sf::Font::getKerning() takes it
+        struct Kerning_key {
+
+            char32_t     first     = 0u;
+            char32_t     second    = 0u;
+            unsigned int char_size = 0u;
+            bool         is_bold   = false;
+
+            bool operator==(Kerning_key const&) const = default;
+        };
+
+        /// @brief Hash for Kerning_key
+        struct Kerning_key_hash {
+
+            std::size_t operator()(Kerning_key const& key) const;
+        };
+
+        /// @brief The font glyphs are looked up in
+        sf::Font const& _font;
+
+        /// @brief The font reopened on eviction, nullptr if the cache never evicts
+        sf::Font* _evictable_font;
+
+        /// @brief File the font is reopened from on eviction
+        std::filesystem::path _font_path;
+
+        /// @brief Allowed character sizes in ascending order
+        std::vector<unsigned int> _size_steps;
+
+        /// @brief Sets rasterized by warm_up() and after every eviction
+        std::vector<Warm_up_set> _warm_up_sets;
+
+        /// @brief Character sizes requested and not released yet, to the number of requests
+        std::map<unsigned int, std::uint64_t> _sizes_in_use;
+
+        /// @brief Guards `_size_steps` and `_sizes_in_use`, widgets may lay out text on any thread
+        mutable std::mutex _sizes_mutex;
+
+        /// @brief Every glyph looked up since the last eviction
+        std::unordered_map<Glyph_key, sf::Glyph, Glyph_key_hash> _glyphs;
+
+        /// @brief Every kerning pair looked up since the last eviction
+        std::unordered_map<Kerning_key, float, Kerning_key_hash> _kernings;
+
+        /// @brief Metrics of every character size the font has a page for
+        std::unordered_map<unsigned int, Metrics> _metrics;
+
+        /// @brief Guards `_glyphs`, `_kernings` and `_metrics`, shared for hits
+        mutable std::shared_mutex _lookup_mutex;
+
+        /// @brief Worker thread of warm_up_async(), joinable while or after it ran
+        std::thread _warm_up_thread;
+
+        /// @brief Guards starting and finishing the worker
+        std::mutex _warm_up_mutex;
+
+        /// @brief Set while the worker runs
+        std::atomic<bool> _is_warming_up;
+
+        /// @brief Set to make the worker start over from the first set
+        std::atomic<bool> _is_warm_up_requested;
+
+        /// @brief Set to make the worker stop at the next glyph
+        std::atomic<bool> _is_warm_up_stopped;
+
+        /// @brief Page texture bytes above which trim() evicts
+        std::size_t _memory_budget;
+
+        /// @brief Number of evictions done by trim()
+        std::size_t _num_evictions;
+
+        /// @brief Bumped by every eviction, geometry built at an older generation is stale
+        std::atomic<std::uint64_t> _generation;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Glyph_cache           (Glyph_cache const&) = delete; ///< Copy constructor deleted
+        Glyph_cache& operator=(Glyph_cache const&) = delete; ///< Copy assignment deleted
+        Glyph_cache           (Glyph_cache&&     ) = delete; ///< Move constructor deleted
+        Glyph_cache& operator=(Glyph_cache&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the cache of a font, made on first use if the font has none
+        /// @details Caches made here only look glyphs up, they never evict. Safe to
+        ///          call from any thread.
+        /// @param font The font, must outlive the program's use of its cache
+        /// @return Glyph_cache& The cache of `font`
+        static Glyph_cache& get(sf::Font const& font);
+
+        /// @brief Look a glyph up, safe to call from any thread
+        /// @param code_point The character
+        /// @param char_size Character size in pixels
+        /// @param is_bold Whether to look up the bold glyph
+        /// @param outline_thickness Outline thickness, 0 for the fill glyph
+        /// @return sf::Glyph The glyph, its texture rectangle is on the page of `char_size`
+        sf::Glyph get_glyph(char32_t const code_point, unsigned int const char_size, bool const is_bold, float const outline_thickness = 0.0f);
+
+        /// @brief Look the kerning of a pair up, safe to call from any thread
+        /// @param first The character before
+        /// @param second The character after
+        /// @param char_size Character size in pixels
+        /// @param is_bold Whether the text is bold
+        /// @return float Offset to add to the pen before `second`
+        float get_kerning(char32_t const first, char32_t const second, unsigned int const char_size, bool const is_bold);
+
+        /// @brief Look the line metrics and page of a size up, safe to call from any thread
+        /// @param char_size Character size in pixels
+        /// @return Metrics Line metrics and page texture of `char_size`
+        Metrics get_metrics(unsigned int const char_size);
+
+        /// @brief Check if the font has a glyph for a character, safe to call from any thread
+        /// @details Not cached, every call locks the font.
+        /// @param code_point The character
+        /// @return bool true if the font has the glyph
+        bool has_glyph(char32_t const code_point) const;
+
+        /// @brief Check if geometry built from the cache is stale and bring its generation up to date
+        /// @details Texture rectangles and pages looked up before an eviction are gone, so
+        ///          geometry built from them must be built again. A page growing keeps its
+        ///          texture and its pixel coordinates, it does not make geometry stale.
+        /// @param generation Generation the geometry was built at, set to the current one
+        /// @return bool true if the geometry must be built again
+        bool update_generation(std::uint64_t& generation) const;
+
+        /// @brief Snap a character size to the allowed steps and record that it is in use
+        /// @param char_size The size a widget wants
+        /// @return unsigned int The largest step not above `char_size`, or the
+        ///         smallest step if every step is above it
+        unsigned int request_size(unsigned int const char_size);
+
+        /// @brief Hand back a size returned by request_size() that is no longer used
+        /// @param char_size The size returned by request_size()
+        void release_size(unsigned int const char_size);
+
+        /// @brief Snap a character size to the allowed steps without requesting it
+        /// @param char_size The size a widget wants
+        /// @return unsigned int The size request_size() would return for `char_size`
+        unsigned int snap_size(unsigned int const char_size) const;
+
+        /// @brief Get the next allowed step below a size, for fit-to-box loops
+        /// @param char_size The current size
+        /// @return unsigned int The largest step below `char_size`, or `char_size`
+        ///         itself when there is no smaller step
+        unsigned int get_next_smaller_size(unsigned int const char_size) const;
+
+        /// @brief Add a set of characters to rasterize ahead of time
+        /// @param char_size Character size, snapped to the allowed steps
+        /// @param charset The characters to rasterize
+        void add_warm_up_set(unsigned int const char_size, sf::String const& charset);
+
+        /// @brief Rasterize every warm-up set on the calling thread
+        void warm_up();
+
+        /// @brief Rasterize every warm-up set on a worker thread
+        /// @details If a warm-up is already running it starts over from the first
+        ///          set, so sets added or evicted since it started are not missed.
+        ///          Call it, wait_for_warm_up() and trim() from the same thread.
+        void warm_up_async();
+
+        /// @brief Block until a running warm-up has finished
+        void wait_for_warm_up();
+
+        /// @brief Free every page texture if the usage is above the budget
+        /// @return bool true if the font was evicted
+        bool trim();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the allowed character sizes
+        /// @param size_steps Allowed sizes, sorted and deduplicated, 0 is ignored
+        void set_size_steps(std::vector<unsigned int> size_steps);
+
+        /// @brief Set the page texture bytes above which trim() evicts
+        /// @param bytes Memory budget, default is 32 MiB
+        void set_memory_budget(std::size_t const bytes);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the font glyphs are looked up in
+        /// @return sf::Font const& The font
+        sf::Font const& get_font() const;
+
+        /// @brief Get the allowed character sizes
+        /// @return std::vector<unsigned int> Allowed sizes in ascending order
+        std::vector<unsigned int> get_size_steps() const;
+
+        /// @brief Get the bytes of every page texture the font has made
+        /// @details Only reads pages that exist, it never makes one.
+        /// @return std::size_t Bytes of texture memory (4 bytes per texel)
+        std::size_t get_memory_usage() const;
+
+        /// @brief Get the number of character sizes requested and not released
+        /// @return std::size_t Number of sizes
+        std::size_t get_num_sizes_in_use() const;
+
+        /// @brief Get the number of evictions done by trim()
+        /// @return std::size_t Number of evictions
+        std::size_t get_num_evictions() const;
+
+        /// @brief Get whether the worker of warm_up_async() is running
+        /// @return bool true while warming up
+        bool is_warming_up() const;
+
+        /// @brief Get the generation, bumped by every eviction, safe to call from any thread
+        /// @return std::uint64_t Current generation
+        std::uint64_t get_generation() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Snap a size to the allowed steps, `_sizes_mutex` must be held
+        /// @param char_size The size to snap
+        /// @return unsigned int The snapped size
+        unsigned int _quantize(unsigned int const char_size) const;
+
+        /// @brief Rasterize the warm-up sets until none is requested, run by the worker
+        void _run_warm_up();
+
+        /// @brief Read the metrics of a size from the font, resources::FONT_MUTEX must be held
+        /// @param char_size Character size in pixels
+        /// @return Metrics Line metrics and page texture of `char_size`
+        Metrics _read_metrics(unsigned int const char_size) const;
+
+    }; // class Glyph_cache
+
+} // namespace widgets
+
+/*
+------------------------------------------------------------------------------
+Namespace resources BEGIN
+------------------------------------------------------------------------------
+*/
+namespace resources {
+
+    /// @brief Glyph cache of the default widget font, used by every text widget
+    inline widgets::Glyph_cache DEFAULT_GLYPH_CACHE(DEFAULT_WIDGET_FONT, DEFAULT_WIDGET_FONT_PATH);
+
+} // namespace resources
+
+#endif // GLYPH_CACHE_H
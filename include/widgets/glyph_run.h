@@ -0,0 +1,328 @@
+/// @file glyph_run.h
+/// @brief Text whose edits only lay out the glyphs they affect
+
+#ifndef GLYPH_RUN_H
+#define GLYPH_RUN_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_cache.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Text whose edits only lay out the glyphs they affect
+    ///
+    /// @details Draws like sf::Text (same font pages, baseline, kerning, bold,
+    ///          italic, underline, strike through, outline and line breaks), but
+    ///          keeps one quad and one pen position per character. sf::Text lays out
+    ///          its whole string again after any change. A run instead remembers
+    ///          which characters an edit touched and, before the next draw, only
+    ///          looks those glyphs up again, plus the one right after them whose
+    ///          kerning pair changed. Every later glyph on the same line keeps its
+    ///          quad and is only moved by the change in width, and later lines only
+    ///          move if the number of lines changed.
+    ///
+    ///          set_string() diffs the new string against the old one and edits
+    ///          only the middle that differs, so "Clicks: 41" to "Clicks: 42" looks
+    ///          up two glyphs, and moves none when the digits have the same width.
+    ///
+    ///          Whitespace advances like in sf::Text, a tab is four spaces.
+    ///
+    ///          Glyphs are looked up through the Glyph_cache of the font, so runs
+    ///          can be laid out on any thread. Like sf::Text, layout happens lazily
+    ///          when the run is drawn or measured, unless the run is frozen.
+    class Glyph_run final : public sf::Drawable, public sf::Transformable {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - a glyph run requires a font
+        Glyph_run() = delete;
+
+        /// @brief Construct an empty run
+        /// @param font The font to draw with, must outlive the run
+        /// @param char_size Character size in pixels
+        explicit Glyph_run(sf::Font const& font, unsigned int const char_size = 30u);
+
+        /// @brief Default destructor
+        ~Glyph_run() override = default;
+
+    private:
+        /// @brief Cache of the font glyphs are taken from
+        Glyph_cache* _glyph_cache;
+
+        /// @brief Character size in pixels
+        unsigned int _char_size;
+
+        /// @brief Combination of sf::Text::Style flags
+        std::uint32_t _style;
+
+        /// @brief Color of the glyphs and lines
+        sf::Color _fill_color;
+
+        /// @brief The characters of the run
+        std::u32string _string;
+
+        /// @brief Thickness of the outline, 0 for none
+        float _outline_thickness;
+
+        /// @brief Color of the outline
+        sf::Color _outline_color;
+
+        /// @brief Pen position before each character, plus one for the end of the run
+        mutable std::vector<float> _pen_x;
+
+        /// @brief Top of the line of each character, plus one for the end of the run
+        mutable std::vector<float> _pen_y;
+
+        /// @brief Six vertices per character, collapsed to a point for whitespace
+        mutable std::vector<sf::Vertex> _vertices;
+
+        /// @brief Six outline vertices per character, only kept while there is an outline
+        mutable std::vector<sf::Vertex> _outline_vertices;
+
+        /// @brief Visible bounds of each character, empty for whitespace
+        mutable std::vector<sf::FloatRect> _glyph_bounds;
+
+        /// @brief Underline and strike through quads
+        mutable std::vector<sf::Vertex> _line_vertices;
+
+        /// @brief Bounds of every glyph and line
+        mutable sf::FloatRect _local_bounds;
+
+        /// @brief First character whose glyph must be looked up again
+        mutable std::size_t _first_dirty;
+
+        /// @brief One past the last changed character, later glyphs are only moved
+        mutable std::size_t _dirty_end;
+
+        /// @brief Whether any part of the geometry must be rebuilt
+        mutable bool _is_geometry_dirty;
+
+        /// @brief Font page the quads were built for
+        mutable sf::Texture const* _texture;
+
+        /// @brief Glyph cache generation the quads were built at, an eviction invalidates them
+        mutable std::uint64_t _generation;
+
+        /// @brief Whether the geometry is kept as built, see freeze()
+        bool _is_frozen;
+
+        /// @brief Number of glyphs looked up since construction
+        mutable std::size_t _num_glyph_updates;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // Runs are copied like sf::Text.
+    public:
+        Glyph_run           (Glyph_run const&) = default; ///< Copy constructor
+        Glyph_run& operator=(Glyph_run const&) = default; ///< Copy assignment
+        Glyph_run           (Glyph_run&&     ) = default; ///< Move constructor
+        Glyph_run& operator=(Glyph_run&&     ) = default; ///< Move assignment
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Insert characters
+        /// @param index Character index to insert before, clamped to the size
+        /// @param string The characters to insert
+        void insert(std::size_t const index, std::u32string_view const string);
+
+        /// @brief Erase characters
+        /// @param index First character to erase, clamped to the size
+        /// @param count Number of characters to erase, clamped to the end
+        void erase(std::size_t const index, std::size_t const count);
+
+        /// @brief Find the caret position closest to a point
+        /// @param local_x X coordinate in the run's local coordinates
+        /// @return std::size_t Character index the caret would be before
+        /// @warning Only meant for runs without line breaks.
+        std::size_t find_char_index(float const local_x) const;
+
+        /// @brief Lay the run out now and never again
+        /// @details Const calls on a frozen run only read, so it can be shared between
+        ///          threads. It is not laid out again even when its font page is
+        ///          evicted, check is_stale() and build a new run instead. A frozen run
+        ///          must not be changed.
+        void freeze();
+
+        /// @brief Check if the glyph cache evicted the page the geometry was built on
+        /// @return bool true if the run must be laid out again before drawing
+        bool is_stale() const;
+
+        /// @brief Append the triangles of the run in draw order, outline, glyphs then lines
+        /// @details The vertices are in local coordinates and sample get_texture().
+        /// @param vertices Vector the triangles are appended to
+        void append_vertices(std::vector<sf::Vertex>& vertices) const;
+
+        /// @brief Append the triangles of the run split into outline and fill
+        /// @details For batching runs with others, where every outline must be drawn
+        ///          before any glyph. The fill gets the glyphs, then the lines.
+        /// @param fill_vertices Vector the glyph and line triangles are appended to
+        /// @param outline_vertices Vector the outline triangles are appended to
+        void append_vertices(std::vector<sf::Vertex>& fill_vertices, std::vector<sf::Vertex>& outline_vertices) const;
+
+    private:
+        /// @brief Draw the glyphs
+        /// @param target The render target to draw to
+        /// @param states Render states, the transform is combined with the run's
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Replace the characters, editing only the part that differs
+        /// @details The longest common prefix and suffix of the old and new string
+        ///          are kept, only the characters between them are replaced.
+        /// @param string The new characters
+        void set_string(std::u32string_view const string);
+
+        /// @brief Set the font
+        /// @param font The font to draw with, must outlive the run
+        void set_font(sf::Font const& font);
+
+        /// @brief Set the character size
+        /// @param char_size Character size in pixels
+        void set_char_size(unsigned int const char_size);
+
+        /// @brief Set the style
+        /// @param style Combination of sf::Text::Style flags
+        void set_style(std::uint32_t const style);
+
+        /// @brief Set the color of the glyphs, recolors without any layout
+        /// @param color Fill color
+        void set_fill_color(sf::Color const color);
+
+        /// @brief Set the thickness of the outline
+        /// @param thickness Outline thickness in pixels, 0 for none
+        void set_outline_thickness(float const thickness);
+
+        /// @brief Set the color of the outline, recolors without any layout
+        /// @param color Outline color
+        void set_outline_color(sf::Color const color);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the characters
+        /// @return std::u32string const& The characters of the run
+        std::u32string const& get_string() const;
+
+        /// @brief Get the number of characters
+        /// @return std::size_t Number of characters
+        std::size_t get_size() const;
+
+        /// @brief Get the font
+        /// @return sf::Font const& The font drawn with
+        sf::Font const& get_font() const;
+
+        /// @brief Get the glyph cache the run looks glyphs up in
+        /// @return Glyph_cache& The cache of the font
+        Glyph_cache& get_glyph_cache() const;
+
+        /// @brief Get the character size
+        /// @return unsigned int Character size in pixels
+        unsigned int get_char_size() const;
+
+        /// @brief Get the font page the glyphs are drawn from
+        /// @return sf::Texture const* Page texture of the character size
+        sf::Texture const* get_texture() const;
+
+        /// @brief Get the style
+        /// @return std::uint32_t Combination of sf::Text::Style flags
+        std::uint32_t get_style() const;
+
+        /// @brief Get the color of the glyphs
+        /// @return sf::Color Fill color
+        sf::Color get_fill_color() const;
+
+        /// @brief Get the thickness of the outline
+        /// @return float Outline thickness in pixels
+        float get_outline_thickness() const;
+
+        /// @brief Get the color of the outline
+        /// @return sf::Color Outline color
+        sf::Color get_outline_color() const;
+
+        /// @brief Get the pen position before a character
+        /// @param index Character index, clamped to the size for the end of the run
+        /// @return float X coordinate in local coordinates
+        float get_char_x(std::size_t const index) const;
+
+        /// @brief Get the bounds of the glyphs before the transform
+        /// @return sf::FloatRect Local bounds
+        sf::FloatRect get_local_bounds() const;
+
+        /// @brief Get the bounds of the glyphs after the transform
+        /// @return sf::FloatRect Global bounds
+        sf::FloatRect get_global_bounds() const;
+
+        /// @brief Get the number of glyphs looked up since construction
+        /// @details Grows by the number of edited characters, plus the one after them,
+        ///          on each layout. Use it to check edits stay local.
+        /// @return std::size_t Number of glyph lookups
+        std::size_t get_num_glyph_updates() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Flag characters for layout
+        /// @param first First character whose glyph changed
+        /// @param end One past the last changed character, `ALL` to lay out every later one
+        void _invalidate(std::size_t const first, std::size_t const end);
+
+        /// @brief Lay out the dirty glyphs and recompute the bounds and lines
+        void _update_geometry() const;
+
+        /// @brief Move the glyphs after the laid out ones by the change in their pen position
+        /// @param first First character that was not laid out
+        /// @param offset Change of its pen position, later lines only move vertically
+        void _move_glyphs(std::size_t const first, sf::Vector2f const offset) const;
+
+        /// @brief Recompute the bounds from the stored glyph bounds and lines
+        void _update_bounds() const;
+
+        /// @brief Rebuild the underline and strike through quads, one per line of text
+        /// @param metrics Line metrics of the character size
+        void _update_lines(Glyph_cache::Metrics const& metrics) const;
+
+        /// @brief `_dirty_end` marking every character from `_first_dirty` on
+        static std::size_t constexpr ALL = static_cast<std::size_t>(-1);
+
+    }; // class Glyph_run
+
+} // namespace widgets
+
+#endif // GLYPH_RUN_H
@@ -10,6 +10,8 @@ Includes
 ------------------------------------------------------------------------------
 */
 #include "widgets/signals_slots.h"
+#include "widgets/sprite_batch.h"
+#include "widgets/texture_atlas.h"
 #include "widgets/widget.h"
 #include "SFML/Graphics.hpp"
 
@@ -35,7 +37,7 @@ namespace widgets {
         ------------------------------------------------------------------------------
         */
     public:
-        /// @brief Default constructor is deleted - widgets require a parent window
+        /// @brief Default constructor is deleted - widgets require a parent render target
         Image() = delete;
 
         /// @brief Construct an Image with a texture
@@ -43,25 +45,35 @@ namespace widgets {
         ///          and the default values:
         ///          - Scale: The scale of the texture passed in by `texture`
         ///          - Position: (0, 0)
-        /// @param parent_window The parent window to draw the widget to
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
         /// @param texture The texture that will be applied to the Image
-        Image(std::shared_ptr<sf::RenderWindow> parent_window, sf::Texture const& texture);
+        Image(std::shared_ptr<sf::RenderTarget> parent_target, sf::Texture const& texture);
 
         /// @brief Construct an Image with a texture and texture rectangle
         /// @details This constructor initializes an Image with your chosen texture,
         ///          texture rectangle, and the default values:
         ///          - Scale: The scale of the texture passed in by `texture`
         ///          - Position: (0, 0)
-        /// @param parent_window The parent window to draw the widget to
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
         /// @param texture The texture that will be applied to the Image
         /// @param texture_rect This rectangle defines a section of `texture` that will be
         ///                     displayed as the texture of the Image
         Image(
-            std::shared_ptr<sf::RenderWindow> parent_window,
+            std::shared_ptr<sf::RenderTarget> parent_target,
             sf::Texture const& texture,
             sf::IntRect const  texture_rect
             );
 
+        /// @brief Construct an Image from a texture atlas region
+        /// @details Widgets built from regions of the same atlas page share one
+        ///          texture, so batch_draw() can draw all of them in one call.
+        ///          Default values:
+        ///          - Size: The size of the region
+        ///          - Position: (0, 0)
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
+        /// @param region Region of a built Texture_atlas, the atlas must outlive the widget
+        Image(std::shared_ptr<sf::RenderTarget> parent_target, Atlas_region const& region);
+
         /// @brief Default destructor
         ~Image() = default;
 
@@ -93,6 +105,17 @@ namespace widgets {
         /// @brief Draws the widget to the parent window
         void draw() override;
 
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
+        /// @brief Adds the widget to a sprite batch instead of drawing it directly
+        /// @details Applies the same hidden and outside view checks as draw().
+        ///          Consecutive widgets sharing a texture are drawn in one call
+        ///          when the batch is drawn.
+        /// @param batch The batch to add the widget's sprite to
+        void batch_draw(Sprite_batch& batch);
+
         /// @brief Moves the widget and all its associated components
         /// @param offset Vector offset to move the widget by
         void move(sf::Vector2f const offset) override;
@@ -193,6 +216,10 @@ namespace widgets {
         /// @return Rotation angle for the widget
         sf::Angle get_rotation() const override;
 
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
     }; // class Image
 
 } // namespace widgets
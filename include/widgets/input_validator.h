@@ -0,0 +1,200 @@
+/// @file input_validator.h
+/// @brief Validators for typed text, compiled once to a DFA that checks each keystroke in O(1)
+
+#ifndef INPUT_VALIDATOR_H
+#define INPUT_VALIDATOR_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Validators for typed text, compiled once to a DFA that checks each keystroke in O(1)
+    ///
+    /// @details A validator is a regular expression over the characters a
+    ///          Line_edit accepts, compiled once into a deterministic
+    ///          automaton. Checking a character is one table lookup from the state
+    ///          reached by the characters before it, so a field that keeps the state
+    ///          after every character validates a keystroke at its end in O(1) and
+    ///          one in the middle in the length of the text after it.
+    ///
+    ///          Every state that cannot lead to a match is folded into
+    ///          DEAD_STATE, so text is a valid partial input, one the user can
+    ///          still complete, exactly while its state is not DEAD_STATE.
+    ///          is_accepting() tells whether it is complete.
+    ///
+    ///          The factories build the pattern for common fields: integer ranges,
+    ///          hexadecimal numbers, IPv4 addresses and date and time masks. regex()
+    ///          takes a pattern directly, with this subset of the usual syntax:
+    ///
+    ///          - Literal characters, `.` for any character and `\` escaping the next one
+    ///          - `\d`, `\w` and `\s` for ASCII digits, word characters and space
+    ///          - Classes such as `[a-f0-9]` and negated classes such as `[^,]`
+    ///          - Groups `( )` and alternation `|`
+    ///          - The quantifiers `*`, `+`, `?`, `{n}`, `{n,}` and `{n,m}`
+    ///
+    ///          The whole text must match, there are no anchors. Patterns are written
+    ///          in ASCII, characters past it are all matched alike by `.`, negated
+    ///          classes and `\D`, `\W` and `\S`. A default constructed validator
+    ///          accepts any text.
+    class Input_validator final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief A state of the automaton, the text validated so far
+        using State = std::uint16_t;
+
+        /// @brief State of text that can no longer match, whatever follows
+        static State constexpr DEAD_STATE = 0u;
+
+        /// @brief Most automaton states a pattern may compile to
+        static std::size_t constexpr MAX_STATES = 4096u;
+
+        /// @brief Construct a validator that accepts any text
+        Input_validator();
+
+        /// @brief Default destructor
+        ~Input_validator() = default;
+
+        /// @brief Compile a validator from a pattern
+        /// @details Logs a warning and accepts any text if the pattern is malformed
+        ///          or compiles to more than MAX_STATES states.
+        /// @param pattern Pattern in the subset described above
+        /// @return Input_validator The compiled validator
+        static Input_validator regex(std::string_view const pattern);
+
+        /// @brief Compile a validator for whole numbers in a range
+        /// @details Numbers are written without leading zeros or a plus sign. Only
+        ///          prefixes of numbers in the range can be typed, so for 10 to 12 a
+        ///          "2" is rejected since no number in the range starts with it.
+        /// @param min Smallest number accepted
+        /// @param max Largest number accepted, swapped with `min` if smaller
+        /// @return Input_validator The compiled validator
+        static Input_validator integer_range(long long const min, long long const max);
+
+        /// @brief Compile a validator for hexadecimal numbers
+        /// @param max_digits Most digits accepted, 0 for any number
+        /// @param has_prefix Whether the number starts with "0x"
+        /// @return Input_validator The compiled validator
+        static Input_validator hex(std::size_t const max_digits = 0u, bool const has_prefix = false);
+
+        /// @brief Compile a validator for dotted IPv4 addresses such as "192.168.0.1"
+        /// @return Input_validator The compiled validator
+        static Input_validator ipv4();
+
+        /// @brief Compile a validator for a date or time mask
+        /// @details `YYYY` is a year, `MM` a month, `DD` a day from 01 to 31, `hh` an
+        ///          hour from 00 to 23 and `mm` and `ss` minutes and seconds. Any other
+        ///          character must be typed as is. Days are not checked against the month.
+        /// @param mask The mask, such as "YYYY-MM-DD" or "hh:mm:ss"
+        /// @return Input_validator The compiled validator
+        static Input_validator date(std::string_view const mask = "YYYY-MM-DD");
+
+    private:
+        /// @brief Transition table, `_transitions[state * _num_classes + class]`
+        std::vector<State> _transitions;
+
+        /// @brief Whether each state is a complete match
+        std::vector<bool> _accepting;
+
+        /// @brief Character class of each printable ASCII character, then of every character past ASCII
+        std::vector<std::uint8_t> _classes;
+
+        /// @brief Number of character classes, characters no pattern tells apart share one
+        std::size_t _num_classes;
+
+        /// @brief State of the empty text
+        State _start_state;
+
+        /// @brief The pattern compiled, empty when any text is accepted
+        std::string _pattern;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // A compiled validator is only tables, fields keep their own copy.
+    public:
+        Input_validator           (Input_validator const&) = default; ///< Copy constructor
+        Input_validator& operator=(Input_validator const&) = default; ///< Copy assignment
+        Input_validator           (Input_validator&&     ) = default; ///< Move constructor
+        Input_validator& operator=(Input_validator&&     ) = default; ///< Move assignment
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Advance the automaton by one character
+        /// @param state State of the text before the character
+        /// @param code_point The character
+        /// @return State State of the text with the character, DEAD_STATE if rejected
+        State advance(State const state, char32_t const code_point) const;
+
+        /// @brief Run the automaton over a whole text
+        /// @param text The text
+        /// @return State State of the text, DEAD_STATE if it cannot match
+        State run(std::u32string_view const text) const;
+
+        /// @brief Check whether a text is a complete match
+        /// @param text The text
+        /// @return bool true if the text matches the whole pattern
+        bool matches(std::u32string_view const text) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the state of the empty text
+        /// @return State The start state, DEAD_STATE if the pattern matches nothing
+        State get_start_state() const;
+
+        /// @brief Get whether a state is a complete match
+        /// @param state The state
+        /// @return bool true if text in this state matches the whole pattern
+        bool is_accepting(State const state) const;
+
+        /// @brief Get the pattern the validator was compiled from
+        /// @return std::string const& The pattern, empty when any text is accepted
+        std::string const& get_pattern() const;
+
+        /// @brief Get the number of automaton states, including DEAD_STATE
+        /// @return std::size_t Number of states
+        std::size_t get_num_states() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Compile a pattern into this validator's tables
+        /// @param pattern Pattern in the supported subset
+        /// @return bool true if compiled, false and a warning log otherwise
+        bool _compile(std::string_view const pattern);
+
+    }; // class Input_validator
+
+} // namespace widgets
+
+#endif // INPUT_VALIDATOR_H
@@ -9,10 +9,15 @@
 Includes
 ------------------------------------------------------------------------------
 */
+#include "widgets/glyph_run.h"
+#include "widgets/sdf_text.h"
 #include "widgets/signals_slots.h"
+#include "widgets/text_wrap.h"
 #include "widgets/widget.h"
 #include "SFML/Graphics.hpp"
 
+#include <memory>
+
 /*
 ------------------------------------------------------------------------------
 Namespace widgets BEGIN
@@ -26,6 +31,17 @@ namespace widgets {
     ///          customizable appearance including colors, styles, borders,
     ///          and basic event handling.
     ///
+    ///          The text is a Glyph_run, so changing part of the string (a counter,
+    ///          a status word) only lays out the characters that changed; the rest
+    ///          of the line is shifted and other lines are left alone.
+    ///
+    ///          With a maximum width set, the text is wrapped or elided to it. The
+    ///          break opportunities and advances of the string are measured once by
+    ///          a Text_wrap, so changing the width only fits the lines again.
+    ///
+    ///          With set_sdf_font() the text is drawn from an Sdf_font, so auto-fit
+    ///          and set_char_size() never rasterize glyphs.
+    ///
     /// @ingroup Widgets
     class Label final :
         public widgets::Widget,
@@ -36,7 +52,7 @@ namespace widgets {
         ------------------------------------------------------------------------------
         */
     public:
-        /// @brief Default constructor is deleted - widgets require a parent window
+        /// @brief Default constructor is deleted - widgets require a parent render target
         Label() = delete;
 
         /// @brief Construct a Label with default values
@@ -46,16 +62,41 @@ namespace widgets {
         ///          - Text Font: Default font defined in constants
         ///          - Text Character Size: 30 pixels
         ///          - Text color: Black
-        /// @param parent_window The parent window to draw the widget to
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
         /// @param string The text string for label
-        explicit Label(std::shared_ptr<sf::RenderWindow> parent_window, sf::String const& string = "");
+        explicit Label(std::shared_ptr<sf::RenderTarget> parent_target, sf::String const& string = "");
 
-        /// @brief Default destructor
-        ~Label() = default;
+        /// @brief Release the character size of the text
+        ~Label();
 
     private:
-        /// @brief SFML text object for displaying the label content
-        sf::Text _lbl_text;
+        /// @brief Glyph run displaying the label content, relaid out only where it changes
+        Glyph_run _lbl_run;
+
+        /// @brief Character size requested with set_char_size(), auto-fit stays at or below it
+        std::uint32_t _lbl_char_size;
+
+        /// @brief Box the text is fitted to, auto-fit is off while either side is 0
+        sf::Vector2f _lbl_fit_size;
+
+        /// @brief The string as set, the run shows it wrapped or elided
+        std::u32string _lbl_string;
+
+        /// @brief Cached break and advance analysis of `_lbl_string`
+        Text_wrap _lbl_wrap;
+
+        /// @brief The run's string after wrapping or eliding, reused between fits
+        std::u32string _lbl_wrapped;
+
+        /// @brief How text wider than the maximum width is laid out
+        Wrap_mode _lbl_wrap_mode;
+
+        /// @brief Width the text is wrapped or elided to, off while 0
+        float _lbl_max_width;
+
+        /// @brief Text drawn instead of `_lbl_run` once set_sdf_font() is called, which
+        ///        then only keeps the string and transform and is never laid out
+        std::unique_ptr<Sdf_text> _lbl_sdf_text;
 
         /*
         ------------------------------------------------------------------------------
@@ -81,6 +122,10 @@ namespace widgets {
         /// @brief Draws the widget to the parent window
         void draw() override;
 
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
         /// @brief Moves the widget and all its associated components
         /// @param offset Vector offset to move the widget by
         void move(sf::Vector2f const offset) override;
@@ -114,9 +159,27 @@ namespace widgets {
         void set_scale(float const x, float const y) override;
 
         /// @brief Set the widget's text character size
+        /// @details Snapped down to the nearest size of resources::DEFAULT_GLYPH_CACHE,
+        ///          unless drawn from an Sdf_font. While auto-fit is on this is the
+        ///          largest size the text may use.
         /// @param char_size Character size for the widget's text
         void set_char_size(std::uint32_t const char_size);
 
+        /// @brief Set the box the widget's text is auto-fitted to
+        /// @details The text uses the largest glyph cache size, up to the character
+        ///          size, at which its local bounds fit the box. Text drawn from an
+        ///          Sdf_font is scaled to fit exactly instead. It shrinks and grows
+        ///          back as the string, style or box change. Pass (0, 0) to turn
+        ///          auto-fit off and use the character size as is. The string is
+        ///          fitted before it is wrapped or elided.
+        /// @param size Vector size of the box
+        void set_auto_fit_size(sf::Vector2f const size);
+
+        /// @brief Set the box the widget's text is auto-fitted to
+        /// @param x Width of the box
+        /// @param y Height of the box
+        void set_auto_fit_size(float const x, float const y);
+
         /// @brief Set the widget's position and all its associated components
         /// @param pos Vector position for the widget
         void set_pos(sf::Vector2f const pos) override;
@@ -163,6 +226,26 @@ namespace widgets {
         /// @param color Color for the widget's text border
         void set_text_border_color(sf::Color const color);
 
+        /// @brief Set how text wider than the maximum width is laid out
+        /// @param mode NONE, WRAP to break lines or ELIDE to end them in an ellipsis
+        void set_wrap_mode(Wrap_mode const mode);
+
+        /// @brief Set the width the text is wrapped or elided to
+        /// @details In local coordinates, before the widget's scale. Only the lines
+        ///          are fitted again, the string is not measured again.
+        /// @warning If you pass in a negative width it will be set to 0.0f, off, and
+        ///          gives a warning log
+        /// @param width Maximum line width, 0 to turn wrapping and eliding off
+        void set_max_width(float const width);
+
+        /// @brief Draw the widget's text from a signed distance field font
+        /// @details The text style and text border are not drawn while it is set.
+        ///          Wrapping measures at the font's base size, which it has already
+        ///          rasterized, and scales the widths.
+        /// @param font The font to draw with, must outlive the widget, nullptr to
+        ///             draw with the bitmap font again
+        void set_sdf_font(Sdf_font* font);
+
         /*
         ------------------------------------------------------------------------------
         Getter Functions
@@ -209,12 +292,20 @@ namespace widgets {
         /// @return Rotation angle for the widget
         sf::Angle get_rotation() const override;
 
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
+        /// @brief Get the box the widget's text is auto-fitted to
+        /// @return Vector size of the box, (0, 0) while auto-fit is off
+        sf::Vector2f get_auto_fit_size() const;
+
         /// @brief Get the widget's text color
         /// @return Color for the widget's text
         sf::Color get_text_color() const;
 
         /// @brief Get the widget's text string
-        /// @return String for the widget's text
+        /// @return String for the widget's text, without the breaks of wrapping or eliding
         sf::String get_text_string() const;
 
         /// @brief Get the widget's text style
@@ -229,6 +320,18 @@ namespace widgets {
         /// @return Color for the widget's text border
         sf::Color get_text_border_color() const;
 
+        /// @brief Get how text wider than the maximum width is laid out
+        /// @return Wrap_mode The wrap mode
+        Wrap_mode get_wrap_mode() const;
+
+        /// @brief Get the width the text is wrapped or elided to
+        /// @return float Maximum line width, 0 while off
+        float get_max_width() const;
+
+        /// @brief Get the signed distance field font the widget's text is drawn from
+        /// @return Sdf_font* The font, nullptr when drawn with the bitmap font
+        Sdf_font* get_sdf_font() const;
+
         /*
         ------------------------------------------------------------------------------
         Signals / Slots
@@ -255,6 +358,19 @@ namespace widgets {
         ------------------------------------------------------------------------------
         */
     private:
+        /// @brief Size the text for the auto-fit box, or to the character size when off
+        /// @details Fits the run itself, measuring its unwrapped local bounds, then wraps
+        ///          the text at the new size. Called only when the size, box, style,
+        ///          outline or, while fitting, the string changes.
+        void _fit_text_to_box();
+
+        /// @brief Set the run to the string wrapped, elided or as is
+        void _wrap_text();
+
+        /// @brief Set the string shown by the run and, if set, the sdf text
+        /// @param string The string wrapped, elided or as is
+        void _set_shown_string(std::u32string const& string);
+
         /// @brief Check if the mouse is hovering over the label
         /// @details Helper function used by `_handle_hover(sf::Event const& event)`.
         ///          It checks if the mouse is within the bounds of our text rectangle
@@ -9,10 +9,26 @@
 Includes
 ------------------------------------------------------------------------------
 */
+#include "widgets/edit_history.h"
+#include "widgets/gap_buffer.h"
+#include "widgets/glyph_run.h"
+#include "widgets/input_validator.h"
+#include "widgets/prefix_index.h"
+#include "widgets/sdf_text.h"
 #include "widgets/signals_slots.h"
+#include "widgets/suggestion_list.h"
 #include "widgets/widget.h"
 #include "SFML/Graphics.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 /*
 ------------------------------------------------------------------------------
 Namespace widgets BEGIN
@@ -26,6 +42,39 @@ namespace widgets {
     ///          character limits, and typing state management. It supports text entry,
     ///          deletion, and various styling options.
     ///
+    ///          The text is stored in a Gap_buffer and drawn with a Glyph_run, so
+    ///          typing or deleting at the cursor neither copies the text nor lays it
+    ///          out again, whatever its length. While typing, a caret marks the cursor
+    ///          and the arrow keys, Home, End, Delete, Ctrl+A and Ctrl+V move, select,
+    ///          delete and paste. Clicking places the cursor and dragging or shift
+    ///          clicking selects. Backspace is left to the `SIGNAL__KEYPRESS_BACKSPACE`
+    ///          slot calling `delete_char()`.
+    ///
+    ///          Any script can be typed. resources::UNICODE_TABLE classifies each
+    ///          code point with two table lookups, so controls and unassigned code
+    ///          points are dropped, and backspace, delete and the arrow keys take a
+    ///          whole grapheme cluster, an accented letter, a flag or a joined emoji,
+    ///          at a time.
+    ///
+    ///          Edits are recorded in an Edit_history, Ctrl+Z undoes and Ctrl+Y or
+    ///          Ctrl+Shift+Z redoes them, a typed word at a time.
+    ///
+    ///          An Input_validator restricts what can be typed. The field keeps the
+    ///          validator state after every character, so a keystroke at the end is
+    ///          one table lookup, and an edit the validator rejects, typed, pasted or
+    ///          deleted, leaves the text untouched.
+    ///
+    ///          Given a Prefix_index, the field suggests completions as it is typed
+    ///          in. Each keystroke narrows the previous prefix's range of the index
+    ///          by one character and takes the highest weighted entries of it, well
+    ///          under a millisecond for millions of entries, and a Suggestion_list
+    ///          below the field lays out only its visible rows. Down and Up move the
+    ///          highlight, Tab or Enter accept and Escape closes the list.
+    ///
+    ///          With set_sdf_font() both texts are drawn from an Sdf_font, so auto-fit
+    ///          and set_char_size() never rasterize glyphs. The runs then only keep
+    ///          the strings and transforms and are never laid out.
+    ///
     /// @ingroup Widgets
     class Line_edit final :
         public widgets::Widget,
@@ -36,7 +85,7 @@ namespace widgets {
         ------------------------------------------------------------------------------
         */
     public:
-        /// @brief Default constructor is deleted - widgets require a parent window
+        /// @brief Default constructor is deleted - widgets require a parent render target
         Line_edit() = delete;
 
         /// @brief Construct a Line_edit with default values
@@ -51,22 +100,79 @@ namespace widgets {
         ///          - Max characters: 18
         ///          - Fill color: Magenta
         ///          - Border: No border
-        /// @param parent_window The parent window to draw the widget to
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
         /// @param placeholder_string The text placeholder string for Line_edit
         explicit Line_edit(
-            std::shared_ptr<sf::RenderWindow> parent_window,
+            std::shared_ptr<sf::RenderTarget> parent_target,
             sf::String const& placeholder_string = "placeholder string"
             );
 
-        /// @brief Default destructor
-        ~Line_edit() = default;
+        /// @brief Release the character size of the text
+        ~Line_edit();
 
     private:
-        /// @brief Text object for displaying typed characters
-        sf::Text _le_typing_text;
+        /// @brief Glyphs of the placeholder text, shown when empty
+        Glyph_run _le_placeholder_run;
+
+        /// @brief Glyphs of the typed characters, edited alongside `_le_buffer`
+        Glyph_run _le_typing_run;
+
+        /// @brief Typed characters and the cursor
+        Gap_buffer _le_buffer;
+
+        /// @brief Inserted and erased characters, for undo and redo
+        Edit_history<std::u32string> _le_history;
+
+        /// @brief Restricts what can be typed, accepts any text by default
+        Input_validator _le_validator;
+
+        /// @brief Validator state before each character, `_le_states[i]` after the first `i`
+        std::vector<Input_validator::State> _le_states;
+
+        /// @brief Index completions are suggested from, none by default
+        std::shared_ptr<Prefix_index const> _le_index;
+
+        /// @brief Index still being built by Prefix_index::build_async(), attached once ready
+        std::future<std::shared_ptr<Prefix_index const>> _le_pending_index;
+
+        /// @brief Range of each prefix of `_le_query`, `_le_prefix_ranges[i]` for the first `i` characters
+        mutable std::vector<Prefix_index::Range> _le_prefix_ranges;
+
+        /// @brief Text the suggestions were found for
+        mutable std::string _le_query;
+
+        /// @brief Completions of the text, heaviest first
+        mutable std::vector<std::string> _le_suggestions;
 
-        /// @brief Text object for displaying placeholder text when empty
-        sf::Text _le_placeholder_text;
+        /// @brief Entry indices of the suggestions, kept to reuse their memory
+        mutable std::vector<std::uint32_t> _le_suggestion_ids;
+
+        /// @brief Dropdown listing the suggestions below the field
+        Suggestion_list _le_dropdown;
+
+        /// @brief Most suggestions found per keystroke
+        std::size_t _le_max_suggestions;
+
+        /// @brief Whether the text changed since the suggestions were found
+        mutable bool _is_suggestions_dirty;
+
+        /// @brief Whether the suggestions changed since the dropdown was given them
+        mutable bool _is_dropdown_dirty;
+
+        /// @brief Whether the dropdown was accepted from or closed since the last edit
+        bool _is_dropdown_dismissed;
+
+        /// @brief End of the selection the cursor does not sit at, equal to the cursor when none
+        std::size_t _le_anchor;
+
+        /// @brief Whether a left mouse drag is extending the selection
+        bool _is_selecting;
+
+        /// @brief Bar drawn at the cursor while typing
+        sf::RectangleShape _le_caret;
+
+        /// @brief Highlight drawn behind the selected characters
+        sf::RectangleShape _le_selection_rect;
 
         /// @brief Rectangle shape representing the input field background
         sf::RectangleShape _le_rect;
@@ -77,6 +183,27 @@ namespace widgets {
         /// @brief Currently typed character to be appended
         sf::String _typed_char;
 
+        /// @brief Character size requested with set_char_size(), auto-fit stays at or below it
+        std::uint32_t _le_char_size;
+
+        /// @brief Width the field is fitted to, auto-fit is off while 0
+        float _le_fit_width;
+
+        /// @brief Size of the field, measured for the maximum number of characters
+        sf::Vector2f _le_rect_size;
+
+        /// @brief Position of both texts relative to the field
+        sf::Vector2f _le_text_offset;
+
+        /// @brief Whether `_le_rect_size` and `_le_text_offset` must be measured again
+        bool _is_metrics_dirty;
+
+        /// @brief Drawn instead of `_le_placeholder_run` once set_sdf_font() is called
+        std::unique_ptr<Sdf_text> _le_sdf_placeholder;
+
+        /// @brief Drawn instead of `_le_typing_run` once set_sdf_font() is called
+        std::unique_ptr<Sdf_text> _le_sdf_typing;
+
         /*
         ------------------------------------------------------------------------------
         Rule of 5
@@ -101,6 +228,10 @@ namespace widgets {
         /// @brief Draws the widget to the parent window
         void draw() override;
 
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
         /// @brief Moves the widget and all its associated components
         /// @param offset Vector offset to move the widget by
         void move(sf::Vector2f const offset) override;
@@ -114,19 +245,71 @@ namespace widgets {
         /// @param angle Rotation angle that will be added to current rotation angle
         void rotate(sf::Angle const angle) override;
 
-        /// @brief Append the current typed character to the input field
-        /// @warning This will only append if we are in the typing state and we have
+        /// @brief Insert the current typed character at the cursor, replacing any selection
+        /// @warning This will only insert if we are in the typing state and we have
         ///          not yet reached our maximum number of characters
         void append_typed_char();
 
-        /// @brief Delete the last character from the input field
-        /// @warning This will only delete if we are in the typing state and the
-        ///          typing text string size is greater than 0
+        /// @brief Insert text at the cursor in one pass, replacing any selection
+        /// @details Control and unassigned code points are skipped and the text is cut
+        ///          where the field reaches its maximum number of characters, in a
+        ///          single pass that stops there. The buffer and the glyph run are
+        ///          each edited once, so a long paste lays out once, not per character.
+        ///          Nothing is inserted if the validator rejects the result.
+        /// @param text The text to insert
+        /// @return std::size_t Number of characters inserted, 0 if rejected
+        std::size_t insert_text(sf::String const& text);
+
+        /// @brief Insert the clipboard at the cursor, replacing any selection
+        /// @details Bound to Ctrl+V while typing.
+        /// @return std::size_t Number of characters inserted
+        std::size_t paste();
+
+        /// @brief Delete the selection, or the grapheme cluster before the cursor like backspace
+        /// @warning This will only delete if we are in the typing state and there
+        ///          is a character to delete
         void delete_char();
 
-    private:
-        /// @brief Final updates before drawing
-        void _update_widget() override;
+        /// @brief Delete the selection, or the grapheme cluster after the cursor like the delete key
+        /// @warning This will only delete if we are in the typing state and there
+        ///          is a character to delete
+        void delete_char_after();
+
+        /// @brief Move the cursor by a number of grapheme clusters
+        /// @details Without extending, a selection collapses to the side moved towards.
+        /// @param offset Number of grapheme clusters to move, negative to move left
+        /// @param is_extending Whether to extend the selection instead of clearing it
+        void move_cursor(int const offset, bool const is_extending = false);
+
+        /// @brief Select every typed character
+        void select_all();
+
+        /// @brief Revert the last edit, a typed word, a paste or a deleted selection
+        /// @details Bound to Ctrl+Z while typing. Costs the size of the edit, not of the text.
+        void undo();
+
+        /// @brief Apply the last undone edit again
+        /// @details Bound to Ctrl+Y and Ctrl+Shift+Z while typing.
+        void redo();
+
+        /// @brief Move the highlight of the suggestion dropdown
+        /// @details Bound to Down and Up while suggestions are shown.
+        /// @param offset Number of suggestions to move, negative to move up
+        void move_suggestion_highlight(int const offset);
+
+        /// @brief Replace the text with the highlighted suggestion, or the first one
+        /// @details Bound to Tab, and to Enter while a suggestion is highlighted.
+        ///          Closes the dropdown until the next edit.
+        /// @return bool true if a suggestion was shown to accept
+        bool accept_suggestion();
+
+        /// @brief Close the suggestion dropdown until the next edit
+        /// @details Bound to Escape while suggestions are shown.
+        void dismiss_suggestions();
+
+        /// @brief Attach an index built in the background once it is ready, without waiting for it
+        /// @return true if the index was attached, false otherwise
+        bool poll() override;
 
         /*
         ------------------------------------------------------------------------------
@@ -139,9 +322,64 @@ namespace widgets {
         void set_max_chars(std::uint32_t const max_chars);
 
         /// @brief Set the widget's text character size
+        /// @details Snapped down to the nearest size of resources::DEFAULT_GLYPH_CACHE,
+        ///          unless drawn from an Sdf_font. While auto-fit is on this is the
+        ///          largest size the text may use.
         /// @param char_size Character size for the widget's text
         void set_char_size(std::uint32_t const char_size);
 
+        /// @brief Place the cursor
+        /// @param index Character index to place the cursor before, clamped to the size
+        /// @param is_extending Whether to extend the selection instead of clearing it
+        void set_cursor(std::size_t const index, bool const is_extending = false);
+
+        /// @brief Set the validator that restricts what can be typed
+        /// @details Clears the undo history, and the text if the new validator rejects it.
+        /// @param validator The validator, a default constructed one accepts any text
+        void set_validator(Input_validator validator);
+
+        /// @brief Set the memory the undo history may use
+        /// @details The oldest edits are dropped past it.
+        /// @param max_bytes Bytes of recorded edits, 0 disables undo
+        void set_max_history_bytes(std::size_t const max_bytes);
+
+        /// @brief Set the index completions are suggested from
+        /// @details Replaces an index still being built, waiting for it to finish.
+        /// @param index The index, nullptr turns suggestions off
+        void set_prefix_index(std::shared_ptr<Prefix_index const> index);
+
+        /// @brief Set an index being built on a background thread
+        /// @details The field keeps working without suggestions and attaches the
+        ///          index from the first poll() after it is ready, never waiting for it.
+        /// @param pending_index The future from Prefix_index::build_async()
+        void set_prefix_index(std::future<std::shared_ptr<Prefix_index const>> pending_index);
+
+        /// @brief Set the most suggestions found per keystroke
+        /// @param max_suggestions Number of suggestions, the dropdown scrolls through them
+        void set_max_suggestions(std::size_t const max_suggestions);
+
+        /// @brief Set the most suggestions shown at once
+        /// @param num_rows Number of dropdown rows, at least 1
+        void set_num_visible_suggestions(std::size_t const num_rows);
+
+        /// @brief Set the width the widget is auto-fitted to
+        /// @details The field is sized to hold its maximum number of characters, so
+        ///          the text uses the largest glyph cache size, up to the character
+        ///          size, at which that field fits the width. It shrinks and grows
+        ///          back as the width or maximum number of characters change. Pass 0
+        ///          to turn auto-fit off and use the character size as is.
+        /// @param width Width of the field including its padding
+        void set_auto_fit_width(float const width);
+
+        /// @brief Draw the widget's texts from a signed distance field font
+        /// @details Fitting the width or changing the character size then only
+        ///          rescales the texts, sizes are no longer snapped to the glyph cache.
+        ///          The text styles are not drawn while it is set, the suggestions
+        ///          keep the bitmap font.
+        /// @param font The font to draw with, must outlive the widget, nullptr to
+        ///             draw with the bitmap font again
+        void set_sdf_font(Sdf_font* font);
+
         /// @brief Set the widget's position and all its associated components
         /// @param pos Vector position for the widget
         void set_pos(sf::Vector2f const pos) override;
@@ -205,9 +443,14 @@ namespace widgets {
         */
     public:
         /// @brief Get the widget's text character size
+        /// @details Rounded down while drawn from an Sdf_font.
         /// @return Character size for the widget's text
         std::uint32_t get_char_size() const;
 
+        /// @brief Get the width the widget is auto-fitted to
+        /// @return float Width of the field, 0 while auto-fit is off
+        float get_auto_fit_width() const;
+
         /// @brief Get the widget's position
         /// @return Vector position for the widget
         sf::Vector2f get_pos() const override;
@@ -236,10 +479,53 @@ namespace widgets {
         /// @return Rotation angle for the widget
         sf::Angle get_rotation() const override;
 
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
         /// @brief Get the widget's typing text string
         /// @return String for the widget's typing text
         sf::String get_typing_text_string() const;
 
+        /// @brief Get the cursor
+        /// @return std::size_t Index of the character after the cursor
+        std::size_t get_cursor() const;
+
+        /// @brief Get the validator that restricts what can be typed
+        /// @return Input_validator const& The validator
+        Input_validator const& get_validator() const;
+
+        /// @brief Get whether the text is complete for the validator
+        /// @details Typed text is always a valid start, this tells whether it is finished,
+        ///          "192.168" is a valid start of an address but not acceptable input.
+        /// @return bool true if the validator matches the whole text
+        bool has_acceptable_input() const;
+
+        /// @brief Get the memory the undo history may use
+        /// @return std::size_t Bytes of recorded edits
+        std::size_t get_max_history_bytes() const;
+
+        /// @brief Get the index completions are suggested from
+        /// @return std::shared_ptr<Prefix_index const> The index, nullptr if none is attached yet
+        std::shared_ptr<Prefix_index const> get_prefix_index() const;
+
+        /// @brief Get the completions of the text, heaviest first
+        /// @details Found when asked after an edit, narrowing the last text's ranges.
+        /// @return std::vector<std::string> const& The suggestions, empty without an index or text
+        std::vector<std::string> const& get_suggestions() const;
+
+        /// @brief Get the most suggestions found per keystroke
+        /// @return std::size_t Number of suggestions
+        std::size_t get_max_suggestions() const;
+
+        /// @brief Get whether any characters are selected
+        /// @return bool true if there is a selection
+        bool has_selection() const;
+
+        /// @brief Get the selected characters
+        /// @return sf::String The selection, empty if there is none
+        sf::String get_selected_text() const;
+
         /// @brief Get the widget's typing text color
         /// @return Color for the widget's typing text
         sf::Color get_typing_text_color() const;
@@ -264,6 +550,10 @@ namespace widgets {
         /// @return Color for the widget's border
         sf::Color get_border_color() const;
 
+        /// @brief Get the signed distance field font the widget's texts are drawn from
+        /// @return Sdf_font* The font, nullptr when drawn with the bitmap font
+        Sdf_font* get_sdf_font() const;
+
         /*
         ------------------------------------------------------------------------------
         Signals / Slots
@@ -291,6 +581,29 @@ namespace widgets {
         /// @param event The SFML event to process
         void _handle_mouse_button_pressed_events(sf::Event const& event) override;
 
+        /// @brief Handle mouse button release events for the line edit
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Ends a drag selection, then emits the base class signals.
+        /// @param event The SFML event to process
+        void _handle_mouse_button_release_events(sf::Event const& event) override;
+
+        /// @brief Handle mouse moved events for the line edit
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Extends the selection to the mouse while dragging, then emits the
+        ///          base class signals.
+        /// @param event The SFML event to process
+        void _handle_mouse_moved_events(sf::Event const& event) override;
+
+        /// @brief Handle key press events for the line edit
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          While typing, the arrow keys, Home and End move the cursor, with
+        ///          shift extending the selection, Delete deletes after the cursor and
+        ///          Ctrl+A selects all. While suggestions are shown Down, Up, Tab,
+        ///          Enter and Escape drive the dropdown. The base class signals are
+        ///          emitted either way.
+        /// @param event The SFML event to process
+        void _handle_key_pressed_events(sf::Event const& event) override;
+
         /*
         ------------------------------------------------------------------------------
         Helper Functions
@@ -303,13 +616,91 @@ namespace widgets {
         /// @return true if hovering, false otherwise
         bool _is_hovering() const;
 
+        /// @brief Insert characters at the cursor into both the buffer and the glyphs
+        /// @param text The characters to insert
+        /// @param is_recorded Whether to record the insert, false when undoing or redoing
+        void _insert_at_cursor(std::u32string_view const text, bool const is_recorded = true);
+
+        /// @brief Erase characters from both the buffer and the glyphs
+        /// @param index First character to erase
+        /// @param count Number of characters to erase
+        /// @param is_recorded Whether to record the erase, false when undoing or redoing
+        void _erase(std::size_t const index, std::size_t const count, bool const is_recorded = true);
+
+        /// @brief Erase the selected characters
+        /// @return bool true if there was a selection to erase
+        bool _erase_selection();
+
+        /// @brief Check an edit against the validator without making it
+        /// @param first First character replaced
+        /// @param last One past the last character replaced
+        /// @param text The characters replacing them
+        /// @return bool true if the text after the edit could still be completed
+        bool _is_edit_valid(std::size_t const first, std::size_t const last, std::u32string_view const text) const;
+
+        /// @brief Run the validator again from a character to the end of the text
+        /// @param index First character whose state may have changed
+        void _update_states(std::size_t const index);
+
+        /// @brief Get the selected range
+        /// @return std::pair<std::size_t, std::size_t> First selected character and one past the last
+        std::pair<std::size_t, std::size_t> _get_selection_range() const;
+
+        /// @brief Find the cursor position under a pixel of the parent window
+        /// @param pixel_pos Position in window pixels
+        /// @return std::size_t Character index closest to the pixel, the cursor when there is no window
+        std::size_t _find_cursor_at(sf::Vector2i const pixel_pos) const;
+
+        /// @brief Find the suggestion under a pixel of the parent window
+        /// @param pixel_pos Position in window pixels
+        /// @return std::size_t The suggestion, Suggestion_list::NO_ITEM if none or there is no window
+        std::size_t _find_suggestion_at(sf::Vector2i const pixel_pos) const;
+
+        /// @brief Get whether the suggestion dropdown is shown
+        /// @return bool true while typing with suggestions that were not dismissed
+        bool _is_dropdown_shown() const;
+
+        /// @brief Find the suggestions for the text if it changed since they were found
+        /// @details Keeps the ranges of the prefix the text shares with the last query
+        ///          and narrows one character at a time from there.
+        void _update_suggestions() const;
+
+        /// @brief Give the dropdown new suggestions and place it below the field
+        void _update_dropdown();
+
+        /// @brief Place the caret and selection highlight over the placed glyphs
+        void _update_caret();
+
+        /// @brief Draw a text, or its sdf text when set, with the run's transform
+        /// @param target The render target to draw to
+        /// @param run The run holding the string and transform
+        /// @param sdf_text The text drawn instead of the run, nullptr for none
+        void _draw_text(sf::RenderTarget& target, Glyph_run const& run, Sdf_text const* sdf_text) const;
+
+        /// @brief Push a text, or its sdf text when set, with the run's transform
+        /// @param queue The queue to push into
+        /// @param run The run holding the string and transform
+        /// @param sdf_text The text pushed instead of the run, nullptr for none
+        void _queue_text(Render_queue& queue, Glyph_run const& run, Sdf_text const* sdf_text) const;
+
+        /// @brief Size both texts for the auto-fit width, or to the character size when off
+        void _fit_text_to_width();
+
+        /// @brief Get the string the field is measured with
+        /// @return std::u32string The maximum number of characters of the widest character "W"
+        std::u32string _get_measure_string() const;
+
+        /// @brief Measure the field if the font size or maximum number of characters changed
+        /// @details The field always fits the maximum amount of characters measured at
+        ///          the widest character for most fonts "W". Measuring lays out text, so
+        ///          the size and text offset are cached until `_fit_text_to_width()`
+        ///          changes what they depend on.
+        void _update_metrics();
+
         /// @brief Resize the rectangle to fit the text content
-        /// @details Helper function used to resize the rectangle of the line edit
-        ///          to always fit the maximum amount of characters measured at the
-        ///          widest character for most fonts "W".
-        /// @param curr_text The text that `_resize_rect` will use as a reference
-        ///                  for resizing based on the number of characters of `curr_text`
-        void _resize_rect(sf::Text const& curr_text);
+        /// @details Helper function used before drawing to size the rectangle of the
+        ///          line edit and place both texts inside it from the cached metrics.
+        void _resize_rect();
 
     }; // class Line_edit
 
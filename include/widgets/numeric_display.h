@@ -0,0 +1,343 @@
+/// @file numeric_display.h
+/// @brief A numeric readout widget that updates live values without allocating
+
+#ifndef NUMERIC_DISPLAY_H
+#define NUMERIC_DISPLAY_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/signals_slots.h"
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief A numeric readout widget that updates live values without allocating
+    ///
+    /// @details The value is shown right aligned in a field of a fixed number of
+    ///          cells, with a fixed number of decimals and an optional units
+    ///          suffix. Every cell is as wide as the widest digit, like a meter,
+    ///          so the digits never jump around as the value changes.
+    ///
+    ///          set_value() formats with std::to_chars into a buffer on the stack
+    ///          and compares it cell by cell with what is shown. Only the cells
+    ///          whose character changed get their quad rewritten, copied from a
+    ///          table of the printable ASCII glyphs built when the font, size or
+    ///          format changes. Updating a value never allocates, never looks up a
+    ///          glyph in the font and never touches the units.
+    ///
+    ///          A value that does not fit the field, or is not finite, shows the
+    ///          field filled with '#'.
+    ///
+    /// @ingroup Widgets
+    class Numeric_display final :
+        public widgets::Widget,
+        public signals_slots::Signals_slots {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Largest number of cells in the field
+        static std::size_t constexpr MAX_WIDTH = 32u;
+
+        /// @brief Default constructor is deleted - widgets require a parent render target
+        Numeric_display() = delete;
+
+        /// @brief Construct a Numeric_display with default values
+        /// @details This constructor initializes a Numeric_display with the default values:
+        ///          - Position: (0, 0)
+        ///          - Value: Either `value` parameter or 0 if parameter is omitted
+        ///          - Width: 8 cells
+        ///          - Precision: 2 decimals
+        ///          - Units: None
+        ///          - Text Font: Default font defined in constants
+        ///          - Text Character Size: 30 pixels
+        ///          - Text color: Black
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
+        /// @param value The value to show
+        explicit Numeric_display(std::shared_ptr<sf::RenderTarget> parent_target, double const value = 0.0);
+
+        /// @brief Release the character size of the text
+        ~Numeric_display();
+
+    private:
+        /// @brief Quad of one character placed in a cell at the origin
+        struct Cell_glyph {
+
+            std::array<sf::Vertex, 6> vertices;
+        };
+
+        /// @brief Position, origin, rotation and scale of the widget
+        sf::Transformable _nd_transform;
+
+        /// @brief Quads of the field cells followed by the units
+        sf::VertexArray _nd_vertices;
+
+        /// @brief Quads of the printable ASCII characters, index is the character minus ' '
+        std::array<Cell_glyph, 95> _nd_glyphs;
+
+        /// @brief Characters shown in each cell
+        std::array<char, MAX_WIDTH> _nd_field;
+
+        /// @brief Value shown
+        double _nd_value;
+
+        /// @brief Number of cells in the field
+        std::size_t _nd_width;
+
+        /// @brief Number of decimals
+        int _nd_precision;
+
+        /// @brief Suffix drawn after the field
+        sf::String _nd_units;
+
+        /// @brief Character size of the field and units
+        std::uint32_t _nd_char_size;
+
+        /// @brief Color of the field and units
+        sf::Color _nd_text_color;
+
+        /// @brief Width of a cell, the widest digit advance
+        float _nd_cell_width;
+
+        /// @brief Bounds of the field and units in local coordinates
+        sf::FloatRect _nd_local_bounds;
+
+        /// @brief Font page the quads were built on
+        sf::Texture const* _nd_texture;
+
+        /// @brief Glyph cache generation the quads were built at, an eviction invalidates them
+        std::uint64_t _nd_generation;
+
+        /// @brief Number of cells rewritten since construction
+        std::size_t _nd_num_cell_updates;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // There is no need for any of these operations. Widgets should be
+        // added using pointers and new, not copied or assigned as this can
+        // get a bit confusing with more complicated widgets referencing
+        // the same thing or containing pointers to other widgets etc.
+    public:
+        Numeric_display           (Numeric_display const&) = delete; ///< Copy constructor deleted
+        Numeric_display& operator=(Numeric_display const&) = delete; ///< Copy assignment deleted
+        Numeric_display           (Numeric_display&&     ) = delete; ///< Move constructor deleted
+        Numeric_display& operator=(Numeric_display&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Core Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Draws the widget to the parent window
+        void draw() override;
+
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
+        /// @brief Moves the widget and all its associated components
+        /// @param offset Vector offset to move the widget by
+        void move(sf::Vector2f const offset) override;
+
+        /// @brief Moves the widget and all its associated components
+        /// @param x X coordinate offset
+        /// @param y Y coordinate offset
+        void move(float const x, float const y) override;
+
+        /// @brief Rotates the widget and all its associated components
+        /// @param angle Rotation angle that will be added to current rotation angle
+        void rotate(sf::Angle const angle) override;
+
+    private:
+        /// @brief Final updates before drawing
+        void _update_widget() override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the value shown
+        /// @details Formats into a stack buffer and rewrites only the cells that
+        ///          changed. Never allocates.
+        /// @param value The value to show
+        void set_value(double const value);
+
+        /// @brief Set the number of cells of the field
+        /// @warning Widths of 0 or above MAX_WIDTH are clamped and give a warning log
+        /// @param width Number of cells, including the sign and decimal point
+        void set_width(std::size_t const width);
+
+        /// @brief Set the number of decimals
+        /// @warning Negative precisions are set to 0 and give a warning log
+        /// @param precision Number of digits after the decimal point, 0 for none
+        void set_precision(int const precision);
+
+        /// @brief Set the suffix drawn after the field
+        /// @param units The units, for example " ms" or "%"
+        void set_units(sf::String const& units);
+
+        /// @brief Set the widget's text character size
+        /// @details Snapped down to the nearest size of resources::DEFAULT_GLYPH_CACHE.
+        /// @param char_size Character size for the widget's text
+        void set_char_size(std::uint32_t const char_size);
+
+        /// @brief Set the widget's text color
+        /// @param color Color for the widget's text
+        void set_text_color(sf::Color const color);
+
+        /// @brief Set the widget's scale and all its associated components
+        /// @param scale Vector scale for the widget
+        void set_scale(sf::Vector2f const scale) override;
+
+        /// @brief Set the widget's scale and all its associated components
+        /// @param x X scale factor
+        /// @param y Y scale factor
+        void set_scale(float const x, float const y) override;
+
+        /// @brief Set the widget's position and all its associated components
+        /// @param pos Vector position for the widget
+        void set_pos(sf::Vector2f const pos) override;
+
+        /// @brief Set the widget's position and all its associated components
+        /// @param x X coordinate
+        /// @param y Y coordinate
+        void set_pos(float const x, float const y) override;
+
+        /// @brief Set the widget's origin and all its associated components
+        /// @param origin Vector origin for the widget
+        void set_origin(sf::Vector2f const origin) override;
+
+        /// @brief Set the widget's origin and all its associated components
+        /// @param x X origin
+        /// @param y Y origin
+        void set_origin(float const x, float const y) override;
+
+        /// @brief Set the widget's rotation and all its associated components
+        /// @param angle Angle for the rotation of the widget
+        void set_rotation(sf::Angle const angle) override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the value shown
+        /// @return double The value
+        double get_value() const;
+
+        /// @brief Get the number of cells of the field
+        /// @return std::size_t Number of cells
+        std::size_t get_width() const;
+
+        /// @brief Get the number of decimals
+        /// @return int Number of digits after the decimal point
+        int get_precision() const;
+
+        /// @brief Get the suffix drawn after the field
+        /// @return sf::String const& The units
+        sf::String const& get_units() const;
+
+        /// @brief Get the widget's text character size
+        /// @return std::uint32_t Character size after snapping
+        std::uint32_t get_char_size() const;
+
+        /// @brief Get the widget's text color
+        /// @return Color for the widget's text
+        sf::Color get_text_color() const;
+
+        /// @brief Get the number of cells rewritten since construction
+        /// @details Counts quads rewritten by value updates and rebuilds, use it to
+        ///          check a ticking value only rewrites the digits that changed.
+        /// @return std::size_t Number of cell updates
+        std::size_t get_num_cell_updates() const;
+
+        /// @brief Get the widget's scale
+        /// @return Vector scale for the widget
+        sf::Vector2f get_scale() const override;
+
+        /// @brief Get the widget's X scale
+        /// @return float X scale factor for the widget
+        float get_scale_x() const override;
+
+        /// @brief Get the widget's Y scale
+        /// @return float Y scale factor for the widget
+        float get_scale_y() const override;
+
+        /// @brief Get the widget's position
+        /// @return Vector position for the widget
+        sf::Vector2f get_pos() const override;
+
+        /// @brief Get the widget's X position
+        /// @return float X coordinate for the widget
+        float get_pos_x() const override;
+
+        /// @brief Get the widget's Y position
+        /// @return float Y coordinate for the widget
+        float get_pos_y() const override;
+
+        /// @brief Get the widget's origin
+        /// @return Vector origin for the widget
+        sf::Vector2f get_origin() const override;
+
+        /// @brief Get the widget's X origin
+        /// @return float X origin for the widget
+        float get_origin_x() const override;
+
+        /// @brief Get the widget's Y origin
+        /// @return float Y origin for the widget
+        float get_origin_y() const override;
+
+        /// @brief Get the widget's rotation angle
+        /// @return Rotation angle for the widget
+        sf::Angle get_rotation() const override;
+
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Format the value and rewrite the cells whose character changed
+        /// @return bool True if any cell was rewritten
+        bool _patch_field();
+
+        /// @brief Rewrite the quad of one cell from the glyph table
+        /// @param cell Index of the cell
+        void _write_cell(std::size_t const cell);
+
+        /// @brief Build the glyph table, every cell and the units
+        /// @details The only function that reads the font, called when the font
+        ///          size or format changes and when the font page is recreated.
+        void _rebuild();
+
+    }; // class Numeric_display
+
+} // namespace widgets
+
+#endif // NUMERIC_DISPLAY_H
@@ -0,0 +1,133 @@
+/// @file offscreen.h
+/// @brief Headless rendering helpers: render textures, pixel readback and golden-image diffs
+
+#ifndef OFFSCREEN_H
+#define OFFSCREEN_H
+
+/*
+    Offscreen rendering — render widgets without a visible window.
+
+    Quick usage:
+
+    auto target = offscreen::create_render_texture({800u, 600u});
+    auto button = std::make_unique<widgets::Push_button>(target);
+
+    target->clear(sf::Color::Black);
+    button->draw();
+
+    sf::Image const frame = offscreen::read_pixels(*target);
+    bool const ok = offscreen::compare_to_golden_file(frame, "golden/button.png", 2u);
+
+
+    Key behavior:
+
+    - Widgets accept any sf::RenderTarget as their parent, so passing the
+    shared render texture binds them to it exactly like a window.
+
+    - read_pixels() resolves the render texture (display()) and copies it
+    back to the CPU as an sf::Image.
+
+    - compare_images() tolerates a per-channel difference of `tolerance`
+    for every pixel and an optional number of pixels that may exceed it.
+
+
+    Headless machines:
+
+    - SFML still needs an OpenGL context to render into a texture. On
+    machines without a GPU or display use Mesa's software rasterizer
+    (llvmpipe), e.g. LIBGL_ALWAYS_SOFTWARE=1 under a virtual X server such
+    as Xvfb. The output is then deterministic for a given Mesa version,
+    which is what golden images should be generated with.
+*/
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+/*
+------------------------------------------------------------------------------
+Namespace offscreen BEGIN
+------------------------------------------------------------------------------
+*/
+namespace offscreen {
+
+    /// @brief Result of comparing a rendered image against a golden image
+    struct Image_diff {
+
+        /// @brief true if the images are considered equal under the tolerance
+        bool is_match = false;
+
+        /// @brief Number of pixels with a channel difference above the tolerance
+        std::size_t num_mismatched_pixels = 0u;
+
+        /// @brief Largest per-channel difference found over all pixels
+        std::uint8_t max_channel_delta = 0u;
+
+        /// @brief Visualisation of the differences
+        /// @details Mismatched pixels are red, matching pixels are a dimmed
+        ///          grey copy of the golden image. Empty if the sizes differ.
+        sf::Image diff_image;
+    };
+
+    /// @brief Create a render texture that widgets can be bound to
+    /// @param size Size of the render texture in pixels
+    /// @param anti_aliasing_level Anti-aliasing level of the render texture.
+    ///                            Keep this at 0 for golden images since
+    ///                            multisampling differs between drivers.
+    /// @return Shared render texture, or nullptr if it could not be created
+    std::shared_ptr<sf::RenderTexture> create_render_texture(
+        sf::Vector2u const size,
+        unsigned int const anti_aliasing_level = 0u
+        );
+
+    /// @brief Read back the pixels of a render texture
+    /// @details Calls display() on the render texture first so that everything
+    ///          drawn so far is resolved before copying.
+    /// @param render_texture The render texture to read back
+    /// @return sf::Image Copy of the render texture's pixels
+    sf::Image read_pixels(sf::RenderTexture& render_texture);
+
+    /// @brief Compare two images pixel by pixel
+    /// @param actual The image that was rendered
+    /// @param golden The reference image
+    /// @param tolerance Maximum allowed difference per color channel (0 - 255)
+    /// @param max_mismatched_pixels Number of pixels allowed to exceed `tolerance`
+    /// @return Image_diff Statistics and a visualisation of the differences
+    Image_diff compare_images(
+        sf::Image    const& actual,
+        sf::Image    const& golden,
+        std::uint8_t const  tolerance,
+        std::size_t  const  max_mismatched_pixels = 0u
+        );
+
+    /// @brief Compare an image against a golden image stored on disk
+    /// @details On a mismatch `<golden>.actual.png` and `<golden>.diff.png` are
+    ///          written next to the golden file. If `update_golden` is true,
+    ///          `actual` is written as the new golden. A missing golden file fails
+    ///          the comparison, `<golden>.actual.png` is written so it can be
+    ///          reviewed and renamed.
+    /// @param actual The image that was rendered
+    /// @param golden_path Path to the golden image (any format sf::Image can load)
+    /// @param tolerance Maximum allowed difference per color channel (0 - 255)
+    /// @param max_mismatched_pixels Number of pixels allowed to exceed `tolerance`
+    /// @param update_golden Overwrite the golden image with `actual`
+    /// @return true if the images match (or the golden was written on request), false otherwise
+    bool compare_to_golden_file(
+        sf::Image             const& actual,
+        std::filesystem::path const& golden_path,
+        std::uint8_t          const  tolerance,
+        std::size_t           const  max_mismatched_pixels = 0u,
+        bool                  const  update_golden         = false
+        );
+
+} // namespace offscreen
+
+#endif // OFFSCREEN_H
@@ -0,0 +1,234 @@
+/// @file piece_table.h
+/// @brief Document storage whose edits never copy the document, with a line index
+
+#ifndef PIECE_TABLE_H
+#define PIECE_TABLE_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Document storage whose edits never copy the document, with a line index
+    ///
+    /// @details The loaded text is kept as is in an original buffer and every inserted
+    ///          byte is appended to an add buffer. The document is a list of pieces,
+    ///          each a span of one of the two buffers:
+    ///
+    ///          original: [hello world]      add: [big ]
+    ///          pieces:   (original 0 6) (add 0 4) (original 6 5) = "hello big world"
+    ///
+    ///          Inserting splits at most one piece and deleting trims or drops pieces,
+    ///          so an edit costs O(number of pieces) whatever the size of the document.
+    ///          Typing at the end of the last insert grows its piece instead of adding
+    ///          one, so the pieces grow with the places edited, not with keystrokes.
+    ///
+    ///          Both buffers also keep the sorted offsets of their newlines, built
+    ///          once on load and appended to on insert. Each piece stores how many
+    ///          newlines it spans. Two Fenwick trees hold the prefix sums of the piece
+    ///          lengths and newline counts, so finding the piece of an offset or of a
+    ///          line takes O(log pieces), plus a binary search of the newlines of that
+    ///          one piece. Growing a piece updates the trees in O(log pieces), adding
+    ///          or dropping one rebuilds them in O(pieces), like shifting the pieces.
+    ///
+    ///          Offsets are in bytes of UTF-8, nothing is decoded until it is drawn.
+    class Piece_table final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty document
+        Piece_table();
+
+        /// @brief Default destructor
+        ~Piece_table() = default;
+
+    private:
+        /// @brief A span of one of the buffers
+        struct Piece {
+            bool        is_added;     ///< Whether the span is in the add buffer, otherwise the original
+            std::size_t start;        ///< First byte in its buffer
+            std::size_t length;       ///< Number of bytes
+            std::size_t num_newlines; ///< Number of '\n' in the span
+        };
+
+        /// @brief The loaded text, never modified until the next load
+        std::string _original;
+
+        /// @brief Every inserted byte, append only
+        std::string _added;
+
+        /// @brief Offsets of every '\n' in `_original`, sorted
+        std::vector<std::size_t> _original_newlines;
+
+        /// @brief Offsets of every '\n' in `_added`, sorted
+        std::vector<std::size_t> _added_newlines;
+
+        /// @brief The document, in order
+        std::vector<Piece> _pieces;
+
+        /// @brief Fenwick tree of the piece lengths, 1-based, one entry more than the pieces
+        std::vector<std::size_t> _length_tree;
+
+        /// @brief Fenwick tree of the piece newline counts, laid out like `_length_tree`
+        std::vector<std::size_t> _newline_tree;
+
+        /// @brief Number of bytes in the document
+        std::size_t _size;
+
+        /// @brief Number of '\n' in the document
+        std::size_t _num_newlines;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Piece_table           (Piece_table const&) = delete; ///< Copy constructor deleted
+        Piece_table& operator=(Piece_table const&) = delete; ///< Copy assignment deleted
+        Piece_table           (Piece_table&&     ) = delete; ///< Move constructor deleted
+        Piece_table& operator=(Piece_table&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Replace the document, taking ownership of the text without copying it
+        /// @details Scans the text once for newlines, the only O(size) step.
+        /// @param text The new document as UTF-8
+        void load(std::string&& text);
+
+        /// @brief Insert bytes
+        /// @param offset Byte offset to insert before, clamped to the size
+        /// @param text The bytes to insert
+        void insert(std::size_t const offset, std::string_view const text);
+
+        /// @brief Erase bytes
+        /// @param offset First byte to erase, clamped to the size
+        /// @param count Number of bytes to erase, clamped to the end
+        void erase(std::size_t const offset, std::size_t const count);
+
+        /// @brief Remove every byte and free both buffers
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of bytes
+        /// @return std::size_t Size of the document
+        std::size_t get_size() const;
+
+        /// @brief Get the number of lines
+        /// @return std::size_t Number of '\n' plus one
+        std::size_t get_num_lines() const;
+
+        /// @brief Get the number of pieces
+        /// @details Every operation walks the pieces, use it to check edits stay cheap.
+        /// @return std::size_t Number of pieces
+        std::size_t get_num_pieces() const;
+
+        /// @brief Get a byte
+        /// @param offset Byte offset, must be below the size
+        /// @return char The byte
+        char get_byte(std::size_t const offset) const;
+
+        /// @brief Get every byte
+        /// @return std::string The document as UTF-8
+        std::string get_text() const;
+
+        /// @brief Get a range of bytes
+        /// @param offset First byte, clamped to the size
+        /// @param count Number of bytes, clamped to the end
+        /// @return std::string The bytes in order
+        std::string get_text(std::size_t const offset, std::size_t const count) const;
+
+        /// @brief Get the offset a line starts at
+        /// @param line Line index, clamped to the last line
+        /// @return std::size_t Offset of the first byte of the line
+        std::size_t get_line_start(std::size_t const line) const;
+
+        /// @brief Get the offset a line ends at
+        /// @param line Line index, clamped to the last line
+        /// @return std::size_t Offset of the line's '\n', or the size for the last line
+        std::size_t get_line_end(std::size_t const line) const;
+
+        /// @brief Get the line containing a byte
+        /// @param offset Byte offset, clamped to the size
+        /// @return std::size_t Line index
+        std::size_t get_line_of(std::size_t const offset) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Get the buffer a piece spans
+        /// @param piece The piece
+        /// @return std::string const& `_added` or `_original`
+        std::string const& _get_buffer(Piece const& piece) const;
+
+        /// @brief Get the newline offsets of the buffer a piece spans
+        /// @param piece The piece
+        /// @return std::vector<std::size_t> const& `_added_newlines` or `_original_newlines`
+        std::vector<std::size_t> const& _get_newlines(Piece const& piece) const;
+
+        /// @brief Count the newlines in part of a buffer
+        /// @param piece Piece telling which buffer
+        /// @param start First byte in the buffer
+        /// @param length Number of bytes
+        /// @return std::size_t Number of '\n', found by binary search
+        std::size_t _count_newlines(Piece const& piece, std::size_t const start, std::size_t const length) const;
+
+        /// @brief Make a piece, counting its newlines
+        /// @param is_added Whether the span is in the add buffer
+        /// @param start First byte in its buffer
+        /// @param length Number of bytes
+        /// @return Piece The piece
+        Piece _make_piece(bool const is_added, std::size_t const start, std::size_t const length) const;
+
+        /// @brief Find the piece containing a byte
+        /// @param offset Byte offset, below the size
+        /// @param offset_in_piece Set to the offset of the byte inside the piece
+        /// @return std::size_t Index of the piece, the number of pieces if `offset` is not below the size
+        std::size_t _find_piece(std::size_t const offset, std::size_t& offset_in_piece) const;
+
+        /// @brief Build both trees again from the pieces, after pieces were added or dropped
+        void _rebuild_trees();
+
+        /// @brief Update both trees after one piece changed its length
+        /// @param index Index of the changed piece
+        /// @param before The piece before the change
+        void _update_trees(std::size_t const index, Piece const& before);
+
+        /// @brief Sum the first pieces' entries of a tree
+        /// @param tree `_length_tree` or `_newline_tree`
+        /// @param count Number of pieces to sum
+        /// @return std::size_t The sum
+        std::size_t _get_prefix_sum(std::vector<std::size_t> const& tree, std::size_t const count) const;
+
+    }; // class Piece_table
+
+} // namespace widgets
+
+#endif // PIECE_TABLE_H
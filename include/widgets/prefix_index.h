@@ -0,0 +1,192 @@
+/// @file prefix_index.h
+/// @brief Sorted, packed prefix index answering ranked completions for millions of entries
+
+#ifndef PREFIX_INDEX_H
+#define PREFIX_INDEX_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Sorted, packed prefix index answering ranked completions for millions of entries
+    ///
+    /// @details The entries are sorted once and packed back to back into one string
+    ///          with an offset and a weight per entry, about 8 bytes per entry on top
+    ///          of the text and no pointers, so 5 million words fit in well under
+    ///          100 MB.
+    ///
+    ///          Entries starting with a prefix are one contiguous Range of the sorted
+    ///          array. narrow() turns the range of a prefix into the range of that
+    ///          prefix plus one more character with one binary search, comparing a
+    ///          single byte per step, so typing narrows the previous keystroke's
+    ///          range instead of searching again.
+    ///
+    ///          get_top() returns the highest weighted entries of a range without
+    ///          visiting the rest of it. A sparse table holds the heaviest entry of
+    ///          every run of blocks, so the heaviest entry of any range is found by
+    ///          scanning two partial blocks. The top k come from splitting the range
+    ///          around each pick, about 2k such queries whatever the range's size.
+    ///
+    ///          The index is immutable once built and can be shared between widgets
+    ///          and threads. build_async() builds one on a background thread.
+    class Prefix_index final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief A string to complete to and its rank
+        struct Entry {
+
+            std::string   text;        ///< The completion, compared bytewise
+            std::uint32_t weight = 0u; ///< Higher weights are suggested first
+        };
+
+        /// @brief Entries starting with the same prefix, `[first, last)` in sorted order
+        struct Range {
+
+            std::uint32_t first = 0u; ///< First entry
+            std::uint32_t last  = 0u; ///< One past the last entry
+            std::uint32_t depth = 0u; ///< Length of the prefix the entries share
+
+            bool is_empty() const { return first == last; }
+        };
+
+        /// @brief Entries per block of the sparse table, scanned directly inside a block
+        static std::size_t constexpr BLOCK_SIZE = 32u;
+
+        /// @brief Build an index
+        /// @details Sorts the entries and keeps the highest weight of duplicates. Takes
+        ///          a second or two for millions of entries, see build_async().
+        /// @param entries The entries, consumed
+        explicit Prefix_index(std::vector<Entry> entries);
+
+        /// @brief Default destructor
+        ~Prefix_index() = default;
+
+        /// @brief Build an index on a background thread
+        /// @param entries The entries, consumed
+        /// @return std::future<std::shared_ptr<Prefix_index const>> The index, once built
+        static std::future<std::shared_ptr<Prefix_index const>> build_async(std::vector<Entry> entries);
+
+    private:
+        /// @brief Every entry's text, sorted, back to back
+        std::string _text;
+
+        /// @brief Start of each entry in `_text`, plus the end of the last one
+        std::vector<std::uint32_t> _offsets;
+
+        /// @brief Weight of each entry
+        std::vector<std::uint32_t> _weights;
+
+        /// @brief `_block_max[level][block]` is the heaviest entry of `2^level` blocks from `block`
+        std::vector<std::vector<std::uint32_t>> _block_max;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // There is no need to copy or move an index, share it with a std::shared_ptr.
+    public:
+        Prefix_index           (Prefix_index const&) = delete; ///< Copy constructor deleted
+        Prefix_index& operator=(Prefix_index const&) = delete; ///< Copy assignment deleted
+        Prefix_index           (Prefix_index&&     ) = delete; ///< Move constructor deleted
+        Prefix_index& operator=(Prefix_index&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Find the entries starting with a prefix
+        /// @param prefix The prefix
+        /// @return Range The entries, empty if none
+        Range find(std::string_view const prefix) const;
+
+        /// @brief Narrow the range of a prefix to the entries starting with a longer prefix
+        /// @details Costs one binary search within `range` per character past its depth.
+        /// @param range Range of the first `range.depth` characters of `prefix`
+        /// @param prefix The longer prefix
+        /// @return Range The entries starting with `prefix`, empty if none
+        Range narrow(Range const range, std::string_view const prefix) const;
+
+        /// @brief Get the highest weighted entries of a range, heaviest first
+        /// @details Equal weights are returned in sorted order.
+        /// @param range The range
+        /// @param count Most entries to return
+        /// @param result Receives the entry indices, cleared first
+        void get_top(Range const range, std::size_t const count, std::vector<std::uint32_t>& result) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the range of every entry
+        /// @return Range The whole index, at depth 0
+        Range get_all() const;
+
+        /// @brief Get an entry's text
+        /// @param index Entry index, below get_num_entries()
+        /// @return std::string_view The text, valid as long as the index
+        std::string_view get_text(std::uint32_t const index) const;
+
+        /// @brief Get an entry's weight
+        /// @param index Entry index, below get_num_entries()
+        /// @return std::uint32_t The weight
+        std::uint32_t get_weight(std::uint32_t const index) const;
+
+        /// @brief Get the number of entries, after removing duplicates
+        /// @return std::size_t Number of entries
+        std::size_t get_num_entries() const;
+
+        /// @brief Get the memory the index uses
+        /// @return std::size_t Bytes of text, offsets, weights and the sparse table
+        std::size_t get_num_bytes() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Get the heavier of two entries, the first in sorted order on a tie
+        /// @param first An entry
+        /// @param second Another entry
+        /// @return std::uint32_t The heavier entry
+        std::uint32_t _get_heavier(std::uint32_t const first, std::uint32_t const second) const;
+
+        /// @brief Find the heaviest entry of a range
+        /// @param first First entry
+        /// @param last One past the last entry, above `first`
+        /// @return std::uint32_t The heaviest entry
+        std::uint32_t _find_heaviest(std::uint32_t const first, std::uint32_t const last) const;
+
+        /// @brief Build the sparse table of the heaviest entry per run of blocks
+        void _build_block_max();
+
+    }; // class Prefix_index
+
+} // namespace widgets
+
+#endif // PREFIX_INDEX_H
@@ -9,10 +9,14 @@
 Includes
 ------------------------------------------------------------------------------
 */
+#include "widgets/sdf_text.h"
+#include "widgets/shared_text.h"
 #include "widgets/signals_slots.h"
 #include "widgets/widget.h"
 #include "SFML/Graphics.hpp"
 
+#include <memory>
+
 /*
 ------------------------------------------------------------------------------
 Namespace widgets BEGIN
@@ -26,6 +30,9 @@ namespace widgets {
     ///          customizable appearance including colors, text, borders,
     ///          and event handling for hover and click interactions.
     ///
+    ///          With set_sdf_font() the text is drawn from an Sdf_font, so fitting
+    ///          it to the button and set_char_size() never rasterize glyphs.
+    ///
     /// @ingroup Widgets
     class Push_button final :
         public widgets::Widget,
@@ -36,7 +43,7 @@ namespace widgets {
         ------------------------------------------------------------------------------
         */
     public:
-        /// @brief Default constructor is deleted - widgets require a parent window
+        /// @brief Default constructor is deleted - widgets require a parent render target
         Push_button() = delete;
 
         /// @brief Construct a Push_button with default values
@@ -50,18 +57,28 @@ namespace widgets {
         ///          - Text color: Black
         ///          - Border thickness: 0.0f
         ///          - Border color: Black
-        /// @param parent_window The parent window to draw the widget to
-        explicit Push_button(std::shared_ptr<sf::RenderWindow> parent_window);
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
+        explicit Push_button(std::shared_ptr<sf::RenderTarget> parent_target);
 
-        /// @brief Default destructor
-        ~Push_button() = default;
+        /// @brief Release the character size of the text
+        ~Push_button();
 
     private:
         /// @brief Rectangle shape representing the button
         sf::RectangleShape _btn_rect;
 
-        /// @brief Text label displayed on the button
-        sf::Text           _btn_text;
+        /// @brief Text label displayed on the button, its glyphs shared with identical labels
+        Shared_text        _btn_text;
+
+        /// @brief Character size requested with set_char_size(), the text is fitted below it
+        std::uint32_t      _btn_char_size;
+
+        /// @brief Text drawn instead of `_btn_text` once set_sdf_font() is called, which
+        ///        then only keeps the string and transform and is never laid out
+        std::unique_ptr<Sdf_text> _btn_sdf_text;
+
+        /// @brief Whether the text must be fitted and centered again before the next draw
+        bool               _is_layout_dirty;
 
         /*
         ------------------------------------------------------------------------------
@@ -87,6 +104,10 @@ namespace widgets {
         /// @brief Draws the widget to the parent window
         void draw() override;
 
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
         /// @brief Moves the widget and all its associated components
         /// @param offset Vector offset to move the widget by
         void move(sf::Vector2f const offset) override;
@@ -124,7 +145,9 @@ namespace widgets {
         /// @brief Set the widget's text character size
         /// @warning If this new character size causes the widget's text to go out of bounds
         ///          of the widget, then it will default to the maximum character size
-        ///          available for that size widget
+        ///          available for that size widget. Sizes are snapped down to the
+        ///          nearest size of resources::DEFAULT_GLYPH_CACHE. The text grows back
+        ///          up to this size when the button grows or the string gets shorter
         /// @param char_size Character size for the widget's text
         void set_char_size(std::uint32_t const char_size);
 
@@ -178,6 +201,14 @@ namespace widgets {
         /// @param style Style for the widget's text
         void set_text_style(std::uint32_t const& style);
 
+        /// @brief Draw the widget's text from a signed distance field font
+        /// @details Resizing the button or changing the character size then only
+        ///          rescales the text, sizes are no longer snapped to the glyph cache.
+        ///          The text style and text border are not drawn while it is set.
+        /// @param font The font to draw with, must outlive the widget, nullptr to
+        ///             draw with the bitmap font again
+        void set_sdf_font(Sdf_font* font);
+
         /// @brief Set the widget's border thickness
         /// @warning If you pass in negative values the border thickness will be
         ///          set to 0.0f and gives a warning log
@@ -220,6 +251,8 @@ namespace widgets {
         float get_size_y() const override;
 
         /// @brief Get the widget's text character size
+        /// @details The size the text was fitted to at the last draw, see set_char_size().
+        ///          Rounded down while drawn from an Sdf_font.
         /// @return Character size for the widget's text
         std::uint32_t get_char_size() const;
 
@@ -266,6 +299,10 @@ namespace widgets {
         /// @return Rotation angle for the widget
         sf::Angle get_rotation() const override;
 
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
         /// @brief Get the widget's color
         /// @warning This will not get the color of the text
         /// @return Color for the widget
@@ -283,6 +320,10 @@ namespace widgets {
         /// @return Style for the widget's text
         std::uint32_t get_text_style() const;
 
+        /// @brief Get the signed distance field font the widget's text is drawn from
+        /// @return Sdf_font* The font, nullptr when drawn with the bitmap font
+        Sdf_font* get_sdf_font() const;
+
         /// @brief Get the widget's border thickness
         /// @return Thickness for the widget's border
         float get_border_thickness() const;
@@ -325,16 +366,21 @@ namespace widgets {
         ------------------------------------------------------------------------------
         */
     private:
+        /// @brief Flag the text layout as stale and the widget as changed
+        /// @details Called by every setter that can move the text relative to the
+        ///          button, so the text is fitted and centered once before the next
+        ///          draw however many setters ran, and in whatever order.
+        void _invalidate_layout();
+
         /// @brief Center the text on the button
-        /// @details Should be called after every update to the button like setting
-        ///          its size, positioning the button, scaling the button, etc.
+        /// @details Called from `_update_widget()` when the layout is dirty.
         void _center_text_on_btn();
 
         /// @brief Fit text to button size
-        /// @details Helper function used by `_center_text_on_btn()`. It checks if
-        ///          the current character size fits for a button of this size and
-        ///          if it does not, it will decrease the character size until either
-        ///          it does fit or the character size reaches 1.
+        /// @details Helper function used by `_center_text_on_btn()`. Sets the text to
+        ///          the largest glyph cache size, up to the requested character size,
+        ///          that fits the button, using resources::DEFAULT_TEXT_FIT. Sdf text
+        ///          is scaled to fit instead.
         void _fit_text_to_btn();
 
         /// @brief Check if the mouse is hovering over the button
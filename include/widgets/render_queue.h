@@ -0,0 +1,334 @@
+/// @file render_queue.h
+/// @brief Collects draw items and reorders them to minimise GPU state changes
+
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_run.h"
+#include "widgets/sdf_text.h"
+#include "widgets/shared_text.h"
+#include "widgets/sprite_batch.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief The render state a draw item is sorted by
+    struct Render_key {
+
+        /// @brief Z-layer, lower layers are always drawn first
+        int layer = 0;
+
+        /// @brief Texture bound for the item, nullptr for untextured items
+        sf::Texture const* texture = nullptr;
+
+        /// @brief Shader bound for the item, nullptr for the fixed pipeline
+        sf::Shader const* shader = nullptr;
+
+        /// @brief Blend mode used for the item
+        sf::BlendMode blend_mode = sf::BlendAlpha;
+    };
+
+    /// @brief Collects draw items and reorders them to minimise GPU state changes
+    ///
+    /// @details Instead of drawing straight to the target, widgets push what they
+    ///          would draw into the queue with Widget::queue_draw(). submit() then
+    ///          sorts the items and draws them:
+    ///
+    ///          1. Layers are drawn in ascending order, nothing crosses a layer.
+    ///          2. Inside a layer every item gets a depth one above the deepest
+    ///             earlier item it overlaps. Items of equal depth never overlap
+    ///             each other, so they can be drawn in any order without changing
+    ///             the picture.
+    ///          3. Items of equal depth are grouped by shader, texture and blend
+    ///             mode, keeping push order inside each group.
+    ///
+    ///          Consecutive sprites that end up with the same key are merged into
+    ///          a single draw call through a Sprite_batch.
+    ///
+    ///          Typical frame:
+    ///
+    ///          @code
+    ///          for (auto& widget : widgets) widget->queue_draw(queue);
+    ///          window->clear();
+    ///          queue.submit(*window);
+    ///          window->display();
+    ///          @endcode
+    ///
+    ///          A retained queue (see set_retained()) copies what is pushed through
+    ///          the typed overloads. It then no longer depends on the widgets it was
+    ///          recorded from, and submit() keeps the items so the same frame can be
+    ///          drawn again. Snapshot_buffer uses this to hand frames to a render
+    ///          thread:
+    ///
+    ///          - Texts, glyph runs and shared texts are kept as their vertices, so
+    ///            drawing them never touches the font. sf::Text is laid out again
+    ///            through its font's Glyph_cache, without its letter and line spacing.
+    ///          - Sdf texts are copied after laying them out, so the copy never
+    ///            reads the Sdf_font's glyphs.
+    ///          - Sprites, vertex arrays and shapes are copied, they never touch a font.
+    ///          - Items sampling a font page are drawn under resources::FONT_MUTEX,
+    ///            since a glyph loaded on another thread updates the page. Items
+    ///            recorded before Glyph_cache::trim() evicted their page are skipped.
+    ///
+    /// @warning Unless the queue is retained, it only stores pointers, every pushed
+    ///          drawable must stay alive and unchanged until submit() or clear() is
+    ///          called. Drawables pushed with an explicit key are never copied.
+    class Render_queue final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty queue
+        Render_queue();
+
+        /// @brief Default destructor
+        ~Render_queue() = default;
+
+    private:
+        /// @brief A pushed draw item
+        struct Item {
+
+            Render_key          key;
+            sf::RenderStates    states;
+            sf::Drawable const* drawable    = nullptr;
+
+            /// @brief Set when the item is a sprite that can be batched
+            sf::Sprite const*   sprite      = nullptr;
+
+            /// @brief World space bounds, used to find overlapping items
+            sf::FloatRect       bounds      = {};
+
+            /// @brief Index into `_blend_modes`, blend modes have no ordering
+            std::uint32_t       blend_index = 0u;
+
+            /// @brief Overlap depth inside the layer, see the class details
+            std::uint32_t       depth       = 0u;
+
+            /// @brief Set when the item is retained and samples a page of this cache's font
+            Glyph_cache const*  glyph_cache = nullptr;
+
+            /// @brief Generation of `glyph_cache` the item was recorded at
+            std::uint64_t       generation  = 0u;
+        };
+
+        /// @brief Vertices of a text kept by a retained queue, drawing them never touches the font
+        struct Text_snapshot final : public sf::Drawable {
+
+            std::vector<sf::Vertex> vertices;
+
+            /// @brief Draw the triangles
+            /// @param target The render target to draw to
+            /// @param states Render states, including the font page
+            void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        };
+
+        /// @brief Items in push order
+        std::vector<Item> _items;
+
+        /// @brief Item indices in submission order
+        std::vector<std::size_t> _order;
+
+        /// @brief Distinct blend modes seen since the last clear
+        std::vector<sf::BlendMode> _blend_modes;
+
+        /// @brief Cell key to the earlier items touching that cell, scratch for depth assignment
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> _depth_cells;
+
+        /// @brief Items too large to bucket, scratch for depth assignment
+        std::vector<std::size_t> _large_items;
+
+        /// @brief Batch used to merge consecutive sprites during submit()
+        Sprite_batch _sprite_batch;
+
+        /// @brief Copies owned by a retained queue, deques keep their addresses stable
+        std::deque<sf::Sprite>         _retained_sprites;
+        std::deque<Text_snapshot>      _retained_texts;
+        std::deque<sf::RectangleShape> _retained_rectangles;
+        std::deque<sf::CircleShape>    _retained_circles;
+        std::deque<sf::ConvexShape>    _retained_convexes;
+        std::deque<sf::VertexArray>    _retained_vertex_arrays;
+        std::deque<Sdf_text>           _retained_sdf_texts;
+
+        /// @brief Whether typed pushes are copied and submit() keeps the items
+        bool _is_retained;
+
+        /// @brief Draw calls made by the last submit()
+        std::size_t _num_draw_calls;
+
+        /// @brief Texture, shader or blend changes made by the last submit()
+        std::size_t _num_state_changes;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Render_queue           (Render_queue const&) = delete; ///< Copy constructor deleted
+        Render_queue& operator=(Render_queue const&) = delete; ///< Copy assignment deleted
+        Render_queue           (Render_queue&&     ) = delete; ///< Move constructor deleted
+        Render_queue& operator=(Render_queue&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Push a sprite, keyed by its texture
+        /// @param layer Z-layer of the sprite
+        /// @param sprite The sprite to draw
+        /// @param states Extra render states, the texture is taken from the sprite
+        void push(int const layer, sf::Sprite const& sprite, sf::RenderStates const& states = sf::RenderStates::Default);
+
+        /// @brief Push a text, keyed by its font page texture
+        /// @param layer Z-layer of the text
+        /// @param text The text to draw
+        /// @param states Extra render states, the texture is taken from the font
+        void push(int const layer, sf::Text const& text, sf::RenderStates const& states = sf::RenderStates::Default);
+
+        /// @brief Push a glyph run, keyed by its font page texture
+        /// @param layer Z-layer of the run
+        /// @param run The run to draw
+        /// @param states Extra render states, the texture is taken from the font
+        void push(int const layer, Glyph_run const& run, sf::RenderStates const& states = sf::RenderStates::Default);
+
+        /// @brief Push a shared text, keyed by its font page texture
+        /// @param layer Z-layer of the text
+        /// @param text The text to draw
+        /// @param states Extra render states, the texture is taken from the font
+        void push(int const layer, Shared_text const& text, sf::RenderStates const& states = sf::RenderStates::Default);
+
+        /// @brief Push an sdf text, keyed by its atlas page and the font's shader
+        /// @param layer Z-layer of the text
+        /// @param text The text to draw
+        /// @param states Extra render states, the texture and shader are taken from the font
+        void push(int const layer, Sdf_text const& text, sf::RenderStates const& states = sf::RenderStates::Default);
+
+        /// @brief Push a vertex array, keyed by the texture of `states`
+        /// @param layer Z-layer of the vertices
+        /// @param vertices The vertices to draw
+        /// @param states Render states, including the texture the vertices sample
+        /// @param glyph_cache Cache of the font whose page `states` samples, nullptr
+        ///                    if the texture is not a font page
+        void push(int const layer, sf::VertexArray const& vertices, sf::RenderStates const& states, Glyph_cache const* glyph_cache = nullptr);
+
+        /// @brief Push a shape, keyed by its texture (usually none)
+        /// @details A retained queue can copy rectangle, circle and convex shapes,
+        ///          any other shape is skipped with a warning.
+        /// @param layer Z-layer of the shape
+        /// @param shape The shape to draw
+        /// @param states Extra render states, the texture is taken from the shape
+        void push(int const layer, sf::Shape const& shape, sf::RenderStates const& states = sf::RenderStates::Default);
+
+        /// @brief Push any drawable with an explicit key
+        /// @param drawable The drawable to draw
+        /// @param key The key to sort the drawable by, its texture, shader and blend
+        ///            mode replace the ones in `states`
+        /// @param bounds World space bounds of everything the drawable touches,
+        ///               used to keep overlapping items in push order
+        /// @param states Render states passed to the draw call
+        void push(
+            sf::Drawable     const& drawable,
+            Render_key       const& key,
+            sf::FloatRect    const& bounds,
+            sf::RenderStates const& states = sf::RenderStates::Default
+            );
+
+        /// @brief Move every item of another queue to the end of this one
+        /// @details Used to merge queues recorded on different threads in order.
+        ///          `other` is left empty.
+        /// @warning `other` must not be retained, its copies would be freed.
+        /// @param other The queue to take the items from
+        void append(Render_queue& other);
+
+        /// @brief Sort and draw every pushed item, then clear the queue
+        /// @details A retained queue keeps its items until clear() is called.
+        /// @param target The render target to draw to
+        void submit(sf::RenderTarget& target);
+
+        /// @brief Remove every pushed item without drawing
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set whether pushed drawables are copied into the queue
+        /// @details Clears the queue. Default is false.
+        /// @param is_retained True to copy typed pushes and keep items after submit()
+        void set_retained(bool const is_retained);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of items waiting for submit()
+        /// @return std::size_t Number of pushed items
+        std::size_t get_num_items() const;
+
+        /// @brief Get the number of draw calls made by the last submit()
+        /// @return std::size_t Number of draw calls
+        std::size_t get_num_draw_calls() const;
+
+        /// @brief Get the number of texture, shader or blend changes made by the last submit()
+        /// @return std::size_t Number of state changes
+        std::size_t get_num_state_changes() const;
+
+        /// @brief Get whether pushed drawables are copied into the queue
+        /// @return bool True if the queue is retained
+        bool is_retained() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Keep the vertices of a run and push them, retained queues only
+        /// @param layer Z-layer of the run
+        /// @param run The run to keep, laid out through its glyph cache
+        /// @param states Render states, the run's transform is added to them
+        /// @param bounds World space bounds of the run
+        void _push_snapshot(int const layer, Glyph_run const& run, sf::RenderStates states, sf::FloatRect const& bounds);
+
+        /// @brief Get the index of a blend mode in `_blend_modes`, adding it if new
+        /// @param blend_mode The blend mode to look up
+        /// @return std::uint32_t Index of the blend mode
+        std::uint32_t _get_blend_index(sf::BlendMode const& blend_mode);
+
+        /// @brief Give every item its overlap depth inside its layer
+        void _assign_depths();
+
+        /// @brief Draw the merged sprites and count the draw call
+        /// @param target The render target to draw to
+        /// @param states Render states of the merged sprites
+        void _flush_sprites(sf::RenderTarget& target, sf::RenderStates const& states);
+
+    }; // class Render_queue
+
+} // namespace widgets
+
+#endif // RENDER_QUEUE_H
@@ -12,6 +12,9 @@ Includes
 #include "widgets/log.h"
 #include "SFML/Graphics.hpp"
 
+#include <filesystem>
+#include <mutex>
+
 /*
 ------------------------------------------------------------------------------
 Namespace resources BEGIN
@@ -38,6 +41,27 @@ Object Constants
     /// @brief Default widget font
     inline sf::Font DEFAULT_WIDGET_FONT;
 
+    /// @brief File the default widget font is loaded from
+    inline std::filesystem::path const DEFAULT_WIDGET_FONT_PATH = "assets/default_font.otf";
+
+    /// @brief Guards glyph loading of every font used by widgets
+    /// @details sf::Font loads glyphs lazily the first time text is laid out, which
+    ///          is not thread safe. Glyph_cache locks this for every lookup it has to
+    ///          ask the font, text widgets never touch a font directly. A retained
+    ///          Render_queue locks it around draw calls sampling a font page.
+    inline std::mutex FONT_MUTEX;
+
+    /// @brief Get the empty texture used by sprite widgets built from an invalid atlas region
+    /// @details Created on first use rather than at static initialization, since a
+    ///          texture needs an OpenGL context.
+    /// @return sf::Texture const& The empty texture
+    inline sf::Texture const& GET_EMPTY_TEXTURE() {
+
+        static sf::Texture const empty_texture;
+
+        return empty_texture;
+    }
+
 /*
 ------------------------------------------------------------------------------
 Load all resources
@@ -55,7 +79,7 @@ Load all resources
             // Resources are already loaded so dont load again.
         } else {
 
-            if (!DEFAULT_WIDGET_FONT.openFromFile("assets/default_font.otf")) {
+            if (!DEFAULT_WIDGET_FONT.openFromFile(DEFAULT_WIDGET_FONT_PATH)) {
 
                 LOG(ERROR) << "Error loading resource [DEFAULT_WIDGET_FONT].";
             }
@@ -0,0 +1,379 @@
+/// @file rich_label.h
+/// @brief A label of styled spans drawn as one vertex batch per font page
+
+#ifndef RICH_LABEL_H
+#define RICH_LABEL_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_run.h"
+#include "widgets/signals_slots.h"
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief A label of styled spans drawn as one vertex batch per font page
+    ///
+    /// @details Each span has its own text, colors, style, character size and
+    ///          outline, and the spans flow one after the other like a single
+    ///          string. A '\n' in a span starts a new line. Spans on a line share
+    ///          a baseline below the tallest of them.
+    ///
+    ///          Every line of a span is laid out by its own Glyph_run, and the span
+    ///          keeps the quads of its runs relative to where each line starts. The
+    ///          quads of all spans with the same character size, which share a font
+    ///          page, are copied into one vertex array, so the label costs one draw
+    ///          call per character size used (and one more for each outlined size)
+    ///          instead of one per span.
+    ///
+    ///          Updates stay at the span level:
+    ///          - A new color rewrites the colors of that span in place, no layout.
+    ///          - New text, style, size or outline lays out that span only, and its
+    ///            runs only look up the characters that changed. The other spans
+    ///            keep their quads and are just moved.
+    ///          - If the span keeps its number of vertices, only its quads and those
+    ///            of the spans it moved are copied into their pages.
+    ///
+    ///          A status line of five differently colored parts is one widget and
+    ///          one draw call instead of five labels placed by hand.
+    ///
+    /// @ingroup Widgets
+    class Rich_label final :
+        public widgets::Widget,
+        public signals_slots::Signals_slots {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief A run of text sharing one look
+        struct Span {
+
+            sf::String    text;                                         ///< The characters, may contain '\n'
+            sf::Color     fill_color        = sf::Color::Black;         ///< Color of the glyphs and lines
+            std::uint32_t style             = sf::Text::Style::Regular; ///< Combination of sf::Text::Style flags
+            std::uint32_t char_size         = 30u;                      ///< Snapped to resources::DEFAULT_GLYPH_CACHE
+            float         outline_thickness = 0.0f;                     ///< Outline thickness in pixels, 0 for none
+            sf::Color     outline_color     = sf::Color::Black;         ///< Color of the outline
+        };
+
+        /// @brief Default constructor is deleted - widgets require a parent render target
+        Rich_label() = delete;
+
+        /// @brief Construct a Rich_label with default values
+        /// @details This constructor initializes a Rich_label with the default values:
+        ///          - Position: (0, 0)
+        ///          - Spans: Either `spans` parameter or none if parameter is omitted
+        ///          - Text Font: Default font defined in constants
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
+        /// @param spans The spans of the label
+        explicit Rich_label(std::shared_ptr<sf::RenderTarget> parent_target, std::vector<Span> spans = {});
+
+        /// @brief Release the character sizes of the text
+        ~Rich_label();
+
+    private:
+        /// @brief Marks that a span has no quads and is in no page
+        static std::size_t constexpr NO_PAGE = static_cast<std::size_t>(-1);
+
+        /// @brief A line of a span, its quads are in the span's vertices
+        struct Segment {
+
+            std::size_t   fill_end    = 0u;           ///< One past its last fill vertex
+            std::size_t   outline_end = 0u;           ///< One past its last outline vertex
+            std::size_t   line        = 0u;           ///< Line of the label it is placed on
+            float         width       = 0.0f;         ///< Pen advance from its start to its end
+            sf::FloatRect bounds;                     ///< Bounds of its quads, empty without glyphs
+            sf::Vector2f  origin      = {0.0f, 0.0f}; ///< Where its pen starts, on the baseline
+        };
+
+        /// @brief Quads of a span relative to the origin of each of its segments
+        struct Span_layout {
+
+            std::vector<Glyph_run>  runs;                     ///< One per segment, its quads are copied out with the baseline at 0
+            std::vector<sf::Vertex> fill_vertices;
+            std::vector<sf::Vertex> outline_vertices;
+            std::vector<Segment>    segments;
+            sf::Texture const*      texture        = nullptr; ///< Font page the quads were built on
+            std::size_t             page           = NO_PAGE; ///< Page the quads are copied into
+            std::size_t             fill_offset    = 0u;      ///< First fill vertex in the page
+            std::size_t             outline_offset = 0u;      ///< First outline vertex in the page
+            bool                    is_moved       = false;   ///< Whether the last placement moved a segment
+        };
+
+        /// @brief The quads of every span sharing a character size, drawn at once
+        struct Page {
+
+            std::uint32_t      char_size = 0u;
+            sf::Texture const* texture   = nullptr; ///< Font page of `char_size`
+            sf::VertexArray    fill_vertices;
+            sf::VertexArray    outline_vertices;
+        };
+
+        /// @brief Position, origin, rotation and scale of the widget
+        sf::Transformable _rl_transform;
+
+        /// @brief The spans, character sizes snapped
+        std::vector<Span> _rl_spans;
+
+        /// @brief Quads and placement of each span
+        std::vector<Span_layout> _rl_layouts;
+
+        /// @brief One batch per character size in use
+        std::vector<Page> _rl_pages;
+
+        /// @brief Bounds of every span in local coordinates
+        sf::FloatRect _rl_local_bounds;
+
+        /// @brief Whether the pages must be filled again before drawing
+        bool _rl_is_pages_dirty;
+
+        /// @brief Glyph cache generation the quads were built at, an eviction invalidates them
+        std::uint64_t _rl_generation;
+
+        /// @brief Number of glyphs looked up since construction
+        std::size_t _rl_num_glyph_updates;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // There is no need for any of these operations. Widgets should be
+        // added using pointers and new, not copied or assigned as this can
+        // get a bit confusing with more complicated widgets referencing
+        // the same thing or containing pointers to other widgets etc.
+    public:
+        Rich_label           (Rich_label const&) = delete; ///< Copy constructor deleted
+        Rich_label& operator=(Rich_label const&) = delete; ///< Copy assignment deleted
+        Rich_label           (Rich_label&&     ) = delete; ///< Move constructor deleted
+        Rich_label& operator=(Rich_label&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Core Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Draws the widget to the parent window
+        void draw() override;
+
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
+        /// @brief Moves the widget and all its associated components
+        /// @param offset Vector offset to move the widget by
+        void move(sf::Vector2f const offset) override;
+
+        /// @brief Moves the widget and all its associated components
+        /// @param x X coordinate offset
+        /// @param y Y coordinate offset
+        void move(float const x, float const y) override;
+
+        /// @brief Rotates the widget and all its associated components
+        /// @param angle Rotation angle that will be added to current rotation angle
+        void rotate(sf::Angle const angle) override;
+
+        /// @brief Add a span after the last one
+        /// @param span The span to add
+        /// @return std::size_t Index of the new span
+        std::size_t add_span(Span span);
+
+        /// @brief Remove every span
+        void clear_spans();
+
+    private:
+        /// @brief Final updates before drawing
+        void _update_widget() override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Replace every span
+        /// @details Spans equal to the ones at the same index keep their quads, so
+        ///          setting the same list with one part changed only lays out that part.
+        /// @param spans The new spans
+        void set_spans(std::vector<Span> spans);
+
+        /// @brief Replace a span
+        /// @details Only recolors when just the colors differ from the current span.
+        /// @warning If you pass an index past the last span nothing changes and gives
+        ///          a warning log
+        /// @param index Index of the span
+        /// @param span The new span
+        void set_span(std::size_t const index, Span span);
+
+        /// @brief Set the text of a span, only its glyphs are looked up
+        /// @warning If you pass an index past the last span nothing changes and gives
+        ///          a warning log
+        /// @param index Index of the span
+        /// @param text The new text
+        void set_span_text(std::size_t const index, sf::String const& text);
+
+        /// @brief Set the fill color of a span, recolored in place without layout
+        /// @warning If you pass an index past the last span nothing changes and gives
+        ///          a warning log
+        /// @param index Index of the span
+        /// @param color The new fill color
+        void set_span_fill_color(std::size_t const index, sf::Color const color);
+
+        /// @brief Set the widget's scale and all its associated components
+        /// @param scale Vector scale for the widget
+        void set_scale(sf::Vector2f const scale) override;
+
+        /// @brief Set the widget's scale and all its associated components
+        /// @param x X scale factor
+        /// @param y Y scale factor
+        void set_scale(float const x, float const y) override;
+
+        /// @brief Set the widget's position and all its associated components
+        /// @param pos Vector position for the widget
+        void set_pos(sf::Vector2f const pos) override;
+
+        /// @brief Set the widget's position and all its associated components
+        /// @param x X coordinate
+        /// @param y Y coordinate
+        void set_pos(float const x, float const y) override;
+
+        /// @brief Set the widget's origin and all its associated components
+        /// @param origin Vector origin for the widget
+        void set_origin(sf::Vector2f const origin) override;
+
+        /// @brief Set the widget's origin and all its associated components
+        /// @param x X origin
+        /// @param y Y origin
+        void set_origin(float const x, float const y) override;
+
+        /// @brief Set the widget's rotation and all its associated components
+        /// @param angle Angle for the rotation of the widget
+        void set_rotation(sf::Angle const angle) override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get every span
+        /// @return std::vector<Span> const& The spans, character sizes snapped
+        std::vector<Span> const& get_spans() const;
+
+        /// @brief Get the number of spans
+        /// @return std::size_t Number of spans
+        std::size_t get_num_spans() const;
+
+        /// @brief Get the number of vertex batches, one per character size in use
+        /// @details Each batch is one draw call, plus one for its outlines if any
+        ///          of its spans has an outline.
+        /// @return std::size_t Number of pages
+        std::size_t get_num_pages() const;
+
+        /// @brief Get the number of glyphs looked up since construction
+        /// @details Grows by the characters the runs of a span laid out again, use it
+        ///          to check an update only touches the part that changed.
+        /// @return std::size_t Number of glyph lookups
+        std::size_t get_num_glyph_updates() const;
+
+        /// @brief Get the widget's scale
+        /// @return Vector scale for the widget
+        sf::Vector2f get_scale() const override;
+
+        /// @brief Get the widget's X scale
+        /// @return float X scale factor for the widget
+        float get_scale_x() const override;
+
+        /// @brief Get the widget's Y scale
+        /// @return float Y scale factor for the widget
+        float get_scale_y() const override;
+
+        /// @brief Get the widget's position
+        /// @return Vector position for the widget
+        sf::Vector2f get_pos() const override;
+
+        /// @brief Get the widget's X position
+        /// @return float X coordinate for the widget
+        float get_pos_x() const override;
+
+        /// @brief Get the widget's Y position
+        /// @return float Y coordinate for the widget
+        float get_pos_y() const override;
+
+        /// @brief Get the widget's origin
+        /// @return Vector origin for the widget
+        sf::Vector2f get_origin() const override;
+
+        /// @brief Get the widget's X origin
+        /// @return float X origin for the widget
+        float get_origin_x() const override;
+
+        /// @brief Get the widget's Y origin
+        /// @return float Y origin for the widget
+        float get_origin_y() const override;
+
+        /// @brief Get the widget's rotation angle
+        /// @return Rotation angle for the widget
+        sf::Angle get_rotation() const override;
+
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Replace a span, laying it out again only if more than its colors changed
+        /// @param index Index of the span
+        /// @param span The new span
+        /// @return bool True if the span was laid out again and the spans must be placed
+        bool _replace_span(std::size_t const index, Span span);
+
+        /// @brief Lay out the runs of a span and copy out their quads
+        /// @param index Index of the span
+        void _build_span(std::size_t const index);
+
+        /// @brief Rewrite the colors of a span, in its page too if the pages are current
+        /// @param index Index of the span
+        void _recolor_span(std::size_t const index);
+
+        /// @brief Place every segment on its line and compute the bounds, no font lookups
+        /// @details Flags the spans whose segments moved.
+        void _place_spans();
+
+        /// @brief Copy the quads of every span into the page of its character size
+        void _build_pages();
+
+        /// @brief Copy the quads of a span to where its segments are placed in its page
+        /// @param index Index of the span, its page and offsets must be current
+        void _copy_span_to_page(std::size_t const index);
+
+        /// @brief Check an index names a span, with a warning log if not
+        /// @param index Index of the span
+        /// @return bool True if the index is below the number of spans
+        bool _is_valid_span(std::size_t const index) const;
+
+    }; // class Rich_label
+
+} // namespace widgets
+
+#endif // RICH_LABEL_H
@@ -0,0 +1,200 @@
+/// @file sdf_font.h
+/// @brief Glyphs rasterized once as signed distance fields, drawable at any size
+
+#ifndef SDF_FONT_H
+#define SDF_FONT_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/texture_atlas.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief A glyph stored in an Sdf_font, metrics are at the font's base size
+    struct Sdf_glyph {
+
+        /// @brief Distance to the next pen position
+        float advance = 0.0f;
+
+        /// @brief Bounds of the visible glyph relative to the pen on the baseline
+        sf::FloatRect bounds = {};
+
+        /// @brief Bounds of the textured quad, `bounds` grown by the spread
+        sf::FloatRect quad = {};
+
+        /// @brief Where the distance field lives in the atlas
+        Atlas_region region = {};
+    };
+
+    /// @brief Glyphs rasterized once as signed distance fields, drawable at any size
+    ///
+    /// @details sf::Text rasterizes a new glyph set for every character size it
+    ///          is drawn at, so auto-fitting, scaling or zooming text costs CPU time
+    ///          and texture memory. An Sdf_font rasterizes each glyph once at the
+    ///          base size and stores, for every pixel, the distance to the nearest
+    ///          glyph edge (inside is above 0.5, outside below). Sdf_text draws those
+    ///          fields at any size, scale or view zoom with a small fragment shader
+    ///          that turns the distance back into a sharp, antialiased edge.
+    ///
+    ///          Without shader support the font stores antialiased coverage at the
+    ///          base size instead, which is drawn with linear filtering. It looks
+    ///          like a scaled bitmap but still never rasterizes again.
+    ///
+    ///          Glyphs are added on demand by load_glyphs(), which Sdf_text calls
+    ///          whenever its string changes. One font may be shared by texts laid
+    ///          out on several threads: the glyphs, kerning pairs and atlas are
+    ///          guarded by the font's own lock, and only glyphs or pairs never
+    ///          looked up before ask the sf::Font under resources::FONT_MUTEX.
+    ///
+    /// @warning The sf::Font must outlive the Sdf_font, and the Sdf_font must
+    ///          outlive every Sdf_text using it.
+    class Sdf_font final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - an sdf font requires a font
+        Sdf_font() = delete;
+
+        /// @brief Construct an sdf font and load the printable ASCII glyphs
+        /// @param font The font to rasterize glyphs from
+        /// @param base_size Character size glyphs are rasterized at, larger sizes
+        ///                  keep sharper corners at high magnification
+        /// @param spread Distance in pixels at the base size the field reaches
+        ///               outside the glyph, at least 1
+        explicit Sdf_font(
+            sf::Font     const& font,
+            unsigned int const  base_size = 48u,
+            float        const  spread    = 6.0f
+            );
+
+        /// @brief Default destructor
+        ~Sdf_font() = default;
+
+    private:
+        /// @brief The font glyphs are rasterized from
+        sf::Font const& _font;
+
+        /// @brief Character size glyphs are rasterized at
+        unsigned int _base_size;
+
+        /// @brief Distance in pixels at the base size the field reaches outside the glyph
+        float _spread;
+
+        /// @brief Packed distance fields (or coverage without shaders)
+        Texture_atlas _atlas;
+
+        /// @brief Loaded glyphs by code point, never changed or removed once loaded
+        std::unordered_map<char32_t, Sdf_glyph> _glyphs;
+
+        /// @brief Kerning at the base size of every pair looked up, by both code points
+        mutable std::unordered_map<std::uint64_t, float> _kernings;
+
+        /// @brief Guards `_atlas`, `_glyphs` and `_kernings`, shared for lookups
+        mutable std::shared_mutex _lookup_mutex;
+
+        /// @brief Distance between two baselines at the base size
+        float _line_spacing;
+
+        /// @brief Turns distances back into edges, only loaded with shader support
+        sf::Shader _shader;
+
+        /// @brief Whether the shader loaded, false uses the coverage fallback
+        bool _is_using_shader;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Sdf_font           (Sdf_font const&) = delete; ///< Copy constructor deleted
+        Sdf_font& operator=(Sdf_font const&) = delete; ///< Copy assignment deleted
+        Sdf_font           (Sdf_font&&     ) = delete; ///< Move constructor deleted
+        Sdf_font& operator=(Sdf_font&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Rasterize every glyph of a string that is not loaded yet
+        /// @details Costs one glyph rasterization and distance transform per new
+        ///          glyph, nothing for glyphs already loaded.
+        /// @param string The characters to load
+        /// @return true if every glyph is loaded, false if the atlas ran out of room
+        bool load_glyphs(sf::String const& string);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get a loaded glyph
+        /// @param code_point The character to look up
+        /// @return Sdf_glyph const* The glyph, valid as long as the font, nullptr if it is not loaded
+        Sdf_glyph const* get_glyph(char32_t const code_point) const;
+
+        /// @brief Get the kerning between two characters
+        /// @details Each pair is read from the font once and kept.
+        /// @param first The character on the left
+        /// @param second The character on the right
+        /// @param char_size Character size the text is drawn at
+        /// @return float Offset added to the pen position
+        float get_kerning(char32_t const first, char32_t const second, float const char_size) const;
+
+        /// @brief Get the distance between two baselines
+        /// @param char_size Character size the text is drawn at
+        /// @return float Line spacing in pixels
+        float get_line_spacing(float const char_size) const;
+
+        /// @brief Get the shader Sdf_text draws with
+        /// @return sf::Shader const* The shader, nullptr when using the coverage fallback
+        sf::Shader const* get_shader() const;
+
+        /// @brief Get the font glyphs are rasterized from
+        /// @return sf::Font const& The font
+        sf::Font const& get_font() const;
+
+        /// @brief Get the character size glyphs are rasterized at
+        /// @return unsigned int Base size
+        unsigned int get_base_size() const;
+
+        /// @brief Get the number of loaded glyphs
+        /// @return std::size_t Number of glyphs
+        std::size_t get_num_glyphs() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Turn a rasterized glyph into a distance field (or coverage) image
+        /// @param glyph_image The glyph as rasterized by the font, coverage in alpha
+        /// @return sf::Image The glyph grown by the spread on every side
+        sf::Image _make_field(sf::Image const& glyph_image) const;
+
+    }; // class Sdf_font
+
+} // namespace widgets
+
+#endif // SDF_FONT_H
@@ -0,0 +1,191 @@
+/// @file sdf_text.h
+/// @brief Text drawn from an Sdf_font, resizing and scaling never rasterize glyphs
+
+#ifndef SDF_TEXT_H
+#define SDF_TEXT_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/sdf_font.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Text drawn from an Sdf_font, resizing and scaling never rasterize glyphs
+    ///
+    /// @details Works like sf::Text for a single style: the string is laid out
+    ///          left to right from the origin, '\n' starts a new line. The
+    ///          character size is a float and may change every frame, along with
+    ///          the scale and the view zoom, without loading anything. Only
+    ///          characters the font has never seen are rasterized, once.
+    ///
+    ///          Glyphs are drawn as textured quads with the font's shader, one
+    ///          draw call per atlas page used (usually one).
+    class Sdf_text final : public sf::Drawable, public sf::Transformable {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - sdf text requires a font
+        Sdf_text() = delete;
+
+        /// @brief Construct sdf text
+        /// @param font The font to draw with, must outlive the text
+        /// @param string The string to draw
+        /// @param char_size Character size in pixels
+        explicit Sdf_text(
+            Sdf_font&         font,
+            sf::String const& string    = "",
+            float      const  char_size = 30.0f
+            );
+
+        /// @brief Default destructor
+        ~Sdf_text() override = default;
+
+    private:
+        /// @brief The triangles drawn from one atlas page
+        struct Page_vertices {
+
+            sf::Texture const*      texture = nullptr;
+            std::vector<sf::Vertex> vertices;
+        };
+
+        /// @brief The font glyphs are taken from
+        Sdf_font* _font;
+
+        /// @brief The string to draw
+        sf::String _string;
+
+        /// @brief Character size in pixels
+        float _char_size;
+
+        /// @brief Color of the glyphs
+        sf::Color _fill_color;
+
+        /// @brief Glyph quads grouped by atlas page, rebuilt lazily
+        mutable std::vector<Page_vertices> _pages;
+
+        /// @brief Pen position before each character, plus one for the end of the string
+        mutable std::vector<float> _pen_x;
+
+        /// @brief Bounds of the visible glyphs in local coordinates
+        mutable sf::FloatRect _local_bounds;
+
+        /// @brief Whether `_pages` and `_local_bounds` must be rebuilt
+        mutable bool _is_geometry_dirty;
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Draw the glyphs
+        /// @param target The render target to draw to
+        /// @param states Render states, the transform is combined with the text's
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    public:
+        /// @brief Set the largest character size, not above `max_size`, that fits a box
+        /// @details The layout scales linearly with the character size, so one layout
+        ///          at `max_size` gives the answer, no sizes are searched or rasterized.
+        ///          Compares the local bounds, ignoring the text's transform.
+        /// @param box_size Size the local bounds must fit in
+        /// @param max_size Largest character size to use
+        /// @return float The character size the text is set to
+        float fit(sf::Vector2f const box_size, float const max_size);
+
+        /// @brief Find the caret position closest to a point
+        /// @param local_x X coordinate in the text's local coordinates
+        /// @return std::size_t Character index the caret would be before
+        /// @warning Only meant for strings without line breaks.
+        std::size_t find_char_index(float const local_x) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the font, loading any glyph of the string it is missing
+        /// @param font The font to draw with, must outlive the text
+        void set_font(Sdf_font& font);
+
+        /// @brief Set the string, loading any glyph the font is missing
+        /// @param string The string to draw
+        void set_string(sf::String const& string);
+
+        /// @brief Set the character size, never rasterizes glyphs
+        /// @param char_size Character size in pixels, negative values are clamped to 0
+        void set_char_size(float const char_size);
+
+        /// @brief Set the color of the glyphs
+        /// @param color Fill color
+        void set_fill_color(sf::Color const color);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the string
+        /// @return sf::String const& The string drawn
+        sf::String const& get_string() const;
+
+        /// @brief Get the character size
+        /// @return float Character size in pixels
+        float get_char_size() const;
+
+        /// @brief Get the color of the glyphs
+        /// @return sf::Color Fill color
+        sf::Color get_fill_color() const;
+
+        /// @brief Get the font glyphs are taken from
+        /// @return Sdf_font& The font
+        Sdf_font& get_font() const;
+
+        /// @brief Get the atlas page of the first glyph, the only page unless the atlas filled up
+        /// @return sf::Texture const* The page, nullptr if no glyph is visible
+        sf::Texture const* get_texture() const;
+
+        /// @brief Get the pen position before a character
+        /// @param index Character index, clamped to the size for the end of the string
+        /// @return float X coordinate in local coordinates
+        float get_char_x(std::size_t const index) const;
+
+        /// @brief Get the bounds of the visible glyphs before the transform
+        /// @return sf::FloatRect Local bounds
+        sf::FloatRect get_local_bounds() const;
+
+        /// @brief Get the bounds of the visible glyphs after the transform
+        /// @return sf::FloatRect Global bounds
+        sf::FloatRect get_global_bounds() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Lay out the string into glyph quads if it changed
+        void _update_geometry() const;
+
+    }; // class Sdf_text
+
+} // namespace widgets
+
+#endif // SDF_TEXT_H
@@ -0,0 +1,211 @@
+/// @file shared_text.h
+/// @brief Text that shares its glyph vertices with every text showing the same string
+
+#ifndef SHARED_TEXT_H
+#define SHARED_TEXT_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_run.h"
+#include "widgets/text_geometry_cache.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Text that shares its glyph vertices with every text showing the same string
+    ///
+    /// @details Used like sf::Text, but only stores its settings, its transform and a
+    ///          reference counted pointer to geometry from a Text_geometry_cache.
+    ///          Texts with the same font, size, style, colors, outline and string
+    ///          point to the same vertices, laid out once, and apply their own
+    ///          transform when drawing. Copying a Shared_text copies the pointer.
+    ///
+    ///          Setters only record the change, the geometry is acquired again the
+    ///          next time the text is drawn or measured.
+    ///
+    ///          Like sf::Text, measuring or drawing may lay the string out. Layout
+    ///          goes through the font's Glyph_cache, so it can run on any thread.
+    class Shared_text final : public sf::Drawable, public sf::Transformable {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - a shared text requires a font
+        Shared_text() = delete;
+
+        /// @brief Construct an empty text
+        /// @param font The font to draw with, must outlive the text
+        /// @param char_size Character size in pixels
+        /// @param cache The cache geometry is shared through, must outlive the text
+        explicit Shared_text(
+            sf::Font            const& font,
+            unsigned int        const  char_size = 30u,
+            Text_geometry_cache&       cache     = resources::DEFAULT_TEXT_GEOMETRY_CACHE
+            );
+
+        /// @brief Default destructor
+        ~Shared_text() override = default;
+
+    private:
+        /// @brief The cache geometry is shared through
+        Text_geometry_cache* _cache;
+
+        /// @brief The font to draw with
+        sf::Font const* _font;
+
+        /// @brief The string to draw
+        std::u32string _string;
+
+        /// @brief Character size in pixels
+        unsigned int _char_size;
+
+        /// @brief sf::Text::Style flags
+        std::uint32_t _style;
+
+        /// @brief Color of the glyphs
+        sf::Color _fill_color;
+
+        /// @brief Thickness of the glyph outline, 0 for none
+        float _outline_thickness;
+
+        /// @brief Color of the glyph outline
+        sf::Color _outline_color;
+
+        /// @brief Shared geometry, at the origin
+        mutable std::shared_ptr<Glyph_run const> _geometry;
+
+        /// @brief Whether a setting changed since `_geometry` was acquired
+        mutable bool _is_geometry_dirty;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // Copies share the geometry.
+    public:
+        Shared_text           (Shared_text const&) = default; ///< Copy constructor
+        Shared_text& operator=(Shared_text const&) = default; ///< Copy assignment
+        Shared_text           (Shared_text&&     ) = default; ///< Move constructor
+        Shared_text& operator=(Shared_text&&     ) = default; ///< Move assignment
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Draw the shared geometry with this text's transform
+        /// @param target The render target to draw to
+        /// @param states Render states, the texture is taken from the font
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the string
+        /// @param string The string to draw
+        void set_string(sf::String const& string);
+
+        /// @brief Set the font
+        /// @param font The font to draw with, must outlive the text
+        void set_font(sf::Font const& font);
+
+        /// @brief Set the character size
+        /// @param char_size Character size in pixels
+        void set_char_size(unsigned int const char_size);
+
+        /// @brief Set the style
+        /// @param style sf::Text::Style flags
+        void set_style(std::uint32_t const style);
+
+        /// @brief Set the color of the glyphs
+        /// @param color Fill color
+        void set_fill_color(sf::Color const color);
+
+        /// @brief Set the thickness of the glyph outline
+        /// @param thickness Outline thickness, 0 for none
+        void set_outline_thickness(float const thickness);
+
+        /// @brief Set the color of the glyph outline
+        /// @param color Outline color
+        void set_outline_color(sf::Color const color);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the string
+        /// @return sf::String The string
+        sf::String get_string() const;
+
+        /// @brief Get the font
+        /// @return sf::Font const& The font
+        sf::Font const& get_font() const;
+
+        /// @brief Get the character size
+        /// @return unsigned int Character size in pixels
+        unsigned int get_char_size() const;
+
+        /// @brief Get the style
+        /// @return std::uint32_t sf::Text::Style flags
+        std::uint32_t get_style() const;
+
+        /// @brief Get the color of the glyphs
+        /// @return sf::Color Fill color
+        sf::Color get_fill_color() const;
+
+        /// @brief Get the thickness of the glyph outline
+        /// @return float Outline thickness
+        float get_outline_thickness() const;
+
+        /// @brief Get the color of the glyph outline
+        /// @return sf::Color Outline color
+        sf::Color get_outline_color() const;
+
+        /// @brief Get the bounds of the glyphs, without the transform
+        /// @return sf::FloatRect Local bounds
+        sf::FloatRect get_local_bounds() const;
+
+        /// @brief Get the bounds of the glyphs, with the transform
+        /// @return sf::FloatRect Global bounds
+        sf::FloatRect get_global_bounds() const;
+
+        /// @brief Get the shared geometry
+        /// @details Other texts showing the same string hold the same pointer.
+        /// @return std::shared_ptr<Glyph_run const> Geometry at the origin
+        std::shared_ptr<Glyph_run const> get_geometry() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Acquire the geometry again if a setting changed or its font page was evicted
+        void _update_geometry() const;
+
+    }; // class Shared_text
+
+} // namespace widgets
+
+#endif // SHARED_TEXT_H
@@ -0,0 +1,160 @@
+/// @file snapshot_buffer.h
+/// @brief Hands recorded frames from a logic thread to a render thread without locking
+
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/render_queue.h"
+#include "SFML/Graphics.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Hands recorded frames from a logic thread to a render thread without locking
+    ///
+    /// @details Widget setters change the same SFML objects draw() reads, so
+    ///          updating and drawing normally have to take turns. The buffer
+    ///          removes that by letting the logic thread record each frame into a
+    ///          retained Render_queue, which keeps text as plain vertices and copies
+    ///          everything else it is given. Once recorded, the frame no longer
+    ///          depends on the widgets and the render thread can draw it while the
+    ///          logic thread builds the next one. Drawing never touches a font, only
+    ///          the draw calls sampling a font page lock resources::FONT_MUTEX.
+    ///
+    ///          Three queues rotate between the two threads: the back queue being
+    ///          recorded, the front queue being drawn and a ready queue holding the
+    ///          newest finished frame. publish() and acquire() swap with the ready
+    ///          queue through one atomic exchange, so neither thread ever waits for
+    ///          the other. If the logic thread publishes faster than frames are
+    ///          drawn, the older unseen frame is dropped. If it is slower, the render
+    ///          thread draws the last frame again.
+    ///
+    ///          Logic thread:
+    ///
+    ///          @code
+    ///          widgets::Render_queue& frame = snapshots.begin_frame();
+    ///          for (auto& widget : widgets) widget->queue_draw(frame);
+    ///          snapshots.publish();
+    ///          @endcode
+    ///
+    ///          Render thread:
+    ///
+    ///          @code
+    ///          snapshots.acquire();
+    ///          window->clear();
+    ///          snapshots.submit(*window);
+    ///          window->display();
+    ///          @endcode
+    ///
+    /// @warning begin_frame() and publish() must only be called from one thread,
+    ///          acquire() and submit() from one other thread. Call Glyph_cache::trim()
+    ///          from the logic thread between frames, items recorded before an
+    ///          eviction are skipped. Textures and fonts are shared with the copies,
+    ///          not copied, and must outlive them.
+    class Snapshot_buffer final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct a buffer with three empty retained queues
+        Snapshot_buffer();
+
+        /// @brief Default destructor
+        ~Snapshot_buffer() = default;
+
+    private:
+        /// @brief Set in `_ready` while the ready queue holds a frame the render thread has not taken
+        static constexpr std::uint32_t FRESH_BIT = 0x4u;
+
+        /// @brief Masks the queue index out of `_ready`
+        static constexpr std::uint32_t INDEX_MASK = 0x3u;
+
+        /// @brief The three rotating queues
+        std::array<Render_queue, 3> _queues;
+
+        /// @brief Queue the logic thread records into, only touched by the logic thread
+        std::uint32_t _back_index;
+
+        /// @brief Queue the render thread draws, only touched by the render thread
+        std::uint32_t _front_index;
+
+        /// @brief Index of the ready queue, plus FRESH_BIT if it was not taken yet
+        std::atomic<std::uint32_t> _ready;
+
+        /// @brief Number of frames published
+        std::atomic<std::uint64_t> _num_published;
+
+        /// @brief Number of frames replaced before the render thread took them
+        std::atomic<std::uint64_t> _num_dropped;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Snapshot_buffer           (Snapshot_buffer const&) = delete; ///< Copy constructor deleted
+        Snapshot_buffer& operator=(Snapshot_buffer const&) = delete; ///< Copy assignment deleted
+        Snapshot_buffer           (Snapshot_buffer&&     ) = delete; ///< Move constructor deleted
+        Snapshot_buffer& operator=(Snapshot_buffer&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Start recording a frame, logic thread only
+        /// @return Render_queue& The cleared back queue to record into
+        Render_queue& begin_frame();
+
+        /// @brief Make the recorded frame the newest one, logic thread only
+        void publish();
+
+        /// @brief Take the newest published frame if there is one, render thread only
+        /// @return bool True if a new frame was taken, false to keep the current one
+        bool acquire();
+
+        /// @brief Draw the current frame, render thread only
+        /// @param target The render target to draw to
+        void submit(sf::RenderTarget& target);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of frames published
+        /// @return std::uint64_t Number of published frames
+        std::uint64_t get_num_published() const;
+
+        /// @brief Get the number of frames replaced before the render thread took them
+        /// @return std::uint64_t Number of dropped frames
+        std::uint64_t get_num_dropped() const;
+
+        /// @brief Get the queue submit() draws, for its statistics, render thread only
+        /// @return Render_queue const& The front queue
+        Render_queue const& get_front_queue() const;
+
+    }; // class Snapshot_buffer
+
+} // namespace widgets
+
+#endif // SNAPSHOT_BUFFER_H
@@ -0,0 +1,236 @@
+/// @file spatial_grid.h
+/// @brief Uniform grid spatial index for culling widgets against the current view
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Get the world space area covered by a view
+    /// @details Rotated views return the axis aligned box around the rotated area.
+    /// @param view The view to get the bounds of
+    /// @return sf::FloatRect Axis aligned world space bounds of the view
+    sf::FloatRect get_view_bounds(sf::View const& view);
+
+    /// @brief Check if two rectangles overlap or touch
+    /// @details Unlike sf::Rect::findIntersection this treats zero sized rectangles
+    ///          (e.g. a widget that has not been sized yet) as points that can overlap.
+    /// @param a First rectangle
+    /// @param b Second rectangle
+    /// @return true if the rectangles overlap, false otherwise
+    bool is_overlapping(sf::FloatRect const& a, sf::FloatRect const& b);
+
+    /// @brief Uniform grid spatial index over widget bounds
+    ///
+    /// @details Widgets are bucketed into fixed size cells by their global bounds so
+    ///          that the widgets inside an area (usually the current view) are found
+    ///          by visiting only the cells covering that area, instead of scanning
+    ///          every widget. Widgets that span very many cells are kept in a separate
+    ///          list that is always tested directly.
+    ///
+    ///          The grid does not watch widgets. After moving, resizing, scaling or
+    ///          rotating a registered widget call update() for it (or update_all()
+    ///          after a bulk change) so that it is re-bucketed.
+    ///
+    ///          The grid only stores non owning pointers, widgets must be removed
+    ///          before they are destroyed.
+    class Spatial_grid final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty grid
+        /// @param cell_size Width and height of a grid cell in world units. A good
+        ///                  value is a few times the size of a typical widget.
+        explicit Spatial_grid(float const cell_size = 256.0f);
+
+        /// @brief Default destructor
+        ~Spatial_grid() = default;
+
+    private:
+        /// @brief Inclusive range of cells covered by a widget
+        struct Cell_range {
+
+            std::int32_t min_x = 0;
+            std::int32_t min_y = 0;
+            std::int32_t max_x = 0;
+            std::int32_t max_y = 0;
+        };
+
+        /// @brief A registered widget
+        struct Entry {
+
+            /// @brief The widget, nullptr if this slot is free
+            Widget*       widget      = nullptr;
+
+            /// @brief Cells the widget is currently bucketed in
+            Cell_range    cells       = {};
+
+            /// @brief true if the widget spans too many cells to bucket
+            bool          is_oversize = false;
+
+            /// @brief Registration order, used to keep drawing order stable
+            std::uint64_t order       = 0u;
+
+            /// @brief Last query that visited this entry, used for de-duplication
+            std::uint64_t query_stamp = 0u;
+        };
+
+        /// @brief Width and height of a cell in world units
+        float _cell_size;
+
+        /// @brief All entries, free slots have a nullptr widget
+        std::vector<Entry> _entries;
+
+        /// @brief Free slots in `_entries` that can be reused
+        std::vector<std::size_t> _free_slots;
+
+        /// @brief Widget to slot lookup
+        std::unordered_map<Widget const*, std::size_t> _slot_lookup;
+
+        /// @brief Cell key to the slots bucketed in that cell
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> _cells;
+
+        /// @brief Slots of widgets that span too many cells to bucket
+        std::vector<std::size_t> _oversize_slots;
+
+        /// @brief Next registration order value
+        std::uint64_t _next_order;
+
+        /// @brief Stamp of the current query
+        std::uint64_t _query_stamp;
+
+        /// @brief Registration order and slot of each hit of the last query, sorted before copying out
+        std::vector<std::pair<std::uint64_t, std::size_t>> _query_hits;
+
+        /// @brief Result of the last query, reused to avoid allocations
+        std::vector<Widget*> _query_result;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Spatial_grid           (Spatial_grid const&) = delete; ///< Copy constructor deleted
+        Spatial_grid& operator=(Spatial_grid const&) = delete; ///< Copy assignment deleted
+        Spatial_grid           (Spatial_grid&&     ) = delete; ///< Move constructor deleted
+        Spatial_grid& operator=(Spatial_grid&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Register a widget with the grid
+        /// @warning Inserting a widget that is already registered only updates it
+        /// @param widget The widget to register
+        void insert(Widget& widget);
+
+        /// @brief Unregister a widget from the grid
+        /// @param widget The widget to unregister
+        void remove(Widget& widget);
+
+        /// @brief Re-bucket a widget after its bounds changed
+        /// @param widget The widget to update
+        void update(Widget& widget);
+
+        /// @brief Re-bucket every registered widget
+        void update_all();
+
+        /// @brief Unregister all widgets
+        void clear();
+
+        /// @brief Find the widgets whose bounds overlap an area
+        /// @details Visits the cells covering `area`, or only the occupied cells if
+        ///          there are fewer of those, so a zoomed out view costs no more than
+        ///          the widgets in the grid. The result is sorted by registration
+        ///          order. The returned vector is reused by the next query.
+        /// @param area World space area to search
+        /// @return std::vector<Widget*> const& Widgets overlapping `area`
+        std::vector<Widget*> const& query(sf::FloatRect const& area);
+
+        /// @brief Find the widgets visible in a render target's current view
+        /// @param target The render target whose view is used
+        /// @return std::vector<Widget*> const& Widgets overlapping the view
+        std::vector<Widget*> const& query_view(sf::RenderTarget const& target);
+
+        /// @brief Draw the widgets visible in a render target's current view
+        /// @details Widgets are drawn in registration order, widgets outside the
+        ///          view are never visited.
+        /// @param target The render target whose view is used for culling
+        void draw_visible(sf::RenderTarget const& target);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of registered widgets
+        /// @return std::size_t Number of registered widgets
+        std::size_t get_size() const;
+
+        /// @brief Get the cell size of the grid
+        /// @return float Width and height of a cell in world units
+        float get_cell_size() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Get the cells covered by an area
+        /// @param area World space area
+        /// @return Cell_range Inclusive range of covered cells
+        Cell_range _get_cell_range(sf::FloatRect const& area) const;
+
+        /// @brief Get the cell covering a coordinate on one axis
+        /// @details Cells are clamped so infinite, huge or NaN coordinates never
+        ///          overflow the cast and cell counts still fit in 64 bits.
+        /// @param coord World space coordinate
+        /// @return std::int32_t Cell index along the axis
+        std::int32_t _get_cell_coord(float const coord) const;
+
+        /// @brief Pack cell coordinates into a single key
+        /// @param x Cell x coordinate
+        /// @param y Cell y coordinate
+        /// @return std::uint64_t Key for `_cells`
+        static std::uint64_t _get_cell_key(std::int32_t const x, std::int32_t const y);
+
+        /// @brief Add a slot to the cells covered by its widget
+        /// @param slot Slot in `_entries`
+        void _bucket(std::size_t const slot);
+
+        /// @brief Remove a slot from the cells it is bucketed in
+        /// @param slot Slot in `_entries`
+        void _unbucket(std::size_t const slot);
+
+    }; // class Spatial_grid
+
+} // namespace widgets
+
+#endif // SPATIAL_GRID_H
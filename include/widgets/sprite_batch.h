@@ -0,0 +1,120 @@
+/// @file sprite_batch.h
+/// @brief Collects sprites and draws each run of same-texture sprites in one call
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Collects sprites and draws each run of same-texture sprites in one call
+    ///
+    /// @details Every added sprite is transformed on the CPU into two triangles, so
+    ///          consecutive sprites that share a texture end up in one vertex range
+    ///          and are drawn with a single draw call and texture bind. Sprites built
+    ///          from the regions of one Texture_atlas page therefore cost one call
+    ///          no matter how many there are.
+    ///
+    ///          Drawing order is the order the sprites were added in, a texture
+    ///          change simply starts a new run.
+    ///
+    ///          Typical frame:
+    ///
+    ///          @code
+    ///          batch.clear();
+    ///          for (auto& icon : icons) icon->batch_draw(batch);
+    ///          batch.draw(*window);
+    ///          @endcode
+    class Sprite_batch final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty batch
+        Sprite_batch();
+
+        /// @brief Default destructor
+        ~Sprite_batch() = default;
+
+    private:
+        /// @brief A run of vertices that share a texture
+        struct Run {
+
+            sf::Texture const* texture      = nullptr;
+            std::size_t        first_vertex = 0u;
+            std::size_t        num_vertices = 0u;
+        };
+
+        /// @brief Vertices of every added sprite, 6 per sprite
+        std::vector<sf::Vertex> _vertices;
+
+        /// @brief Same-texture runs in drawing order
+        std::vector<Run> _runs;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Sprite_batch           (Sprite_batch const&) = delete; ///< Copy constructor deleted
+        Sprite_batch& operator=(Sprite_batch const&) = delete; ///< Copy assignment deleted
+        Sprite_batch           (Sprite_batch&&     ) = delete; ///< Move constructor deleted
+        Sprite_batch& operator=(Sprite_batch&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Add a sprite to the batch
+        /// @details The sprite's transform, texture rectangle and color are copied, so
+        ///          the sprite can change after being added.
+        /// @param sprite The sprite to add
+        void add(sf::Sprite const& sprite);
+
+        /// @brief Draw every added sprite, one call per same-texture run
+        /// @param target The render target to draw to
+        /// @param states Render states applied to the whole batch, the texture is
+        ///               replaced by each run's texture
+        void draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) const;
+
+        /// @brief Remove every sprite, keeps the allocated memory for the next frame
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of sprites in the batch
+        /// @return std::size_t Number of sprites
+        std::size_t get_num_sprites() const;
+
+        /// @brief Get the number of draw calls draw() will make
+        /// @return std::size_t Number of same-texture runs
+        std::size_t get_num_draw_calls() const;
+
+    }; // class Sprite_batch
+
+} // namespace widgets
+
+#endif // SPRITE_BATCH_H
@@ -10,6 +10,8 @@ Includes
 ------------------------------------------------------------------------------
 */
 #include "widgets/signals_slots.h"
+#include "widgets/sprite_batch.h"
+#include "widgets/texture_atlas.h"
 #include "widgets/widget.h"
 
 #include "SFML/Graphics.hpp"
@@ -36,7 +38,7 @@ namespace widgets {
         // Construction / Destruction
         // =========================================================================
     public:
-        /// @brief Default constructor is deleted - widgets require a parent window
+        /// @brief Default constructor is deleted - widgets require a parent render target
         Sprite_button() = delete;
 
         /// @brief Construct a Sprite_button with a texture
@@ -44,25 +46,35 @@ namespace widgets {
         ///          your chosen texture and the default values:
         ///          - Scale: The scale of the texture passed in by `texture`
         ///          - Position: (0, 0)
-        /// @param parent_window The parent window to draw the widget to
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
         /// @param texture The texture that will be applied to the sprite button
-        Sprite_button(std::shared_ptr<sf::RenderWindow> parent_window, sf::Texture const& texture);
+        Sprite_button(std::shared_ptr<sf::RenderTarget> parent_target, sf::Texture const& texture);
 
         /// @brief Construct a Sprite_button with a texture and texture rectangle
         /// @details This constructor initializes a Sprite_button with
         ///          your chosen texture, texture rectangle, and the default values:
         ///          - Scale: The scale of the texture passed in by `texture`
         ///          - Position: (0, 0)
-        /// @param parent_window The parent window to draw the widget to
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
         /// @param texture The texture that will be applied to the sprite button
         /// @param texture_rect This rectangle defines a section of `texture` that will be
         ///                     displayed as the texture of the sprite button
         Sprite_button(
-            std::shared_ptr<sf::RenderWindow> parent_window,
+            std::shared_ptr<sf::RenderTarget> parent_target,
             sf::Texture const& texture,
             sf::IntRect const  texture_rect
             );
 
+        /// @brief Construct a Sprite_button from a texture atlas region
+        /// @details Widgets built from regions of the same atlas page share one
+        ///          texture, so batch_draw() can draw all of them in one call.
+        ///          Default values:
+        ///          - Size: The size of the region
+        ///          - Position: (0, 0)
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
+        /// @param region Region of a built Texture_atlas, the atlas must outlive the widget
+        Sprite_button(std::shared_ptr<sf::RenderTarget> parent_target, Atlas_region const& region);
+
         /// @brief Default destructor
         ~Sprite_button() = default;
 
@@ -90,6 +102,17 @@ namespace widgets {
         /// @brief Draws the widget to the parent window
         void draw() override;
 
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
+        /// @brief Adds the widget to a sprite batch instead of drawing it directly
+        /// @details Applies the same hidden and outside view checks as draw().
+        ///          Consecutive widgets sharing a texture are drawn in one call
+        ///          when the batch is drawn.
+        /// @param batch The batch to add the widget's sprite to
+        void batch_draw(Sprite_batch& batch);
+
         /// @brief Moves the widget and all its associated components
         /// @param offset Vector offset to move the widget by
         void move(sf::Vector2f const offset) override;
@@ -186,6 +209,10 @@ namespace widgets {
         /// @return sf::Angle Rotation angle for the widget
         sf::Angle get_rotation() const override;
 
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
         // =========================================================================
         // Signals / Slots
         // =========================================================================
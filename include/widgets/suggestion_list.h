@@ -0,0 +1,221 @@
+/// @file suggestion_list.h
+/// @brief Scrolling list of suggestions that only lays out its visible rows
+
+#ifndef SUGGESTION_LIST_H
+#define SUGGESTION_LIST_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_run.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    class Render_queue; // See render_queue.h
+
+    /// @brief Scrolling list of suggestions that only lays out its visible rows
+    ///
+    /// @details Draws a dropdown of rows below a text field. Only a fixed pool of
+    ///          glyph runs, one per visible row, exists whatever the number of items,
+    ///          and they are laid out again only when the items, the scroll
+    ///          position or the style change. Moving the highlight past the
+    ///          visible rows scrolls the list.
+    ///
+    ///          Used by Line_edit for autocomplete, drawn axis aligned.
+    class Suggestion_list final : public sf::Drawable {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Marks that no item is highlighted or found
+        static std::size_t constexpr NO_ITEM = static_cast<std::size_t>(-1);
+
+        /// @brief Default constructor is deleted - a suggestion list requires a font
+        Suggestion_list() = delete;
+
+        /// @brief Construct an empty list
+        /// @param font The font to draw with, must outlive the list
+        explicit Suggestion_list(sf::Font const& font);
+
+        /// @brief Default destructor
+        ~Suggestion_list() override = default;
+
+    private:
+        /// @brief The font to draw with
+        sf::Font const* _font;
+
+        /// @brief Every item, only the visible ones are laid out
+        std::vector<std::string> _items;
+
+        /// @brief One run per visible row
+        mutable std::vector<Glyph_run> _row_runs;
+
+        /// @brief Background behind the visible rows
+        mutable sf::RectangleShape _background;
+
+        /// @brief Bar behind the highlighted row
+        mutable sf::RectangleShape _highlight;
+
+        /// @brief Top left corner of the list
+        sf::Vector2f _position;
+
+        /// @brief Width of the list
+        float _width;
+
+        /// @brief Character size of the rows
+        unsigned int _char_size;
+
+        /// @brief Most rows shown at once
+        std::size_t _num_rows;
+
+        /// @brief Item shown in the first row
+        std::size_t _first_item;
+
+        /// @brief Highlighted item, NO_ITEM for none
+        std::size_t _highlighted;
+
+        /// @brief Color of the row texts
+        sf::Color _text_color;
+
+        /// @brief Whether the rows must be laid out again before drawing
+        mutable bool _is_layout_dirty;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Suggestion_list           (Suggestion_list const&) = delete; ///< Copy constructor deleted
+        Suggestion_list& operator=(Suggestion_list const&) = delete; ///< Copy assignment deleted
+        Suggestion_list           (Suggestion_list&&     ) = delete; ///< Move constructor deleted
+        Suggestion_list& operator=(Suggestion_list&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Queue the background, highlight and visible rows
+        /// @param queue The queue to push to
+        /// @param layer Layer to push on
+        void queue_draw(Render_queue& queue, int const layer) const;
+
+        /// @brief Move the highlight, scrolling to keep it visible
+        /// @details Without a highlight, moving down highlights the first item and
+        ///          moving up the last.
+        /// @param offset Number of items to move, negative to move up
+        void move_highlight(int const offset);
+
+        /// @brief Find the item under a point
+        /// @param point Point in world coordinates
+        /// @return std::size_t The item, NO_ITEM if the point is not over a visible row
+        std::size_t find_item_at(sf::Vector2f const point) const;
+
+    private:
+        /// @brief Draw the background, highlight and visible rows
+        /// @param target The render target to draw to
+        /// @param states Render states to draw with
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Replace the items, clearing the highlight and scrolling to the top
+        /// @param items The items
+        void set_items(std::vector<std::string> items);
+
+        /// @brief Highlight an item, scrolling to keep it visible
+        /// @param item The item, NO_ITEM to clear the highlight
+        void set_highlighted(std::size_t const item);
+
+        /// @brief Set the top left corner of the list
+        /// @param position Position in world coordinates
+        void set_position(sf::Vector2f const position);
+
+        /// @brief Set the width of the list
+        /// @param width Width in pixels
+        void set_width(float const width);
+
+        /// @brief Set the character size of the rows
+        /// @param char_size Character size in pixels
+        void set_char_size(unsigned int const char_size);
+
+        /// @brief Set the most rows shown at once
+        /// @param num_rows Number of rows, at least 1
+        void set_num_rows(std::size_t const num_rows);
+
+        /// @brief Set the color of the row texts
+        /// @param color Text color
+        void set_text_color(sf::Color const color);
+
+        /// @brief Set the color behind the rows
+        /// @param color Background color
+        void set_background_color(sf::Color const color);
+
+        /// @brief Set the color behind the highlighted row
+        /// @param color Highlight color
+        void set_highlight_color(sf::Color const color);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the items
+        /// @return std::vector<std::string> const& Every item
+        std::vector<std::string> const& get_items() const;
+
+        /// @brief Get the highlighted item
+        /// @return std::size_t The item, NO_ITEM for none
+        std::size_t get_highlighted() const;
+
+        /// @brief Get the most rows shown at once
+        /// @return std::size_t Number of rows
+        std::size_t get_num_rows() const;
+
+        /// @brief Get the area the visible rows cover
+        /// @return sf::FloatRect Bounds in world coordinates, empty without items
+        sf::FloatRect get_global_bounds() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Get the height of one row
+        /// @return float Row height in pixels
+        float _get_row_height() const;
+
+        /// @brief Get the number of rows shown
+        /// @return std::size_t The visible rows, at most the number of items
+        std::size_t _get_num_visible() const;
+
+        /// @brief Set the strings and positions of the visible rows if anything changed
+        void _update_layout() const;
+
+    }; // class Suggestion_list
+
+} // namespace widgets
+
+#endif // SUGGESTION_LIST_H
@@ -0,0 +1,521 @@
+/// @file text_editor.h
+/// @brief A multi-line text editor widget for documents of many megabytes
+
+#ifndef TEXT_EDITOR_H
+#define TEXT_EDITOR_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/edit_history.h"
+#include "widgets/glyph_run.h"
+#include "widgets/piece_table.h"
+#include "widgets/signals_slots.h"
+#include "widgets/widget.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief A multi-line text editor widget for documents of many megabytes
+    ///
+    /// @details The document lives in a Piece_table as UTF-8, so opening a file reads
+    ///          it and scans it for newlines once, and an edit costs the same in a
+    ///          ten line file as in a ten megabyte one. Nothing outside the view is
+    ///          decoded or laid out:
+    ///
+    ///          - Only the visible lines get a Glyph_run. Runs are reused by line
+    ///            number, so scrolling by one line lays out one new line, and a
+    ///            run only lays out again when the text of its line changed.
+    ///          - The visible lines are clipped to the widget on the CPU into one
+    ///            vertex array. It is only rebuilt after an edit, a scroll or a
+    ///            style change, every other frame draws three vertex arrays and
+    ///            queue_draw() does no GL work, so it is safe on worker threads.
+    ///
+    ///          The mouse wheel scrolls smoothly, easing towards the wheel's target
+    ///          over a few frames. While typing, the arrow keys, Home, End, Page Up
+    ///          and Page Down move the cursor, with shift selecting and control
+    ///          moving to the start or end of the document for Home and End.
+    ///          Backspace, Delete, Enter, Tab, Ctrl+A and Ctrl+V work as usual and
+    ///          clicking or dragging places the cursor or selects. Ctrl+Z undoes and
+    ///          Ctrl+Y or Ctrl+Shift+Z redoes, from an Edit_history that keeps only
+    ///          the inserted and erased bytes, never copies of the document.
+    ///
+    ///          The editor is drawn axis aligned, it cannot be rotated or scaled.
+    ///          Lines ending in "\r\n" are shown and edited like lines ending in "\n"
+    ///          and saved unchanged.
+    ///
+    /// @ingroup Widgets
+    class Text_editor final :
+        public widgets::Widget,
+        public signals_slots::Signals_slots {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - widgets require a parent render target
+        Text_editor() = delete;
+
+        /// @brief Construct an empty Text_editor with default values
+        /// @details This constructor initializes a Text_editor with the default values:
+        ///          - Position: (0, 0)
+        ///          - Size: (600, 400)
+        ///          - Text Font: Default font defined in constants
+        ///          - Text Character Size: 20 pixels
+        ///          - Text color: Black
+        ///          - Fill color: White
+        ///          - Border: No border
+        /// @param parent_target The parent render target (window or render texture) to draw the widget to
+        /// @param size Size of the widget
+        explicit Text_editor(
+            std::shared_ptr<sf::RenderTarget> parent_target,
+            sf::Vector2f const size = {600.0f, 400.0f}
+            );
+
+        /// @brief Release the character size of the lines
+        ~Text_editor();
+
+    private:
+        /// @brief Background and border of the widget
+        sf::RectangleShape _te_rect;
+
+        /// @brief The document as UTF-8
+        Piece_table _te_document;
+
+        /// @brief Inserted and erased bytes, for undo and redo
+        Edit_history<std::string> _te_history;
+
+        /// @brief One run per visible line, line `n` uses the run at `n % size`
+        std::vector<Glyph_run> _te_line_runs;
+
+        /// @brief Highlight behind the selected lines, relative to `_te_rect`
+        sf::VertexArray _te_selection;
+
+        /// @brief Glyphs of the visible lines clipped to `_te_rect`, rebuilt only when `_is_view_dirty`
+        sf::VertexArray _te_text;
+
+        /// @brief Bar drawn at the cursor while typing, relative to `_te_rect`
+        sf::VertexArray _te_caret;
+
+        /// @brief Font page `_te_text` samples
+        sf::Texture const* _te_page;
+
+        /// @brief Glyph cache generation `_te_text` was built in
+        std::uint64_t _te_generation;
+
+        /// @brief Character size of every line
+        std::uint32_t _te_char_size;
+
+        /// @brief Color of every line
+        sf::Color _te_text_color;
+
+        /// @brief Byte offset of the cursor in the document
+        std::size_t _te_cursor;
+
+        /// @brief End of the selection the cursor does not sit at, equal to the cursor when none
+        std::size_t _te_anchor;
+
+        /// @brief Column moving up or down aims for, kept across short lines
+        std::size_t _te_goal_column;
+
+        /// @brief Whether `_te_goal_column` is set, moving left, right or editing clears it
+        bool _has_goal_column;
+
+        /// @brief Horizontal scroll in pixels
+        float _scroll_x;
+
+        /// @brief Vertical scroll in pixels, eases towards `_scroll_target_y`
+        float _scroll_y;
+
+        /// @brief Vertical scroll the wheel asked for
+        float _scroll_target_y;
+
+        /// @brief Time since the scroll last eased
+        sf::Clock _scroll_clock;
+
+        /// @brief Whether a left mouse drag is extending the selection
+        bool _is_selecting;
+
+        /// @brief Whether `_te_text`, `_te_selection` and `_te_caret` must be rebuilt
+        bool _is_view_dirty;
+
+        /// @brief Whether the horizontal scroll must bring the cursor into view on the next redraw
+        bool _is_cursor_moved;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // There is no need for any of these operations. Widgets should be
+        // added using pointers and new, not copied or assigned as this can
+        // get a bit confusing with more complicated widgets referencing
+        // the same thing or containing pointers to other widgets etc.
+    public:
+        Text_editor           (Text_editor const&) = delete; ///< Copy constructor deleted
+        Text_editor& operator=(Text_editor const&) = delete; ///< Copy assignment deleted
+        Text_editor           (Text_editor&&     ) = delete; ///< Move constructor deleted
+        Text_editor& operator=(Text_editor&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Core Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Draws the widget to the parent window
+        void draw() override;
+
+        /// @brief Pushes the widget's drawables into a render queue on its layer
+        /// @details Redraws the visible lines first if needed, so the queuing thread
+        ///          must be able to activate an OpenGL context.
+        /// @param queue The queue to push into
+        void queue_draw(Render_queue& queue) override;
+
+        /// @brief Moves the widget and all its associated components
+        /// @param offset Vector offset to move the widget by
+        void move(sf::Vector2f const offset) override;
+
+        /// @brief Moves the widget and all its associated components
+        /// @param x X coordinate offset
+        /// @param y Y coordinate offset
+        void move(float const x, float const y) override;
+
+        /// @brief Replace the document with a file
+        /// @details Reads the file in one go and indexes its lines, nothing is decoded.
+        ///          Clears the undo history.
+        /// @param path Path to a UTF-8 or ASCII text file
+        /// @return true if the file was read, false and a warning log otherwise
+        bool load_file(std::filesystem::path const& path);
+
+        /// @brief Write the document to a file
+        /// @param path Path to write to, replaced if it exists
+        /// @return true if the file was written, false and a warning log otherwise
+        bool save_file(std::filesystem::path const& path) const;
+
+        /// @brief Insert text at the cursor, replacing any selection
+        /// @param text UTF-8 text, may span several lines
+        void insert_text(std::string_view const text);
+
+        /// @brief Insert the clipboard at the cursor, replacing any selection
+        /// @details Bound to Ctrl+V while typing. The whole clipboard is one edit of
+        ///          the document and one redraw, however long it is.
+        void paste();
+
+        /// @brief Delete the selection, or the character before the cursor like backspace
+        void delete_char();
+
+        /// @brief Delete the selection, or the character after the cursor like the delete key
+        void delete_char_after();
+
+        /// @brief Move the cursor by a number of characters
+        /// @details Without extending, a selection collapses to the side moved towards.
+        /// @param offset Number of characters to move, negative to move left
+        /// @param is_extending Whether to extend the selection instead of clearing it
+        void move_cursor(int const offset, bool const is_extending = false);
+
+        /// @brief Move the cursor by a number of lines, keeping its column
+        /// @param offset Number of lines to move, negative to move up
+        /// @param is_extending Whether to extend the selection instead of clearing it
+        void move_cursor_lines(int const offset, bool const is_extending = false);
+
+        /// @brief Select the whole document
+        void select_all();
+
+        /// @brief Revert the last edit, a typed word, a paste or a deleted selection
+        /// @details Bound to Ctrl+Z while typing. Costs the size of the edit, not of the document.
+        void undo();
+
+        /// @brief Apply the last undone edit again
+        /// @details Bound to Ctrl+Y and Ctrl+Shift+Z while typing.
+        void redo();
+
+        /// @brief Scroll by a number of pixels, easing there over a few frames
+        /// @param pixels Distance to scroll, negative to scroll up
+        void scroll_by(float const pixels);
+
+        /// @brief Scroll a line to the top of the widget at once
+        /// @param line Line index, clamped to the document
+        void scroll_to_line(std::size_t const line);
+
+    private:
+        /// @brief Eases the scroll towards its target
+        void _update_widget() override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Replace the document
+        /// @details Clears the undo history.
+        /// @param text UTF-8 text
+        void set_text(std::string_view const text);
+
+        /// @brief Place the cursor
+        /// @param offset Byte offset, clamped to the document and moved back to the
+        ///        start of the character it falls in
+        /// @param is_extending Whether to extend the selection instead of clearing it
+        void set_cursor(std::size_t const offset, bool const is_extending = false);
+
+        /// @brief Set the widget's size, also the size of the visible area
+        /// @param size Vector size for the widget
+        void set_size(sf::Vector2f const size) override;
+
+        /// @brief Set the widget's size, also the size of the visible area
+        /// @param x Width
+        /// @param y Height
+        void set_size(float const x, float const y) override;
+
+        /// @brief Set the widget's position and all its associated components
+        /// @param pos Vector position for the widget
+        void set_pos(sf::Vector2f const pos) override;
+
+        /// @brief Set the widget's position and all its associated components
+        /// @param x X coordinate
+        /// @param y Y coordinate
+        void set_pos(float const x, float const y) override;
+
+        /// @brief Set the widget's text character size
+        /// @param char_size Character size for every line, quantized by the glyph cache
+        void set_char_size(std::uint32_t const char_size);
+
+        /// @brief Set the widget's text color
+        /// @param color Color for every line
+        void set_text_color(sf::Color const color);
+
+        /// @brief Set the widget's background color
+        /// @param color Fill color for the widget
+        void set_background_color(sf::Color const color);
+
+        /// @brief Set the widget's border thickness
+        /// @warning If you pass in negative values the border thickness will be
+        ///          set to 0.0f and gives a warning log
+        /// @param thickness Thickness for the widget's border
+        void set_border_thickness(float const thickness);
+
+        /// @brief Set the widget's border color
+        /// @param color Color for the widget's border
+        void set_border_color(sf::Color const color);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the document
+        /// @return std::string The document as UTF-8
+        std::string get_text() const;
+
+        /// @brief Get the selected text
+        /// @return std::string The selection as UTF-8, empty if there is none
+        std::string get_selected_text() const;
+
+        /// @brief Get whether any text is selected
+        /// @return bool true if there is a selection
+        bool has_selection() const;
+
+        /// @brief Get the cursor
+        /// @return std::size_t Byte offset of the cursor in the document
+        std::size_t get_cursor() const;
+
+        /// @brief Get the line the cursor is on
+        /// @return std::size_t Line index
+        std::size_t get_cursor_line() const;
+
+        /// @brief Get the number of lines
+        /// @return std::size_t Number of lines in the document
+        std::size_t get_num_lines() const;
+
+        /// @brief Get the storage of the document
+        /// @return Piece_table const& The document
+        Piece_table const& get_document() const;
+
+        /// @brief Get the widget's text character size
+        /// @return Character size for every line
+        std::uint32_t get_char_size() const;
+
+        /// @brief Get the widget's size
+        /// @return Vector size for the widget
+        sf::Vector2f get_size() const override;
+
+        /// @brief Get the widget's width
+        /// @return float Width for the widget
+        float get_size_x() const override;
+
+        /// @brief Get the widget's height
+        /// @return float Height for the widget
+        float get_size_y() const override;
+
+        /// @brief Get the widget's position
+        /// @return Vector position for the widget
+        sf::Vector2f get_pos() const override;
+
+        /// @brief Get the widget's X position
+        /// @return float X coordinate for the widget
+        float get_pos_x() const override;
+
+        /// @brief Get the widget's Y position
+        /// @return float Y coordinate for the widget
+        float get_pos_y() const override;
+
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @return sf::FloatRect Axis aligned bounds for the widget
+        sf::FloatRect get_global_bounds() const override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Signals / Slots
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Handle hover events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Checks if the mouse is within the bounds of our rectangle and
+        ///          if it is then a hovering signal will be emitted.
+        /// @param event The SFML event to process
+        void _handle_hover(sf::Event const& event) override;
+
+        /// @brief Handle text entered events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          While typing, printable characters, Enter and Tab are inserted at
+        ///          the cursor, then the base class signals are emitted.
+        /// @param event The SFML event to process
+        void _handle_text_entered_events(sf::Event const& event) override;
+
+        /// @brief Handle mouse button press events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          A left click inside the widget starts typing and places the cursor,
+        ///          a left click outside stops typing.
+        /// @param event The SFML event to process
+        void _handle_mouse_button_pressed_events(sf::Event const& event) override;
+
+        /// @brief Handle mouse button release events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Ends a drag selection, then emits the base class signals.
+        /// @param event The SFML event to process
+        void _handle_mouse_button_release_events(sf::Event const& event) override;
+
+        /// @brief Handle mouse moved events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Extends the selection to the mouse while dragging, then emits the
+        ///          base class signals.
+        /// @param event The SFML event to process
+        void _handle_mouse_moved_events(sf::Event const& event) override;
+
+        /// @brief Handle mouse wheel events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Scrolls three lines per notch while hovering, then emits the base
+        ///          class signals.
+        /// @param event The SFML event to process
+        void _handle_mouse_wheel_events(sf::Event const& event) override;
+
+        /// @brief Handle key press events for the text editor
+        /// @details Overrides base Signals_slots function for this specific widget.
+        ///          Moves, selects and deletes while typing, then emits the base class
+        ///          signals.
+        /// @param event The SFML event to process
+        void _handle_key_pressed_events(sf::Event const& event) override;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Check if the mouse is hovering over the text editor
+        /// @return true if hovering, false otherwise
+        bool _is_hovering() const;
+
+        /// @brief Get the height of one line
+        /// @return float Line spacing of the font at the character size
+        float _get_line_height() const;
+
+        /// @brief Get the number of lines that fit the widget, plus one partly shown
+        /// @return std::size_t Number of runs needed
+        std::size_t _get_num_visible_lines() const;
+
+        /// @brief Get the offset a line's characters end at
+        /// @param line Line index
+        /// @return std::size_t Offset of its "\n" or "\r\n", or the size for the last line
+        std::size_t _get_line_content_end(std::size_t const line) const;
+
+        /// @brief Get the run of a line, laying it out only if the line's text changed
+        /// @param line Line index
+        /// @return Glyph_run& The run holding the line
+        Glyph_run& _get_line_run(std::size_t const line);
+
+        /// @brief Get the column of an offset on its line
+        /// @param offset Byte offset
+        /// @param line Line containing the offset
+        /// @return std::size_t Number of characters between the line start and the offset
+        std::size_t _get_column(std::size_t const offset, std::size_t const line) const;
+
+        /// @brief Get the offset of a column on a line
+        /// @param line Line index
+        /// @param column Number of characters from the line start, clamped to the line
+        /// @return std::size_t Byte offset
+        std::size_t _get_offset_at_column(std::size_t const line, std::size_t const column) const;
+
+        /// @brief Get the offset of the character after an offset
+        /// @param offset Byte offset below the size
+        /// @return std::size_t Offset past one character, "\r\n" counting as one
+        std::size_t _get_next_offset(std::size_t const offset) const;
+
+        /// @brief Get the offset of the character before an offset
+        /// @param offset Byte offset above 0
+        /// @return std::size_t Offset of the previous character, "\r\n" counting as one
+        std::size_t _get_previous_offset(std::size_t const offset) const;
+
+        /// @brief Find the cursor offset under a pixel of the parent window
+        /// @param pixel_pos Position in window pixels
+        /// @return std::size_t Byte offset closest to the pixel, the cursor when there is no window
+        std::size_t _find_offset_at(sf::Vector2i const pixel_pos);
+
+        /// @brief Get the selected range
+        /// @return std::pair<std::size_t, std::size_t> First selected byte and one past the last
+        std::pair<std::size_t, std::size_t> _get_selection_range() const;
+
+        /// @brief Erase the selected text
+        /// @return bool true if there was a selection to erase
+        bool _erase_selection();
+
+        /// @brief Move the cursor without clearing the column up and down aim for
+        /// @param offset Byte offset at the start of a character
+        /// @param is_extending Whether to extend the selection instead of clearing it
+        void _place_cursor(std::size_t const offset, bool const is_extending);
+
+        /// @brief Flag a redraw after the document changed
+        void _on_edit();
+
+        /// @brief Clamp the scroll to the document
+        void _clamp_scroll();
+
+        /// @brief Scroll vertically at once so the cursor line is visible
+        void _scroll_to_cursor();
+
+        /// @brief Rebuild the visible lines, selection and caret if anything changed
+        void _update_view();
+
+    }; // class Text_editor
+
+} // namespace widgets
+
+#endif // TEXT_EDITOR_H
@@ -0,0 +1,197 @@
+/// @file text_fit.h
+/// @brief Finds the largest cached character size at which text fits a box, memoized
+
+#ifndef TEXT_FIT_H
+#define TEXT_FIT_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_cache.h"
+#include "widgets/glyph_run.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Finds the largest cached character size at which text fits a box, memoized
+    ///
+    /// @details Every character size tried means laying the text out again, which
+    ///          also rasterizes its glyphs at that size. Instead of stepping down one
+    ///          size at a time, fit():
+    ///
+    ///          1. Lays the text out once at the largest allowed size, done if it fits.
+    ///          2. Scales that size by how far the measured bounds overflow the box,
+    ///            which is almost always the answer or one step off.
+    ///          3. Binary searches the glyph cache steps on the side of the guess
+    ///            that is left, so a fit costs a handful of layouts at most.
+    ///
+    ///          Results are memoized per (string, font, style, outline, spacing, box
+    ///          size, largest size), so a widget redrawn or resized back and forth
+    ///          lays nothing out. The fit always searches down from the largest
+    ///          size, so text grows back when its box grows or its string shrinks.
+    ///
+    ///          Only sizes of the glyph cache are tried, call clear() after changing
+    ///          its steps. The fit does not request the size it settles on, the
+    ///          caller does that with Glyph_cache::request_size(). The text widgets
+    ///          share resources::DEFAULT_TEXT_FIT.
+    class Text_fit final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Default constructor is deleted - a fit engine requires a glyph cache
+        Text_fit() = delete;
+
+        /// @brief Construct a fit engine trying the sizes of a glyph cache
+        /// @param glyph_cache The cache sizes are taken from, must outlive the engine
+        explicit Text_fit(Glyph_cache& glyph_cache);
+
+        /// @brief Default destructor
+        ~Text_fit() = default;
+
+    private:
+        /// @brief Everything the bounds of a fitted text depend on
+        struct Fit_key {
+
+            std::u32string  string;
+            sf::Font const* font            = nullptr;
+            std::uint32_t   style           = 0u;
+            float           outline         = 0.0f;
+            float           box_x           = 0.0f;
+            float           box_y           = 0.0f;
+            unsigned int    max_size        = 0u;
+
+            bool operator==(Fit_key const&) const = default;
+        };
+
+        /// @brief Hash of a Fit_key
+        struct Fit_key_hash {
+
+            std::size_t operator()(Fit_key const& key) const;
+        };
+
+        /// @brief The cache sizes are taken from
+        Glyph_cache& _glyph_cache;
+
+        /// @brief Fitted character size per key
+        std::unordered_map<Fit_key, unsigned int, Fit_key_hash> _fits;
+
+        /// @brief Guards `_fits` and the counters, widgets may fit text on any thread
+        mutable std::mutex _fits_mutex;
+
+        /// @brief Number of fits after which the memo is cleared
+        std::size_t _capacity;
+
+        /// @brief Number of fits answered from the memo
+        std::size_t _num_hits;
+
+        /// @brief Number of fits that had to search
+        std::size_t _num_misses;
+
+        /// @brief Number of times text was laid out while searching
+        std::size_t _num_layouts;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Text_fit           (Text_fit const&) = delete; ///< Copy constructor deleted
+        Text_fit& operator=(Text_fit const&) = delete; ///< Copy assignment deleted
+        Text_fit           (Text_fit&&     ) = delete; ///< Move constructor deleted
+        Text_fit& operator=(Text_fit&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set a run to the largest cached size, not above `max_size`, that fits a box
+        /// @details Compares the local bounds of the run to `box_size`, so the run's
+        ///          scale and rotation are not taken into account. If not even the
+        ///          smallest size fits, the run is set to the smallest size.
+        /// @param run The run to size, its character size is changed
+        /// @param box_size Size the local bounds of the run must fit in
+        /// @param max_size Largest character size to use, snapped to the cache sizes
+        /// @return unsigned int The character size the run is set to
+        unsigned int fit(Glyph_run& run, sf::Vector2f const box_size, unsigned int const max_size);
+
+        /// @brief Forget every memoized fit
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set the number of memoized fits after which the memo is cleared
+        /// @param capacity Number of fits, default is 1024, 0 disables memoization
+        void set_capacity(std::size_t const capacity);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of fits answered from the memo
+        /// @return std::size_t Number of hits
+        std::size_t get_num_hits() const;
+
+        /// @brief Get the number of fits that had to search
+        /// @return std::size_t Number of misses
+        std::size_t get_num_misses() const;
+
+        /// @brief Get the number of times text was laid out while searching
+        /// @return std::size_t Number of layouts
+        std::size_t get_num_layouts() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Search the cache sizes for the largest one at which the run fits
+        /// @param run The run to size, left at the returned size
+        /// @param box_size Size the local bounds of the run must fit in
+        /// @param max_size Largest character size to use
+        /// @return unsigned int The fitted character size
+        unsigned int _search(Glyph_run& run, sf::Vector2f const box_size, unsigned int const max_size);
+
+    }; // class Text_fit
+
+} // namespace widgets
+
+/*
+------------------------------------------------------------------------------
+Namespace resources BEGIN
+------------------------------------------------------------------------------
+*/
+namespace resources {
+
+    /// @brief Fit engine over resources::DEFAULT_GLYPH_CACHE, used by every text widget
+    inline widgets::Text_fit DEFAULT_TEXT_FIT(DEFAULT_GLYPH_CACHE);
+
+} // namespace resources
+
+#endif // TEXT_FIT_H
@@ -0,0 +1,185 @@
+/// @file text_geometry_cache.h
+/// @brief Shares the laid out glyphs of identical strings between every text drawing them
+
+#ifndef TEXT_GEOMETRY_CACHE_H
+#define TEXT_GEOMETRY_CACHE_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_run.h"
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Shares the laid out glyphs of identical strings between every text drawing them
+    ///
+    /// @details Screens repeat the same few strings ("OK", "Cancel", units) many
+    ///          times, and every sf::Text lays out and stores its own quads. The
+    ///          cache lays each distinct (font, size, style, colors, outline,
+    ///          string) out once into a Glyph_run and hands out reference counted
+    ///          pointers to it. Texts keep their own transform and apply it when
+    ///          drawing, so a thousand "OK" buttons share one set of vertices.
+    ///
+    ///          The cache only holds weak pointers: a geometry is freed as soon as
+    ///          the last text using it changes or is destroyed. Expired entries are
+    ///          dropped every time the map doubles, so lookups stay O(1) amortized.
+    ///
+    ///          Shared geometry is frozen once laid out, so const calls on it only
+    ///          read and any thread may draw or measure it. When Glyph_cache::trim()
+    ///          evicts its font page, the next acquire() lays the string out again
+    ///          and replaces the entry, texts still holding the old geometry pick the
+    ///          new one up the next time they are drawn or measured.
+    ///
+    ///          Widgets share resources::DEFAULT_TEXT_GEOMETRY_CACHE through Shared_text.
+    class Text_geometry_cache final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty cache
+        Text_geometry_cache();
+
+        /// @brief Default destructor
+        ~Text_geometry_cache() = default;
+
+    private:
+        /// @brief Everything the vertices of a laid out string depend on
+        struct Geometry_key {
+
+            std::u32string  string;
+            sf::Font const* font              = nullptr;
+            unsigned int    char_size         = 0u;
+            std::uint32_t   style             = 0u;
+            sf::Color       fill_color        = sf::Color::White;
+            float           outline_thickness = 0.0f;
+            sf::Color       outline_color     = sf::Color::Black;
+
+            bool operator==(Geometry_key const&) const = default;
+        };
+
+        /// @brief Hash of a Geometry_key
+        struct Geometry_key_hash {
+
+            std::size_t operator()(Geometry_key const& key) const;
+        };
+
+        /// @brief Geometry per key, expired once no text uses it
+        std::unordered_map<Geometry_key, std::weak_ptr<Glyph_run const>, Geometry_key_hash> _entries;
+
+        /// @brief Guards `_entries` and the counters, texts may acquire on any thread
+        mutable std::mutex _entries_mutex;
+
+        /// @brief Number of entries at which expired ones are dropped next
+        std::size_t _prune_size;
+
+        /// @brief Number of acquires answered with shared geometry
+        std::size_t _num_hits;
+
+        /// @brief Number of acquires that laid a string out
+        std::size_t _num_misses;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Text_geometry_cache           (Text_geometry_cache const&) = delete; ///< Copy constructor deleted
+        Text_geometry_cache& operator=(Text_geometry_cache const&) = delete; ///< Copy assignment deleted
+        Text_geometry_cache           (Text_geometry_cache&&     ) = delete; ///< Move constructor deleted
+        Text_geometry_cache& operator=(Text_geometry_cache&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the shared geometry of a string, laying it out if no text uses it yet
+        /// @details The geometry is laid out and frozen without holding the lock,
+        ///          before it is shared, so drawing it never lays it out.
+        /// @param font The font, must outlive every text using the geometry
+        /// @param char_size Character size in pixels
+        /// @param style sf::Text::Style flags
+        /// @param fill_color Color of the glyphs
+        /// @param outline_thickness Thickness of the glyph outline, 0 for none
+        /// @param outline_color Color of the glyph outline
+        /// @param string The string
+        /// @return std::shared_ptr<Glyph_run const> Geometry at the origin, shared with other texts
+        std::shared_ptr<Glyph_run const> acquire(
+            sf::Font            const& font,
+            unsigned int        const  char_size,
+            std::uint32_t       const  style,
+            sf::Color           const  fill_color,
+            float               const  outline_thickness,
+            sf::Color           const  outline_color,
+            std::u32string_view const  string
+            );
+
+        /// @brief Forget every entry
+        /// @details Geometry still in use stays alive with its texts, it is just not
+        ///          shared with texts acquiring it afterwards.
+        void clear();
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of entries, including expired ones not dropped yet
+        /// @return std::size_t Number of entries
+        std::size_t get_num_entries() const;
+
+        /// @brief Get the number of acquires answered with shared geometry
+        /// @return std::size_t Number of hits
+        std::size_t get_num_hits() const;
+
+        /// @brief Get the number of acquires that laid a string out
+        /// @return std::size_t Number of misses
+        std::size_t get_num_misses() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Drop every expired entry, `_entries_mutex` must be held
+        void _prune();
+
+    }; // class Text_geometry_cache
+
+} // namespace widgets
+
+/*
+------------------------------------------------------------------------------
+Namespace resources BEGIN
+------------------------------------------------------------------------------
+*/
+namespace resources {
+
+    /// @brief Geometry cache shared by every Shared_text unless given another one
+    inline widgets::Text_geometry_cache DEFAULT_TEXT_GEOMETRY_CACHE;
+
+} // namespace resources
+
+#endif // TEXT_GEOMETRY_CACHE_H
@@ -0,0 +1,172 @@
+/// @file text_wrap.h
+/// @brief Wraps or elides text to a width from a cached analysis of its breaks and advances
+
+#ifndef TEXT_WRAP_H
+#define TEXT_WRAP_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief How text wider than its maximum width is laid out
+    enum class Wrap_mode : std::uint8_t {
+
+        NONE,  ///< Lines are as long as the text, the maximum width is ignored
+        WRAP,  ///< Lines are broken to fit, between words or ideographs where possible
+        ELIDE  ///< Each line is cut to fit and ends in an ellipsis
+    };
+
+    /// @brief Wraps or elides text to a width from a cached analysis of its breaks and advances
+    ///
+    /// @details Fitting text to a width has two parts. The analysis measures the
+    ///          advance and kerning of every character and finds where lines may
+    ///          break, which means a glyph lookup per character. Fitting then walks
+    ///          those numbers for a given width, which is additions and compares.
+    ///
+    ///          analyze() runs the first part and keeps the result until the string,
+    ///          font, size or boldness change. When only part of the string changes
+    ///          only those characters are measured again. wrap() and elide() run the
+    ///          second part, so resizing a wrapped label never touches the font.
+    ///
+    ///          Lines may break:
+    ///          - After a run of spaces or tabs. The last one becomes the newline,
+    ///            the others hang past the width.
+    ///          - After a hyphen inside a word.
+    ///          - Before and after CJK ideographs, kana and Hangul, except before
+    ///            closing punctuation and after opening punctuation.
+    ///          - Between any two grapheme clusters when a word alone is wider
+    ///            than the width.
+    ///
+    ///          This is a subset of UAX #14 that covers Latin, CJK and mixed text.
+    ///          Widths are pen advances, as Glyph_run lays them out.
+    class Text_wrap final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty analysis
+        Text_wrap();
+
+        /// @brief Default destructor
+        ~Text_wrap() = default;
+
+    private:
+        /// @brief The analyzed string
+        std::u32string _string;
+
+        /// @brief Advance of each character, 0 for newlines
+        std::vector<float> _advances;
+
+        /// @brief Kerning of each character with the one before it
+        std::vector<float> _kernings;
+
+        /// @brief Break flags of the position before each character
+        std::vector<std::uint8_t> _breaks;
+
+        /// @brief Ellipsis elided lines end in, U+2026 or three periods if the font lacks it
+        std::u32string _ellipsis;
+
+        /// @brief Width of the ellipsis
+        float _ellipsis_width;
+
+        /// @brief The font the string was measured with
+        sf::Font const* _font;
+
+        /// @brief Character size the string was measured at
+        unsigned int _char_size;
+
+        /// @brief Whether the string was measured bold
+        bool _is_bold;
+
+        /// @brief Number of characters measured with the font
+        std::size_t _num_measured;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // Each widget owns its analysis, there is no need to copy or move it.
+    public:
+        Text_wrap           (Text_wrap const&) = delete; ///< Copy constructor deleted
+        Text_wrap& operator=(Text_wrap const&) = delete; ///< Copy assignment deleted
+        Text_wrap           (Text_wrap&&     ) = delete; ///< Move constructor deleted
+        Text_wrap& operator=(Text_wrap&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Measure a string and find its break opportunities
+        /// @details Does nothing if the string, font, size and boldness are those of
+        ///          the last analysis. Otherwise only the characters between the
+        ///          common prefix and suffix of the two strings are measured, unless
+        ///          the font, size or boldness changed.
+        /// @param string The string to analyze
+        /// @param font The font to measure with, must outlive the analysis
+        /// @param char_size Character size to measure at
+        /// @param style Text style, only bold changes the advances
+        void analyze(std::u32string_view const string, sf::Font const& font, unsigned int const char_size, std::uint32_t const style);
+
+        /// @brief Break the analyzed string into lines no wider than a width
+        /// @details Newlines in the string are kept. A grapheme cluster wider than the
+        ///          width is put on a line of its own.
+        /// @param max_width Width the lines must fit in
+        /// @param result Set to the string with newlines at the chosen breaks
+        void wrap(float const max_width, std::u32string& result) const;
+
+        /// @brief Cut each line of the analyzed string to a width, ending it in an ellipsis
+        /// @details Lines that fit are kept as is. Others are cut at a grapheme cluster
+        ///          boundary, trailing spaces dropped, so that the ellipsis fits too.
+        /// @param max_width Width the lines must fit in
+        /// @param result Set to the string with the long lines elided
+        void elide(float const max_width, std::u32string& result) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the analyzed string
+        /// @return std::u32string const& The string
+        std::u32string const& get_string() const;
+
+        /// @brief Get the number of characters measured with the font since construction
+        /// @return std::size_t Number of characters measured
+        std::size_t get_num_measured() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Find the break opportunities of the whole string
+        void _find_breaks();
+
+    }; // class Text_wrap
+
+} // namespace widgets
+
+#endif // TEXT_WRAP_H
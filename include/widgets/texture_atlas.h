@@ -0,0 +1,235 @@
+/// @file texture_atlas.h
+/// @brief Packs many small images into a few large atlas textures
+
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "SFML/Graphics.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief A rectangle inside one of an atlas' page textures
+    struct Atlas_region {
+
+        /// @brief The page texture the region lives in, nullptr if the region is invalid
+        sf::Texture const* texture = nullptr;
+
+        /// @brief Pixel rectangle of the region inside `texture`
+        sf::IntRect rect = {};
+    };
+
+    /// @brief Packs many small images into a few large atlas textures
+    ///
+    /// @details Images are added under a name and packed when build() is called.
+    ///          Packing uses a skyline bottom-left packer: the images are sorted
+    ///          by height and each one is placed where it ends up lowest on the
+    ///          current skyline of a page, a new page is started when no page has
+    ///          room left. Every packed image is surrounded by `padding` pixels
+    ///          copied from its own edges so that smoothing never samples a
+    ///          neighbour.
+    ///
+    ///          Widgets built from the regions of one page all share the same
+    ///          texture, which is what allows Sprite_batch to draw them in a
+    ///          single call.
+    ///
+    ///          Page textures are never moved or destroyed until the atlas is, so
+    ///          region pointers stay valid while images are added and built later.
+    ///
+    /// @warning The atlas must outlive every widget built from its regions.
+    class Texture_atlas final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct an empty atlas
+        /// @param page_size Size of each page texture in pixels, clamped to the
+        ///                  maximum texture size of the GPU
+        /// @param padding Pixels of edge extrusion around every packed image
+        explicit Texture_atlas(
+            sf::Vector2u const page_size = {2048u, 2048u},
+            unsigned int const padding   = 1u
+            );
+
+        /// @brief Default destructor
+        ~Texture_atlas() = default;
+
+    private:
+        /// @brief A horizontal segment of a page's skyline
+        struct Skyline_node {
+
+            unsigned int x     = 0u;
+            unsigned int y     = 0u;
+            unsigned int width = 0u;
+        };
+
+        /// @brief A page texture and the skyline of what is packed into it
+        struct Page {
+
+            std::unique_ptr<sf::Texture> texture;
+            std::vector<Skyline_node>    skyline;
+        };
+
+        /// @brief An image waiting for build()
+        struct Pending_image {
+
+            std::string name;
+            sf::Image   image;
+        };
+
+        /// @brief Size of each page texture in pixels
+        sf::Vector2u _page_size;
+
+        /// @brief Pixels of edge extrusion around every packed image
+        unsigned int _padding;
+
+        /// @brief Smoothing applied to every page texture
+        bool _is_smooth;
+
+        /// @brief All pages, the textures are heap allocated so they never move
+        std::vector<Page> _pages;
+
+        /// @brief Images added since the last build()
+        std::vector<Pending_image> _pending;
+
+        /// @brief Name to packed region lookup
+        std::unordered_map<std::string, Atlas_region> _regions;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Texture_atlas           (Texture_atlas const&) = delete; ///< Copy constructor deleted
+        Texture_atlas& operator=(Texture_atlas const&) = delete; ///< Copy assignment deleted
+        Texture_atlas           (Texture_atlas&&     ) = delete; ///< Move constructor deleted
+        Texture_atlas& operator=(Texture_atlas&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Queue an image to be packed by the next build()
+        /// @warning Adding a name that is already used replaces it on the next build()
+        /// @param name Name used to look the region up
+        /// @param image The image to pack
+        /// @return true if the image was queued, false if it can never fit a page
+        bool add(std::string const& name, sf::Image const& image);
+
+        /// @brief Load an image from a file and queue it to be packed by the next build()
+        /// @param name Name used to look the region up
+        /// @param path Path to any image format sf::Image can load
+        /// @return true if the image was loaded and queued, false otherwise
+        bool add_from_file(std::string const& name, std::filesystem::path const& path);
+
+        /// @brief Pack every queued image into the pages and upload them
+        /// @details Images are packed into the free space left by earlier builds
+        ///          before a new page is started, so existing regions never move.
+        /// @return true if every queued image was packed, false otherwise
+        bool build();
+
+        /*
+        ------------------------------------------------------------------------------
+        Setter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Set smoothing on every page texture, current and future
+        /// @param is_smooth true to enable linear filtering
+        void set_smooth(bool const is_smooth);
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get a packed region by name
+        /// @param name Name the image was added under
+        /// @return Atlas_region The region, with a nullptr texture if it does not exist
+        Atlas_region get_region(std::string const& name) const;
+
+        /// @brief Check if a packed region exists
+        /// @param name Name the image was added under
+        /// @return true if the region has been built, false otherwise
+        bool has_region(std::string const& name) const;
+
+        /// @brief Get the number of page textures
+        /// @return std::size_t Number of page textures
+        std::size_t get_num_pages() const;
+
+        /// @brief Get a page texture
+        /// @param index Index of the page
+        /// @return sf::Texture const* The page texture, nullptr if `index` is out of range
+        sf::Texture const* get_page_texture(std::size_t const index) const;
+
+        /// @brief Get the size of each page texture
+        /// @return sf::Vector2u Page size in pixels
+        sf::Vector2u get_page_size() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Start a new empty page
+        /// @return true if the page texture could be created, false otherwise
+        bool _add_page();
+
+        /// @brief Find where a rectangle sits lowest on a page's skyline
+        /// @param page The page to search
+        /// @param size Size of the rectangle including padding
+        /// @param out_node Index of the skyline node to place at
+        /// @param out_y Y position the rectangle would be placed at
+        /// @return true if the rectangle fits the page, false otherwise
+        bool _find_position(
+            Page         const& page,
+            sf::Vector2u const  size,
+            std::size_t&        out_node,
+            unsigned int&       out_y
+            ) const;
+
+        /// @brief Raise a page's skyline after placing a rectangle
+        /// @param page The page the rectangle was placed on
+        /// @param node Index of the skyline node the rectangle was placed at
+        /// @param pos Position of the rectangle
+        /// @param size Size of the rectangle including padding
+        void _place(
+            Page&              page,
+            std::size_t  const node,
+            sf::Vector2u const pos,
+            sf::Vector2u const size
+            );
+
+        /// @brief Copy an image into a larger one with its edges extruded by `_padding`
+        /// @param image The image to extrude
+        /// @return sf::Image The padded image
+        sf::Image _extrude(sf::Image const& image) const;
+
+    }; // class Texture_atlas
+
+} // namespace widgets
+
+#endif // TEXTURE_ATLAS_H
@@ -0,0 +1,147 @@
+/// @file thread_pool.h
+/// @brief Work stealing thread pool used to spread widget work over all cores
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Work stealing thread pool used to spread widget work over all cores
+    ///
+    /// @details Every worker owns a task deque. Workers take their own newest task
+    ///          first (it is the most likely to still be in cache) and, once their
+    ///          deque is empty, steal the oldest task of another worker. Tasks
+    ///          submitted from a worker go to that worker's deque, tasks submitted
+    ///          from any other thread are spread round robin.
+    ///
+    ///          Idle workers sleep on a condition variable, so an idle pool costs
+    ///          no CPU.
+    class Thread_pool final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Construct a pool and start its workers
+        /// @param num_threads Number of workers, 0 uses one less than the number of
+        ///                    hardware threads since the calling thread helps out in
+        ///                    parallel_for()
+        explicit Thread_pool(std::size_t const num_threads = 0u);
+
+        /// @brief Finish the queued tasks and join the workers
+        ~Thread_pool();
+
+    private:
+        /// @brief A worker's task deque
+        struct Task_deque {
+
+            std::mutex                        mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        /// @brief One task deque per worker, stored as pointers since mutexes cannot move
+        std::vector<std::unique_ptr<Task_deque>> _deques;
+
+        /// @brief The worker threads
+        std::vector<std::thread> _threads;
+
+        /// @brief Guards sleeping and waking the workers
+        std::mutex _sleep_mutex;
+
+        /// @brief Wakes sleeping workers when tasks are submitted or the pool stops
+        std::condition_variable _wake_condition;
+
+        /// @brief Number of tasks queued but not yet taken
+        std::atomic<std::size_t> _num_queued;
+
+        /// @brief Round robin deque for tasks submitted from outside the pool
+        std::atomic<std::size_t> _next_deque;
+
+        /// @brief Set when the pool is being destroyed
+        std::atomic<bool> _is_stopping;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+    public:
+        Thread_pool           (Thread_pool const&) = delete; ///< Copy constructor deleted
+        Thread_pool& operator=(Thread_pool const&) = delete; ///< Copy assignment deleted
+        Thread_pool           (Thread_pool&&     ) = delete; ///< Move constructor deleted
+        Thread_pool& operator=(Thread_pool&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Queue a task to run on a worker
+        /// @param task The task to run
+        void submit(std::function<void()> task);
+
+        /// @brief Run `body` over [0, count) split into chunks and wait for all of them
+        /// @details The calling thread runs chunks too instead of only waiting, so
+        ///          this also works (serially) on a pool without workers.
+        /// @param count Number of indices
+        /// @param grain_size Most indices per chunk, 0 picks a size that gives every
+        ///                   thread a few chunks to balance with
+        /// @param body Called as body(begin, end) for each chunk
+        void parallel_for(
+            std::size_t                                   const  count,
+            std::size_t                                   const  grain_size,
+            std::function<void(std::size_t, std::size_t)> const& body
+            );
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the number of worker threads
+        /// @return std::size_t Number of workers
+        std::size_t get_num_threads() const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Take a task, own deque first and then by stealing, and run it
+        /// @param home_deque Deque to take from first
+        /// @return true if a task ran, false if every deque was empty
+        bool _try_run_one(std::size_t const home_deque);
+
+        /// @brief Main function of a worker thread
+        /// @param index Index of the worker and its deque
+        void _worker_loop(std::size_t const index);
+
+    }; // class Thread_pool
+
+} // namespace widgets
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,203 @@
+/// @file unicode_table.h
+/// @brief Two-stage lookup table classifying every Unicode code point in O(1)
+
+#ifndef UNICODE_TABLE_H
+#define UNICODE_TABLE_H
+
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+
+    /// @brief Two-stage lookup table classifying every Unicode code point in O(1)
+    ///
+    /// @details Each code point has one byte of properties: its kind, printable,
+    ///          combining, format or control, and its grapheme cluster break
+    ///          property from Unicode 14.0. A byte per code point would take 1.1 MB,
+    ///          but most blocks of 128 code points repeat, so the table stores each
+    ///          distinct block once, about 30 KB, and an index of blocks:
+    ///
+    ///          properties = blocks[index[code_point / 128] * 128 + code_point % 128]
+    ///
+    ///          A lookup is two loads, no search and no branch on the script, cheap
+    ///          enough to run on every keystroke of every field.
+    ///
+    ///          find_previous_grapheme() and find_next_grapheme() walk user
+    ///          perceived characters with the rules of UAX #29, so "e" followed by
+    ///          a combining accent, a flag of two regional indicators or an emoji
+    ///          joined with zero width joiners are each deleted and stepped over as
+    ///          one. The text widgets share resources::UNICODE_TABLE.
+    class Unicode_table final {
+        /*
+        ------------------------------------------------------------------------------
+        Construction / Destruction
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Broad class of a code point
+        enum class Kind : std::uint8_t {
+
+            UNASSIGNED, ///< No character, or past U+10FFFF
+            CONTROL,    ///< Controls, line and paragraph separators and surrogates
+            FORMAT,     ///< Invisible characters that affect text, such as the zero width joiner
+            COMBINING,  ///< Marks drawn on the character before them
+            PRINTABLE   ///< Letters, numbers, punctuation, symbols, spaces and private use
+        };
+
+        /// @brief Grapheme cluster break property, UAX #29
+        enum class Grapheme_break : std::uint8_t {
+
+            OTHER,
+            CR,
+            LF,
+            CONTROL,
+            EXTEND,
+            ZWJ,
+            REGIONAL_INDICATOR,
+            PREPEND,
+            SPACING_MARK,
+            L,
+            V,
+            T,
+            LV,
+            LVT,
+            EXTENDED_PICTOGRAPHIC ///< From emoji-data, its code points are OTHER for UAX #29
+        };
+
+        /// @brief Code points per block of the second stage
+        static std::size_t constexpr BLOCK_SIZE = 128u;
+
+        /// @brief Number of code points, U+0000 to U+10FFFF
+        static std::size_t constexpr NUM_CODE_POINTS = 0x110000u;
+
+        /// @brief Build the table
+        /// @details Expands the runs of code points sharing properties into blocks
+        ///          and keeps each distinct block once, under a millisecond.
+        Unicode_table();
+
+        /// @brief Default destructor
+        ~Unicode_table() = default;
+
+    private:
+        /// @brief First stage, `_block_index[code_point / BLOCK_SIZE]` is the block of a code point
+        std::vector<std::uint16_t> _block_index;
+
+        /// @brief Second stage, the distinct blocks back to back, kind in the high nibble
+        std::vector<std::uint8_t> _blocks;
+
+        /*
+        ------------------------------------------------------------------------------
+        Rule of 5
+        ------------------------------------------------------------------------------
+        */
+        // There is no need to copy or move the table, share resources::UNICODE_TABLE.
+    public:
+        Unicode_table           (Unicode_table const&) = delete; ///< Copy constructor deleted
+        Unicode_table& operator=(Unicode_table const&) = delete; ///< Copy assignment deleted
+        Unicode_table           (Unicode_table&&     ) = delete; ///< Move constructor deleted
+        Unicode_table& operator=(Unicode_table&&     ) = delete; ///< Move assignment deleted
+
+        /*
+        ------------------------------------------------------------------------------
+        Functionality
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Find the start of the grapheme cluster ending at an index
+        /// @details Looks back no further than the cluster, except over a run of
+        ///          regional indicators whose pairs it has to count.
+        /// @param text The text, only characters before `index` are read
+        /// @param index A cluster boundary, clamped to the size
+        /// @return std::size_t Start of the cluster before `index`, 0 at the start
+        std::size_t find_previous_grapheme(std::u32string_view const text, std::size_t const index) const;
+
+        /// @brief Find the end of the grapheme cluster starting at an index
+        /// @param text The text
+        /// @param index A cluster boundary
+        /// @return std::size_t End of the cluster after `index`, the size at the end
+        std::size_t find_next_grapheme(std::u32string_view const text, std::size_t const index) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Getter Functions
+        ------------------------------------------------------------------------------
+        */
+    public:
+        /// @brief Get the kind of a code point
+        /// @param code_point The code point
+        /// @return Kind The kind, UNASSIGNED past U+10FFFF
+        Kind get_kind(char32_t const code_point) const;
+
+        /// @brief Get the grapheme cluster break property of a code point
+        /// @param code_point The code point
+        /// @return Grapheme_break The property, OTHER past U+10FFFF
+        Grapheme_break get_grapheme_break(char32_t const code_point) const;
+
+        /// @brief Get whether a code point is drawn, a space or a combining mark
+        /// @param code_point The code point
+        /// @return bool true for PRINTABLE and COMBINING code points
+        bool is_printable(char32_t const code_point) const;
+
+        /// @brief Get whether a code point is a combining mark
+        /// @param code_point The code point
+        /// @return bool true for COMBINING code points
+        bool is_combining(char32_t const code_point) const;
+
+        /// @brief Get whether a code point is a control character
+        /// @param code_point The code point
+        /// @return bool true for CONTROL code points, tabs and newlines included
+        bool is_control(char32_t const code_point) const;
+
+        /// @brief Get whether a code point can be typed into a text field
+        /// @details Printable and format characters, format characters join emoji
+        ///          and mark the direction of text.
+        /// @param code_point The code point
+        /// @return bool true for PRINTABLE, COMBINING and FORMAT code points
+        bool is_insertable(char32_t const code_point) const;
+
+        /*
+        ------------------------------------------------------------------------------
+        Helper Functions
+        ------------------------------------------------------------------------------
+        */
+    private:
+        /// @brief Get the properties byte of a code point
+        /// @param code_point The code point
+        /// @return std::uint8_t Kind in the high nibble, grapheme break in the low one
+        std::uint8_t _get_properties(char32_t const code_point) const;
+
+        /// @brief Get whether a grapheme cluster boundary lies before a character
+        /// @param text The text
+        /// @param index Index of the character after the boundary, from 1 to below the size
+        /// @return bool true if `text[index - 1]` and `text[index]` are in different clusters
+        bool _is_grapheme_boundary(std::u32string_view const text, std::size_t const index) const;
+
+    }; // class Unicode_table
+
+} // namespace widgets
+
+/*
+------------------------------------------------------------------------------
+Namespace resources BEGIN
+------------------------------------------------------------------------------
+*/
+namespace resources {
+
+    /// @brief Unicode properties shared by every text widget
+    inline widgets::Unicode_table const UNICODE_TABLE;
+
+} // namespace resources
+
+#endif // UNICODE_TABLE_H
@@ -15,13 +15,18 @@
 ///
 /// @section lifecycle_sec Overview & Lifecycle
 ///
-/// Widgets exist on a single RenderWindow and should be managed by pointers that are
+/// Widgets exist on a single render target and should be managed by pointers that are
 /// dynamically created on the heap using "new" or smart pointers (never copied or moved)
 /// and freed in the destructor of the class where they are created.
 ///
+/// The render target is usually an sf::RenderWindow, but any sf::RenderTarget can be
+/// passed in. Binding widgets to an sf::RenderTexture renders them offscreen, which is
+/// how the library is used on headless machines (see offscreen.h). Offscreen widgets
+/// have no window to read the mouse from, so they never enter the HOVERING state.
+///
 /// The typical lifecycle is:
 ///
-///   1. Construction:   Widget created with parent window reference
+///   1. Construction:   Widget created with parent render target reference
 ///   2. Initialization: Size, position, and appearance set up
 ///   3. Active use:     Drawing occurs each frame
 ///   4. Destruction:    Virtual destructor called, cleanup performed
@@ -57,8 +62,31 @@
 /// Override draw() to render the widget. The base implementation:
 ///
 ///   1. Checks if in HIDDEN state, if so, returns without drawing
-///   2. Calls _update_widget() for final pre draw updates
-///   3. Logs a warning if not overridden
+///   2. Checks if the widget is outside the current view, if so, returns without drawing
+///   3. Calls _update_widget() for final pre draw updates
+///   4. Logs a warning if not overridden
+///
+/// @subsection culling_subsec Viewport Culling
+///
+/// Widgets whose get_global_bounds() lie entirely outside the render target's current
+/// sf::View skip _update_widget() and submission. Checking a single widget is O(1), but
+/// scrolling or panning canvases with many widgets should register them in a
+/// Spatial_grid and draw through Spatial_grid::draw_visible(), which only visits the
+/// widgets in the grid cells covered by the view.
+///
+/// @subsection queue_subsec Render Queue
+///
+/// draw() submits immediately, so the GPU state follows the order the application
+/// draws in. Calling queue_draw(Render_queue&) instead pushes the same drawables into a
+/// Render_queue, which sorts them per layer (see set_layer(int)) by texture, shader and
+/// blend mode while keeping overlapping drawables in their original order.
+///
+/// @subsection compositor_subsec Compositor
+///
+/// Widgets attached to a Compositor layer call _mark_dirty() from every function that
+/// changes how they look (setters, move(), rotate(), change_state() ...). Derived
+/// classes must do the same in their own mutating functions, otherwise a cached layer
+/// keeps showing the old picture.
 ///
 /// @subsection update_subsec Update Widget
 ///
@@ -106,6 +134,9 @@ Includes
 /// @brief Widget namespace containing all UI widget classes
 namespace widgets {
 
+    class Render_queue; // See render_queue.h
+    class Compositor;   // See compositor.h
+
     /// @brief Base class for all UI widgets
     ///
     /// @details Provides core functionality for state management, positioning,
@@ -122,14 +153,20 @@ namespace widgets {
         virtual ~Widget() = default;
 
     protected:
-        /// @brief Default constructor is deleted - widgets require a parent window
+        /// @brief Default constructor is deleted - widgets require a parent render target
         Widget() = delete;
 
-        /// @brief Construct a new Widget with a parent window
-        /// @param parent_window Reference to the parent render window
-        explicit Widget(std::shared_ptr<sf::RenderWindow> parent_window);
+        /// @brief Construct a new Widget with a parent render target
+        /// @details The target is usually an sf::RenderWindow. Passing an
+        ///          sf::RenderTexture instead renders the widget offscreen.
+        /// @param parent_target Reference to the parent render target
+        explicit Widget(std::shared_ptr<sf::RenderTarget> parent_target);
 
-        /// @brief Reference to the parent window for rendering
+        /// @brief Reference to the parent render target for rendering
+        std::weak_ptr<sf::RenderTarget> _parent_target;
+
+        /// @brief Reference to the parent window for mouse input
+        /// @details Empty when the parent render target is not an sf::RenderWindow.
         std::weak_ptr<sf::RenderWindow> _parent_window;
 
         // =========================================================================
@@ -170,16 +207,41 @@ namespace widgets {
         /// @brief Current state of the widget
         State _current_state;
 
+        /// @brief Z-layer used when the widget is drawn through a Render_queue
+        int _layer;
+
+    private:
+        /// @brief Dirty flag of the Compositor layer the widget is attached to, nullptr if none
+        bool* _compositor_dirty_flag;
+
+        /// @brief The compositor sets `_compositor_dirty_flag` on attach and detach
+        friend class Compositor;
+
         // =========================================================================
         // Core Functionality
         // =========================================================================
     public:
-        /// @brief Draw the widget to its parent window
+        /// @brief Draw the widget to its parent render target
         /// @details Override this function in derived classes to implement
         ///          custom rendering. Base implementation checks for HIDDEN
         ///          state and calls _update_widget().
         virtual void draw();
 
+        /// @brief Push the widget's drawables into a render queue instead of drawing them
+        /// @details Same checks as draw(), but the drawables are pushed on the widget's
+        ///          layer so the queue can reorder them by render state. The widget
+        ///          must stay unchanged until the queue is submitted.
+        /// @param queue The queue to push into
+        virtual void queue_draw(Render_queue& queue);
+
+        /// @brief Pick up work a background thread finished for the widget
+        /// @details Application calls this for every registered widget each time its
+        ///          loop wakes, including the idle wakes while it waits for events.
+        ///          Override it to take the results and call _mark_dirty(). Without
+        ///          an Application, call it from the loop, not from draw().
+        /// @return true if the widget changed and a frame must be drawn, false otherwise
+        virtual bool poll();
+
         /// @brief Move the widget by specified offset
         /// @param offset Vector offset to move the widget by
         virtual void move(sf::Vector2f const offset);
@@ -244,6 +306,10 @@ namespace widgets {
         /// @param angle New rotation angle
         virtual void set_rotation(sf::Angle const angle);
 
+        /// @brief Set the z-layer used when drawing through a Render_queue
+        /// @param layer Layer of the widget, lower layers are drawn first
+        void set_layer(int const layer);
+
         // =========================================================================
         // Getter Functions
         // =========================================================================
@@ -299,11 +365,38 @@ namespace widgets {
         /// @brief Get the widget rotation
         /// @return sf::Angle Current rotation angle
         virtual sf::Angle get_rotation() const;
+
+        /// @brief Get the z-layer used when drawing through a Render_queue
+        /// @return int Layer of the widget
+        int get_layer() const;
+
+        /// @brief Get the widget's bounding rectangle in world coordinates
+        /// @details Used for viewport culling and spatial indexing, so it should
+        ///          cover everything the widget draws.
+        /// @return sf::FloatRect Axis aligned bounds of the widget
+        virtual sf::FloatRect get_global_bounds() const;
         // =========================================================================
         // Helper Functions
         // =========================================================================
     protected:
+        /// @brief Check if the parent window has expired or was never set
+        /// @return true if there is no parent window, false otherwise
         bool _is_parent_window_nullptr() const;
+
+        /// @brief Check if the parent render target has expired
+        /// @return true if there is no parent render target, false otherwise
+        bool _is_parent_target_nullptr() const;
+
+        /// @brief Check if the widget lies entirely outside the target's current view
+        /// @details Helper function used by draw() to skip updating and drawing
+        ///          widgets that cannot be seen.
+        /// @return true if the widget can be culled, false otherwise
+        bool _is_outside_view() const;
+
+        /// @brief Tell the Compositor layer the widget is attached to that it must be redrawn
+        /// @details Call this from every function that changes how the widget looks.
+        ///          Does nothing when the widget is not attached to a compositor.
+        void _mark_dirty();
     }; // class widget
 
 } // namespace widgets
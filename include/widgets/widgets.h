@@ -37,9 +37,30 @@
 /// @see widgets::Widget
 /// @see widgets::Push_button
 /// @see widgets::Label
+/// @see widgets::Rich_label
 /// @see widgets::Line_edit
 /// @see widgets::Sprite_button
 /// @see widgets::Image
+/// @see offscreen.h for headless rendering into an sf::RenderTexture
+/// @see widgets::Spatial_grid for viewport culling of large scenes
+/// @see widgets::Texture_atlas and widgets::Sprite_batch for drawing many icons cheaply
+/// @see widgets::Render_queue for sorting draws by render state
+/// @see widgets::Frame_pipeline for recording draws on all cores
+/// @see widgets::Snapshot_buffer for drawing on a separate render thread
+/// @see widgets::Compositor for named layers with cached static content
+/// @see widgets::Sdf_text for text that scales without rasterizing glyphs
+/// @see widgets::Glyph_cache for warming up and bounding glyph memory
+/// @see widgets::Text_fit for fitting text to a box in a few layouts
+/// @see widgets::Text_wrap for wrapping or eliding Label text without measuring it again
+/// @see widgets::Gap_buffer and widgets::Glyph_run for editing text without laying it all out again
+/// @see widgets::Text_editor and widgets::Piece_table for editing documents of many megabytes
+/// @see widgets::Edit_history for undo and redo that stores edits, not copies of the text
+/// @see widgets::Input_validator for Line_edit input checked per keystroke by a compiled DFA
+/// @see widgets::Unicode_table for classifying code points and finding grapheme clusters in O(1)
+/// @see widgets::Prefix_index and widgets::Suggestion_list for Line_edit autocomplete over millions of entries
+/// @see widgets::Shared_text and widgets::Text_geometry_cache for sharing the glyphs of repeated strings
+/// @see widgets::Numeric_display for live values updated every frame without allocating
+/// @see widgets::Application for an event driven run loop that sleeps when idle
 
 #ifndef WIDGETS_H
 #define WIDGETS_H
@@ -53,7 +74,35 @@
 #include "widgets/push_button.h"
 #include "widgets/line_edit.h"
 #include "widgets/label.h"
+#include "widgets/rich_label.h"
 #include "widgets/image.h"
+#include "widgets/offscreen.h"
+#include "widgets/spatial_grid.h"
+#include "widgets/texture_atlas.h"
+#include "widgets/sprite_batch.h"
+#include "widgets/render_queue.h"
+#include "widgets/thread_pool.h"
+#include "widgets/frame_pipeline.h"
+#include "widgets/snapshot_buffer.h"
+#include "widgets/compositor.h"
+#include "widgets/sdf_font.h"
+#include "widgets/sdf_text.h"
+#include "widgets/glyph_cache.h"
+#include "widgets/text_fit.h"
+#include "widgets/text_wrap.h"
+#include "widgets/edit_history.h"
+#include "widgets/gap_buffer.h"
+#include "widgets/glyph_run.h"
+#include "widgets/input_validator.h"
+#include "widgets/unicode_table.h"
+#include "widgets/prefix_index.h"
+#include "widgets/suggestion_list.h"
+#include "widgets/piece_table.h"
+#include "widgets/text_editor.h"
+#include "widgets/numeric_display.h"
+#include "widgets/text_geometry_cache.h"
+#include "widgets/shared_text.h"
+#include "widgets/application.h"
 
 namespace widgets {
 
@@ -0,0 +1,605 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/application.h"
+#include "widgets/log.h"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Application::Application(
+        std::shared_ptr<sf::RenderWindow> window
+        ) :
+        _window                 (std::move(window)      ),
+        _widgets                (                       ),
+        _is_dispatching         (false                  ),
+        _timers                 (                       ),
+        _next_timer_id          (1u                     ),
+        _posted_tasks_mutex     (                       ),
+        _posted_tasks           (                       ),
+        _is_wake_requested      (false                  ),
+        _wake_condition         (                       ),
+        _is_redraw_requested    (true                   ),
+        _is_quit_requested      (false                  ),
+        _is_animating           (false                  ),
+        _is_render_queue_enabled(false                  ),
+        _render_queue           (                       ),
+        _frame_pipeline         (nullptr                ),
+        _pipeline_widgets       (                       ),
+        _compositor             (nullptr                ),
+        _frame_interval         (sf::microseconds(16667)),
+        _clear_color            (sf::Color::Black       ),
+        _event_callback         (                       ),
+        _frame_callback         (                       ),
+        _draw_callback          (                       ),
+        _clock                  (                       ),
+        _num_frames_drawn       (0u                     )
+    {
+
+        if (!_window) {
+
+            LOG(ERROR) << "Application is constructed without a window, run() will return immediately.";
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Application::run() {
+
+        if (!_window) {
+
+            LOG(ERROR) << "Application has no window to run.";
+            return;
+        }
+
+        _is_quit_requested   = false;
+        _is_redraw_requested = true;
+
+        sf::Time last_frame = _clock.getElapsedTime();
+        sf::Time next_frame = last_frame;
+
+        while (_window->isOpen() && !_is_quit_requested) {
+
+            bool has_changes = _run_posted_tasks();
+            has_changes      = _run_due_timers(_clock.getElapsedTime()) || has_changes;
+            has_changes      = _poll_widgets() || has_changes;
+
+            while (std::optional const event = _window->pollEvent()) {
+
+                _dispatch(*event);
+                has_changes = true;
+            }
+
+            if (has_changes) {
+
+                _is_redraw_requested = true;
+            }
+
+            sf::Time const now         = _clock.getElapsedTime();
+            bool     const wants_frame = _is_animating || _is_redraw_requested;
+
+            if (wants_frame && now >= next_frame) {
+
+                _is_redraw_requested = false;
+                _draw_frame(now - last_frame);
+
+                last_frame = now;
+                next_frame = now + _frame_interval;
+                continue;
+            }
+
+            // Nothing to do right now, sleep until an event arrives, another
+            // thread wakes the loop or the next frame or timer is due.
+            sf::Time timeout = sf::Time::Zero;
+
+            if (wants_frame) {
+
+                timeout = next_frame - now;
+            }
+
+            if (!_timers.empty()) {
+
+                sf::Time const until_timer = _get_next_deadline() - now;
+                timeout = timeout == sf::Time::Zero ? until_timer : std::min(timeout, until_timer);
+            }
+
+            if (wants_frame || !_timers.empty()) {
+
+                // Zero would mean sleeping until woken.
+                timeout = std::max(timeout, sf::microseconds(1));
+            }
+
+            _wait(timeout);
+        }
+    }
+
+    void Application::quit() {
+
+        _is_quit_requested = true;
+        _wake();
+    }
+
+    void Application::add_widget(
+        Widget& widget
+        ) {
+
+        auto const found = std::find_if(_widgets.begin(), _widgets.end(), [&widget](Registered_widget const& registered) {
+
+            return registered.widget == &widget;
+        });
+
+        if (found != _widgets.end()) {
+
+            LOG(WARNING) << "Widget is already registered with the application.";
+            return;
+        }
+
+        _widgets.push_back({&widget, dynamic_cast<signals_slots::Signals_slots*>(&widget)});
+        _is_redraw_requested = true;
+    }
+
+    void Application::remove_widget(
+        Widget& widget
+        ) {
+
+        auto const found = std::find_if(_widgets.begin(), _widgets.end(), [&widget](Registered_widget const& registered) {
+
+            return registered.widget == &widget;
+        });
+
+        if (found == _widgets.end()) {
+
+            LOG(WARNING) << "Attempting to remove a widget that is not registered with the application.";
+            return;
+        }
+
+        if (_is_dispatching) {
+
+            // Erasing would shift the widgets still being dispatched to.
+            found->widget  = nullptr;
+            found->signals = nullptr;
+        } else {
+
+            _widgets.erase(found);
+        }
+
+        _is_redraw_requested = true;
+    }
+
+    Timer_id Application::add_timer(
+        sf::Time              const  interval,
+        std::function<void()> const& callback,
+        bool                  const  is_repeating
+        ) {
+
+        Timer timer{};
+        timer.id           = _next_timer_id++;
+        timer.interval     = std::max(interval, sf::Time::Zero);
+        timer.deadline     = _clock.getElapsedTime() + timer.interval;
+        timer.is_repeating = is_repeating;
+        timer.callback     = callback;
+
+        if (is_repeating && timer.interval == sf::Time::Zero) {
+
+            LOG(WARNING) << "Repeating timer has a zero interval and will run every loop iteration.";
+        }
+
+        _timers.push_back(std::move(timer));
+
+        return _timers.back().id;
+    }
+
+    void Application::remove_timer(
+        Timer_id const id
+        ) {
+
+        std::erase_if(_timers, [id](Timer const& timer) {
+
+            return timer.id == id;
+        });
+    }
+
+    void Application::post(
+        std::function<void()> task
+        ) {
+
+        {
+            std::lock_guard<std::mutex> const lock(_posted_tasks_mutex);
+
+            _posted_tasks.push_back(std::move(task));
+        }
+
+        _wake_condition.notify_one();
+    }
+
+    void Application::request_redraw() {
+
+        _is_redraw_requested = true;
+        _wake();
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Application::set_animating(
+        bool const is_animating
+        ) {
+
+        _is_animating = is_animating;
+    }
+
+    void Application::set_frame_limit(
+        unsigned int const frame_limit
+        ) {
+
+        if (frame_limit == 0u) {
+
+            _frame_interval = sf::Time::Zero;
+        } else {
+
+            _frame_interval = sf::microseconds(1'000'000 / static_cast<std::int64_t>(frame_limit));
+        }
+    }
+
+    void Application::set_clear_color(
+        sf::Color const color
+        ) {
+
+        _clear_color         = color;
+        _is_redraw_requested = true;
+    }
+
+    void Application::set_render_queue_enabled(
+        bool const is_enabled
+        ) {
+
+        _is_render_queue_enabled = is_enabled;
+    }
+
+    void Application::set_frame_pipeline(
+        Frame_pipeline* const frame_pipeline
+        ) {
+
+        _frame_pipeline = frame_pipeline;
+    }
+
+    void Application::set_compositor(
+        Compositor* const compositor
+        ) {
+
+        _compositor = compositor;
+    }
+
+    void Application::set_event_callback(
+        std::function<void(sf::Event const&)> const& callback
+        ) {
+
+        _event_callback = callback;
+    }
+
+    void Application::set_frame_callback(
+        std::function<void(sf::Time)> const& callback
+        ) {
+
+        _frame_callback = callback;
+    }
+
+    void Application::set_draw_callback(
+        std::function<void(sf::RenderWindow&)> const& callback
+        ) {
+
+        _draw_callback = callback;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    bool Application::is_animating() const {
+
+        return _is_animating;
+    }
+
+    std::uint64_t Application::get_num_frames_drawn() const {
+
+        return _num_frames_drawn;
+    }
+
+    std::size_t Application::get_num_widgets() const {
+
+        return static_cast<std::size_t>(std::count_if(_widgets.begin(), _widgets.end(), [](Registered_widget const& registered) {
+
+            return registered.widget != nullptr;
+        }));
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    void Application::_dispatch(
+        sf::Event const& event
+        ) {
+
+        if (_event_callback) {
+
+            _event_callback(event);
+        }
+
+        if (event.is<sf::Event::Closed>()) {
+
+            _window->close();
+        }
+
+        _is_dispatching = true;
+
+        // Indexed since slots may register more widgets while dispatching.
+        for (std::size_t i = 0u; i < _widgets.size(); ++i) {
+
+            signals_slots::Signals_slots* const signals = _widgets[i].signals;
+
+            if (signals != nullptr) {
+
+                signals->handle_events(event);
+            }
+        }
+
+        _is_dispatching = false;
+
+        _compact_widgets();
+    }
+
+    bool Application::_run_posted_tasks() {
+
+        std::vector<std::function<void()>> tasks;
+
+        {
+            std::lock_guard<std::mutex> const lock(_posted_tasks_mutex);
+
+            tasks.swap(_posted_tasks);
+        }
+
+        // Run outside the lock so tasks can post more tasks.
+        for (std::function<void()>& task : tasks) {
+
+            task();
+        }
+
+        return !tasks.empty();
+    }
+
+    bool Application::_poll_widgets() {
+
+        bool has_changed = false;
+
+        // Every widget is polled, so each takes its finished work in the same wake.
+        for (Registered_widget const& registered : _widgets) {
+
+            if (registered.widget != nullptr && registered.widget->poll()) {
+
+                has_changed = true;
+            }
+        }
+
+        return has_changed;
+    }
+
+    bool Application::_run_due_timers(
+        sf::Time const now
+        ) {
+
+        bool has_run = false;
+
+        // Look timers up by id each time, callbacks may add or remove timers.
+        std::vector<Timer_id> due_ids;
+
+        for (Timer const& timer : _timers) {
+
+            if (timer.deadline <= now) {
+
+                due_ids.push_back(timer.id);
+            }
+        }
+
+        for (Timer_id const id : due_ids) {
+
+            auto const found = std::find_if(_timers.begin(), _timers.end(), [id](Timer const& timer) {
+
+                return timer.id == id;
+            });
+
+            if (found == _timers.end()) {
+
+                // Removed by an earlier callback.
+                continue;
+            }
+
+            std::function<void()> const callback = found->callback;
+
+            if (found->is_repeating) {
+
+                found->deadline += found->interval;
+
+                if (found->deadline <= now) {
+
+                    // Skip missed runs instead of firing them in a burst.
+                    found->deadline = now + found->interval;
+                }
+            } else {
+
+                _timers.erase(found);
+            }
+
+            callback();
+            has_run = true;
+        }
+
+        return has_run;
+    }
+
+    sf::Time Application::_get_next_deadline() const {
+
+        if (_timers.empty()) {
+
+            return sf::Time::Zero;
+        }
+
+        auto const earliest = std::min_element(_timers.begin(), _timers.end(), [](Timer const& a, Timer const& b) {
+
+            return a.deadline < b.deadline;
+        });
+
+        return earliest->deadline;
+    }
+
+    void Application::_wait(
+        sf::Time const timeout
+        ) {
+
+        // SFML has no way to wake a window's event wait from another thread, its
+        // waitEvent() polls every 10 milliseconds. Poll at the same rate but sleep
+        // on the condition so posted tasks and redraws end the wait at once.
+        sf::Time const poll_interval = sf::milliseconds(10);
+        sf::Time const deadline      = _clock.getElapsedTime() + timeout;
+
+        while (true) {
+
+            if (std::optional const event = _window->pollEvent()) {
+
+                _dispatch(*event);
+                _is_redraw_requested = true;
+                return;
+            }
+
+            if (_poll_widgets()) {
+
+                _is_redraw_requested = true;
+                return;
+            }
+
+            sf::Time sleep_time = poll_interval;
+
+            if (timeout != sf::Time::Zero) {
+
+                sf::Time const remaining = deadline - _clock.getElapsedTime();
+
+                if (remaining <= sf::Time::Zero) {
+
+                    return;
+                }
+
+                sleep_time = std::min(sleep_time, remaining);
+            }
+
+            std::unique_lock<std::mutex> lock(_posted_tasks_mutex);
+
+            bool const is_woken = _wake_condition.wait_for(lock, sleep_time.toDuration(), [this]() {
+
+                return _is_wake_requested || !_posted_tasks.empty();
+            });
+
+            if (is_woken) {
+
+                _is_wake_requested = false;
+                return;
+            }
+        }
+    }
+
+    void Application::_wake() {
+
+        {
+            std::lock_guard<std::mutex> const lock(_posted_tasks_mutex);
+
+            _is_wake_requested = true;
+        }
+
+        _wake_condition.notify_one();
+    }
+
+    void Application::_draw_frame(
+        sf::Time const delta_time
+        ) {
+
+        if (_frame_callback) {
+
+            _frame_callback(delta_time);
+        }
+
+        if (!_window->isOpen()) {
+
+            // The frame callback closed the window.
+            return;
+        }
+
+        _window->clear(_clear_color);
+
+        if (_compositor != nullptr) {
+
+            _compositor->draw();
+        } else if (_frame_pipeline != nullptr) {
+
+            _pipeline_widgets.clear();
+
+            for (Registered_widget const& registered : _widgets) {
+
+                _pipeline_widgets.push_back(registered.widget);
+            }
+
+            _frame_pipeline->record(_pipeline_widgets);
+            _frame_pipeline->submit(*_window);
+        } else if (_is_render_queue_enabled) {
+
+            for (Registered_widget const& registered : _widgets) {
+
+                registered.widget->queue_draw(_render_queue);
+            }
+
+            _render_queue.submit(*_window);
+        } else {
+
+            for (Registered_widget const& registered : _widgets) {
+
+                registered.widget->draw();
+            }
+        }
+
+        if (_draw_callback) {
+
+            _draw_callback(*_window);
+        }
+
+        _window->display();
+
+        ++_num_frames_drawn;
+    }
+
+    void Application::_compact_widgets() {
+
+        std::erase_if(_widgets, [](Registered_widget const& registered) {
+
+            return registered.widget == nullptr;
+        });
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
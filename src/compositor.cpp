@@ -0,0 +1,369 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/compositor.h"
+#include "widgets/log.h"
+
+#include <algorithm>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Internal helpers
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Check if two views show exactly the same area
+    bool is_same_view(
+        sf::View const& a,
+        sf::View const& b
+        ) {
+
+        return a.getCenter  () == b.getCenter  () &&
+               a.getSize    () == b.getSize    () &&
+               a.getRotation() == b.getRotation() &&
+               a.getViewport() == b.getViewport();
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Compositor::Compositor(
+        std::shared_ptr<sf::RenderTarget> parent_target
+        ) :
+        _parent_target    (parent_target),
+        _layers           (             ),
+        _widget_layers    (             ),
+        _render_queue     (             ),
+        _num_cache_updates(0u           )
+    {}
+
+    Compositor::~Compositor() {
+
+        for (auto const& [widget, layer] : _widget_layers) {
+
+            widget->_compositor_dirty_flag = nullptr;
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    bool Compositor::add_layer(
+        std::string const& name,
+        int         const  z_order,
+        bool        const  is_cached
+        ) {
+
+        if (has_layer(name)) {
+
+            LOG(WARNING)              <<
+            "Layer is not added as [" <<
+            name                      <<
+            "] is already a layer name.";
+
+            return false;
+        }
+
+        auto layer = std::make_unique<Layer>();
+        layer->name      = name;
+        layer->z_order   = z_order;
+        layer->is_cached = is_cached;
+
+        // Insert after every layer with the same z-order so add order breaks ties.
+        auto const position = std::upper_bound(_layers.begin(), _layers.end(), z_order, [](int const z, std::unique_ptr<Layer> const& other) {
+
+            return z < other->z_order;
+        });
+
+        _layers.insert(position, std::move(layer));
+
+        return true;
+    }
+
+    void Compositor::remove_layer(
+        std::string const& name
+        ) {
+
+        Layer* const layer = _find_layer(name);
+
+        if (layer == nullptr) {
+
+            return;
+        }
+
+        for (Widget* const widget : layer->widgets) {
+
+            widget->_compositor_dirty_flag = nullptr;
+            _widget_layers.erase(widget);
+        }
+
+        std::erase_if(_layers, [layer](std::unique_ptr<Layer> const& other) {
+
+            return other.get() == layer;
+        });
+    }
+
+    void Compositor::attach(
+        Widget&            widget,
+        std::string const& layer_name
+        ) {
+
+        Layer* const layer = _find_layer(layer_name);
+
+        if (layer == nullptr) {
+
+            return;
+        }
+
+        if (_widget_layers.contains(&widget)) {
+
+            detach(widget);
+        }
+
+        layer->widgets.push_back(&widget);
+        layer->is_dirty = true;
+
+        _widget_layers[&widget]       = layer;
+        widget._compositor_dirty_flag = &layer->is_dirty;
+    }
+
+    void Compositor::detach(
+        Widget& widget
+        ) {
+
+        auto const iter = _widget_layers.find(&widget);
+
+        if (iter == _widget_layers.end()) {
+
+            LOG(WARNING) << "Attempting to detach a widget that is not attached to the compositor.";
+            return;
+        }
+
+        Layer* const layer = iter->second;
+
+        std::erase(layer->widgets, &widget);
+        layer->is_dirty = true;
+
+        _widget_layers.erase(iter);
+        widget._compositor_dirty_flag = nullptr;
+    }
+
+    void Compositor::invalidate(
+        std::string const& name
+        ) {
+
+        if (Layer* const layer = _find_layer(name)) {
+
+            layer->is_dirty = true;
+        }
+    }
+
+    void Compositor::invalidate_all() {
+
+        for (std::unique_ptr<Layer> const& layer : _layers) {
+
+            layer->is_dirty = true;
+        }
+    }
+
+    void Compositor::draw() {
+
+        _num_cache_updates = 0u;
+
+        auto temp_ptr = _parent_target.lock();
+
+        if (!temp_ptr) {
+
+            LOG(WARNING) << "Compositor cannot draw as its parent target has expired.";
+            return;
+        }
+
+        for (std::unique_ptr<Layer> const& layer : _layers) {
+
+            if (!layer->is_visible) {
+
+                // Dont draw since layer is hidden.
+            } else if (layer->is_cached && _update_cache(*layer, *temp_ptr)) {
+
+                // The cache holds colors already multiplied by alpha, blending them
+                // with BlendAlpha again would darken every antialiased edge.
+                sf::BlendMode const premultiplied_alpha(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+
+                sf::View const view = temp_ptr->getView();
+
+                temp_ptr->setView(temp_ptr->getDefaultView());
+                temp_ptr->draw(sf::Sprite(layer->cache->getTexture()), premultiplied_alpha);
+                temp_ptr->setView(view);
+            } else {
+
+                _record_layer(*layer, *temp_ptr);
+            }
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Compositor::set_layer_cached(
+        std::string const& name,
+        bool        const  is_cached
+        ) {
+
+        if (Layer* const layer = _find_layer(name)) {
+
+            layer->is_cached = is_cached;
+            layer->is_dirty  = true;
+
+            if (!is_cached) {
+
+                // Free the texture memory, the layer is drawn directly from now on.
+                layer->cache.reset();
+            }
+        }
+    }
+
+    void Compositor::set_layer_visible(
+        std::string const& name,
+        bool        const  is_visible
+        ) {
+
+        if (Layer* const layer = _find_layer(name)) {
+
+            layer->is_visible = is_visible;
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    bool Compositor::has_layer(
+        std::string const& name
+        ) const {
+
+        return std::any_of(_layers.begin(), _layers.end(), [&name](std::unique_ptr<Layer> const& layer) {
+
+            return layer->name == name;
+        });
+    }
+
+    std::size_t Compositor::get_num_layers() const {
+
+        return _layers.size();
+    }
+
+    std::size_t Compositor::get_num_cache_updates() const {
+
+        return _num_cache_updates;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    Compositor::Layer* Compositor::_find_layer(
+        std::string const& name
+        ) const {
+
+        for (std::unique_ptr<Layer> const& layer : _layers) {
+
+            if (layer->name == name) {
+
+                return layer.get();
+            }
+        }
+
+        LOG(WARNING)                <<
+        "There is no layer named [" <<
+        name                        <<
+        "] in the compositor.";
+
+        return nullptr;
+    }
+
+    bool Compositor::_update_cache(
+        Layer&            layer,
+        sf::RenderTarget& target
+        ) {
+
+        sf::Vector2u const size = target.getSize();
+
+        if (!layer.cache) {
+
+            layer.cache = std::make_unique<sf::RenderTexture>();
+        }
+
+        if (layer.cache->getSize() != size) {
+
+            if (!layer.cache->resize(size)) {
+
+                LOG(WARNING)                         <<
+                "Layer ["                            <<
+                layer.name                           <<
+                "] is drawn uncached as its render " <<
+                "texture could not be created.";
+
+                layer.cache.reset();
+                layer.is_cached = false;
+
+                return false;
+            }
+
+            layer.is_dirty = true;
+        }
+
+        if (!is_same_view(layer.cache_view, target.getView())) {
+
+            layer.is_dirty = true;
+        }
+
+        if (layer.is_dirty) {
+
+            // Widgets cull against their parent target's view, the cache must match it.
+            layer.cache->setView(target.getView());
+            layer.cache->clear(sf::Color::Transparent);
+
+            _record_layer(layer, *layer.cache);
+
+            layer.cache->display();
+
+            layer.cache_view = target.getView();
+            layer.is_dirty   = false;
+
+            ++_num_cache_updates;
+        }
+
+        return true;
+    }
+
+    void Compositor::_record_layer(
+        Layer      const& layer,
+        sf::RenderTarget& target
+        ) {
+
+        for (Widget* const widget : layer.widgets) {
+
+            widget->queue_draw(_render_queue);
+        }
+
+        _render_queue.submit(target);
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
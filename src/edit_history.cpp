@@ -0,0 +1,353 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/edit_history.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    template <typename String>
+    Edit_history<String>::Edit_history(
+        std::size_t const max_bytes
+        ) :
+        _undo_edits     (         ),
+        _redo_edits     (         ),
+        _max_bytes      (max_bytes),
+        _num_bytes      (0u       ),
+        _step           (0u       ),
+        _is_step_pending(true     ),
+        _can_coalesce   (false    )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    template <typename String>
+    void Edit_history<String>::begin_step() {
+
+        _is_step_pending = true;
+    }
+
+    template <typename String>
+    void Edit_history<String>::break_coalescing() {
+
+        _can_coalesce = false;
+    }
+
+    template <typename String>
+    void Edit_history<String>::record_insert(
+        std::size_t const offset,
+        View        const text
+        ) {
+
+        _record(offset, text, true);
+    }
+
+    template <typename String>
+    void Edit_history<String>::record_erase(
+        std::size_t const offset,
+        View        const text
+        ) {
+
+        _record(offset, text, false);
+    }
+
+    template <typename String>
+    std::span<typename Edit_history<String>::Edit const> Edit_history<String>::undo() {
+
+        _can_coalesce = false;
+
+        return _move_step(_undo_edits, _redo_edits);
+    }
+
+    template <typename String>
+    std::span<typename Edit_history<String>::Edit const> Edit_history<String>::redo() {
+
+        _can_coalesce = false;
+
+        return _move_step(_redo_edits, _undo_edits);
+    }
+
+    template <typename String>
+    void Edit_history<String>::clear() {
+
+        _undo_edits.clear();
+        _redo_edits.clear();
+
+        _num_bytes       = 0u;
+        _is_step_pending = true;
+        _can_coalesce    = false;
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    template <typename String>
+    void Edit_history<String>::set_max_bytes(
+        std::size_t const max_bytes
+        ) {
+
+        _max_bytes = max_bytes;
+
+        if (_max_bytes == 0u) {
+
+            clear();
+        } else {
+
+            _enforce_cap();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    template <typename String>
+    bool Edit_history<String>::can_undo() const {
+
+        return !_undo_edits.empty();
+    }
+
+    template <typename String>
+    bool Edit_history<String>::can_redo() const {
+
+        return !_redo_edits.empty();
+    }
+
+    template <typename String>
+    std::size_t Edit_history<String>::get_max_bytes() const {
+
+        return _max_bytes;
+    }
+
+    template <typename String>
+    std::size_t Edit_history<String>::get_num_bytes() const {
+
+        return _num_bytes;
+    }
+
+    template <typename String>
+    std::size_t Edit_history<String>::get_num_edits() const {
+
+        return _undo_edits.size() + _redo_edits.size();
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    template <typename String>
+    void Edit_history<String>::_record(
+        std::size_t const offset,
+        View        const text,
+        bool        const is_insert
+        ) {
+
+        if (text.empty()) {
+
+            return;
+        }
+
+        // A new edit makes the undone ones unreachable.
+        for (Edit const& edit : _redo_edits) {
+
+            _num_bytes -= _get_edit_bytes(edit);
+        }
+
+        _redo_edits.clear();
+
+        if (_max_bytes == 0u) {
+
+            // Dont record since the history is disabled.
+            return;
+        }
+
+        bool const is_single_char = _is_single_char(text);
+
+        if (_can_coalesce && is_single_char && !_undo_edits.empty()) {
+
+            Edit& last = _undo_edits.back();
+
+            bool const is_short  = last.text.size() < MAX_COALESCE;
+            bool       is_merged = false;
+
+            if (is_insert && last.is_insert && is_short && offset == last.offset + last.text.size()) {
+
+                // A space after a word starts a new edit, so undo goes back a word at a time.
+                bool const is_word_end = text.front() == ' ' && last.text.back() != ' ';
+
+                if (!is_word_end) {
+
+                    last.text.append(text);
+                    is_merged = true;
+                }
+            } else if (!is_insert && !last.is_insert && is_short) {
+
+                if (offset + text.size() == last.offset) {
+
+                    // Backspace, the erased text grows to the left.
+                    last.text.insert(0u, text);
+                    last.offset = offset;
+                    is_merged   = true;
+                } else if (offset == last.offset) {
+
+                    // Delete, the erased text grows to the right.
+                    last.text.append(text);
+                    is_merged = true;
+                }
+            }
+
+            if (is_merged) {
+
+                _num_bytes       += text.size() * sizeof(typename String::value_type);
+                _is_step_pending  = false;
+
+                _enforce_cap();
+                return;
+            }
+        }
+
+        if (_is_step_pending) {
+
+            ++_step;
+            _is_step_pending = false;
+        }
+
+        Edit edit{};
+        edit.text      = String(text);
+        edit.offset    = offset;
+        edit.step      = _step;
+        edit.is_insert = is_insert;
+
+        _num_bytes += _get_edit_bytes(edit);
+        _undo_edits.push_back(std::move(edit));
+
+        // Only typing and deleting one character at a time merges, pastes stay separate.
+        _can_coalesce = is_single_char;
+
+        _enforce_cap();
+    }
+
+    template <typename String>
+    std::span<typename Edit_history<String>::Edit const> Edit_history<String>::_move_step(
+        std::vector<Edit>& from,
+        std::vector<Edit>& to
+        ) {
+
+        if (from.empty()) {
+
+            return {};
+        }
+
+        std::size_t const step  = from.back().step;
+        std::size_t       first = from.size() - 1u;
+
+        while (first > 0u && from[first - 1u].step == step) {
+
+            --first;
+        }
+
+        std::size_t const to_size = to.size();
+
+        to.insert(to.end(), std::make_move_iterator(from.begin() + static_cast<std::ptrdiff_t>(first)), std::make_move_iterator(from.end()));
+        from.erase(from.begin() + static_cast<std::ptrdiff_t>(first), from.end());
+
+        return std::span<Edit const>(to.data() + to_size, to.size() - to_size);
+    }
+
+    template <typename String>
+    bool Edit_history<String>::_is_single_char(
+        View const text
+        ) {
+
+        if constexpr (sizeof(typename String::value_type) == 1u) {
+
+            // One UTF-8 lead byte followed only by continuation bytes.
+            if (text.empty() || text.size() > 4u || (static_cast<unsigned char>(text.front()) & 0xC0u) == 0x80u) {
+
+                return false;
+            }
+
+            return std::all_of(text.begin() + 1, text.end(), [](char const unit) {
+
+                return (static_cast<unsigned char>(unit) & 0xC0u) == 0x80u;
+            });
+        } else {
+
+            return text.size() == 1u;
+        }
+    }
+
+    template <typename String>
+    std::size_t Edit_history<String>::_get_edit_bytes(
+        Edit const& edit
+        ) {
+
+        return sizeof(Edit) + edit.text.size() * sizeof(typename String::value_type);
+    }
+
+    template <typename String>
+    void Edit_history<String>::_enforce_cap() {
+
+        if (_num_bytes <= _max_bytes) {
+
+            return;
+        }
+
+        // Dropping down to three quarters of the cap means the next drop is many edits away.
+        std::size_t const target = _max_bytes / 4u * 3u;
+        std::size_t       drop   = 0u;
+
+        while (drop < _undo_edits.size() && _num_bytes > target) {
+
+            std::size_t const step = _undo_edits[drop].step;
+
+            // Whole steps only, half an undo step would leave the text inconsistent.
+            while (drop < _undo_edits.size() && _undo_edits[drop].step == step) {
+
+                _num_bytes -= _get_edit_bytes(_undo_edits[drop]);
+                ++drop;
+            }
+        }
+
+        _undo_edits.erase(_undo_edits.begin(), _undo_edits.begin() + static_cast<std::ptrdiff_t>(drop));
+
+        if (_num_bytes > target) {
+
+            // Only undone edits are left, they are the least likely to be needed.
+            for (Edit const& edit : _redo_edits) {
+
+                _num_bytes -= _get_edit_bytes(edit);
+            }
+
+            _redo_edits.clear();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Explicit instantiations
+------------------------------------------------------------------------------
+*/
+    template class Edit_history<std::string>;
+    template class Edit_history<std::u32string>;
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,115 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/frame_pipeline.h"
+#include "widgets/log.h"
+
+#include <algorithm>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Frame_pipeline::Frame_pipeline(
+        Thread_pool& pool
+        ) :
+        _pool                 (pool),
+        _chunk_queues         (    ),
+        _merged_queue         (    ),
+        _min_widgets_per_chunk(32u ),
+        _num_chunks           (0u  )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Frame_pipeline::record(
+        std::vector<Widget*> const& widgets
+        ) {
+
+        // A few chunks per thread so that fast threads can steal from slow ones.
+        std::size_t const max_chunks = (_pool.get_num_threads() + 1u) * 4u;
+        std::size_t const chunk_size = std::max(_min_widgets_per_chunk, (widgets.size() + max_chunks - 1u) / max_chunks);
+
+        _num_chunks = (widgets.size() + chunk_size - 1u) / chunk_size;
+
+        while (_chunk_queues.size() < _num_chunks) {
+
+            _chunk_queues.push_back(std::make_unique<Render_queue>());
+        }
+
+        // Chunk boundaries are fixed up front so each chunk owns one queue.
+        _pool.parallel_for(_num_chunks, 1u, [&](std::size_t const first_chunk, std::size_t const last_chunk) {
+
+            for (std::size_t chunk = first_chunk; chunk < last_chunk; ++chunk) {
+
+                Render_queue& queue = *_chunk_queues[chunk];
+
+                std::size_t const begin = chunk * chunk_size;
+                std::size_t const end   = std::min(begin + chunk_size, widgets.size());
+
+                for (std::size_t i = begin; i < end; ++i) {
+
+                    widgets[i]->queue_draw(queue);
+                }
+            }
+        });
+    }
+
+    void Frame_pipeline::submit(
+        sf::RenderTarget& target
+        ) {
+
+        for (std::size_t chunk = 0u; chunk < _num_chunks; ++chunk) {
+
+            _merged_queue.append(*_chunk_queues[chunk]);
+        }
+
+        _merged_queue.submit(target);
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Frame_pipeline::set_min_widgets_per_chunk(
+        std::size_t const min_widgets_per_chunk
+        ) {
+
+        if (min_widgets_per_chunk == 0u) {
+
+            LOG(WARNING) << "Minimum widgets per chunk is not set to [0] as at least 1 is required.";
+            return;
+        }
+
+        _min_widgets_per_chunk = min_widgets_per_chunk;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Frame_pipeline::get_num_chunks() const {
+
+        return _num_chunks;
+    }
+
+    Render_queue const& Frame_pipeline::get_merged_queue() const {
+
+        return _merged_queue;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
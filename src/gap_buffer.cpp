@@ -0,0 +1,217 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/gap_buffer.h"
+
+#include <algorithm>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Gap_buffer::Gap_buffer(
+        std::size_t const capacity
+        ) :
+        _buffer   (std::max<std::size_t>(capacity, 1u), U'\0'),
+        _gap_begin(0u                                        ),
+        _gap_end  (_buffer.size()                            )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Gap_buffer::insert(
+        std::u32string_view const text
+        ) {
+
+        _reserve_gap(text.size());
+
+        std::copy(text.begin(), text.end(), _buffer.begin() + _gap_begin);
+        _gap_begin += text.size();
+    }
+
+    std::size_t Gap_buffer::erase_before(
+        std::size_t const count
+        ) {
+
+        std::size_t const num_erased = std::min(count, _gap_begin);
+
+        _gap_begin -= num_erased;
+
+        return num_erased;
+    }
+
+    std::size_t Gap_buffer::erase_after(
+        std::size_t const count
+        ) {
+
+        std::size_t const num_erased = std::min(count, _buffer.size() - _gap_end);
+
+        _gap_end += num_erased;
+
+        return num_erased;
+    }
+
+    void Gap_buffer::clear() {
+
+        _gap_begin = 0u;
+        _gap_end   = _buffer.size();
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Gap_buffer::set_cursor(
+        std::size_t const index
+        ) {
+
+        _move_gap(std::min(index, get_size()));
+    }
+
+    void Gap_buffer::set_text(
+        std::u32string_view const text
+        ) {
+
+        clear();
+        insert(text);
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Gap_buffer::get_cursor() const {
+
+        return _gap_begin;
+    }
+
+    std::size_t Gap_buffer::get_size() const {
+
+        return _buffer.size() - _get_gap_size();
+    }
+
+    bool Gap_buffer::is_empty() const {
+
+        return get_size() == 0u;
+    }
+
+    char32_t Gap_buffer::get_char(
+        std::size_t const index
+        ) const {
+
+        return index < _gap_begin ? _buffer[index] : _buffer[index + _get_gap_size()];
+    }
+
+    std::u32string Gap_buffer::get_text() const {
+
+        return get_text(0u, get_size());
+    }
+
+    std::u32string Gap_buffer::get_text(
+        std::size_t const index,
+        std::size_t const count
+        ) const {
+
+        std::size_t const first = std::min(index, get_size());
+        std::size_t const last  = first + std::min(count, get_size() - first);
+
+        std::u32string text;
+        text.reserve(last - first);
+
+        // Up to two spans, one on each side of the gap.
+        if (first < _gap_begin) {
+
+            std::size_t const span_end = std::min(last, _gap_begin);
+            text.append(_buffer.begin() + first, _buffer.begin() + span_end);
+        }
+
+        if (last > _gap_begin) {
+
+            std::size_t const span_begin = std::max(first, _gap_begin) + _get_gap_size();
+            text.append(_buffer.begin() + span_begin, _buffer.begin() + last + _get_gap_size());
+        }
+
+        return text;
+    }
+
+    std::u32string_view Gap_buffer::get_text_before_cursor() const {
+
+        return std::u32string_view(_buffer.data(), _gap_begin);
+    }
+
+    std::u32string_view Gap_buffer::get_text_after_cursor() const {
+
+        return std::u32string_view(_buffer.data() + _gap_end, _buffer.size() - _gap_end);
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Gap_buffer::_get_gap_size() const {
+
+        return _gap_end - _gap_begin;
+    }
+
+    void Gap_buffer::_move_gap(
+        std::size_t const index
+        ) {
+
+        if (index < _gap_begin) {
+
+            // Characters between the index and the gap move to the back of the gap.
+            std::size_t const num_moved = _gap_begin - index;
+
+            std::copy_backward(_buffer.begin() + index, _buffer.begin() + _gap_begin, _buffer.begin() + _gap_end);
+
+            _gap_begin -= num_moved;
+            _gap_end   -= num_moved;
+        } else if (index > _gap_begin) {
+
+            // Characters after the gap up to the index move to its front.
+            std::size_t const num_moved = index - _gap_begin;
+
+            std::copy(_buffer.begin() + _gap_end, _buffer.begin() + _gap_end + num_moved, _buffer.begin() + _gap_begin);
+
+            _gap_begin += num_moved;
+            _gap_end   += num_moved;
+        }
+    }
+
+    void Gap_buffer::_reserve_gap(
+        std::size_t const count
+        ) {
+
+        if (_get_gap_size() >= count) {
+
+            return;
+        }
+
+        std::size_t const num_after    = _buffer.size() - _gap_end;
+        std::size_t const new_capacity = std::max(_buffer.size() * 2u, get_size() + count + 64u);
+
+        std::vector<char32_t> grown(new_capacity, U'\0');
+
+        std::copy(_buffer.begin(),            _buffer.begin() + _gap_begin, grown.begin());
+        std::copy(_buffer.begin() + _gap_end, _buffer.end(),                grown.end() - num_after);
+
+        _buffer  = std::move(grown);
+        _gap_end = _buffer.size() - num_after;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,633 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_cache.h"
+#include "widgets/log.h"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Cache registry
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Guards the registry
+    std::mutex& get_registry_mutex() {
+
+        static std::mutex registry_mutex;
+
+        return registry_mutex;
+    }
+
+    /// @brief The cache of every font that has one
+    std::unordered_map<sf::Font const*, widgets::Glyph_cache*>& get_registry() {
+
+        static std::unordered_map<sf::Font const*, widgets::Glyph_cache*> registry;
+
+        return registry;
+    }
+
+    /// @brief Caches get() made for fonts without one, kept for the program's lifetime
+    std::vector<std::unique_ptr<widgets::Glyph_cache>>& get_made_caches() {
+
+        static std::vector<std::unique_ptr<widgets::Glyph_cache>> made_caches;
+
+        return made_caches;
+    }
+
+    /// @brief Mix a value into a hash
+    void combine(
+        std::size_t&      hash,
+        std::size_t const value
+        ) {
+
+        hash ^= value + 0x9e3779b97f4a7c15u + (hash << 6u) + (hash >> 2u);
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Glyph_cache::Glyph_cache(
+        sf::Font&                    font,
+        std::filesystem::path const& font_path
+        ) :
+        _font                (font                                         ),
+        _evictable_font      (&font                                        ),
+        _font_path           (font_path                                    ),
+        _size_steps          ({ 6u,  7u,  8u,  9u, 10u, 11u, 12u, 13u, 14u, 15u,
+                               16u, 18u, 20u, 22u, 24u, 26u, 28u, 30u, 32u, 36u,
+                               40u, 44u, 48u, 54u, 60u, 66u, 72u, 80u, 88u, 96u,
+                              112u, 128u}                                  ),
+        _warm_up_sets        (                                             ),
+        _sizes_in_use        (                                             ),
+        _sizes_mutex         (                                             ),
+        _glyphs              (                                             ),
+        _kernings            (                                             ),
+        _metrics             (                                             ),
+        _lookup_mutex        (                                             ),
+        _warm_up_thread      (                                             ),
+        _warm_up_mutex       (                                             ),
+        _is_warming_up       (false                                        ),
+        _is_warm_up_requested(false                                        ),
+        _is_warm_up_stopped  (false                                        ),
+        _memory_budget       (32u * 1024u * 1024u                          ),
+        _num_evictions       (0u                                           ),
+        _generation          (0u                                           )
+    {
+
+        std::lock_guard<std::mutex> const registry_lock(get_registry_mutex());
+
+        get_registry()[&_font] = this;
+    }
+
+    Glyph_cache::Glyph_cache(
+        sf::Font const& font
+        ) :
+        _font                (font                                         ),
+        _evictable_font      (nullptr                                      ),
+        _font_path           (                                             ),
+        _size_steps          ({ 6u,  7u,  8u,  9u, 10u, 11u, 12u, 13u, 14u, 15u,
+                               16u, 18u, 20u, 22u, 24u, 26u, 28u, 30u, 32u, 36u,
+                               40u, 44u, 48u, 54u, 60u, 66u, 72u, 80u, 88u, 96u,
+                              112u, 128u}                                  ),
+        _warm_up_sets        (                                             ),
+        _sizes_in_use        (                                             ),
+        _sizes_mutex         (                                             ),
+        _glyphs              (                                             ),
+        _kernings            (                                             ),
+        _metrics             (                                             ),
+        _lookup_mutex        (                                             ),
+        _warm_up_thread      (                                             ),
+        _warm_up_mutex       (                                             ),
+        _is_warming_up       (false                                        ),
+        _is_warm_up_requested(false                                        ),
+        _is_warm_up_stopped  (false                                        ),
+        _memory_budget       (32u * 1024u * 1024u                          ),
+        _num_evictions       (0u                                           ),
+        _generation          (0u                                           )
+    {}
+
+    Glyph_cache::~Glyph_cache() {
+
+        _is_warm_up_stopped = true;
+        wait_for_warm_up();
+
+        std::lock_guard<std::mutex> const registry_lock(get_registry_mutex());
+
+        auto const iter = get_registry().find(&_font);
+
+        if (iter != get_registry().end() && iter->second == this) {
+
+            get_registry().erase(iter);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    Glyph_cache& Glyph_cache::get(
+        sf::Font const& font
+        ) {
+
+        std::lock_guard<std::mutex> const registry_lock(get_registry_mutex());
+
+        Glyph_cache*& cache = get_registry()[&font];
+
+        if (cache == nullptr) {
+
+            cache = get_made_caches().emplace_back(std::make_unique<Glyph_cache>(font)).get();
+        }
+
+        return *cache;
+    }
+
+    sf::Glyph Glyph_cache::get_glyph(
+        char32_t     const code_point,
+        unsigned int const char_size,
+        bool         const is_bold,
+        float        const outline_thickness
+        ) {
+
+        Glyph_key const key{code_point, char_size, is_bold, outline_thickness};
+
+        {
+            std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+            auto const iter = _glyphs.find(key);
+
+            if (iter != _glyphs.end()) {
+
+                return iter->second;
+            }
+        }
+
+        std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+        sf::Glyph const glyph   = _font.getGlyph(code_point, char_size, is_bold, outline_thickness);
+        Metrics   const metrics = _read_metrics(char_size);
+
+        std::unique_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        // The glyph may have made the page of its size, keep it for get_memory_usage().
+        _glyphs.emplace(key, glyph);
+        _metrics.emplace(char_size, metrics);
+
+        return glyph;
+    }
+
+    float Glyph_cache::get_kerning(
+        char32_t     const first,
+        char32_t     const second,
+        unsigned int const char_size,
+        bool         const is_bold
+        ) {
+
+        if (first == 0u) {
+
+            // Nothing before the first character of a line.
+            return 0.0f;
+        }
+
+        Kerning_key const key{first, second, char_size, is_bold};
+
+        {
+            std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+            auto const iter = _kernings.find(key);
+
+            if (iter != _kernings.end()) {
+
+                return iter->second;
+            }
+        }
+
+        std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+        float const kerning = _font.getKerning(first, second, char_size, is_bold);
+
+        std::unique_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        _kernings.emplace(key, kerning);
+
+        return kerning;
+    }
+
+    Glyph_cache::Metrics Glyph_cache::get_metrics(
+        unsigned int const char_size
+        ) {
+
+        {
+            std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+            auto const iter = _metrics.find(char_size);
+
+            if (iter != _metrics.end()) {
+
+                return iter->second;
+            }
+        }
+
+        std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+        Metrics const metrics = _read_metrics(char_size);
+
+        std::unique_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        _metrics.emplace(char_size, metrics);
+
+        return metrics;
+    }
+
+    bool Glyph_cache::has_glyph(
+        char32_t const code_point
+        ) const {
+
+        std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+        return _font.hasGlyph(code_point);
+    }
+
+    bool Glyph_cache::update_generation(
+        std::uint64_t& generation
+        ) const {
+
+        std::uint64_t const current = get_generation();
+
+        if (generation == current) {
+
+            return false;
+        }
+
+        generation = current;
+
+        return true;
+    }
+
+    unsigned int Glyph_cache::request_size(
+        unsigned int const char_size
+        ) {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        unsigned int const size = _quantize(char_size);
+        ++_sizes_in_use[size];
+
+        return size;
+    }
+
+    void Glyph_cache::release_size(
+        unsigned int const char_size
+        ) {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        auto const iter = _sizes_in_use.find(char_size);
+
+        if (iter == _sizes_in_use.end()) {
+
+            LOG(WARNING)                                  <<
+            "Glyph cache size is not released for size [" <<
+            char_size                                     <<
+            "] as it was not requested.";
+
+            return;
+        }
+
+        if (--iter->second == 0u) {
+
+            _sizes_in_use.erase(iter);
+        }
+    }
+
+    unsigned int Glyph_cache::snap_size(
+        unsigned int const char_size
+        ) const {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        return _quantize(char_size);
+    }
+
+    unsigned int Glyph_cache::get_next_smaller_size(
+        unsigned int const char_size
+        ) const {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        auto const iter = std::lower_bound(_size_steps.begin(), _size_steps.end(), char_size);
+
+        return iter == _size_steps.begin() ? char_size : *std::prev(iter);
+    }
+
+    void Glyph_cache::add_warm_up_set(
+        unsigned int const  char_size,
+        sf::String   const& charset
+        ) {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        _warm_up_sets.push_back({_quantize(char_size), charset});
+    }
+
+    void Glyph_cache::warm_up() {
+
+        std::vector<Warm_up_set> sets;
+
+        {
+            std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+            sets = _warm_up_sets;
+        }
+
+        for (Warm_up_set const& set : sets) {
+
+            for (char32_t const code_point : set.charset) {
+
+                static_cast<void>(get_glyph(code_point, set.char_size, false));
+            }
+        }
+    }
+
+    void Glyph_cache::warm_up_async() {
+
+        std::lock_guard<std::mutex> const warm_up_lock(_warm_up_mutex);
+
+        _is_warm_up_requested = true;
+
+        if (_is_warming_up) {
+
+            // Dont start a worker since the running one starts over from the first set.
+            return;
+        }
+
+        // Join the thread of the previous, finished, warm-up.
+        if (_warm_up_thread.joinable()) {
+
+            _warm_up_thread.join();
+        }
+
+        _is_warming_up = true;
+        _warm_up_thread = std::thread(&Glyph_cache::_run_warm_up, this);
+    }
+
+    void Glyph_cache::wait_for_warm_up() {
+
+        // Not under `_warm_up_mutex`, the worker takes it once more before it finishes.
+        if (_warm_up_thread.joinable()) {
+
+            _warm_up_thread.join();
+        }
+    }
+
+    bool Glyph_cache::trim() {
+
+        if (_evictable_font == nullptr) {
+
+            // Dont evict since the font can not be reopened.
+            return false;
+        }
+
+        std::size_t const memory_usage = get_memory_usage();
+
+        if (memory_usage <= _memory_budget) {
+
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+            // sf::Font frees every page texture when it is opened again.
+            if (!_evictable_font->openFromFile(_font_path)) {
+
+                LOG(ERROR)                            <<
+                "Glyph cache could not reopen font [" <<
+                _font_path.string()                   <<
+                "] to evict its glyphs.";
+
+                return false;
+            }
+
+            std::unique_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+            // Texture rectangles and pages of the old font are gone.
+            _glyphs.clear();
+            _kernings.clear();
+            _metrics.clear();
+
+            ++_generation;
+        }
+
+        ++_num_evictions;
+
+        LOG(INFO)                                 <<
+        "Glyph cache evicted ["                   <<
+        memory_usage                              <<
+        "] bytes of glyph pages, budget is ["     <<
+        _memory_budget                            <<
+        "] bytes.";
+
+        // Rasterizes on the worker, the frame after an eviction does not stall on it.
+        warm_up_async();
+
+        return true;
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Glyph_cache::set_size_steps(
+        std::vector<unsigned int> size_steps
+        ) {
+
+        std::erase(size_steps, 0u);
+        std::sort(size_steps.begin(), size_steps.end());
+        size_steps.erase(std::unique(size_steps.begin(), size_steps.end()), size_steps.end());
+
+        if (size_steps.empty()) {
+
+            LOG(WARNING) << "Glyph cache size steps are not set as at least one non zero size is required.";
+            return;
+        }
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        _size_steps = std::move(size_steps);
+    }
+
+    void Glyph_cache::set_memory_budget(
+        std::size_t const bytes
+        ) {
+
+        _memory_budget = bytes;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    sf::Font const& Glyph_cache::get_font() const {
+
+        return _font;
+    }
+
+    std::vector<unsigned int> Glyph_cache::get_size_steps() const {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        return _size_steps;
+    }
+
+    std::size_t Glyph_cache::get_memory_usage() const {
+
+        // Pages grow under the font lock, every page the font made has metrics.
+        std::lock_guard<std::mutex>         const font_lock  (resources::FONT_MUTEX);
+        std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        std::size_t bytes = 0u;
+
+        for (auto const& [size, metrics] : _metrics) {
+
+            sf::Vector2u const page_size = metrics.texture->getSize();
+            bytes += static_cast<std::size_t>(page_size.x) * page_size.y * 4u;
+        }
+
+        return bytes;
+    }
+
+    std::size_t Glyph_cache::get_num_sizes_in_use() const {
+
+        std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+        return _sizes_in_use.size();
+    }
+
+    std::size_t Glyph_cache::get_num_evictions() const {
+
+        return _num_evictions;
+    }
+
+    bool Glyph_cache::is_warming_up() const {
+
+        return _is_warming_up;
+    }
+
+    std::uint64_t Glyph_cache::get_generation() const {
+
+        return _generation.load();
+    }
+
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Glyph_cache::Glyph_key_hash::operator()(
+        Glyph_key const& key
+        ) const {
+
+        std::size_t hash = std::hash<char32_t>{}(key.code_point);
+
+        combine(hash, std::hash<unsigned int >{}(key.char_size                                    ));
+        combine(hash, std::hash<bool         >{}(key.is_bold                                      ));
+        combine(hash, std::hash<std::uint32_t>{}(std::bit_cast<std::uint32_t>(key.outline_thickness)));
+
+        return hash;
+    }
+
+    std::size_t Glyph_cache::Kerning_key_hash::operator()(
+        Kerning_key const& key
+        ) const {
+
+        std::size_t hash = std::hash<char32_t>{}(key.first);
+
+        combine(hash, std::hash<char32_t    >{}(key.second   ));
+        combine(hash, std::hash<unsigned int>{}(key.char_size));
+        combine(hash, std::hash<bool        >{}(key.is_bold  ));
+
+        return hash;
+    }
+
+    unsigned int Glyph_cache::_quantize(
+        unsigned int const char_size
+        ) const {
+
+        auto const iter = std::upper_bound(_size_steps.begin(), _size_steps.end(), char_size);
+
+        return iter == _size_steps.begin() ? _size_steps.front() : *std::prev(iter);
+    }
+
+    void Glyph_cache::_run_warm_up() {
+
+        while (true) {
+
+            std::vector<Warm_up_set> sets;
+
+            {
+                std::lock_guard<std::mutex> const warm_up_lock(_warm_up_mutex);
+
+                if (!_is_warm_up_requested || _is_warm_up_stopped) {
+
+                    _is_warming_up = false;
+                    return;
+                }
+
+                _is_warm_up_requested = false;
+            }
+
+            {
+                std::lock_guard<std::mutex> const sizes_lock(_sizes_mutex);
+
+                sets = _warm_up_sets;
+            }
+
+            for (Warm_up_set const& set : sets) {
+
+                // Each miss locks the font on its own, so widgets lay out and draw text in between.
+                for (char32_t const code_point : set.charset) {
+
+                    if (_is_warm_up_requested || _is_warm_up_stopped) {
+
+                        break;
+                    }
+
+                    static_cast<void>(get_glyph(code_point, set.char_size, false));
+                }
+            }
+        }
+    }
+
+    Glyph_cache::Metrics Glyph_cache::_read_metrics(
+        unsigned int const char_size
+        ) const {
+
+        Metrics metrics{};
+        metrics.texture             = &_font.getTexture           (char_size);
+        metrics.line_spacing        =  _font.getLineSpacing       (char_size);
+        metrics.underline_position  =  _font.getUnderlinePosition (char_size);
+        metrics.underline_thickness =  _font.getUnderlineThickness(char_size);
+
+        return metrics;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
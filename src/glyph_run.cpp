@@ -0,0 +1,782 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_run.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+/*
+------------------------------------------------------------------------------
+Glyph quads
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Italic shear of sf::Text, 12 degrees in radians
+    float constexpr ITALIC_SHEAR = 0.2094395f;
+
+    /// @brief Padding sf::Text leaves around each glyph so smoothing does not clip it
+    float constexpr GLYPH_PADDING = 1.0f;
+
+    /// @brief Whether a character only advances the pen
+    bool is_whitespace(
+        char32_t const code_point
+        ) {
+
+        return code_point == U' ' || code_point == U'\t' || code_point == U'\n' || code_point == U'\r';
+    }
+
+    /// @brief Write the two triangles of a quad, sheared for italic around the baseline
+    void write_quad(
+        sf::Vertex*         quad,
+        sf::Vector2f const  min_corner,
+        sf::Vector2f const  max_corner,
+        sf::Vector2f const  tex_min,
+        sf::Vector2f const  tex_max,
+        float        const  baseline,
+        float        const  shear,
+        sf::Color    const  color
+        ) {
+
+        float const top_shift    = shear * (min_corner.y - baseline);
+        float const bottom_shift = shear * (max_corner.y - baseline);
+
+        quad[0] = {{min_corner.x - top_shift,    min_corner.y}, color, {tex_min.x, tex_min.y}};
+        quad[1] = {{max_corner.x - top_shift,    min_corner.y}, color, {tex_max.x, tex_min.y}};
+        quad[2] = {{min_corner.x - bottom_shift, max_corner.y}, color, {tex_min.x, tex_max.y}};
+        quad[3] = {{min_corner.x - bottom_shift, max_corner.y}, color, {tex_min.x, tex_max.y}};
+        quad[4] = {{max_corner.x - top_shift,    min_corner.y}, color, {tex_max.x, tex_min.y}};
+        quad[5] = {{max_corner.x - bottom_shift, max_corner.y}, color, {tex_max.x, tex_max.y}};
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Glyph_run::Glyph_run(
+        sf::Font     const& font,
+        unsigned int const  char_size
+        ) :
+        _glyph_cache      (&Glyph_cache::get(font) ),
+        _char_size        (char_size               ),
+        _style            (sf::Text::Style::Regular),
+        _fill_color       (sf::Color::White        ),
+        _string           (                        ),
+        _outline_thickness(0.0f                    ),
+        _outline_color    (sf::Color::Black        ),
+        _pen_x            (1u, 0.0f                ),
+        _pen_y            (1u, 0.0f                ),
+        _vertices         (                        ),
+        _outline_vertices (                        ),
+        _glyph_bounds     (                        ),
+        _line_vertices    (                        ),
+        _local_bounds     (                        ),
+        _first_dirty      (0u                      ),
+        _dirty_end        (ALL                     ),
+        _is_geometry_dirty(true                    ),
+        _texture          (nullptr                 ),
+        _generation       (0u                      ),
+        _is_frozen        (false                   ),
+        _num_glyph_updates(0u                      )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Glyph_run::insert(
+        std::size_t         const index,
+        std::u32string_view const string
+        ) {
+
+        if (string.empty()) {
+
+            return;
+        }
+
+        std::size_t const first = std::min(index, _string.size());
+        std::size_t const count = string.size();
+
+        _string.insert(first, string);
+
+        // The new characters start where the old character at `first` did.
+        _pen_x.insert       (_pen_x.begin()        + first,      count,      _pen_x[first]);
+        _pen_y.insert       (_pen_y.begin()        + first,      count,      _pen_y[first]);
+        _vertices.insert    (_vertices.begin()     + first * 6u, count * 6u, sf::Vertex{}  );
+        _glyph_bounds.insert(_glyph_bounds.begin() + first,      count,      sf::FloatRect{});
+
+        if (!_outline_vertices.empty() || _outline_thickness != 0.0f) {
+
+            _outline_vertices.insert(_outline_vertices.begin() + first * 6u, count * 6u, sf::Vertex{});
+        }
+
+        // Changed characters after the insert move along with it.
+        if (_is_geometry_dirty && _dirty_end != ALL && _dirty_end > first) {
+
+            _dirty_end += count;
+        }
+
+        _invalidate(first, first + count);
+    }
+
+    void Glyph_run::erase(
+        std::size_t const index,
+        std::size_t const count
+        ) {
+
+        std::size_t const first     = std::min(index, _string.size());
+        std::size_t const num_erase = std::min(count, _string.size() - first);
+
+        if (num_erase == 0u) {
+
+            return;
+        }
+
+        _string.erase(first, num_erase);
+
+        // Keep the pen position at `first`, the next character now starts there.
+        _pen_x.erase       (_pen_x.begin()        + first + 1u,  _pen_x.begin()        + first + 1u + num_erase);
+        _pen_y.erase       (_pen_y.begin()        + first + 1u,  _pen_y.begin()        + first + 1u + num_erase);
+        _vertices.erase    (_vertices.begin()     + first * 6u,  _vertices.begin()     + (first + num_erase) * 6u);
+        _glyph_bounds.erase(_glyph_bounds.begin() + first,       _glyph_bounds.begin() + first + num_erase);
+
+        if (!_outline_vertices.empty()) {
+
+            _outline_vertices.erase(_outline_vertices.begin() + first * 6u, _outline_vertices.begin() + (first + num_erase) * 6u);
+        }
+
+        // Changed characters after the erased ones move back with them.
+        if (_is_geometry_dirty && _dirty_end != ALL && _dirty_end > first) {
+
+            _dirty_end = _dirty_end >= first + num_erase ? _dirty_end - num_erase : first;
+        }
+
+        // Nothing changed at `first` itself, but the character now there has a new kerning pair.
+        _invalidate(first, first);
+    }
+
+    std::size_t Glyph_run::find_char_index(
+        float const local_x
+        ) const {
+
+        _update_geometry();
+
+        auto const iter = std::upper_bound(_pen_x.begin(), _pen_x.end(), local_x);
+
+        if (iter == _pen_x.begin()) {
+
+            return 0u;
+        }
+
+        if (iter == _pen_x.end()) {
+
+            return _string.size();
+        }
+
+        // Snap to whichever edge of the character under the point is closer.
+        std::size_t const after = static_cast<std::size_t>(std::distance(_pen_x.begin(), iter));
+
+        return local_x - _pen_x[after - 1u] <= _pen_x[after] - local_x ? after - 1u : after;
+    }
+
+    void Glyph_run::freeze() {
+
+        _update_geometry();
+
+        _is_frozen = true;
+    }
+
+    bool Glyph_run::is_stale() const {
+
+        std::uint64_t generation = _generation;
+
+        return _glyph_cache->update_generation(generation);
+    }
+
+    void Glyph_run::append_vertices(
+        std::vector<sf::Vertex>& vertices
+        ) const {
+
+        _update_geometry();
+
+        vertices.insert(vertices.end(), _outline_vertices.begin(), _outline_vertices.end());
+        vertices.insert(vertices.end(), _vertices.begin(),         _vertices.end()        );
+        vertices.insert(vertices.end(), _line_vertices.begin(),    _line_vertices.end()   );
+    }
+
+    void Glyph_run::append_vertices(
+        std::vector<sf::Vertex>& fill_vertices,
+        std::vector<sf::Vertex>& outline_vertices
+        ) const {
+
+        _update_geometry();
+
+        outline_vertices.insert(outline_vertices.end(), _outline_vertices.begin(), _outline_vertices.end());
+        fill_vertices.insert   (fill_vertices.end(),    _vertices.begin(),         _vertices.end()        );
+        fill_vertices.insert   (fill_vertices.end(),    _line_vertices.begin(),    _line_vertices.end()   );
+    }
+
+    void Glyph_run::draw(
+        sf::RenderTarget& target,
+        sf::RenderStates  states
+        ) const {
+
+        _update_geometry();
+
+        states.transform *= getTransform();
+        states.texture    = _texture;
+
+        // Outlines go under the glyphs, like sf::Text.
+        if (!_outline_vertices.empty()) {
+
+            target.draw(_outline_vertices.data(), _outline_vertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+
+        if (!_vertices.empty()) {
+
+            target.draw(_vertices.data(), _vertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+
+        if (!_line_vertices.empty()) {
+
+            target.draw(_line_vertices.data(), _line_vertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Glyph_run::set_string(
+        std::u32string_view const string
+        ) {
+
+        if (_string == string) {
+
+            // Same string so no need to lay it out again.
+            return;
+        }
+
+        std::size_t const old_size = _string.size();
+        std::size_t const new_size = string.size();
+        std::size_t const shortest = std::min(old_size, new_size);
+
+        std::size_t prefix = 0u;
+
+        while (prefix < shortest && _string[prefix] == string[prefix]) {
+
+            ++prefix;
+        }
+
+        // The suffix may not overlap the prefix in either string.
+        std::size_t suffix = 0u;
+
+        while (suffix < shortest - prefix && _string[old_size - 1u - suffix] == string[new_size - 1u - suffix]) {
+
+            ++suffix;
+        }
+
+        erase (prefix, old_size - prefix - suffix);
+        insert(prefix, string.substr(prefix, new_size - prefix - suffix));
+    }
+
+    void Glyph_run::set_font(
+        sf::Font const& font
+        ) {
+
+        if (&_glyph_cache->get_font() != &font) {
+
+            _glyph_cache = &Glyph_cache::get(font);
+            _invalidate(0u, ALL);
+        }
+    }
+
+    void Glyph_run::set_char_size(
+        unsigned int const char_size
+        ) {
+
+        if (_char_size != char_size) {
+
+            _char_size = char_size;
+            _invalidate(0u, ALL);
+        }
+    }
+
+    void Glyph_run::set_style(
+        std::uint32_t const style
+        ) {
+
+        if (_style != style) {
+
+            _style = style;
+            _invalidate(0u, ALL);
+        }
+    }
+
+    void Glyph_run::set_fill_color(
+        sf::Color const color
+        ) {
+
+        _fill_color = color;
+
+        for (sf::Vertex& vertex : _vertices) {
+
+            vertex.color = color;
+        }
+
+        for (sf::Vertex& vertex : _line_vertices) {
+
+            vertex.color = color;
+        }
+    }
+
+    void Glyph_run::set_outline_thickness(
+        float const thickness
+        ) {
+
+        if (_outline_thickness != thickness) {
+
+            _outline_thickness = thickness;
+
+            // Runs without an outline keep no outline vertices at all.
+            _outline_vertices.assign(_outline_thickness != 0.0f ? _vertices.size() : 0u, sf::Vertex{});
+
+            _invalidate(0u, ALL);
+        }
+    }
+
+    void Glyph_run::set_outline_color(
+        sf::Color const color
+        ) {
+
+        _outline_color = color;
+
+        for (sf::Vertex& vertex : _outline_vertices) {
+
+            vertex.color = color;
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::u32string const& Glyph_run::get_string() const {
+
+        return _string;
+    }
+
+    std::size_t Glyph_run::get_size() const {
+
+        return _string.size();
+    }
+
+    sf::Font const& Glyph_run::get_font() const {
+
+        return _glyph_cache->get_font();
+    }
+
+    Glyph_cache& Glyph_run::get_glyph_cache() const {
+
+        return *_glyph_cache;
+    }
+
+    unsigned int Glyph_run::get_char_size() const {
+
+        return _char_size;
+    }
+
+    sf::Texture const* Glyph_run::get_texture() const {
+
+        _update_geometry();
+
+        return _texture;
+    }
+
+    std::uint32_t Glyph_run::get_style() const {
+
+        return _style;
+    }
+
+    sf::Color Glyph_run::get_fill_color() const {
+
+        return _fill_color;
+    }
+
+    float Glyph_run::get_outline_thickness() const {
+
+        return _outline_thickness;
+    }
+
+    sf::Color Glyph_run::get_outline_color() const {
+
+        return _outline_color;
+    }
+
+    float Glyph_run::get_char_x(
+        std::size_t const index
+        ) const {
+
+        _update_geometry();
+
+        return _pen_x[std::min(index, _string.size())];
+    }
+
+    sf::FloatRect Glyph_run::get_local_bounds() const {
+
+        _update_geometry();
+
+        return _local_bounds;
+    }
+
+    sf::FloatRect Glyph_run::get_global_bounds() const {
+
+        return getTransform().transformRect(get_local_bounds());
+    }
+
+    std::size_t Glyph_run::get_num_glyph_updates() const {
+
+        return _num_glyph_updates;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    void Glyph_run::_invalidate(
+        std::size_t const first,
+        std::size_t const end
+        ) {
+
+        if (_is_geometry_dirty) {
+
+            _first_dirty = std::min(_first_dirty, first);
+            _dirty_end   = _dirty_end == ALL || end == ALL ? ALL : std::max(_dirty_end, end);
+        } else {
+
+            _first_dirty = first;
+            _dirty_end   = end;
+        }
+
+        _is_geometry_dirty = true;
+    }
+
+    void Glyph_run::_update_geometry() const {
+
+        if (_is_frozen) {
+
+            // Dont lay out since the run may be shared between threads.
+            return;
+        }
+
+        // Texture coordinates of every quad are only valid for the page they were built on.
+        if (_glyph_cache->update_generation(_generation)) {
+
+            _first_dirty       = 0u;
+            _dirty_end         = ALL;
+            _is_geometry_dirty = true;
+        }
+
+        if (!_is_geometry_dirty) {
+
+            return;
+        }
+
+        Glyph_cache::Metrics const metrics = _glyph_cache->get_metrics(_char_size);
+
+        _texture = metrics.texture;
+
+        _is_geometry_dirty = false;
+
+        bool  const is_bold          = (_style & sf::Text::Style::Bold) != 0u;
+        bool  const has_outline      = _outline_thickness != 0.0f;
+        float const shear            = (_style & sf::Text::Style::Italic) != 0u ? ITALIC_SHEAR : 0.0f;
+        float const whitespace_width = _glyph_cache->get_glyph(U' ', _char_size, is_bold).advance;
+        float const line_spacing     = metrics.line_spacing;
+        float const baseline         = static_cast<float>(_char_size);
+
+        std::size_t const size  = _string.size();
+        std::size_t const first = std::min(_first_dirty, size);
+
+        // The character after the changed ones is laid out too, its kerning pair changed.
+        std::size_t const layout_end = _dirty_end >= size ? size : _dirty_end + 1u;
+
+        // Characters before the first dirty one keep their quads and pen positions.
+        float    pen_x    = first == 0u ? 0.0f : _pen_x[first];
+        float    pen_y    = first == 0u ? 0.0f : _pen_y[first];
+        char32_t previous = first == 0u ? 0u   : _string[first - 1u];
+
+        sf::Vector2f const padding = {GLYPH_PADDING, GLYPH_PADDING};
+
+        for (std::size_t i = first; i < layout_end; ++i) {
+
+            char32_t const code_point = _string[i];
+
+            _pen_x[i] = pen_x;
+            _pen_y[i] = pen_y;
+
+            pen_x    += _glyph_cache->get_kerning(previous, code_point, _char_size, is_bold);
+            previous  = code_point;
+
+            sf::Vertex* const quad         = _vertices.data() + i * 6u;
+            sf::Vertex* const outline_quad = has_outline ? _outline_vertices.data() + i * 6u : nullptr;
+            sf::Vector2f const origin      = {pen_x, pen_y + baseline};
+
+            if (is_whitespace(code_point)) {
+
+                std::fill(quad, quad + 6, sf::Vertex{origin, _fill_color, {0.0f, 0.0f}});
+
+                if (has_outline) {
+
+                    std::fill(outline_quad, outline_quad + 6, sf::Vertex{origin, _outline_color, {0.0f, 0.0f}});
+                }
+
+                _glyph_bounds[i] = sf::FloatRect(origin, {0.0f, 0.0f});
+
+                if (code_point == U'\n') {
+
+                    pen_x  = 0.0f;
+                    pen_y += line_spacing;
+                } else {
+
+                    pen_x += code_point == U'\t' ? whitespace_width * 4.0f : whitespace_width;
+                }
+
+                continue;
+            }
+
+            if (has_outline) {
+
+                sf::Glyph const outline_glyph = _glyph_cache->get_glyph(code_point, _char_size, is_bold, _outline_thickness);
+
+                sf::Vector2f const tex_min(outline_glyph.textureRect.position);
+                sf::Vector2f const tex_max = tex_min + sf::Vector2f(outline_glyph.textureRect.size);
+
+                write_quad(
+                    outline_quad,
+                    origin  + outline_glyph.bounds.position - padding,
+                    origin  + outline_glyph.bounds.position + outline_glyph.bounds.size + padding,
+                    tex_min - padding,
+                    tex_max + padding,
+                    origin.y,
+                    shear,
+                    _outline_color
+                    );
+            }
+
+            sf::Glyph const glyph = _glyph_cache->get_glyph(code_point, _char_size, is_bold);
+
+            sf::Vector2f const tex_min(glyph.textureRect.position);
+            sf::Vector2f const tex_max = tex_min + sf::Vector2f(glyph.textureRect.size);
+
+            write_quad(
+                quad,
+                origin  + glyph.bounds.position - padding,
+                origin  + glyph.bounds.position + glyph.bounds.size + padding,
+                tex_min - padding,
+                tex_max + padding,
+                origin.y,
+                shear,
+                _fill_color
+                );
+
+            // Bounds cover the sheared glyph, not the padding around it.
+            float const top    = glyph.bounds.position.y;
+            float const bottom = top + glyph.bounds.size.y;
+            float const left   = pen_x + glyph.bounds.position.x - shear * bottom;
+            float const right  = pen_x + glyph.bounds.position.x + glyph.bounds.size.x - shear * top;
+
+            _glyph_bounds[i] = sf::FloatRect({left, origin.y + top}, {right - left, bottom - top});
+
+            pen_x += glyph.advance;
+        }
+
+        if (layout_end < size) {
+
+            _move_glyphs(layout_end, {pen_x - _pen_x[layout_end], pen_y - _pen_y[layout_end]});
+        } else {
+
+            _pen_x[size] = pen_x;
+            _pen_y[size] = pen_y;
+        }
+
+        _num_glyph_updates += layout_end - first;
+
+        _update_lines (metrics);
+        _update_bounds();
+    }
+
+    void Glyph_run::_move_glyphs(
+        std::size_t  const first,
+        sf::Vector2f const offset
+        ) const {
+
+        sf::Vector2f shift = offset;
+
+        std::size_t const size  = _string.size();
+        std::size_t       index = first;
+
+        for (; index < size; ++index) {
+
+            if (shift.x == 0.0f && shift.y == 0.0f) {
+
+                // Nothing further along moves, the usual case for same width digits.
+                return;
+            }
+
+            for (std::size_t v = index * 6u; v < index * 6u + 6u; ++v) {
+
+                _vertices[v].position += shift;
+            }
+
+            if (!_outline_vertices.empty()) {
+
+                for (std::size_t v = index * 6u; v < index * 6u + 6u; ++v) {
+
+                    _outline_vertices[v].position += shift;
+                }
+            }
+
+            _glyph_bounds[index].position += shift;
+
+            _pen_x[index] += shift.x;
+            _pen_y[index] += shift.y;
+
+            // Later lines start at the left edge whatever came before them.
+            if (_string[index] == U'\n') {
+
+                shift.x = 0.0f;
+            }
+        }
+
+        _pen_x[size] += shift.x;
+        _pen_y[size] += shift.y;
+    }
+
+    void Glyph_run::_update_bounds() const {
+
+        // Bounds need every glyph, but only the stored rectangles, no font lookups.
+        bool         has_bounds = false;
+        sf::Vector2f min_corner = {0.0f, 0.0f};
+        sf::Vector2f max_corner = {0.0f, 0.0f};
+
+        auto const add_bounds = [&](sf::Vector2f const corner_a, sf::Vector2f const corner_b) {
+
+            if (!has_bounds) {
+
+                min_corner = corner_a;
+                max_corner = corner_b;
+                has_bounds = true;
+            } else {
+
+                min_corner = {std::min(min_corner.x, corner_a.x), std::min(min_corner.y, corner_a.y)};
+                max_corner = {std::max(max_corner.x, corner_b.x), std::max(max_corner.y, corner_b.y)};
+            }
+        };
+
+        for (sf::FloatRect const& bounds : _glyph_bounds) {
+
+            if (bounds.size.x > 0.0f || bounds.size.y > 0.0f) {
+
+                add_bounds(bounds.position, bounds.position + bounds.size);
+            }
+        }
+
+        for (std::size_t i = 0u; i < _line_vertices.size(); i += 6u) {
+
+            add_bounds(_line_vertices[i].position, _line_vertices[i + 5u].position);
+        }
+
+        // Like sf::Text, the outline widens the bounds on every side.
+        if (has_bounds && _outline_thickness != 0.0f) {
+
+            float const outline = std::abs(std::ceil(_outline_thickness));
+
+            min_corner -= {outline, outline};
+            max_corner += {outline, outline};
+        }
+
+        _local_bounds = sf::FloatRect(min_corner, max_corner - min_corner);
+    }
+
+    void Glyph_run::_update_lines(
+        Glyph_cache::Metrics const& metrics
+        ) const {
+
+        _line_vertices.clear();
+
+        bool const is_underlined       = (_style & sf::Text::Style::Underlined   ) != 0u;
+        bool const is_strike_through   = (_style & sf::Text::Style::StrikeThrough) != 0u;
+
+        if (_string.empty() || (!is_underlined && !is_strike_through)) {
+
+            return;
+        }
+
+        bool  const is_bold   = (_style & sf::Text::Style::Bold) != 0u;
+        float const baseline  = static_cast<float>(_char_size);
+        float const thickness = metrics.underline_thickness;
+
+        sf::FloatRect const x_bounds = _glyph_cache->get_glyph(U'x', _char_size, is_bold).bounds;
+
+        float const underline_offset = metrics.underline_position;
+        float const strike_offset    = x_bounds.position.y + x_bounds.size.y / 2.0f;
+
+        auto const add_line = [&](float const line_y, float const line_length, float const offset) {
+
+            float const top    = std::floor(line_y + baseline + offset - thickness / 2.0f + 0.5f);
+            float const bottom = top + std::floor(thickness + 0.5f);
+
+            // The font page keeps a white texel at (1, 1) for lines.
+            _line_vertices.resize(_line_vertices.size() + 6u);
+
+            write_quad(
+                _line_vertices.data() + _line_vertices.size() - 6u,
+                {0.0f, top},
+                {line_length, bottom},
+                {1.0f, 1.0f},
+                {1.0f, 1.0f},
+                0.0f,
+                0.0f,
+                _fill_color
+                );
+        };
+
+        // One line per line of text, running to the pen position at its end.
+        for (std::size_t i = 0u; i <= _string.size(); ++i) {
+
+            if (i < _string.size() && _string[i] != U'\n') {
+
+                continue;
+            }
+
+            if (_pen_x[i] > 0.0f) {
+
+                if (is_underlined) {
+
+                    add_line(_pen_y[i], _pen_x[i], underline_offset);
+                }
+
+                if (is_strike_through) {
+
+                    add_line(_pen_y[i], _pen_x[i], strike_offset);
+                }
+            }
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
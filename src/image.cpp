@@ -4,6 +4,7 @@ Includes
 ------------------------------------------------------------------------------
 */
 #include "widgets/log.h"
+#include "widgets/render_queue.h"
 #include "widgets/resources.h"
 #include "widgets/image.h"
 #include "widgets/widget.h"
@@ -27,10 +28,10 @@ Construction / Destruction
 ------------------------------------------------------------------------------
 */
     Image::Image(
-        std::shared_ptr<sf::RenderWindow> parent_window,
+        std::shared_ptr<sf::RenderTarget> parent_target,
         sf::Texture const& texture
         ) :
-        Widget       (std::move(parent_window)),
+        Widget       (std::move(parent_target)),
         Signals_slots(/*--------------------*/),
         _sprite      (texture                 )
     {
@@ -39,11 +40,11 @@ Construction / Destruction
     }
 
     Image::Image(
-        std::shared_ptr<sf::RenderWindow> parent_window,
+        std::shared_ptr<sf::RenderTarget> parent_target,
         sf::Texture const& texture,
         sf::IntRect const  texture_rect
         ) :
-        Widget       (std::move(parent_window)),
+        Widget       (std::move(parent_target)),
         Signals_slots(/*--------------------*/),
         _sprite      (texture                 )
     {
@@ -51,6 +52,23 @@ Construction / Destruction
         _sprite.setPosition   (DEFAULT_WIDGET_POS);
         _sprite.setTextureRect(texture_rect      );
     }
+
+    Image::Image(
+        std::shared_ptr<sf::RenderTarget> parent_target,
+        Atlas_region const& region
+        ) :
+        Widget       (std::move(parent_target)                                                      ),
+        Signals_slots(/*--------------------------------------------------------------------------*/),
+        _sprite      (region.texture != nullptr ? *region.texture : GET_EMPTY_TEXTURE(), region.rect)
+    {
+
+        if (region.texture == nullptr) {
+
+            LOG(WARNING) << "Image is built from an invalid atlas region and will be empty.";
+        }
+
+        _sprite.setPosition(DEFAULT_WIDGET_POS);
+    }
 /*
 ------------------------------------------------------------------------------
 Functionality
@@ -61,26 +79,66 @@ Functionality
         if (_current_state == STATE__HIDDEN) {
 
             // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
         } else {
 
             // Can call _update_widget() for final updating
             // of the widget before drawing to the window.
             _update_widget();
 
-            if (!_is_parent_window_nullptr()) {
+            if (!_is_parent_target_nullptr()) {
 
-                auto temp_ptr = _parent_window.lock();
+                auto temp_ptr = _parent_target.lock();
 
                 temp_ptr->draw(_sprite);
             }
         }
     }
 
+    void Image::batch_draw(
+        Sprite_batch& batch
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            batch.add(_sprite);
+        }
+    }
+
+    void Image::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            queue.push(_layer, _sprite);
+        }
+    }
+
     void Image::move(
         sf::Vector2f const offset
         ) {
 
         _sprite.move(offset);
+        _mark_dirty();
     }
 
     void Image::move(
@@ -89,6 +147,7 @@ Functionality
         ) {
 
         _sprite.move({x, y});
+        _mark_dirty();
     }
 
     void Image::rotate(
@@ -96,6 +155,7 @@ Functionality
         ) {
 
         _sprite.rotate(angle);
+        _mark_dirty();
     }
 
     void Image::_update_widget() {
@@ -112,6 +172,7 @@ Set Functions
         ) {
 
         _sprite.setScale(scale);
+        _mark_dirty();
     }
 
     void Image::set_scale(
@@ -120,6 +181,7 @@ Set Functions
         ) {
 
         _sprite.setScale({x, y});
+        _mark_dirty();
     }
 
     void Image::set_pos(
@@ -127,6 +189,7 @@ Set Functions
         ) {
 
         _sprite.setPosition(pos);
+        _mark_dirty();
     }
 
     void Image::set_pos(
@@ -135,6 +198,7 @@ Set Functions
         ) {
 
         _sprite.setPosition({x, y});
+        _mark_dirty();
     }
 
     void Image::set_origin(
@@ -142,6 +206,7 @@ Set Functions
         ) {
 
         _sprite.setOrigin(origin);
+        _mark_dirty();
     }
 
     void Image::set_origin(
@@ -150,6 +215,7 @@ Set Functions
         ) {
 
         _sprite.setOrigin({x, y});
+        _mark_dirty();
     }
 
     void Image::set_rotation(
@@ -157,6 +223,7 @@ Set Functions
         ) {
 
         _sprite.setRotation(angle);
+        _mark_dirty();
     }
 /*
 ------------------------------------------------------------------------------
@@ -212,6 +279,11 @@ Get Functions
 
         return _sprite.getRotation();
     }
+
+    sf::FloatRect Image::get_global_bounds() const {
+
+        return _sprite.getGlobalBounds();
+    }
 }
 /*
 ------------------------------------------------------------------------------
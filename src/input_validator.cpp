@@ -0,0 +1,1019 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/input_validator.h"
+#include "widgets/log.h"
+
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Anonymous namespace BEGIN
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief First character a validator sees, a space
+    char32_t constexpr FIRST_CHAR = U' ';
+
+    /// @brief Number of printable ASCII characters, from ' ' to '~'
+    std::size_t constexpr NUM_ASCII_CHARS = 95u;
+
+    /// @brief Symbol standing for every character past ASCII, after the ASCII ones
+    std::size_t constexpr NON_ASCII_CHAR = NUM_ASCII_CHARS;
+
+    /// @brief Number of symbols a validator tells apart
+    std::size_t constexpr NUM_CHARS = NUM_ASCII_CHARS + 1u;
+
+    /// @brief Most NFA states a pattern may build, before the DFA is made
+    std::size_t constexpr MAX_NFA_STATES = 65536u;
+
+    /// @brief Largest count a `{n,m}` quantifier may use
+    std::size_t constexpr MAX_REPEAT = 255u;
+
+    /// @brief Marks a missing NFA transition
+    std::uint32_t constexpr NO_STATE = 0xFFFFFFFFu;
+
+    /// @brief Set of characters, bit `c - FIRST_CHAR` for ASCII `c`, bit NON_ASCII_CHAR for the rest
+    using Char_set = std::bitset<NUM_CHARS>;
+
+    /// @brief Thompson NFA state, either a character transition or up to two empty ones
+    struct Nfa_state {
+
+        Char_set      chars;
+        std::uint32_t next      = NO_STATE;
+        std::uint32_t epsilon_1 = NO_STATE;
+        std::uint32_t epsilon_2 = NO_STATE;
+    };
+
+    /// @brief Part of the NFA with one entry and one exit without outgoing transitions
+    struct Fragment {
+
+        std::uint32_t start = NO_STATE;
+        std::uint32_t end   = NO_STATE;
+    };
+
+    /// @brief Recursive descent parser building a Thompson NFA from a pattern
+    class Nfa_builder final {
+    public:
+        explicit Nfa_builder(std::string_view const pattern) :
+            _pattern(pattern),
+            _pos    (0u     ),
+            _states (       ),
+            _error  (       )
+        {}
+
+        /// @brief Parse the whole pattern
+        /// @return Fragment Entry and accepting exit, check get_error() first
+        Fragment build() {
+
+            Fragment const fragment = _parse_alternation();
+
+            if (_error.empty() && _pos < _pattern.size()) {
+
+                _fail("unmatched ')'");
+            }
+
+            return fragment;
+        }
+
+        std::vector<Nfa_state> const& get_states() const { return _states; }
+        std::string            const& get_error () const { return _error;  }
+
+    private:
+        std::string_view       _pattern;
+        std::size_t            _pos;
+        std::vector<Nfa_state> _states;
+        std::string            _error;
+
+        void _fail(std::string_view const reason) {
+
+            if (_error.empty()) {
+
+                _error = std::string(reason) + " at " + std::to_string(_pos);
+            }
+        }
+
+        bool _is_at(char const c) const {
+
+            return _pos < _pattern.size() && _pattern[_pos] == c;
+        }
+
+        std::uint32_t _add_state() {
+
+            if (_states.size() >= MAX_NFA_STATES) {
+
+                _fail("pattern too large");
+                return 0u;
+            }
+
+            _states.emplace_back();
+
+            return static_cast<std::uint32_t>(_states.size() - 1u);
+        }
+
+        void _link(std::uint32_t const from, std::uint32_t const to) {
+
+            if (!_error.empty()) {
+
+                return;
+            }
+
+            Nfa_state& state = _states[from];
+
+            if (state.epsilon_1 == NO_STATE) {
+
+                state.epsilon_1 = to;
+            } else {
+
+                state.epsilon_2 = to;
+            }
+        }
+
+        Fragment _make_empty() {
+
+            std::uint32_t const state = _add_state();
+
+            return {state, state};
+        }
+
+        Fragment _make_chars(Char_set const& chars) {
+
+            std::uint32_t const start = _add_state();
+            std::uint32_t const end   = _add_state();
+
+            if (_error.empty()) {
+
+                _states[start].chars = chars;
+                _states[start].next  = end;
+            }
+
+            return {start, end};
+        }
+
+        Fragment _concat(Fragment const first, Fragment const second) {
+
+            _link(first.end, second.start);
+
+            return {first.start, second.end};
+        }
+
+        Fragment _optional(Fragment const fragment) {
+
+            std::uint32_t const start = _add_state();
+            std::uint32_t const end   = _add_state();
+
+            _link(start,        fragment.start);
+            _link(start,        end           );
+            _link(fragment.end, end           );
+
+            return {start, end};
+        }
+
+        Fragment _star(Fragment const fragment) {
+
+            std::uint32_t const start = _add_state();
+            std::uint32_t const end   = _add_state();
+
+            _link(start,        fragment.start);
+            _link(start,        end           );
+            _link(fragment.end, fragment.start);
+            _link(fragment.end, end           );
+
+            return {start, end};
+        }
+
+        Fragment _plus(Fragment const fragment) {
+
+            std::uint32_t const end = _add_state();
+
+            _link(fragment.end, fragment.start);
+            _link(fragment.end, end           );
+
+            return {fragment.start, end};
+        }
+
+        Fragment _parse_alternation() {
+
+            Fragment result = _parse_concat();
+
+            while (_error.empty() && _is_at('|')) {
+
+                ++_pos;
+
+                Fragment const other = _parse_concat();
+
+                std::uint32_t const start = _add_state();
+                std::uint32_t const end   = _add_state();
+
+                _link(start,      result.start);
+                _link(start,      other.start );
+                _link(result.end, end         );
+                _link(other.end,  end         );
+
+                result = {start, end};
+            }
+
+            return result;
+        }
+
+        Fragment _parse_concat() {
+
+            Fragment result = _make_empty();
+
+            while (_error.empty() && _pos < _pattern.size() && !_is_at('|') && !_is_at(')')) {
+
+                result = _concat(result, _parse_repeat());
+            }
+
+            return result;
+        }
+
+        Fragment _parse_repeat() {
+
+            std::size_t const atom_pos = _pos;
+            Fragment          fragment = _parse_atom();
+
+            if (!_error.empty() || _pos >= _pattern.size()) {
+
+                return fragment;
+            }
+
+            switch (_pattern[_pos]) {
+
+            case '*': ++_pos; return _star    (fragment);
+            case '+': ++_pos; return _plus    (fragment);
+            case '?': ++_pos; return _optional(fragment);
+            case '{':                                      break;
+            default : return fragment;
+            }
+
+            ++_pos;
+
+            std::size_t const min     = _parse_count();
+            std::size_t       max     = min;
+            bool              has_max = true;
+
+            if (_is_at(',')) {
+
+                ++_pos;
+
+                has_max = !_is_at('}');
+                max     = has_max ? _parse_count() : min;
+            }
+
+            if (!_is_at('}')) {
+
+                _fail("expected '}'");
+                return fragment;
+            } else if (max < min) {
+
+                _fail("repeat range is reversed");
+                return fragment;
+            }
+
+            ++_pos;
+
+            std::size_t const end_pos = _pos;
+
+            // Every copy is parsed again from the atom's text, the NFA has no shared parts.
+            auto copy_atom = [this, atom_pos, &fragment, is_first = true]() mutable {
+
+                if (is_first) {
+
+                    is_first = false;
+                    return fragment;
+                }
+
+                _pos = atom_pos;
+
+                return _parse_atom();
+            };
+
+            Fragment result = _make_empty();
+
+            for (std::size_t i = 0u; i < min && _error.empty(); ++i) {
+
+                result = _concat(result, copy_atom());
+            }
+
+            if (!has_max) {
+
+                result = _concat(result, _star(copy_atom()));
+            } else {
+
+                for (std::size_t i = min; i < max && _error.empty(); ++i) {
+
+                    result = _concat(result, _optional(copy_atom()));
+                }
+            }
+
+            _pos = end_pos;
+
+            return result;
+        }
+
+        std::size_t _parse_count() {
+
+            std::size_t count     = 0u;
+            std::size_t num_digit = 0u;
+
+            while (_pos < _pattern.size() && _pattern[_pos] >= '0' && _pattern[_pos] <= '9') {
+
+                count = count * 10u + static_cast<std::size_t>(_pattern[_pos] - '0');
+                ++num_digit;
+                ++_pos;
+
+                if (count > MAX_REPEAT) {
+
+                    _fail("repeat count above 255");
+                    return 0u;
+                }
+            }
+
+            if (num_digit == 0u) {
+
+                _fail("expected a repeat count");
+            }
+
+            return count;
+        }
+
+        Fragment _parse_atom() {
+
+            char const c = _pattern[_pos];
+
+            switch (c) {
+
+            case '(': {
+
+                ++_pos;
+
+                Fragment const fragment = _parse_alternation();
+
+                if (!_is_at(')')) {
+
+                    _fail("expected ')'");
+                }
+
+                ++_pos;
+
+                return fragment;
+            }
+            case '[':
+
+                ++_pos;
+                return _make_chars(_parse_class());
+
+            case '.':
+
+                ++_pos;
+                return _make_chars(Char_set().set());
+
+            case '\\':
+
+                ++_pos;
+                return _make_chars(_parse_escape());
+
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+
+                _fail("nothing to repeat");
+                return _make_empty();
+
+            default:
+
+                ++_pos;
+                return _make_chars(_get_char_set(c));
+            }
+        }
+
+        Char_set _parse_class() {
+
+            Char_set chars;
+
+            bool const is_negated = _is_at('^');
+
+            if (is_negated) {
+
+                ++_pos;
+            }
+
+            while (_error.empty() && !_is_at(']')) {
+
+                if (_pos >= _pattern.size()) {
+
+                    _fail("expected ']'");
+                    break;
+                }
+
+                char const first = _pattern[_pos++];
+
+                if (first == '\\') {
+
+                    chars |= _parse_escape();
+                    continue;
+                }
+
+                bool const is_range = _is_at('-') && _pos + 1u < _pattern.size() && _pattern[_pos + 1u] != ']';
+
+                if (!is_range) {
+
+                    chars |= _get_char_set(first);
+                    continue;
+                }
+
+                char const last = _pattern[_pos + 1u];
+                _pos += 2u;
+
+                if (last < first) {
+
+                    _fail("class range is reversed");
+                    break;
+                }
+
+                for (int range_char = first; range_char <= last; ++range_char) {
+
+                    chars |= _get_char_set(static_cast<char>(range_char));
+                }
+            }
+
+            ++_pos;
+
+            return is_negated ? ~chars : chars;
+        }
+
+        Char_set _parse_escape() {
+
+            if (_pos >= _pattern.size()) {
+
+                _fail("pattern ends in '\\'");
+                return {};
+            }
+
+            char const c = _pattern[_pos++];
+
+            Char_set digits;
+            Char_set words = _get_char_set('_');
+
+            for (char d = '0'; d <= '9'; ++d) { digits |= _get_char_set(d); }
+            for (char l = 'a'; l <= 'z'; ++l) { words  |= _get_char_set(l) | _get_char_set(static_cast<char>(l - 'a' + 'A')); }
+
+            words |= digits;
+
+            switch (c) {
+
+            case 'd': return  digits;
+            case 'D': return ~digits;
+            case 'w': return  words;
+            case 'W': return ~words;
+            case 's': return  _get_char_set(' ');
+            case 'S': return ~_get_char_set(' ');
+            default : return  _get_char_set(c);
+            }
+        }
+
+        Char_set _get_char_set(char const c) {
+
+            Char_set chars;
+
+            if (static_cast<unsigned char>(c) < FIRST_CHAR || static_cast<unsigned char>(c) >= FIRST_CHAR + NUM_ASCII_CHARS) {
+
+                _fail("character outside printable ASCII");
+                return chars;
+            }
+
+            chars.set(static_cast<std::size_t>(static_cast<unsigned char>(c) - FIRST_CHAR));
+
+            return chars;
+        }
+    };
+
+    /// @brief Get whether every digit of a string is a given digit
+    bool is_all(std::string_view const digits, char const digit) {
+
+        return std::all_of(digits.begin(), digits.end(), [digit](char const c) { return c == digit; });
+    }
+
+    /// @brief Join patterns into one group matching any of them
+    std::string join_branches(std::vector<std::string> const& branches) {
+
+        std::string pattern = "(";
+
+        for (std::size_t i = 0u; i < branches.size(); ++i) {
+
+            pattern += (i == 0u ? "" : "|") + branches[i];
+        }
+
+        return pattern + ")";
+    }
+
+    /// @brief Pattern for numbers from `low` to `high`, both written with the same number of digits
+    std::string get_same_length_range(std::string_view const low, std::string_view const high) {
+
+        if (low == high) {
+
+            return std::string(low);
+        } else if (low.front() == high.front()) {
+
+            return low.front() + get_same_length_range(low.substr(1u), high.substr(1u));
+        }
+
+        std::size_t const rest         = low.size() - 1u;
+        bool        const is_low_full  = is_all(low.substr(1u),  '0');
+        bool        const is_high_full = is_all(high.substr(1u), '9');
+
+        // The leading digits whose every continuation is in range share one branch.
+        char const middle_first = is_low_full  ? low.front()  : static_cast<char>(low.front()  + 1);
+        char const middle_last  = is_high_full ? high.front() : static_cast<char>(high.front() - 1);
+
+        std::string const any_rest = rest > 0u ? "[0-9]{" + std::to_string(rest) + "}" : "";
+
+        std::vector<std::string> branches;
+
+        if (!is_low_full) {
+
+            branches.push_back(low.front() + get_same_length_range(low.substr(1u), std::string(rest, '9')));
+        }
+
+        if (middle_first <= middle_last) {
+
+            branches.push_back(std::string("[") + middle_first + "-" + middle_last + "]" + any_rest);
+        }
+
+        if (!is_high_full) {
+
+            branches.push_back(high.front() + get_same_length_range(std::string(rest, '0'), high.substr(1u)));
+        }
+
+        return join_branches(branches);
+    }
+
+    /// @brief Pattern for non-negative numbers from `low` to `high`, without leading zeros
+    std::string get_range_pattern(unsigned long long const low, unsigned long long const high) {
+
+        std::vector<std::string> branches;
+
+        unsigned long long length_low = 0u;
+        unsigned long long power      = 10u;
+
+        // One branch per number of digits, each a range of equally long numbers.
+        for (std::size_t length = 1u;; ++length) {
+
+            bool const is_longest = length == 20u;
+
+            unsigned long long const length_high = is_longest ? ~0ull : power - 1u;
+
+            unsigned long long const first = std::max(low,  length_low );
+            unsigned long long const last  = std::min(high, length_high);
+
+            if (first <= last) {
+
+                branches.push_back(get_same_length_range(std::to_string(first), std::to_string(last)));
+            }
+
+            if (is_longest || length_high >= high) {
+
+                break;
+            }
+
+            length_low = length_high + 1u;
+
+            if (length < 19u) {
+
+                power *= 10u;
+            }
+        }
+
+        return join_branches(branches);
+    }
+}
+/*
+------------------------------------------------------------------------------
+Anonymous namespace END
+------------------------------------------------------------------------------
+*/
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Input_validator::Input_validator() :
+        _transitions({DEAD_STATE, 1u}             ),
+        _accepting  ({false, true}                ),
+        _classes    (NUM_CHARS, std::uint8_t{0u}  ),
+        _num_classes(1u                           ),
+        _start_state(1u                           ),
+        _pattern    (/*-------------------------*/)
+    {}
+
+    Input_validator Input_validator::regex(
+        std::string_view const pattern
+        ) {
+
+        Input_validator validator;
+
+        // A failed compile leaves the validator accepting any text.
+        static_cast<void>(validator._compile(pattern));
+
+        return validator;
+    }
+
+    Input_validator Input_validator::integer_range(
+        long long const min,
+        long long const max
+        ) {
+
+        long long const low  = std::min(min, max);
+        long long const high = std::max(min, max);
+
+        // Negated in unsigned so the smallest long long has a magnitude too.
+        auto const magnitude = [](long long const value) {
+
+            return 0ull - static_cast<unsigned long long>(value);
+        };
+
+        std::string pattern;
+
+        if (high < 0) {
+
+            pattern = "-" + get_range_pattern(magnitude(high), magnitude(low));
+        } else if (low < 0) {
+
+            pattern = "(-" + get_range_pattern(1u, magnitude(low)) + "|" + get_range_pattern(0u, static_cast<unsigned long long>(high)) + ")";
+        } else {
+
+            pattern = get_range_pattern(static_cast<unsigned long long>(low), static_cast<unsigned long long>(high));
+        }
+
+        return regex(pattern);
+    }
+
+    Input_validator Input_validator::hex(
+        std::size_t const max_digits,
+        bool        const has_prefix
+        ) {
+
+        std::string const prefix = has_prefix ? "0[xX]" : "";
+        std::string const count  = max_digits > 0u ? "{1," + std::to_string(max_digits) + "}" : "+";
+
+        return regex(prefix + "[0-9A-Fa-f]" + count);
+    }
+
+    Input_validator Input_validator::ipv4() {
+
+        std::string const octet = "(25[0-5]|2[0-4][0-9]|1[0-9][0-9]|[1-9]?[0-9])";
+
+        return regex(octet + "\\." + octet + "\\." + octet + "\\." + octet);
+    }
+
+    Input_validator Input_validator::date(
+        std::string_view const mask
+        ) {
+
+        std::string pattern;
+
+        for (std::size_t i = 0u; i < mask.size();) {
+
+            std::string_view const rest = mask.substr(i);
+
+            if (rest.starts_with("YYYY")) {
+
+                pattern += "[0-9]{4}";
+                i       += 4u;
+            } else if (rest.starts_with("MM")) {
+
+                pattern += "(0[1-9]|1[0-2])";
+                i       += 2u;
+            } else if (rest.starts_with("DD")) {
+
+                pattern += "(0[1-9]|[12][0-9]|3[01])";
+                i       += 2u;
+            } else if (rest.starts_with("hh")) {
+
+                pattern += "([01][0-9]|2[0-3])";
+                i       += 2u;
+            } else if (rest.starts_with("mm") || rest.starts_with("ss")) {
+
+                pattern += "[0-5][0-9]";
+                i       += 2u;
+            } else {
+
+                bool const is_alnum = (rest.front() >= '0' && rest.front() <= '9') ||
+                                      (rest.front() >= 'a' && rest.front() <= 'z') ||
+                                      (rest.front() >= 'A' && rest.front() <= 'Z');
+
+                // Escaped punctuation is always literal, whatever it means in a pattern.
+                if (!is_alnum) {
+
+                    pattern += '\\';
+                }
+
+                pattern += rest.front();
+                i       += 1u;
+            }
+        }
+
+        return regex(pattern);
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    Input_validator::State Input_validator::advance(
+        State    const state,
+        char32_t const code_point
+        ) const {
+
+        bool const is_ascii = code_point < FIRST_CHAR + NUM_ASCII_CHARS;
+
+        // Controls and delete never match, fields do not let them be typed anyway.
+        if (code_point < FIRST_CHAR || code_point == FIRST_CHAR + NUM_ASCII_CHARS) {
+
+            return DEAD_STATE;
+        }
+
+        // Past ASCII every character is one symbol, matched by `.` and negated classes.
+        std::size_t const symbol = is_ascii ? code_point - FIRST_CHAR : NON_ASCII_CHAR;
+
+        return _transitions[state * _num_classes + _classes[symbol]];
+    }
+
+    Input_validator::State Input_validator::run(
+        std::u32string_view const text
+        ) const {
+
+        State state = _start_state;
+
+        for (std::size_t i = 0u; i < text.size() && state != DEAD_STATE; ++i) {
+
+            state = advance(state, text[i]);
+        }
+
+        return state;
+    }
+
+    bool Input_validator::matches(
+        std::u32string_view const text
+        ) const {
+
+        return is_accepting(run(text));
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    Input_validator::State Input_validator::get_start_state() const {
+
+        return _start_state;
+    }
+
+    bool Input_validator::is_accepting(
+        State const state
+        ) const {
+
+        return _accepting[state];
+    }
+
+    std::string const& Input_validator::get_pattern() const {
+
+        return _pattern;
+    }
+
+    std::size_t Input_validator::get_num_states() const {
+
+        return _accepting.size();
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    bool Input_validator::_compile(
+        std::string_view const pattern
+        ) {
+
+        Nfa_builder    builder(pattern);
+        Fragment const nfa = builder.build();
+
+        if (!builder.get_error().empty()) {
+
+            LOG(WARNING)                                          <<
+                "Could not compile validator pattern [" << pattern <<
+                "], "   << builder.get_error()                  <<
+                ". Any text is accepted.";
+            return false;
+        }
+
+        std::vector<Nfa_state> const& nfa_states = builder.get_states();
+
+        // Characters every NFA transition treats alike share a class, and a table column.
+        std::vector<std::uint8_t>           classes(NUM_CHARS, std::uint8_t{0u});
+        std::vector<std::size_t>            class_chars;
+        std::map<std::string, std::uint8_t> signatures;
+
+        for (std::size_t c = 0u; c < NUM_CHARS; ++c) {
+
+            std::string signature;
+
+            for (Nfa_state const& state : nfa_states) {
+
+                if (state.next != NO_STATE) {
+
+                    signature.push_back(state.chars[c] ? '1' : '0');
+                }
+            }
+
+            auto const [iter, is_new] = signatures.try_emplace(signature, static_cast<std::uint8_t>(signatures.size()));
+
+            if (is_new) {
+
+                class_chars.push_back(c);
+            }
+
+            classes[c] = iter->second;
+        }
+
+        std::size_t const num_classes = class_chars.size();
+
+        std::vector<bool> is_in_closure(nfa_states.size(), false);
+
+        auto const get_closure = [&nfa_states, &is_in_closure](std::vector<std::uint32_t> stack) {
+
+            std::vector<std::uint32_t> closure;
+
+            while (!stack.empty()) {
+
+                std::uint32_t const index = stack.back();
+                stack.pop_back();
+
+                if (is_in_closure[index]) {
+
+                    continue;
+                }
+
+                is_in_closure[index] = true;
+                closure.push_back(index);
+
+                if (nfa_states[index].epsilon_1 != NO_STATE) { stack.push_back(nfa_states[index].epsilon_1); }
+                if (nfa_states[index].epsilon_2 != NO_STATE) { stack.push_back(nfa_states[index].epsilon_2); }
+            }
+
+            for (std::uint32_t const index : closure) {
+
+                is_in_closure[index] = false;
+            }
+
+            std::sort(closure.begin(), closure.end());
+
+            return closure;
+        };
+
+        // Subset construction, DFA state 0 is the empty set and so the dead state.
+        std::map<std::vector<std::uint32_t>, State> state_ids;
+        std::vector<std::vector<std::uint32_t>>     state_sets;
+        std::vector<State>                          transitions(num_classes, DEAD_STATE);
+
+        state_ids.emplace(std::vector<std::uint32_t>{}, DEAD_STATE);
+        state_sets.emplace_back();
+
+        auto const add_state = [&](std::vector<std::uint32_t> set) {
+
+            auto const [iter, is_new] = state_ids.try_emplace(set, static_cast<State>(state_sets.size()));
+
+            if (is_new) {
+
+                state_sets.push_back(std::move(set));
+                transitions.resize(state_sets.size() * num_classes, DEAD_STATE);
+            }
+
+            return iter->second;
+        };
+
+        State const start_state = add_state(get_closure({nfa.start}));
+
+        for (std::size_t id = 1u; id < state_sets.size(); ++id) {
+
+            if (state_sets.size() > MAX_STATES) {
+
+                LOG(WARNING)                                          <<
+                    "Validator pattern [" << pattern                  <<
+                    "] compiles to more than " << MAX_STATES          <<
+                    " states. Any text is accepted.";
+                return false;
+            }
+
+            for (std::size_t cls = 0u; cls < num_classes; ++cls) {
+
+                std::vector<std::uint32_t> moved;
+
+                for (std::uint32_t const index : state_sets[id]) {
+
+                    if (nfa_states[index].next != NO_STATE && nfa_states[index].chars[class_chars[cls]]) {
+
+                        moved.push_back(nfa_states[index].next);
+                    }
+                }
+
+                State const target = moved.empty() ? DEAD_STATE : add_state(get_closure(std::move(moved)));
+
+                transitions[id * num_classes + cls] = target;
+            }
+        }
+
+        std::size_t const num_states = state_sets.size();
+
+        // States that can no longer reach a match are folded into the dead state.
+        std::vector<bool> is_live(num_states, false);
+
+        for (std::size_t id = 1u; id < num_states; ++id) {
+
+            is_live[id] = std::binary_search(state_sets[id].begin(), state_sets[id].end(), nfa.end);
+        }
+
+        for (bool is_changed = true; is_changed;) {
+
+            is_changed = false;
+
+            for (std::size_t id = 1u; id < num_states; ++id) {
+
+                for (std::size_t cls = 0u; cls < num_classes && !is_live[id]; ++cls) {
+
+                    if (is_live[transitions[id * num_classes + cls]]) {
+
+                        is_live[id] = true;
+                        is_changed  = true;
+                    }
+                }
+            }
+        }
+
+        // Renumber the live states reachable from the start, dropping the rest.
+        std::vector<State> new_ids(num_states, DEAD_STATE);
+        std::vector<State> order   {DEAD_STATE};
+
+        if (is_live[start_state]) {
+
+            new_ids[start_state] = 1u;
+            order.push_back(start_state);
+        }
+
+        for (std::size_t i = 1u; i < order.size(); ++i) {
+
+            for (std::size_t cls = 0u; cls < num_classes; ++cls) {
+
+                State const target = transitions[order[i] * num_classes + cls];
+
+                if (is_live[target] && new_ids[target] == DEAD_STATE) {
+
+                    new_ids[target] = static_cast<State>(order.size());
+                    order.push_back(target);
+                }
+            }
+        }
+
+        if (order.size() == 1u) {
+
+            LOG(WARNING) << "Validator pattern [" << pattern << "] matches no text, any text is rejected.";
+        }
+
+        _transitions.assign(order.size() * num_classes, DEAD_STATE);
+        _accepting.assign  (order.size(), false);
+
+        for (std::size_t id = 1u; id < order.size(); ++id) {
+
+            _accepting[id] = std::binary_search(state_sets[order[id]].begin(), state_sets[order[id]].end(), nfa.end);
+
+            for (std::size_t cls = 0u; cls < num_classes; ++cls) {
+
+                _transitions[id * num_classes + cls] = new_ids[transitions[order[id] * num_classes + cls]];
+            }
+        }
+
+        _classes     = std::move(classes);
+        _num_classes = num_classes;
+        _start_state = order.size() > 1u ? State{1u} : DEAD_STATE;
+        _pattern     = std::string(pattern);
+
+        return true;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -3,10 +3,15 @@
 Includes
 ------------------------------------------------------------------------------
 */
+#include "widgets/glyph_cache.h"
 #include "widgets/log.h"
+#include "widgets/render_queue.h"
 #include "widgets/resources.h"
 #include "widgets/label.h"
+#include "widgets/text_fit.h"
 #include "widgets/widget.h"
+
+#include <limits>
 /*
 ------------------------------------------------------------------------------
 Using namespaces
@@ -27,17 +32,31 @@ Construction / Destruction
 ------------------------------------------------------------------------------
 */
     Label::Label(
-        std::shared_ptr<sf::RenderWindow> parent_window,
+        std::shared_ptr<sf::RenderTarget> parent_target,
         sf::String const&  string
         ) :
-        Widget       (std::move(parent_window)),
-        Signals_slots(/*--------------------*/),
-        _lbl_text    (DEFAULT_WIDGET_FONT     )
+        Widget        (std::move(parent_target)                                  ),
+        Signals_slots (/*------------------------------------------------------*/),
+        _lbl_run      (DEFAULT_WIDGET_FONT, DEFAULT_GLYPH_CACHE.request_size(30u)),
+        _lbl_char_size(30u                                                       ),
+        _lbl_fit_size (0.0f, 0.0f                                                ),
+        _lbl_string   (string.getData(), string.getSize()                        ),
+        _lbl_wrap     (/*------------------------------------------------------*/),
+        _lbl_wrapped  (/*------------------------------------------------------*/),
+        _lbl_wrap_mode(Wrap_mode::NONE                                           ),
+        _lbl_max_width(0.0f                                                      ),
+        _lbl_sdf_text (nullptr                                                   )
     {
 
-        _lbl_text.setPosition (DEFAULT_WIDGET_POS);
-        _lbl_text.setString   (string            );
-        _lbl_text.setFillColor(sf::Color::Black  );
+        _lbl_run.setPosition   (DEFAULT_WIDGET_POS);
+        _lbl_run.set_fill_color(sf::Color::Black  );
+
+        _fit_text_to_box();
+    }
+
+    Label::~Label() {
+
+        DEFAULT_GLYPH_CACHE.release_size(_lbl_run.get_char_size());
     }
 /*
 ------------------------------------------------------------------------------
@@ -49,17 +68,50 @@ Functionality
         if (_current_state == STATE__HIDDEN) {
 
             // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
         } else {
 
             // Can call _update_widget() for final updating
             // of the widget before drawing to the window.
             _update_widget();
 
-            if (!_is_parent_window_nullptr()) {
+            if (!_is_parent_target_nullptr()) {
+
+                auto temp_ptr = _parent_target.lock();
+
+                if (_lbl_sdf_text) {
+
+                    temp_ptr->draw(*_lbl_sdf_text, _lbl_run.getTransform());
+                } else {
+
+                    temp_ptr->draw(_lbl_run);
+                }
+            }
+        }
+    }
+
+    void Label::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            if (_lbl_sdf_text) {
 
-                auto temp_ptr = _parent_window.lock();
+                queue.push(_layer, *_lbl_sdf_text, _lbl_run.getTransform());
+            } else {
 
-                temp_ptr->draw(_lbl_text);
+                queue.push(_layer, _lbl_run);
             }
         }
     }
@@ -68,7 +120,8 @@ Functionality
         sf::Vector2f const offset
         ) {
 
-        _lbl_text.move(offset);
+        _lbl_run.move(offset);
+        _mark_dirty();
     }
 
     void Label::move(
@@ -76,14 +129,16 @@ Functionality
         float const y
         ) {
 
-        _lbl_text.move({x, y});
+        _lbl_run.move({x, y});
+        _mark_dirty();
     }
 
     void Label::rotate(
         sf::Angle const angle
         ) {
 
-        _lbl_text.rotate(angle);
+        _lbl_run.rotate(angle);
+        _mark_dirty();
     }
 
     void Label::_update_widget() {
@@ -99,7 +154,8 @@ Set Functions
         sf::Vector2f const scale
         ) {
 
-        _lbl_text.setScale(scale);
+        _lbl_run.setScale(scale);
+        _mark_dirty();
     }
 
     void Label::set_scale(
@@ -107,21 +163,48 @@ Set Functions
         float const y
         ) {
 
-        _lbl_text.setScale({x, y});
+        _lbl_run.setScale({x, y});
+        _mark_dirty();
     }
 
     void Label::set_char_size(
         std::uint32_t const char_size
         ) {
 
-        _lbl_text.setCharacterSize(char_size);
+        if (_lbl_char_size != char_size) {
+
+            _lbl_char_size = char_size;
+            _fit_text_to_box();
+            _mark_dirty();
+        }
+    }
+
+    void Label::set_auto_fit_size(
+        sf::Vector2f const size
+        ) {
+
+        if (_lbl_fit_size != size) {
+
+            _lbl_fit_size = size;
+            _fit_text_to_box();
+            _mark_dirty();
+        }
+    }
+
+    void Label::set_auto_fit_size(
+        float const x,
+        float const y
+        ) {
+
+        set_auto_fit_size({x, y});
     }
 
     void Label::set_pos(
         sf::Vector2f const pos
         ) {
 
-        _lbl_text.setPosition(pos);
+        _lbl_run.setPosition(pos);
+        _mark_dirty();
     }
 
     void Label::set_pos(
@@ -129,14 +212,16 @@ Set Functions
         float const y
         ) {
 
-        _lbl_text.setPosition({x, y});
+        _lbl_run.setPosition({x, y});
+        _mark_dirty();
     }
 
     void Label::set_origin(
         sf::Vector2f const origin
         ) {
 
-        _lbl_text.setOrigin(origin);
+        _lbl_run.setOrigin(origin);
+        _mark_dirty();
     }
 
     void Label::set_origin(
@@ -144,28 +229,48 @@ Set Functions
         float const y
         ) {
 
-        _lbl_text.setOrigin({x, y});
+        _lbl_run.setOrigin({x, y});
+        _mark_dirty();
     }
 
     void Label::set_rotation(
         sf::Angle const angle
         ) {
 
-        _lbl_text.setRotation(angle);
+        _lbl_run.setRotation(angle);
+        _mark_dirty();
     }
 
     void Label::set_text_color(
         sf::Color const color
         ) {
 
-        _lbl_text.setFillColor(color);
+        _lbl_run.set_fill_color(color);
+
+        if (_lbl_sdf_text) {
+
+            _lbl_sdf_text->set_fill_color(color);
+        }
+
+        _mark_dirty();
     }
 
     void Label::set_text_string(
         sf::String const string
         ) {
 
-        _lbl_text.setString(string);
+        _lbl_string.assign(string.getData(), string.getSize());
+
+        // Fitting sets the run, which diffs the strings and only lays out what changed.
+        if (_lbl_fit_size.x > 0.0f && _lbl_fit_size.y > 0.0f) {
+
+            _fit_text_to_box();
+        } else {
+
+            _wrap_text();
+        }
+
+        _mark_dirty();
     }
 
     void Label::set_text_style(
@@ -181,10 +286,14 @@ Set Functions
         std::uint32_t const valid_style_mask =
         Regular | Bold | Italic | Underlined | StrikeThrough;
 
-        // Is a valid style.
-        if (style & valid_style_mask) {
+        if (style == _lbl_run.get_style()) {
+
+            // Dont fit again since the style did not change.
+        } else if (style & valid_style_mask) {
 
-            _lbl_text.setStyle(style);
+            _lbl_run.set_style(style);
+            _fit_text_to_box();
+            _mark_dirty();
         } else {
 
             LOG(WARNING)                            <<
@@ -200,81 +309,178 @@ Get Functions
 */
     sf::Vector2f Label::get_scale() const {
 
-        return _lbl_text.getScale();
+        return _lbl_run.getScale();
     }
 
     float Label::get_scale_x() const {
 
-        return _lbl_text.getScale().x;
+        return _lbl_run.getScale().x;
     }
 
     float Label::get_scale_y() const {
 
-        return _lbl_text.getScale().y;
+        return _lbl_run.getScale().y;
     }
 
     sf::Vector2f Label::get_pos() const {
 
-        return _lbl_text.getPosition();
+        return _lbl_run.getPosition();
     }
 
     float Label::get_pos_x() const {
 
-        return _lbl_text.getPosition().x;
+        return _lbl_run.getPosition().x;
     }
 
     float Label::get_pos_y() const {
 
-        return _lbl_text.getPosition().y;
+        return _lbl_run.getPosition().y;
     }
 
     sf::Vector2f Label::get_origin() const {
 
-        return _lbl_text.getOrigin();
+        return _lbl_run.getOrigin();
     }
 
     float Label::get_origin_x() const {
 
-        return _lbl_text.getOrigin().x;
+        return _lbl_run.getOrigin().x;
     }
 
     float Label::get_origin_y() const {
 
-        return _lbl_text.getOrigin().y;
+        return _lbl_run.getOrigin().y;
     }
 
     sf::Angle Label::get_rotation() const {
 
-        return _lbl_text.getRotation();
+        return _lbl_run.getRotation();
+    }
+
+    sf::FloatRect Label::get_global_bounds() const {
+
+        if (_lbl_sdf_text) {
+
+            // The sdf text is drawn with the transform of `_lbl_run`.
+            return _lbl_run.getTransform().transformRect(_lbl_sdf_text->get_local_bounds());
+        }
+
+        return _lbl_run.get_global_bounds();
+    }
+
+    sf::Vector2f Label::get_auto_fit_size() const {
+
+        return _lbl_fit_size;
     }
 
     sf::Color Label::get_text_color() const {
 
-        return _lbl_text.getFillColor();
+        return _lbl_run.get_fill_color();
     }
 
     sf::String Label::get_text_string() const {
 
-        return _lbl_text.getString();
+        return sf::String(_lbl_string);
     }
 
     std::uint32_t Label::get_text_style() const {
 
-        return _lbl_text.getStyle();
+        return _lbl_run.get_style();
     }
 
     void Label::set_text_border_thickness(
         float const thickness
         ) {
 
-        _lbl_text.setOutlineThickness(thickness);
+        if (_lbl_run.get_outline_thickness() != thickness) {
+
+            _lbl_run.set_outline_thickness(thickness);
+            _fit_text_to_box();
+            _mark_dirty();
+        }
     }
 
     void Label::set_text_border_color(
         sf::Color const color
         ) {
 
-        _lbl_text.setOutlineColor(color);
+        _lbl_run.set_outline_color(color);
+        _mark_dirty();
+    }
+
+    void Label::set_wrap_mode(
+        Wrap_mode const mode
+        ) {
+
+        _lbl_wrap_mode = mode;
+        _wrap_text();
+        _mark_dirty();
+    }
+
+    void Label::set_max_width(
+        float const width
+        ) {
+
+        if (width < 0.0f) {
+
+            LOG(WARNING)                                 <<
+            "Max width for widget text is set to [0.0f]" <<
+            " instead of [" << width                     <<
+            "] as it can not be negative.";
+
+            _lbl_max_width = 0.0f;
+        } else {
+
+            _lbl_max_width = width;
+        }
+
+        _wrap_text();
+        _mark_dirty();
+    }
+
+    float Label::get_text_border_thickness() const {
+
+        return _lbl_run.get_outline_thickness();
+    }
+
+    sf::Color Label::get_text_border_color() const {
+
+        return _lbl_run.get_outline_color();
+    }
+
+    void Label::set_sdf_font(
+        Sdf_font* font
+        ) {
+
+        if (font == nullptr) {
+
+            _lbl_sdf_text.reset();
+        } else if (_lbl_sdf_text) {
+
+            _lbl_sdf_text->set_font(*font);
+        } else {
+
+            _lbl_sdf_text = std::make_unique<Sdf_text>(*font);
+            _lbl_sdf_text->set_fill_color(_lbl_run.get_fill_color());
+        }
+
+        _fit_text_to_box();
+        _mark_dirty();
+    }
+
+    Sdf_font* Label::get_sdf_font() const {
+
+        return _lbl_sdf_text ? &_lbl_sdf_text->get_font() : nullptr;
+    }
+
+    Wrap_mode Label::get_wrap_mode() const {
+
+        return _lbl_wrap_mode;
+    }
+
+    float Label::get_max_width() const {
+
+        return _lbl_max_width;
     }
 /*
 ------------------------------------------------------------------------------
@@ -316,15 +522,125 @@ Signals / slots
 Helper Functions
 ------------------------------------------------------------------------------
 */
+    void Label::_fit_text_to_box() {
+
+        bool const         is_auto_fit = _lbl_fit_size.x > 0.0f && _lbl_fit_size.y > 0.0f;
+        unsigned int const size_in_use = _lbl_run.get_char_size();
+        unsigned int       size        = 0u;
+
+        if (_lbl_sdf_text) {
+
+            // Scaling the distance fields rasterizes nothing, so no cache size is requested.
+            if (is_auto_fit) {
+
+                _lbl_sdf_text->set_string(sf::String(_lbl_string));
+                _lbl_sdf_text->fit(_lbl_fit_size, static_cast<float>(_lbl_char_size));
+            } else {
+
+                _lbl_sdf_text->set_char_size(static_cast<float>(_lbl_char_size));
+            }
+
+            _wrap_text();
+            return;
+        }
+
+        if (is_auto_fit) {
+
+            // The fit measures the unwrapped string on a scratch run, so the shown run
+            // is only laid out once, with the wrapped string set below.
+            Glyph_run measure(_lbl_run.get_font(), size_in_use);
+
+            measure.set_style            (_lbl_run.get_style            ());
+            measure.set_outline_thickness(_lbl_run.get_outline_thickness());
+            measure.set_string           (_lbl_string                    );
+
+            size = DEFAULT_TEXT_FIT.fit(measure, _lbl_fit_size, _lbl_char_size);
+            _lbl_run.set_char_size(size);
+        } else {
+
+            size = DEFAULT_GLYPH_CACHE.snap_size(_lbl_char_size);
+            _lbl_run.set_char_size(size);
+        }
+
+        if (size == size_in_use) {
+
+            // Dont request since the run keeps the size it has.
+        } else {
+
+            // Request the new size before releasing the old one, so a size kept in use stays counted.
+            DEFAULT_GLYPH_CACHE.request_size(size);
+            DEFAULT_GLYPH_CACHE.release_size(size_in_use);
+        }
+
+        // Lines break at widths that depend on the size just chosen.
+        _wrap_text();
+    }
+
+    void Label::_wrap_text() {
+
+        bool const is_wrapping = _lbl_wrap_mode != Wrap_mode::NONE && _lbl_max_width > 0.0f;
+
+        if (!is_wrapping) {
+
+            _set_shown_string(_lbl_string);
+            return;
+        }
+
+        float max_width = _lbl_max_width;
+
+        // Measures only if the string, font, size or boldness changed since the last call.
+        if (_lbl_sdf_text) {
+
+            // Sdf text is laid out from the base size glyphs scaled, so measure those.
+            Sdf_font const& font  = _lbl_sdf_text->get_font();
+            float     const scale = _lbl_sdf_text->get_char_size() / static_cast<float>(font.get_base_size());
+
+            _lbl_wrap.analyze(_lbl_string, font.get_font(), font.get_base_size(), sf::Text::Regular);
+
+            max_width = scale > 0.0f ? max_width / scale : std::numeric_limits<float>::max();
+        } else {
+
+            _lbl_wrap.analyze(_lbl_string, _lbl_run.get_font(), _lbl_run.get_char_size(), _lbl_run.get_style());
+        }
+
+        if (_lbl_wrap_mode == Wrap_mode::WRAP) {
+
+            _lbl_wrap.wrap(max_width, _lbl_wrapped);
+        } else {
+
+            _lbl_wrap.elide(max_width, _lbl_wrapped);
+        }
+
+        _set_shown_string(_lbl_wrapped);
+    }
+
+    void Label::_set_shown_string(
+        std::u32string const& string
+        ) {
+
+        _lbl_run.set_string(string);
+
+        if (_lbl_sdf_text) {
+
+            _lbl_sdf_text->set_string(sf::String(string));
+        }
+    }
+
     bool Label::_is_hovering() const {
 
         bool is_hovering = false;
 
         auto temp_ptr = _parent_window.lock();
 
+        // Offscreen widgets have no window to read the mouse position from.
+        if (!temp_ptr) {
+
+            return false;
+        }
+
         sf::Vector2i  const mouse_pos_pixels = sf::Mouse::getPosition    (*temp_ptr       );
         sf::Vector2f  const mouse_pos_coords = temp_ptr->mapPixelToCoords(mouse_pos_pixels);
-        sf::FloatRect const lbl_bounds       = _lbl_text.getGlobalBounds (/*------------*/);
+        sf::FloatRect const lbl_bounds       = get_global_bounds         (/*------------*/);
 
         if (lbl_bounds.contains(mouse_pos_coords)) {
 
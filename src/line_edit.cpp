@@ -3,10 +3,22 @@
 Includes
 ------------------------------------------------------------------------------
 */
+#include "widgets/glyph_cache.h"
 #include "widgets/log.h"
+#include "widgets/render_queue.h"
 #include "widgets/resources.h"
+#include "widgets/input_validator.h"
 #include "widgets/line_edit.h"
+#include "widgets/text_fit.h"
+#include "widgets/unicode_table.h"
 #include "widgets/widget.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
 /*
 ------------------------------------------------------------------------------
 Using namespaces
@@ -27,25 +39,62 @@ Construction / Destruction
 ------------------------------------------------------------------------------
 */
     Line_edit::Line_edit(
-        std::shared_ptr<sf::RenderWindow> parent_window,
+        std::shared_ptr<sf::RenderTarget> parent_target,
         sf::String const&  placeholder_string
         ) :
-        Widget              (std::move(parent_window)),
-        Signals_slots       (/*--------------------*/),
-        _le_placeholder_text(DEFAULT_WIDGET_FONT     ),
-        _le_typing_text     (DEFAULT_WIDGET_FONT     ),
-        _le_rect            (DEFAULT_WIDGET_SIZE     ),
-        _max_chars          (18u                     ),
-        _typed_char         (""                      )
+        Widget                (std::move(parent_target)                                  ),
+        Signals_slots         (/*------------------------------------------------------*/),
+        _le_placeholder_run   (DEFAULT_WIDGET_FONT                                       ),
+        _le_typing_run        (DEFAULT_WIDGET_FONT, DEFAULT_GLYPH_CACHE.request_size(30u)),
+        _le_buffer            (/*------------------------------------------------------*/),
+        _le_history           (/*------------------------------------------------------*/),
+        _le_validator         (/*------------------------------------------------------*/),
+        _le_states            (1u, _le_validator.get_start_state()                       ),
+        _le_index             (/*------------------------------------------------------*/),
+        _le_pending_index     (/*------------------------------------------------------*/),
+        _le_prefix_ranges     (/*------------------------------------------------------*/),
+        _le_query             (/*------------------------------------------------------*/),
+        _le_suggestions       (/*------------------------------------------------------*/),
+        _le_suggestion_ids    (/*------------------------------------------------------*/),
+        _le_dropdown          (DEFAULT_WIDGET_FONT                                       ),
+        _le_max_suggestions   (50u                                                       ),
+        _is_suggestions_dirty (false                                                     ),
+        _is_dropdown_dirty    (false                                                     ),
+        _is_dropdown_dismissed(false                                                     ),
+        _le_anchor            (0u                                                        ),
+        _is_selecting         (false                                                     ),
+        _le_caret             (/*------------------------------------------------------*/),
+        _le_selection_rect    (/*------------------------------------------------------*/),
+        _le_rect              (DEFAULT_WIDGET_SIZE                                       ),
+        _max_chars            (18u                                                       ),
+        _typed_char           (""                                                        ),
+        _le_char_size         (30u                                                       ),
+        _le_fit_width         (0.0f                                                      ),
+        _le_rect_size         (0.0f, 0.0f                                                ),
+        _le_text_offset       (0.0f, 0.0f                                                ),
+        _is_metrics_dirty     (true                                                      ),
+        _le_sdf_placeholder   (nullptr                                                   ),
+        _le_sdf_typing        (nullptr                                                   )
     {
 
-        _le_placeholder_text.setPosition (DEFAULT_WIDGET_POS         );
-        _le_placeholder_text.setString   (placeholder_string         );
-        _le_placeholder_text.setStyle    (sf::Text::Italic           );
-        _le_placeholder_text.setFillColor(sf::Color(0u, 0u, 0u, 127u));
+        _le_placeholder_run.setPosition   (DEFAULT_WIDGET_POS          );
+        _le_placeholder_run.set_string    (placeholder_string.toUtf32());
+        _le_placeholder_run.set_style     (sf::Text::Italic            );
+        _le_placeholder_run.set_fill_color(sf::Color(0u, 0u, 0u, 127u) );
 
         _le_rect.setPosition (DEFAULT_WIDGET_POS  );
         _le_rect.setFillColor(DEFAULT_WIDGET_COLOR);
+
+        _le_caret.setFillColor         (DEFAULT_TEXT_COLOR               );
+        _le_selection_rect.setFillColor(sf::Color(0u, 120u, 215u, 90u));
+
+        _fit_text_to_width();
+    }
+
+    Line_edit::~Line_edit() {
+
+        // The placeholder shares the size of the typing run.
+        DEFAULT_GLYPH_CACHE.release_size(_le_typing_run.get_char_size());
     }
 /*
 ------------------------------------------------------------------------------
@@ -57,33 +106,103 @@ Functionality
         if (_current_state == STATE__HIDDEN) {
 
             // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
         } else {
 
             // Can call _update_widget() for final updating
             // of the widget before drawing to the window.
             _update_widget();
+            _resize_rect();
+
+            if (_le_buffer.is_empty() && !(_current_state == STATE__TYPING)) {
 
-            if (_le_typing_text.getString().isEmpty() && !(_current_state == STATE__TYPING)) {
+                if (!_is_parent_target_nullptr()) {
 
-                _resize_rect(_le_placeholder_text);
+                    auto temp_ptr = _parent_target.lock();
 
-                if (!_is_parent_window_nullptr()) {
+                    temp_ptr->draw(_le_rect);
+                    _draw_text(*temp_ptr, _le_placeholder_run, _le_sdf_placeholder.get());
+                }
+            } else {
+
+                if (!_is_parent_target_nullptr()) {
 
-                    auto temp_ptr = _parent_window.lock();
+                    auto temp_ptr = _parent_target.lock();
 
                     temp_ptr->draw(_le_rect);
-                    temp_ptr->draw(_le_placeholder_text);
+
+                    if (_current_state == STATE__TYPING) {
+
+                        _update_caret();
+                        _update_dropdown();
+
+                        if (has_selection()) {
+
+                            temp_ptr->draw(_le_selection_rect);
+                        }
+
+                        _draw_text(*temp_ptr, _le_typing_run, _le_sdf_typing.get());
+                        temp_ptr->draw(_le_caret);
+
+                        if (_is_dropdown_shown()) {
+
+                            temp_ptr->draw(_le_dropdown);
+                        }
+                    } else {
+
+                        _draw_text(*temp_ptr, _le_typing_run, _le_sdf_typing.get());
+                    }
                 }
+            }
+        }
+    }
+
+    void Line_edit::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+            _resize_rect();
+
+            if (_le_buffer.is_empty() && !(_current_state == STATE__TYPING)) {
+
+                queue.push(_layer, _le_rect);
+                _queue_text(queue, _le_placeholder_run, _le_sdf_placeholder.get());
             } else {
 
-                _resize_rect(_le_typing_text);
+                queue.push(_layer, _le_rect);
 
-                if (!_is_parent_window_nullptr()) {
+                if (_current_state == STATE__TYPING) {
 
-                    auto temp_ptr = _parent_window.lock();
+                    _update_caret();
+                    _update_dropdown();
 
-                    temp_ptr->draw(_le_rect);
-                    temp_ptr->draw(_le_typing_text);
+                    if (has_selection()) {
+
+                        queue.push(_layer, _le_selection_rect);
+                    }
+
+                    _queue_text(queue, _le_typing_run, _le_sdf_typing.get());
+                    queue.push(_layer, _le_caret);
+
+                    // One layer up, so the dropdown covers the widgets below the field.
+                    if (_is_dropdown_shown()) {
+
+                        _le_dropdown.queue_draw(queue, _layer + 1);
+                    }
+                } else {
+
+                    _queue_text(queue, _le_typing_run, _le_sdf_typing.get());
                 }
             }
         }
@@ -93,9 +212,10 @@ Functionality
         sf::Vector2f const offset
         ) {
 
-        _le_typing_text.move     (offset);
-        _le_placeholder_text.move(offset);
-        _le_rect.move            (offset);
+        _le_typing_run.move     (offset);
+        _le_placeholder_run.move(offset);
+        _le_rect.move           (offset);
+        _mark_dirty();
     }
 
     void Line_edit::move(
@@ -103,50 +223,268 @@ Functionality
         float const y
         ) {
 
-        _le_typing_text.move     ({x, y});
-        _le_placeholder_text.move({x, y});
-        _le_rect.move            ({x, y});
+        _le_typing_run.move     ({x, y});
+        _le_placeholder_run.move({x, y});
+        _le_rect.move           ({x, y});
+        _mark_dirty();
     }
 
     void Line_edit::rotate(
         sf::Angle const angle
         ) {
 
-        _le_typing_text.rotate     (angle);
-        _le_placeholder_text.rotate(angle);
-        _le_rect.rotate            (angle);
+        _le_typing_run.rotate     (angle);
+        _le_placeholder_run.rotate(angle);
+        _le_rect.rotate           (angle);
+        _mark_dirty();
     }
 
-    void Line_edit::_update_widget() {
+    bool Line_edit::poll() {
+
+        if (!_le_pending_index.valid() || _le_pending_index.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+
+            return false;
+        }
+
+        _le_index = _le_pending_index.get();
+        _le_prefix_ranges.clear();
+        _le_query.clear();
+        _is_suggestions_dirty = true;
 
+        // Suggestions for the text already typed show without waiting for input.
+        _mark_dirty();
+
+        return true;
     }
 
     void Line_edit::append_typed_char() {
 
-        sf::String const typing_text = _le_typing_text.getString();
-        size_t     const num_chars   = typing_text.getSize();
+        if (_current_state == STATE__TYPING) {
 
-        bool const is_typing         = _current_state == STATE__TYPING;
-        bool const can_append_char   = num_chars < _max_chars;
-        bool const is_printable_char = *_typed_char.getData() >= 32u && *_typed_char.getData() < 127u;
+            insert_text(_typed_char);
+        }
+    }
+
+    std::size_t Line_edit::insert_text(
+        sf::String const& text
+        ) {
+
+        auto const [first, last] = _get_selection_range();
+
+        std::size_t const num_chars = _le_buffer.get_size() - (last - first);
+        std::size_t const room      = _max_chars > num_chars ? _max_chars - num_chars : 0u;
+
+        std::u32string_view const input(text.getData(), text.getSize());
+        std::u32string            accepted;
+
+        accepted.reserve(std::min(room, input.size()));
 
-        if (is_typing && can_append_char && is_printable_char) {
+        // One pass filters and truncates, it stops as soon as the field is full.
+        for (std::size_t i = 0u; i < input.size() && accepted.size() < room; ++i) {
 
-            _le_typing_text.setString(typing_text + _typed_char);
+            // Any script, combining marks and emoji joiners, not controls or unassigned code points.
+            if (UNICODE_TABLE.is_insertable(input[i])) {
+
+                accepted.push_back(input[i]);
+            }
         }
+
+        // A rejected edit leaves the text as it was, the validator sees it before the buffer does.
+        if (accepted.empty() || !_is_edit_valid(first, last, accepted)) {
+
+            return 0u;
+        }
+
+        // Replacing the selection is one step, undone together.
+        _le_history.begin_step();
+
+        _erase_selection();
+        _insert_at_cursor(accepted);
+        _mark_dirty();
+
+        return accepted.size();
+    }
+
+    std::size_t Line_edit::paste() {
+
+        return insert_text(sf::Clipboard::getString());
     }
 
     void Line_edit::delete_char() {
 
-        sf::String const typing_text = _le_typing_text.getString();
-        size_t     const num_chars   = typing_text.getSize();
+        if (_current_state != STATE__TYPING) {
+
+            return;
+        }
+
+        std::size_t const cursor = _le_buffer.get_cursor();
+
+        // Backspace takes the whole grapheme cluster, an accented letter or a flag, not
+        // just its last code point. The text before the cursor is contiguous in the buffer.
+        auto const [first, last] = has_selection()
+            ? _get_selection_range()
+            : std::pair<std::size_t, std::size_t>(UNICODE_TABLE.find_previous_grapheme(_le_buffer.get_text_before_cursor(), cursor), cursor);
+
+        // Deleting must leave text the validator can still complete, like typing.
+        if (first == last || !_is_edit_valid(first, last, {})) {
+
+            return;
+        }
+
+        _le_history.begin_step();
+        _erase(first, last - first);
+        _mark_dirty();
+    }
+
+    void Line_edit::delete_char_after() {
+
+        if (_current_state != STATE__TYPING) {
+
+            return;
+        }
+
+        std::size_t const cursor = _le_buffer.get_cursor();
+
+        auto const [first, last] = has_selection()
+            ? _get_selection_range()
+            : std::pair<std::size_t, std::size_t>(cursor, cursor + UNICODE_TABLE.find_next_grapheme(_le_buffer.get_text_after_cursor(), 0u));
+
+        if (first == last || !_is_edit_valid(first, last, {})) {
+
+            return;
+        }
+
+        _le_history.begin_step();
+        _erase(first, last - first);
+        _mark_dirty();
+    }
+
+    void Line_edit::move_cursor(
+        int  const offset,
+        bool const is_extending
+        ) {
+
+        std::size_t const cursor = _le_buffer.get_cursor();
+
+        if (!is_extending && has_selection()) {
+
+            // Collapse the selection to the side moved towards, like most text fields.
+            auto const [first, last] = _get_selection_range();
+            set_cursor(offset < 0 ? first : last);
+        } else if (offset < 0) {
+
+            std::u32string_view const before = _le_buffer.get_text_before_cursor();
+            std::size_t               index  = cursor;
+
+            // Step over whole grapheme clusters so the cursor never splits one.
+            for (int step = 0; step > offset && index > 0u; --step) {
+
+                index = UNICODE_TABLE.find_previous_grapheme(before, index);
+            }
+
+            set_cursor(index, is_extending);
+        } else {
+
+            std::u32string_view const after = _le_buffer.get_text_after_cursor();
+            std::size_t               index = 0u;
+
+            for (int step = 0; step < offset && index < after.size(); ++step) {
+
+                index = UNICODE_TABLE.find_next_grapheme(after, index);
+            }
+
+            set_cursor(cursor + index, is_extending);
+        }
+    }
+
+    void Line_edit::select_all() {
+
+        _le_anchor = 0u;
+        _le_buffer.set_cursor(_le_buffer.get_size());
+        _le_history.break_coalescing();
+        _mark_dirty();
+    }
+
+    void Line_edit::undo() {
+
+        auto const edits = _le_history.undo();
+
+        // Reverted newest first, each costs the size of its text, not of the field.
+        for (auto iter = edits.rbegin(); iter != edits.rend(); ++iter) {
+
+            if (iter->is_insert) {
+
+                _erase(iter->offset, iter->text.size(), false);
+            } else {
+
+                _le_buffer.set_cursor(iter->offset);
+                _insert_at_cursor(iter->text, false);
+            }
+        }
+
+        if (!edits.empty()) {
+
+            _mark_dirty();
+        }
+    }
+
+    void Line_edit::redo() {
+
+        auto const edits = _le_history.redo();
+
+        for (auto const& edit : edits) {
+
+            if (edit.is_insert) {
+
+                _le_buffer.set_cursor(edit.offset);
+                _insert_at_cursor(edit.text, false);
+            } else {
+
+                _erase(edit.offset, edit.text.size(), false);
+            }
+        }
 
-        if (_current_state == STATE__TYPING && num_chars > 0u) {
+        if (!edits.empty()) {
 
-            sf::String const new_typing_text = typing_text.substring(0u, typing_text.getSize() - 1u);
-            _le_typing_text.setString(new_typing_text);
+            _mark_dirty();
         }
     }
+
+    void Line_edit::move_suggestion_highlight(
+        int const offset
+        ) {
+
+        _le_dropdown.move_highlight(offset);
+        _mark_dirty();
+    }
+
+    bool Line_edit::accept_suggestion() {
+
+        if (!_is_dropdown_shown()) {
+
+            return false;
+        }
+
+        std::size_t const highlighted = _le_dropdown.get_highlighted();
+        std::size_t const item        = highlighted == Suggestion_list::NO_ITEM ? 0u : highlighted;
+
+        // Copied, replacing the text finds new suggestions.
+        std::string const suggestion = _le_dropdown.get_items()[item];
+
+        select_all();
+        insert_text(sf::String::fromUtf8(suggestion.begin(), suggestion.end()));
+
+        _is_dropdown_dismissed = true;
+        _mark_dirty();
+
+        return true;
+    }
+
+    void Line_edit::dismiss_suggestions() {
+
+        _is_dropdown_dismissed = true;
+        _mark_dirty();
+    }
 /*
 ------------------------------------------------------------------------------
 Set Functions
@@ -157,23 +495,143 @@ Set Functions
         ) {
 
         _max_chars = max_chars;
+        _fit_text_to_width();
+        _mark_dirty();
     }
 
     void Line_edit::set_char_size(
         std::uint32_t const char_size
         ) {
 
-        _le_typing_text.setCharacterSize     (char_size);
-        _le_placeholder_text.setCharacterSize(char_size);
+        _le_char_size = char_size;
+        _fit_text_to_width();
+        _mark_dirty();
+    }
+
+    void Line_edit::set_cursor(
+        std::size_t const index,
+        bool        const is_extending
+        ) {
+
+        _le_buffer.set_cursor(index);
+
+        if (!is_extending) {
+
+            _le_anchor = _le_buffer.get_cursor();
+        }
+
+        // Typing after moving the cursor is undone separately.
+        _le_history.break_coalescing();
+        _mark_dirty();
+    }
+
+    void Line_edit::set_validator(
+        Input_validator validator
+        ) {
+
+        _le_validator = std::move(validator);
+
+        // Edits made under the old validator may not undo to text the new one accepts.
+        _le_history.clear();
+        _update_states(0u);
+
+        if (_le_states.back() == Input_validator::DEAD_STATE) {
+
+            _erase(0u, _le_buffer.get_size(), false);
+        }
+
+        _mark_dirty();
+    }
+
+    void Line_edit::set_max_history_bytes(
+        std::size_t const max_bytes
+        ) {
+
+        _le_history.set_max_bytes(max_bytes);
+    }
+
+    void Line_edit::set_prefix_index(
+        std::shared_ptr<Prefix_index const> index
+        ) {
+
+        _le_pending_index = {};
+        _le_index         = std::move(index);
+
+        // Ranges of the old index mean nothing in the new one.
+        _le_prefix_ranges.clear();
+        _le_query.clear();
+
+        _is_suggestions_dirty = true;
+        _mark_dirty();
+    }
+
+    void Line_edit::set_prefix_index(
+        std::future<std::shared_ptr<Prefix_index const>> pending_index
+        ) {
+
+        _le_pending_index = std::move(pending_index);
+        _mark_dirty();
+    }
+
+    void Line_edit::set_max_suggestions(
+        std::size_t const max_suggestions
+        ) {
+
+        _le_max_suggestions   = max_suggestions;
+        _is_suggestions_dirty = true;
+        _mark_dirty();
+    }
+
+    void Line_edit::set_num_visible_suggestions(
+        std::size_t const num_rows
+        ) {
+
+        _le_dropdown.set_num_rows(num_rows);
+        _mark_dirty();
+    }
+
+    void Line_edit::set_auto_fit_width(
+        float const width
+        ) {
+
+        _le_fit_width = width;
+        _fit_text_to_width();
+        _mark_dirty();
+    }
+
+    void Line_edit::set_sdf_font(
+        Sdf_font* font
+        ) {
+
+        if (font == nullptr) {
+
+            _le_sdf_placeholder.reset();
+            _le_sdf_typing.reset();
+        } else if (_le_sdf_typing) {
+
+            _le_sdf_placeholder->set_font(*font);
+            _le_sdf_typing->set_font     (*font);
+        } else {
+
+            _le_sdf_placeholder = std::make_unique<Sdf_text>(*font, sf::String(_le_placeholder_run.get_string()));
+            _le_sdf_typing      = std::make_unique<Sdf_text>(*font, sf::String(_le_typing_run.get_string     ()));
+
+            _le_sdf_placeholder->set_fill_color(_le_placeholder_run.get_fill_color());
+            _le_sdf_typing->set_fill_color     (_le_typing_run.get_fill_color     ());
+        }
+
+        _fit_text_to_width();
+        _mark_dirty();
     }
 
     void Line_edit::set_pos(
         sf::Vector2f const pos
         ) {
 
-        _le_typing_text.setPosition     (pos);
-        _le_placeholder_text.setPosition(pos);
-        _le_rect.setPosition            (pos);
+        _le_typing_run.setPosition     (pos);
+        _le_placeholder_run.setPosition(pos);
+        _le_rect.setPosition           (pos);
+        _mark_dirty();
     }
 
     void Line_edit::set_pos(
@@ -181,18 +639,20 @@ Set Functions
         float const y
         ) {
 
-        _le_typing_text.setPosition     ({x, y});
-        _le_placeholder_text.setPosition({x, y});
-        _le_rect.setPosition            ({x, y});
+        _le_typing_run.setPosition     ({x, y});
+        _le_placeholder_run.setPosition({x, y});
+        _le_rect.setPosition           ({x, y});
+        _mark_dirty();
     }
 
     void Line_edit::set_origin(
         sf::Vector2f const origin
         ) {
 
-        _le_typing_text.setOrigin     (origin);
-        _le_placeholder_text.setOrigin(origin);
-        _le_rect.setOrigin            (origin);
+        _le_typing_run.setOrigin     (origin);
+        _le_placeholder_run.setOrigin(origin);
+        _le_rect.setOrigin           (origin);
+        _mark_dirty();
     }
 
     void Line_edit::set_origin(
@@ -200,32 +660,48 @@ Set Functions
         float const y
         ) {
 
-        _le_typing_text.setOrigin     ({x, y});
-        _le_placeholder_text.setOrigin({x, y});
-        _le_rect.setOrigin            ({x, y});
+        _le_typing_run.setOrigin     ({x, y});
+        _le_placeholder_run.setOrigin({x, y});
+        _le_rect.setOrigin           ({x, y});
+        _mark_dirty();
     }
 
     void Line_edit::set_rotation(
         sf::Angle const angle
         ) {
 
-        _le_typing_text.setRotation     (angle);
-        _le_placeholder_text.setRotation(angle);
-        _le_rect.setRotation            (angle);
+        _le_typing_run.setRotation     (angle);
+        _le_placeholder_run.setRotation(angle);
+        _le_rect.setRotation           (angle);
+        _mark_dirty();
     }
 
     void Line_edit::set_typing_text_color(
         sf::Color const color
         ) {
 
-        _le_typing_text.setFillColor(color);
+        _le_typing_run.set_fill_color(color);
+
+        if (_le_sdf_typing) {
+
+            _le_sdf_typing->set_fill_color(color);
+        }
+
+        _mark_dirty();
     }
 
     void Line_edit::set_placeholder_text_color(
         sf::Color const color
         ) {
 
-        _le_placeholder_text.setFillColor(color);
+        _le_placeholder_run.set_fill_color(color);
+
+        if (_le_sdf_placeholder) {
+
+            _le_sdf_placeholder->set_fill_color(color);
+        }
+
+        _mark_dirty();
     }
 
     void Line_edit::set_typing_text_style(
@@ -244,7 +720,8 @@ Set Functions
         // Is a valid style.
         if (style & valid_style_mask) {
 
-            _le_typing_text.setStyle(style);
+            _le_typing_run.set_style(style);
+            _mark_dirty();
         } else {
 
             LOG(WARNING)                            <<
@@ -270,7 +747,8 @@ Set Functions
         // Is a valid style.
         if (style & valid_style_mask) {
 
-            _le_placeholder_text.setStyle(style);
+            _le_placeholder_run.set_style(style);
+            _mark_dirty();
         } else {
 
             LOG(WARNING)                            <<
@@ -296,6 +774,8 @@ Set Functions
 
             _le_rect.setOutlineThickness(thickness);
         }
+
+        _mark_dirty();
     }
 
     void Line_edit::set_border_color(
@@ -303,6 +783,7 @@ Set Functions
         ) {
 
         _le_rect.setOutlineColor(color);
+        _mark_dirty();
     }
 /*
 ------------------------------------------------------------------------------
@@ -311,7 +792,17 @@ Get Functions
 */
     std::uint32_t Line_edit::get_char_size() const {
 
-        return _le_typing_text.getCharacterSize();
+        if (_le_sdf_typing) {
+
+            return static_cast<std::uint32_t>(_le_sdf_typing->get_char_size());
+        }
+
+        return _le_typing_run.get_char_size();
+    }
+
+    float Line_edit::get_auto_fit_width() const {
+
+        return _le_fit_width;
     }
 
     sf::Vector2f Line_edit::get_pos() const {
@@ -349,29 +840,83 @@ Get Functions
         return _le_rect.getRotation();
     }
 
+    sf::FloatRect Line_edit::get_global_bounds() const {
+
+        return _le_rect.getGlobalBounds();
+    }
+
     sf::String Line_edit::get_typing_text_string() const {
 
-        return _le_typing_text.getString();
+        return sf::String(_le_typing_run.get_string());
+    }
+
+    std::size_t Line_edit::get_cursor() const {
+
+        return _le_buffer.get_cursor();
+    }
+
+    Input_validator const& Line_edit::get_validator() const {
+
+        return _le_validator;
+    }
+
+    bool Line_edit::has_acceptable_input() const {
+
+        return _le_validator.is_accepting(_le_states.back());
+    }
+
+    std::size_t Line_edit::get_max_history_bytes() const {
+
+        return _le_history.get_max_bytes();
+    }
+
+    std::shared_ptr<Prefix_index const> Line_edit::get_prefix_index() const {
+
+        return _le_index;
+    }
+
+    std::vector<std::string> const& Line_edit::get_suggestions() const {
+
+        _update_suggestions();
+
+        return _le_suggestions;
+    }
+
+    std::size_t Line_edit::get_max_suggestions() const {
+
+        return _le_max_suggestions;
+    }
+
+    bool Line_edit::has_selection() const {
+
+        return _le_anchor != _le_buffer.get_cursor();
+    }
+
+    sf::String Line_edit::get_selected_text() const {
+
+        auto const [first, last] = _get_selection_range();
+
+        return sf::String(_le_buffer.get_text(first, last - first));
     }
 
     sf::Color Line_edit::get_typing_text_color() const {
 
-        return _le_typing_text.getFillColor();
+        return _le_typing_run.get_fill_color();
     }
 
     sf::Color Line_edit::get_placeholder_text_color() const {
 
-        return _le_placeholder_text.getFillColor();
+        return _le_placeholder_run.get_fill_color();
     }
 
     std::uint32_t Line_edit::get_typing_text_style() const {
 
-        return _le_typing_text.getStyle();
+        return _le_typing_run.get_style();
     }
 
     std::uint32_t Line_edit::get_placeholder_text_style() const {
 
-        return _le_placeholder_text.getStyle();
+        return _le_placeholder_run.get_style();
     }
 
     float Line_edit::get_border_thickness() const {
@@ -383,6 +928,11 @@ Get Functions
 
         return _le_rect.getOutlineColor();
     }
+
+    Sdf_font* Line_edit::get_sdf_font() const {
+
+        return _le_sdf_typing ? &_le_sdf_typing->get_font() : nullptr;
+    }
 /*
 ------------------------------------------------------------------------------
 Signals / slots
@@ -437,12 +987,36 @@ Signals / slots
 
             if (btn_press->button == sf::Mouse::Button::Left) {
 
+                // The dropdown hangs below the field, a click on it is not a click away.
+                if (_is_dropdown_shown()) {
+
+                    std::size_t const item = _find_suggestion_at(btn_press->position);
+
+                    if (item != Suggestion_list::NO_ITEM) {
+
+                        _le_dropdown.set_highlighted(item);
+                        accept_suggestion();
+
+                        _emit_signal(SIGNAL__MOUSE_BUTTON_LEFT_PRESS);
+                        return;
+                    }
+                }
+
                 if (_is_hovering()) {
 
+                    bool const is_shift_held = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LShift) ||
+                                               sf::Keyboard::isKeyPressed(sf::Keyboard::Key::RShift);
+
+                    // Shift clicking extends a selection already being typed in.
+                    bool const is_extending = _current_state == STATE__TYPING && is_shift_held;
+
                     change_state(STATE__TYPING);
+                    set_cursor(_find_cursor_at(btn_press->position), is_extending);
+                    _is_selecting = true;
                 } else {
 
                     change_state(STATE__DEFAULT);
+                    set_cursor(_le_buffer.get_cursor());
                 }
 
                 _emit_signal(SIGNAL__MOUSE_BUTTON_LEFT_PRESS);
@@ -452,6 +1026,78 @@ Signals / slots
 
         Signals_slots::_handle_mouse_button_pressed_events(event);
     }
+
+    void Line_edit::_handle_mouse_button_release_events(
+        sf::Event const& event
+        ) {
+
+        if (auto btn_release = event.getIf<sf::Event::MouseButtonReleased>()) {
+
+            if (btn_release->button == sf::Mouse::Button::Left) {
+
+                _is_selecting = false;
+            }
+        }
+
+        Signals_slots::_handle_mouse_button_release_events(event);
+    }
+
+    void Line_edit::_handle_mouse_moved_events(
+        sf::Event const& event
+        ) {
+
+        if (auto mouse_moved = event.getIf<sf::Event::MouseMoved>()) {
+
+            if (_is_selecting && _current_state == STATE__TYPING) {
+
+                std::size_t const index = _find_cursor_at(mouse_moved->position);
+
+                // Most moves stay over the same character, dont redraw for those.
+                if (index != _le_buffer.get_cursor()) {
+
+                    set_cursor(index, true);
+                }
+            }
+        }
+
+        Signals_slots::_handle_mouse_moved_events(event);
+    }
+
+    void Line_edit::_handle_key_pressed_events(
+        sf::Event const& event
+        ) {
+
+        if (auto const key_pressed = event.getIf<sf::Event::KeyPressed>()) {
+
+            // Keys only drive the dropdown while it is shown, Enter only with a highlight.
+            bool const is_dropdown_shown = _is_dropdown_shown();
+            bool const has_highlight     = _le_dropdown.get_highlighted() != Suggestion_list::NO_ITEM;
+
+            if (_current_state == STATE__TYPING) {
+
+                switch (key_pressed->code) {
+
+                case sf::Keyboard::Key::Left  : move_cursor(-1, key_pressed->shift);                                break;
+                case sf::Keyboard::Key::Right : move_cursor( 1, key_pressed->shift);                                break;
+                case sf::Keyboard::Key::Home  : set_cursor (0u, key_pressed->shift);                                break;
+                case sf::Keyboard::Key::End   : set_cursor (_le_buffer.get_size(), key_pressed->shift);             break;
+                case sf::Keyboard::Key::Delete: delete_char_after();                                                break;
+                case sf::Keyboard::Key::Down  : if (is_dropdown_shown) { move_suggestion_highlight( 1); }           break;
+                case sf::Keyboard::Key::Up    : if (is_dropdown_shown) { move_suggestion_highlight(-1); }           break;
+                case sf::Keyboard::Key::Tab   : if (is_dropdown_shown) { accept_suggestion();           }           break;
+                case sf::Keyboard::Key::Enter : if (is_dropdown_shown && has_highlight) { accept_suggestion(); }    break;
+                case sf::Keyboard::Key::Escape: if (is_dropdown_shown) { dismiss_suggestions();         }           break;
+                case sf::Keyboard::Key::A     : if (key_pressed->control) { select_all(); }                         break;
+                case sf::Keyboard::Key::V     : if (key_pressed->control) { paste();      }                         break;
+                case sf::Keyboard::Key::Y     : if (key_pressed->control) { redo();       }                         break;
+                case sf::Keyboard::Key::Z     : if (key_pressed->control) { key_pressed->shift ? redo() : undo(); } break;
+                default                       :                                                                     break;
+                }
+            }
+        }
+
+        Signals_slots::_handle_key_pressed_events(event);
+    }
 /*
 ------------------------------------------------------------------------------
 Helper Functions
@@ -463,6 +1109,12 @@ Helper Functions
 
         auto temp_ptr = _parent_window.lock();
 
+        // Offscreen widgets have no window to read the mouse position from.
+        if (!temp_ptr) {
+
+            return false;
+        }
+
         sf::Vector2i  const mouse_pos_pixels = sf::Mouse::getPosition    (*temp_ptr       );
         sf::Vector2f  const mouse_pos_coords = temp_ptr->mapPixelToCoords(mouse_pos_pixels);
         sf::FloatRect const lbl_bounds       = _le_rect.getGlobalBounds  (/*------------*/);
@@ -478,25 +1130,409 @@ Helper Functions
         return is_hovering;
     }
 
-    void Line_edit::_resize_rect(
-        sf::Text const& curr_text
+    void Line_edit::_insert_at_cursor(
+        std::u32string_view const text,
+        bool                const is_recorded
         ) {
 
-        // Measurement
-        sf::Text measure(curr_text.getFont());
-        measure.setCharacterSize(curr_text.getCharacterSize());
-        sf::String wide = "";
+        std::size_t const index = _le_buffer.get_cursor();
+
+        if (is_recorded) {
+
+            _le_history.record_insert(index, text);
+        }
+
+        _le_buffer.insert(text);
+        _le_typing_run.insert(index, text);
+        _update_states(index);
 
-        for (std::uint32_t i = 0; i < _max_chars; ++i) {
+        if (_le_sdf_typing) {
 
-            wide += 'W';
+            _le_sdf_typing->set_string(sf::String(_le_typing_run.get_string()));
         }
 
-        measure.setString(wide);
+        _le_anchor = _le_buffer.get_cursor();
+
+        _is_suggestions_dirty  = true;
+        _is_dropdown_dismissed = false;
+    }
+
+    void Line_edit::_erase(
+        std::size_t const index,
+        std::size_t const count,
+        bool        const is_recorded
+        ) {
+
+        if (is_recorded) {
+
+            _le_history.record_erase(index, _le_buffer.get_text(index, count));
+        }
+
+        _le_buffer.set_cursor  (index + count);
+        _le_buffer.erase_before(count        );
+        _le_typing_run.erase   (index, count );
+        _update_states         (index        );
+
+        if (_le_sdf_typing) {
+
+            _le_sdf_typing->set_string(sf::String(_le_typing_run.get_string()));
+        }
+
+        _le_anchor = _le_buffer.get_cursor();
+
+        _is_suggestions_dirty  = true;
+        _is_dropdown_dismissed = false;
+    }
+
+    std::size_t Line_edit::_find_suggestion_at(
+        sf::Vector2i const pixel_pos
+        ) const {
+
+        auto temp_ptr = _parent_window.lock();
+
+        if (!temp_ptr) {
+
+            return Suggestion_list::NO_ITEM;
+        }
+
+        return _le_dropdown.find_item_at(temp_ptr->mapPixelToCoords(pixel_pos));
+    }
+
+    bool Line_edit::_is_dropdown_shown() const {
+
+        return _current_state == STATE__TYPING && !_is_dropdown_dismissed && !_le_dropdown.get_items().empty();
+    }
+
+    void Line_edit::_update_suggestions() const {
+
+        if (!_is_suggestions_dirty) {
+
+            return;
+        }
+
+        _is_suggestions_dirty = false;
+        _is_dropdown_dirty    = true;
+
+        _le_suggestions.clear();
+
+        if (!_le_index) {
+
+            return;
+        }
+
+        // The index compares UTF-8 bytes, which sort like the code points they encode.
+        std::u32string const text = _le_buffer.get_text();
+
+        std::string query;
+        query.reserve(text.size());
+
+        sf::Utf32::toUtf8(text.begin(), text.end(), std::back_inserter(query));
+
+        // Typing or deleting at the end keeps every range up to the cursor, appending a
+        // character costs one binary search within the previous range.
+        std::size_t common = 0u;
+
+        while (common < query.size() && common < _le_query.size() && query[common] == _le_query[common]) {
+
+            ++common;
+        }
+
+        if (_le_prefix_ranges.empty()) {
+
+            _le_prefix_ranges.push_back(_le_index->get_all());
+        }
+
+        _le_prefix_ranges.resize(std::min(common + 1u, _le_prefix_ranges.size()));
+
+        for (std::size_t depth = _le_prefix_ranges.size(); depth <= query.size(); ++depth) {
+
+            _le_prefix_ranges.push_back(_le_index->narrow(_le_prefix_ranges.back(), std::string_view(query).substr(0u, depth)));
+        }
+
+        _le_query = std::move(query);
+
+        // An empty field suggests nothing rather than the whole index.
+        if (_le_query.empty()) {
+
+            return;
+        }
+
+        _le_index->get_top(_le_prefix_ranges.back(), _le_max_suggestions, _le_suggestion_ids);
+
+        for (std::uint32_t const id : _le_suggestion_ids) {
+
+            _le_suggestions.emplace_back(_le_index->get_text(id));
+        }
+    }
+
+    void Line_edit::_update_dropdown() {
+
+        _update_suggestions();
+
+        if (_is_dropdown_dirty) {
+
+            _le_dropdown.set_items(_le_suggestions);
+            _is_dropdown_dirty = false;
+        }
+
+        // Hangs from the bottom left corner of the field, as wide as it.
+        sf::FloatRect const bounds = _le_rect.getGlobalBounds();
+
+        _le_dropdown.set_position ({bounds.position.x, bounds.position.y + bounds.size.y});
+        _le_dropdown.set_width    (bounds.size.x                                         );
+        _le_dropdown.set_char_size(_le_typing_run.get_char_size()                        );
+    }
 
-        // Get useful variables that influence sizing
-        sf::FloatRect const lb      = measure.getLocalBounds();
-        float         const cs      = static_cast<float>(measure.getCharacterSize());
+    bool Line_edit::_erase_selection() {
+
+        if (!has_selection()) {
+
+            return false;
+        }
+
+        auto const [first, last] = _get_selection_range();
+        _erase(first, last - first);
+
+        return true;
+    }
+
+    bool Line_edit::_is_edit_valid(
+        std::size_t         const first,
+        std::size_t         const last,
+        std::u32string_view const text
+        ) const {
+
+        Input_validator::State state = _le_states[first];
+
+        for (char32_t const code_point : text) {
+
+            state = _le_validator.advance(state, code_point);
+
+            if (state == Input_validator::DEAD_STATE) {
+
+                return false;
+            }
+        }
+
+        // The characters after the edit only need checking until the states meet again,
+        // typing at the end checks nothing more.
+        for (std::size_t i = last; i < _le_buffer.get_size() && state != _le_states[i]; ++i) {
+
+            state = _le_validator.advance(state, _le_buffer.get_char(i));
+
+            if (state == Input_validator::DEAD_STATE) {
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Line_edit::_update_states(
+        std::size_t const index
+        ) {
+
+        std::size_t const size = _le_buffer.get_size();
+
+        _le_states.resize(std::min(index, size) + 1u);
+        _le_states.front() = _le_validator.get_start_state();
+
+        for (std::size_t i = _le_states.size() - 1u; i < size; ++i) {
+
+            _le_states.push_back(_le_validator.advance(_le_states[i], _le_buffer.get_char(i)));
+        }
+    }
+
+    std::pair<std::size_t, std::size_t> Line_edit::_get_selection_range() const {
+
+        std::size_t const cursor = _le_buffer.get_cursor();
+
+        return {std::min(cursor, _le_anchor), std::max(cursor, _le_anchor)};
+    }
+
+    std::size_t Line_edit::_find_cursor_at(
+        sf::Vector2i const pixel_pos
+        ) const {
+
+        auto temp_ptr = _parent_window.lock();
+
+        // Offscreen widgets have no window to map the pixel with.
+        if (!temp_ptr) {
+
+            return _le_buffer.get_cursor();
+        }
+
+        sf::Vector2f const coords      = temp_ptr->mapPixelToCoords(pixel_pos);
+        sf::Vector2f const local_point = _le_typing_run.getInverseTransform().transformPoint(coords);
+
+        if (_le_sdf_typing) {
+
+            return _le_sdf_typing->find_char_index(local_point.x);
+        }
+
+        return _le_typing_run.find_char_index(local_point.x);
+    }
+
+    void Line_edit::_update_caret() {
+
+        // Both bars span one line of the run, mapped through its transform so they
+        // follow the text when the widget is rotated.
+        float cs           = 0.0f;
+        float line_spacing = 0.0f;
+
+        auto const get_char_x = [this](std::size_t const index) {
+
+            return _le_sdf_typing ? _le_sdf_typing->get_char_x(index) : _le_typing_run.get_char_x(index);
+        };
+
+        if (_le_sdf_typing) {
+
+            cs           = _le_sdf_typing->get_char_size();
+            line_spacing = _le_sdf_typing->get_font().get_line_spacing(cs);
+        } else {
+
+            cs           = static_cast<float>(_le_typing_run.get_char_size());
+            line_spacing = DEFAULT_GLYPH_CACHE.get_metrics(_le_typing_run.get_char_size()).line_spacing;
+        }
+
+        float const cursor_x = get_char_x(_le_buffer.get_cursor());
+
+        sf::Transform const& run_transform = _le_typing_run.getTransform();
+
+        _le_caret.setSize    ({std::max(1.0f, cs / 16.0f), line_spacing});
+        _le_caret.setPosition(run_transform.transformPoint({cursor_x, 0.0f}));
+        _le_caret.setRotation(_le_typing_run.getRotation());
+
+        if (has_selection()) {
+
+            auto  const [first, last] = _get_selection_range();
+            float const first_x       = get_char_x(first);
+            float const last_x        = get_char_x(last );
+
+            _le_selection_rect.setSize    ({last_x - first_x, line_spacing});
+            _le_selection_rect.setPosition(run_transform.transformPoint({first_x, 0.0f}));
+            _le_selection_rect.setRotation(_le_typing_run.getRotation());
+        }
+    }
+
+    void Line_edit::_draw_text(
+        sf::RenderTarget&       target,
+        Glyph_run        const& run,
+        Sdf_text         const* sdf_text
+        ) const {
+
+        if (sdf_text != nullptr) {
+
+            // The run is never laid out, it only carries the transform.
+            target.draw(*sdf_text, run.getTransform());
+        } else {
+
+            target.draw(run);
+        }
+    }
+
+    void Line_edit::_queue_text(
+        Render_queue&       queue,
+        Glyph_run    const& run,
+        Sdf_text     const* sdf_text
+        ) const {
+
+        if (sdf_text != nullptr) {
+
+            queue.push(_layer, *sdf_text, run.getTransform());
+        } else {
+
+            queue.push(_layer, run);
+        }
+    }
+
+    void Line_edit::_fit_text_to_width() {
+
+        if (_le_sdf_typing) {
+
+            // Scaling the distance fields rasterizes nothing, so no cache size is requested.
+            float size = static_cast<float>(_le_char_size);
+
+            if (_le_fit_width > 0.0f) {
+
+                Sdf_text measure(_le_sdf_typing->get_font(), sf::String(_get_measure_string()));
+
+                float const pad_x = std::max(4.0f, size * 0.6f);
+
+                size = measure.fit({_le_fit_width - pad_x * 2.0f, std::numeric_limits<float>::max()}, size);
+            }
+
+            _le_sdf_typing->set_char_size     (size);
+            _le_sdf_placeholder->set_char_size(size);
+
+            _is_metrics_dirty = true;
+            return;
+        }
+
+        unsigned int const size_in_use = _le_typing_run.get_char_size();
+        unsigned int       size        = _le_char_size;
+
+        if (_le_fit_width > 0.0f) {
+
+            // Fit the widest string the field can hold, leaving room for the
+            // padding of `_resize_rect()` at the largest size.
+            Glyph_run measure(_le_typing_run.get_font(), _le_char_size);
+            measure.set_string(_get_measure_string());
+
+            float const pad_x = std::max(4.0f, static_cast<float>(_le_char_size) * 0.6f);
+
+            sf::Vector2f const box_size = {
+                _le_fit_width - pad_x * 2.0f,
+                std::numeric_limits<float>::max()
+            };
+
+            size = DEFAULT_TEXT_FIT.fit(measure, box_size, _le_char_size);
+        }
+
+        // Request the new size before releasing the old one, so a size kept in use stays counted.
+        size = DEFAULT_GLYPH_CACHE.request_size(size);
+        DEFAULT_GLYPH_CACHE.release_size(size_in_use);
+
+        _le_typing_run.set_char_size     (size);
+        _le_placeholder_run.set_char_size(size);
+
+        // The field is measured at the character size for the maximum number of characters.
+        _is_metrics_dirty = true;
+    }
+
+    std::u32string Line_edit::_get_measure_string() const {
+
+        return std::u32string(_max_chars, U'W');
+    }
+
+    void Line_edit::_update_metrics() {
+
+        if (!_is_metrics_dirty) {
+
+            return;
+        }
+
+        _is_metrics_dirty = false;
+
+        // Measurement, the bounds and character size are what influence sizing
+        sf::FloatRect lb;
+        float         cs = 0.0f;
+
+        if (_le_sdf_typing) {
+
+            Sdf_text measure(_le_sdf_typing->get_font(), sf::String(_get_measure_string()), _le_sdf_typing->get_char_size());
+
+            lb = measure.get_local_bounds();
+            cs = measure.get_char_size   ();
+        } else {
+
+            Glyph_run measure(_le_typing_run.get_font(), _le_typing_run.get_char_size());
+            measure.set_string(_get_measure_string());
+
+            lb = measure.get_local_bounds();
+            cs = static_cast<float>(measure.get_char_size());
+        }
 
         // Padding
         float const pad_x  = std::max(4.0f, cs *  0.6f);
@@ -507,20 +1543,23 @@ Helper Functions
         rect_x = std::max(rect_x, 40.f     );
         rect_y = std::max(rect_y,  8.f + cs);
 
-        _le_rect.setSize({rect_x, rect_y});
+        _le_rect_size = {rect_x, rect_y};
 
-        // position text inside rect accounting for lb and padding
-        sf::Vector2f const rp     = _le_rect.getPosition();
-        float        const text_x = rp.x + pad_x - lb.position.x;
-        float        const text_y = rp.y + pad_y - lb.position.y;
+        // Offset of the text inside rect accounting for lb and padding
+        _le_text_offset = {pad_x - lb.position.x, pad_y - lb.position.y};
+    }
 
-        if (curr_text.getString() == _le_typing_text.getString()) {
+    void Line_edit::_resize_rect() {
 
-            _le_typing_text.setPosition({text_x, text_y});
-        } else {
+        _update_metrics();
 
-            _le_placeholder_text.setPosition({text_x, text_y});
-        }
+        _le_rect.setSize(_le_rect_size);
+
+        // Both texts share the metrics, so place them together.
+        sf::Vector2f const text_pos = _le_rect.getPosition() + _le_text_offset;
+
+        _le_typing_run.setPosition     (text_pos);
+        _le_placeholder_run.setPosition(text_pos);
     }
 }
 /*
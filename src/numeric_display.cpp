@@ -0,0 +1,589 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_cache.h"
+#include "widgets/log.h"
+#include "widgets/numeric_display.h"
+#include "widgets/render_queue.h"
+#include "widgets/resources.h"
+#include "widgets/widget.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <system_error>
+/*
+------------------------------------------------------------------------------
+Using namespaces
+------------------------------------------------------------------------------
+*/
+using namespace resources;
+using namespace signals_slots;
+using namespace widgets;
+/*
+------------------------------------------------------------------------------
+Glyph quads
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Padding sf::Text leaves around each glyph so smoothing does not clip it
+    float constexpr GLYPH_PADDING = 1.0f;
+
+    /// @brief First character of the glyph table
+    char constexpr FIRST_CHAR = ' ';
+
+    /// @brief Last character of the glyph table
+    char constexpr LAST_CHAR = '~';
+
+    /// @brief Character filling a field the value does not fit
+    char constexpr OVERFLOW_CHAR = '#';
+
+    /// @brief Write the two triangles of a glyph quad, or an empty quad for whitespace
+    void write_glyph_quad(
+        sf::Vertex*         quad,
+        sf::Glyph    const& glyph,
+        sf::Vector2f const  origin,
+        sf::Color    const  color
+        ) {
+
+        if (glyph.textureRect.size.x == 0 || glyph.textureRect.size.y == 0) {
+
+            std::fill(quad, quad + 6, sf::Vertex{origin, color, {0.0f, 0.0f}});
+            return;
+        }
+
+        sf::Vector2f const padding    = {GLYPH_PADDING, GLYPH_PADDING};
+        sf::Vector2f const min_corner = origin + glyph.bounds.position - padding;
+        sf::Vector2f const max_corner = origin + glyph.bounds.position + glyph.bounds.size + padding;
+        sf::Vector2f const tex_min    = sf::Vector2f(glyph.textureRect.position) - padding;
+        sf::Vector2f const tex_max    = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+
+        quad[0] = {{min_corner.x, min_corner.y}, color, {tex_min.x, tex_min.y}};
+        quad[1] = {{max_corner.x, min_corner.y}, color, {tex_max.x, tex_min.y}};
+        quad[2] = {{min_corner.x, max_corner.y}, color, {tex_min.x, tex_max.y}};
+        quad[3] = {{min_corner.x, max_corner.y}, color, {tex_min.x, tex_max.y}};
+        quad[4] = {{max_corner.x, min_corner.y}, color, {tex_max.x, tex_min.y}};
+        quad[5] = {{max_corner.x, max_corner.y}, color, {tex_max.x, tex_max.y}};
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Numeric_display::Numeric_display(
+        std::shared_ptr<sf::RenderTarget> parent_target,
+        double const value
+        ) :
+        Widget              (std::move(parent_target)    ),
+        Signals_slots       (/*------------------------*/),
+        _nd_transform       (                            ),
+        _nd_vertices        (sf::PrimitiveType::Triangles),
+        _nd_glyphs          (                            ),
+        _nd_field           (                            ),
+        _nd_value           (value                       ),
+        _nd_width           (8u                          ),
+        _nd_precision       (2                           ),
+        _nd_units           (                            ),
+        _nd_char_size       (30u                         ),
+        _nd_text_color      (sf::Color::Black            ),
+        _nd_cell_width      (0.0f                        ),
+        _nd_local_bounds    (                            ),
+        _nd_texture         (nullptr                     ),
+        _nd_generation      (0u                          ),
+        _nd_num_cell_updates(0u                          )
+    {
+
+        _nd_transform.setPosition(DEFAULT_WIDGET_POS);
+
+        _nd_char_size = DEFAULT_GLYPH_CACHE.request_size(_nd_char_size);
+
+        _rebuild();
+    }
+
+    Numeric_display::~Numeric_display() {
+
+        DEFAULT_GLYPH_CACHE.release_size(_nd_char_size);
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Numeric_display::draw() {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
+        } else {
+
+            // Can call _update_widget() for final updating
+            // of the widget before drawing to the window.
+            _update_widget();
+
+            if (!_is_parent_target_nullptr()) {
+
+                auto temp_ptr = _parent_target.lock();
+
+                sf::RenderStates states(_nd_transform.getTransform());
+                states.texture = _nd_texture;
+
+                temp_ptr->draw(_nd_vertices, states);
+            }
+        }
+    }
+
+    void Numeric_display::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            sf::RenderStates states(_nd_transform.getTransform());
+            states.texture = _nd_texture;
+
+            queue.push(_layer, _nd_vertices, states, &DEFAULT_GLYPH_CACHE);
+        }
+    }
+
+    void Numeric_display::move(
+        sf::Vector2f const offset
+        ) {
+
+        _nd_transform.move(offset);
+        _mark_dirty();
+    }
+
+    void Numeric_display::move(
+        float const x,
+        float const y
+        ) {
+
+        _nd_transform.move({x, y});
+        _mark_dirty();
+    }
+
+    void Numeric_display::rotate(
+        sf::Angle const angle
+        ) {
+
+        _nd_transform.rotate(angle);
+        _mark_dirty();
+    }
+
+    void Numeric_display::_update_widget() {
+
+        // Texture coordinates of every quad are only valid for the page they were built on.
+        if (DEFAULT_GLYPH_CACHE.update_generation(_nd_generation)) {
+
+            _rebuild();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Numeric_display::set_value(
+        double const value
+        ) {
+
+        _nd_value = value;
+
+        // Most updates only change the last digit or two, or nothing at all.
+        if (_patch_field()) {
+
+            _mark_dirty();
+        }
+    }
+
+    void Numeric_display::set_width(
+        std::size_t const width
+        ) {
+
+        _nd_width = std::clamp(width, std::size_t{1u}, MAX_WIDTH);
+
+        if (_nd_width != width) {
+
+            LOG(WARNING)                            <<
+            "Width for numeric display is set to [" <<
+            _nd_width                               <<
+            "] instead of ["                        <<
+            width                                   <<
+            "] as it must be between 1 and "        <<
+            MAX_WIDTH                               <<
+            " cells.";
+        }
+
+        _rebuild();
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_precision(
+        int const precision
+        ) {
+
+        _nd_precision = std::max(precision, 0);
+
+        if (_nd_precision != precision) {
+
+            LOG(WARNING)                                             <<
+            "Precision for numeric display is set to 0 instead of [" <<
+            precision                                                <<
+            "] as it can not be negative.";
+        }
+
+        // The glyphs and cell positions do not change, only the digits.
+        if (_patch_field()) {
+
+            _mark_dirty();
+        }
+    }
+
+    void Numeric_display::set_units(
+        sf::String const& units
+        ) {
+
+        _nd_units = units;
+        _rebuild();
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_char_size(
+        std::uint32_t const char_size
+        ) {
+
+        unsigned int const size_in_use = _nd_char_size;
+
+        // Request the new size before releasing the old one, so a size kept in use stays counted.
+        _nd_char_size = DEFAULT_GLYPH_CACHE.request_size(char_size);
+        DEFAULT_GLYPH_CACHE.release_size(size_in_use);
+
+        _rebuild();
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_text_color(
+        sf::Color const color
+        ) {
+
+        _nd_text_color = color;
+
+        for (Cell_glyph& glyph : _nd_glyphs) {
+
+            for (sf::Vertex& vertex : glyph.vertices) {
+
+                vertex.color = color;
+            }
+        }
+
+        for (std::size_t i = 0u; i < _nd_vertices.getVertexCount(); ++i) {
+
+            _nd_vertices[i].color = color;
+        }
+
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_scale(
+        sf::Vector2f const scale
+        ) {
+
+        _nd_transform.setScale(scale);
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_scale(
+        float const x,
+        float const y
+        ) {
+
+        _nd_transform.setScale({x, y});
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_pos(
+        sf::Vector2f const pos
+        ) {
+
+        _nd_transform.setPosition(pos);
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_pos(
+        float const x,
+        float const y
+        ) {
+
+        _nd_transform.setPosition({x, y});
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_origin(
+        sf::Vector2f const origin
+        ) {
+
+        _nd_transform.setOrigin(origin);
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_origin(
+        float const x,
+        float const y
+        ) {
+
+        _nd_transform.setOrigin({x, y});
+        _mark_dirty();
+    }
+
+    void Numeric_display::set_rotation(
+        sf::Angle const angle
+        ) {
+
+        _nd_transform.setRotation(angle);
+        _mark_dirty();
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    double Numeric_display::get_value() const {
+
+        return _nd_value;
+    }
+
+    std::size_t Numeric_display::get_width() const {
+
+        return _nd_width;
+    }
+
+    int Numeric_display::get_precision() const {
+
+        return _nd_precision;
+    }
+
+    sf::String const& Numeric_display::get_units() const {
+
+        return _nd_units;
+    }
+
+    std::uint32_t Numeric_display::get_char_size() const {
+
+        return _nd_char_size;
+    }
+
+    sf::Color Numeric_display::get_text_color() const {
+
+        return _nd_text_color;
+    }
+
+    std::size_t Numeric_display::get_num_cell_updates() const {
+
+        return _nd_num_cell_updates;
+    }
+
+    sf::Vector2f Numeric_display::get_scale() const {
+
+        return _nd_transform.getScale();
+    }
+
+    float Numeric_display::get_scale_x() const {
+
+        return _nd_transform.getScale().x;
+    }
+
+    float Numeric_display::get_scale_y() const {
+
+        return _nd_transform.getScale().y;
+    }
+
+    sf::Vector2f Numeric_display::get_pos() const {
+
+        return _nd_transform.getPosition();
+    }
+
+    float Numeric_display::get_pos_x() const {
+
+        return _nd_transform.getPosition().x;
+    }
+
+    float Numeric_display::get_pos_y() const {
+
+        return _nd_transform.getPosition().y;
+    }
+
+    sf::Vector2f Numeric_display::get_origin() const {
+
+        return _nd_transform.getOrigin();
+    }
+
+    float Numeric_display::get_origin_x() const {
+
+        return _nd_transform.getOrigin().x;
+    }
+
+    float Numeric_display::get_origin_y() const {
+
+        return _nd_transform.getOrigin().y;
+    }
+
+    sf::Angle Numeric_display::get_rotation() const {
+
+        return _nd_transform.getRotation();
+    }
+
+    sf::FloatRect Numeric_display::get_global_bounds() const {
+
+        return _nd_transform.getTransform().transformRect(_nd_local_bounds);
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    bool Numeric_display::_patch_field() {
+
+        // Sized for any value that fits the field, larger ones overflow to '#'.
+        std::array<char, MAX_WIDTH> text{};
+        std::size_t                 length = _nd_width + 1u;
+
+        if (std::isfinite(_nd_value)) {
+
+            auto const [end, error] = std::to_chars(
+                text.data(),
+                text.data() + text.size(),
+                _nd_value,
+                std::chars_format::fixed,
+                _nd_precision
+                );
+
+            if (error == std::errc()) {
+
+                length = static_cast<std::size_t>(end - text.data());
+            }
+        }
+
+        bool        const is_fitting = length <= _nd_width;
+        std::size_t const padding    = is_fitting ? _nd_width - length : 0u;
+        bool              is_changed = false;
+
+        for (std::size_t cell = 0u; cell < _nd_width; ++cell) {
+
+            char const character = !is_fitting ? OVERFLOW_CHAR : cell < padding ? ' ' : text[cell - padding];
+
+            if (character != _nd_field[cell]) {
+
+                _nd_field[cell] = character;
+                _write_cell(cell);
+
+                is_changed = true;
+            }
+        }
+
+        return is_changed;
+    }
+
+    void Numeric_display::_write_cell(
+        std::size_t const cell
+        ) {
+
+        char const character = _nd_field[cell];
+        char const clamped   = character >= FIRST_CHAR && character <= LAST_CHAR ? character : OVERFLOW_CHAR;
+
+        Cell_glyph const&  glyph  = _nd_glyphs[static_cast<std::size_t>(clamped - FIRST_CHAR)];
+        float        const offset = static_cast<float>(cell) * _nd_cell_width;
+
+        for (std::size_t v = 0u; v < 6u; ++v) {
+
+            sf::Vertex& vertex = _nd_vertices[cell * 6u + v];
+
+            vertex             = glyph.vertices[v];
+            vertex.position.x += offset;
+        }
+
+        ++_nd_num_cell_updates;
+    }
+
+    void Numeric_display::_rebuild() {
+
+        Glyph_cache&                cache    = DEFAULT_GLYPH_CACHE;
+        Glyph_cache::Metrics const  metrics  = cache.get_metrics(_nd_char_size);
+        float                const  baseline = static_cast<float>(_nd_char_size);
+
+        // The quads below are built at the current generation.
+        cache.update_generation(_nd_generation);
+
+        _nd_cell_width = 0.0f;
+
+        for (char digit = '0'; digit <= '9'; ++digit) {
+
+            _nd_cell_width = std::max(_nd_cell_width, cache.get_glyph(static_cast<char32_t>(digit), _nd_char_size, false).advance);
+        }
+
+        // Every character is centered in its cell, so a '1' sits where an '8' would.
+        for (char character = FIRST_CHAR; character <= LAST_CHAR; ++character) {
+
+            sf::Glyph const glyph = cache.get_glyph(static_cast<char32_t>(character), _nd_char_size, false);
+
+            write_glyph_quad(
+                _nd_glyphs[static_cast<std::size_t>(character - FIRST_CHAR)].vertices.data(),
+                glyph,
+                {(_nd_cell_width - glyph.advance) / 2.0f, baseline},
+                _nd_text_color
+                );
+        }
+
+        _nd_vertices.resize((_nd_width + _nd_units.getSize()) * 6u);
+
+        // The units are laid out once here, value updates never touch them.
+        float    pen_x    = static_cast<float>(_nd_width) * _nd_cell_width;
+        char32_t previous = 0u;
+
+        for (std::size_t i = 0u; i < _nd_units.getSize(); ++i) {
+
+            char32_t const code_point = _nd_units[i];
+
+            pen_x    += cache.get_kerning(previous, code_point, _nd_char_size, false);
+            previous  = code_point;
+
+            sf::Glyph const glyph = cache.get_glyph(code_point, _nd_char_size, false);
+
+            write_glyph_quad(&_nd_vertices[(_nd_width + i) * 6u], glyph, {pen_x, baseline}, _nd_text_color);
+
+            pen_x += glyph.advance;
+        }
+
+        _nd_local_bounds = sf::FloatRect({0.0f, 0.0f}, {pen_x, metrics.line_spacing});
+
+        _nd_texture = metrics.texture;
+
+        _nd_field.fill('\0');
+        _patch_field();
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
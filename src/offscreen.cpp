@@ -0,0 +1,253 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/log.h"
+#include "widgets/offscreen.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+/*
+------------------------------------------------------------------------------
+Namespace offscreen BEGIN
+------------------------------------------------------------------------------
+*/
+namespace offscreen {
+/*
+------------------------------------------------------------------------------
+Render targets
+------------------------------------------------------------------------------
+*/
+    std::shared_ptr<sf::RenderTexture> create_render_texture(
+        sf::Vector2u const size,
+        unsigned int const anti_aliasing_level
+        ) {
+
+        sf::ContextSettings ctx_settings{};
+        ctx_settings.antiAliasingLevel = anti_aliasing_level;
+
+        auto render_texture = std::make_shared<sf::RenderTexture>();
+
+        if (!render_texture->resize(size, ctx_settings)) {
+
+            LOG(ERROR)                         <<
+            "Could not create render texture [" <<
+            size.x                             <<
+            "x"                                <<
+            size.y                             <<
+            "], is an OpenGL context available?";
+
+            return nullptr;
+        }
+
+        return render_texture;
+    }
+
+    sf::Image read_pixels(
+        sf::RenderTexture& render_texture
+        ) {
+
+        // Resolve everything drawn so far before reading it back.
+        render_texture.display();
+
+        return render_texture.getTexture().copyToImage();
+    }
+/*
+------------------------------------------------------------------------------
+Golden image comparison
+------------------------------------------------------------------------------
+*/
+    Image_diff compare_images(
+        sf::Image    const& actual,
+        sf::Image    const& golden,
+        std::uint8_t const  tolerance,
+        std::size_t  const  max_mismatched_pixels
+        ) {
+
+        Image_diff result{};
+
+        sf::Vector2u const size = golden.getSize();
+
+        if (actual.getSize() != size) {
+
+            LOG(WARNING)                      <<
+            "Image sizes differ, actual is [" <<
+            actual.getSize().x                <<
+            "x"                               <<
+            actual.getSize().y                <<
+            "] and golden is ["               <<
+            size.x                            <<
+            "x"                               <<
+            size.y                            <<
+            "].";
+
+            result.is_match              = false;
+            result.num_mismatched_pixels = std::max(
+                static_cast<std::size_t>(actual.getSize().x) * actual.getSize().y,
+                static_cast<std::size_t>(size.x) * size.y
+                );
+            result.max_channel_delta     = 255u;
+
+            return result;
+        }
+
+        std::size_t const num_pixels = static_cast<std::size_t>(size.x) * size.y;
+
+        // Both images are tightly packed RGBA8.
+        std::uint8_t const* actual_pixels = actual.getPixelsPtr();
+        std::uint8_t const* golden_pixels = golden.getPixelsPtr();
+
+        std::vector<std::uint8_t> diff_pixels(num_pixels * 4u);
+
+        for (std::size_t i = 0u; i < num_pixels; ++i) {
+
+            std::size_t  const offset      = i * 4u;
+            std::uint8_t       pixel_delta = 0u;
+
+            for (std::size_t channel = 0u; channel < 4u; ++channel) {
+
+                int const delta = std::abs(
+                    static_cast<int>(actual_pixels[offset + channel]) -
+                    static_cast<int>(golden_pixels[offset + channel])
+                    );
+
+                pixel_delta = std::max(pixel_delta, static_cast<std::uint8_t>(delta));
+            }
+
+            result.max_channel_delta = std::max(result.max_channel_delta, pixel_delta);
+
+            if (pixel_delta > tolerance) {
+
+                ++result.num_mismatched_pixels;
+
+                diff_pixels[offset + 0u] = 255u;
+                diff_pixels[offset + 1u] = 0u;
+                diff_pixels[offset + 2u] = 0u;
+                diff_pixels[offset + 3u] = 255u;
+            } else {
+
+                // Dimmed grey copy of the golden so the mismatches stand out.
+                std::uint8_t const luma = static_cast<std::uint8_t>((
+                    golden_pixels[offset + 0u] * 77u  +
+                    golden_pixels[offset + 1u] * 150u +
+                    golden_pixels[offset + 2u] * 29u
+                    ) >> 10u);
+
+                diff_pixels[offset + 0u] = luma;
+                diff_pixels[offset + 1u] = luma;
+                diff_pixels[offset + 2u] = luma;
+                diff_pixels[offset + 3u] = 255u;
+            }
+        }
+
+        result.is_match = result.num_mismatched_pixels <= max_mismatched_pixels;
+        result.diff_image.resize(size, diff_pixels.data());
+
+        return result;
+    }
+
+    bool compare_to_golden_file(
+        sf::Image             const& actual,
+        std::filesystem::path const& golden_path,
+        std::uint8_t          const  tolerance,
+        std::size_t           const  max_mismatched_pixels,
+        bool                  const  update_golden
+        ) {
+
+        if (!update_golden && !std::filesystem::exists(golden_path)) {
+
+            // A missing golden is a failure, a mistyped path must not pass. The
+            // rendered image is left next to it to be reviewed and renamed.
+            std::filesystem::path actual_path = golden_path;
+            actual_path.replace_extension(".actual.png");
+
+            if (!actual.saveToFile(actual_path)) {
+
+                LOG(WARNING) << "Could not write [" << actual_path.string() << "].";
+            }
+
+            LOG(ERROR)                       <<
+            "Golden image ["                 <<
+            golden_path.string()             <<
+            "] does not exist, pass update_golden to create it.";
+
+            return false;
+        }
+
+        if (update_golden) {
+
+            if (actual.saveToFile(golden_path)) {
+
+                LOG(INFO)                    <<
+                "Written golden image to ["  <<
+                golden_path.string()         <<
+                "].";
+
+                return true;
+            } else {
+
+                LOG(ERROR)                         <<
+                "Could not write golden image to [" <<
+                golden_path.string()               <<
+                "].";
+
+                return false;
+            }
+        }
+
+        sf::Image golden;
+
+        if (!golden.loadFromFile(golden_path)) {
+
+            LOG(ERROR)                          <<
+            "Could not load golden image from [" <<
+            golden_path.string()                <<
+            "].";
+
+            return false;
+        }
+
+        Image_diff const diff = compare_images(actual, golden, tolerance, max_mismatched_pixels);
+
+        if (diff.is_match) {
+
+            // Nothing to write out when the images match.
+        } else {
+
+            std::filesystem::path actual_path = golden_path;
+            std::filesystem::path diff_path   = golden_path;
+            actual_path.replace_extension(".actual.png");
+            diff_path.replace_extension  (".diff.png"  );
+
+            if (!actual.saveToFile(actual_path)) {
+
+                LOG(WARNING) << "Could not write [" << actual_path.string() << "].";
+            }
+
+            if (diff.diff_image.getSize() != sf::Vector2u{0u, 0u} && !diff.diff_image.saveToFile(diff_path)) {
+
+                LOG(WARNING) << "Could not write [" << diff_path.string() << "].";
+            }
+
+            LOG(ERROR)                       <<
+            "Image does not match golden ["  <<
+            golden_path.string()             <<
+            "], ["                           <<
+            diff.num_mismatched_pixels       <<
+            "] pixels differ by more than [" <<
+            static_cast<int>(tolerance)      <<
+            "], largest difference is ["     <<
+            static_cast<int>(diff.max_channel_delta) <<
+            "].";
+        }
+
+        return diff.is_match;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace offscreen END
+------------------------------------------------------------------------------
+*/
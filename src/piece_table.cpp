@@ -0,0 +1,492 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/piece_table.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Piece_table::Piece_table() :
+        _original         (  ),
+        _added            (  ),
+        _original_newlines(  ),
+        _added_newlines   (  ),
+        _pieces           (  ),
+        _length_tree      (  ),
+        _newline_tree     (  ),
+        _size             (0u),
+        _num_newlines     (0u)
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Piece_table::load(
+        std::string&& text
+        ) {
+
+        clear();
+
+        _original = std::move(text);
+        _size     = _original.size();
+
+        // memchr is vectorized by the C library, scanning megabytes in a few milliseconds.
+        char const* const data = _original.data();
+        char const* const end  = data + _original.size();
+        char const*       iter = data;
+
+        while ((iter = static_cast<char const*>(std::memchr(iter, '\n', static_cast<std::size_t>(end - iter)))) != nullptr) {
+
+            _original_newlines.push_back(static_cast<std::size_t>(iter - data));
+            ++iter;
+        }
+
+        _num_newlines = _original_newlines.size();
+
+        if (_size > 0u) {
+
+            _pieces.push_back(_make_piece(false, 0u, _size));
+        }
+
+        _rebuild_trees();
+    }
+
+    void Piece_table::insert(
+        std::size_t      const offset,
+        std::string_view const text
+        ) {
+
+        if (text.empty()) {
+
+            return;
+        }
+
+        std::size_t const pos       = std::min(offset, _size);
+        std::size_t const add_start = _added.size();
+
+        for (std::size_t i = 0u; i < text.size(); ++i) {
+
+            if (text[i] == '\n') {
+
+                _added_newlines.push_back(add_start + i);
+            }
+        }
+
+        _added.append(text);
+
+        Piece const piece = _make_piece(true, add_start, text.size());
+
+        std::size_t index           = _pieces.size();
+        std::size_t offset_in_piece = 0u;
+
+        if (pos < _size) {
+
+            index = _find_piece(pos, offset_in_piece);
+        }
+
+        _size         += piece.length;
+        _num_newlines += piece.num_newlines;
+
+        if (offset_in_piece == 0u) {
+
+            // Typing right after the previous insert grows its piece.
+            if (index > 0u) {
+
+                Piece& previous = _pieces[index - 1u];
+
+                if (previous.is_added && previous.start + previous.length == add_start) {
+
+                    Piece const before = previous;
+
+                    previous.length       += piece.length;
+                    previous.num_newlines += piece.num_newlines;
+
+                    _update_trees(index - 1u, before);
+                    return;
+                }
+            }
+
+            _pieces.insert(_pieces.begin() + static_cast<std::ptrdiff_t>(index), piece);
+        } else {
+
+            Piece const split = _pieces[index];
+            Piece const left  = _make_piece(split.is_added, split.start,                   offset_in_piece               );
+            Piece const right = _make_piece(split.is_added, split.start + offset_in_piece, split.length - offset_in_piece);
+
+            _pieces[index] = left;
+            _pieces.insert(_pieces.begin() + static_cast<std::ptrdiff_t>(index) + 1, {piece, right});
+        }
+
+        _rebuild_trees();
+    }
+
+    void Piece_table::erase(
+        std::size_t const offset,
+        std::size_t const count
+        ) {
+
+        std::size_t const first     = std::min(offset, _size);
+        std::size_t       remaining = std::min(count, _size - first);
+
+        if (remaining == 0u) {
+
+            return;
+        }
+
+        _size -= remaining;
+
+        std::size_t offset_in_piece = 0u;
+        std::size_t index           = _find_piece(first, offset_in_piece);
+
+        // The first piece keeps what comes before the erased range.
+        if (offset_in_piece > 0u) {
+
+            Piece       const piece        = _pieces[index];
+            std::size_t const end_in_piece = offset_in_piece + remaining;
+            Piece       const left         = _make_piece(piece.is_added, piece.start, offset_in_piece);
+
+            if (end_in_piece < piece.length) {
+
+                // The whole range is inside this piece, it splits around it.
+                Piece const right = _make_piece(piece.is_added, piece.start + end_in_piece, piece.length - end_in_piece);
+
+                _num_newlines -= piece.num_newlines - left.num_newlines - right.num_newlines;
+
+                _pieces[index] = left;
+                _pieces.insert(_pieces.begin() + static_cast<std::ptrdiff_t>(index) + 1, right);
+
+                _rebuild_trees();
+                return;
+            }
+
+            _num_newlines -= piece.num_newlines - left.num_newlines;
+            remaining     -= piece.length - offset_in_piece;
+
+            _pieces[index] = left;
+            ++index;
+        }
+
+        // Pieces fully inside the range are dropped, the last one may keep its tail.
+        std::size_t erase_end = index;
+
+        while (remaining > 0u && erase_end < _pieces.size()) {
+
+            Piece& piece = _pieces[erase_end];
+
+            if (remaining >= piece.length) {
+
+                _num_newlines -= piece.num_newlines;
+                remaining     -= piece.length;
+                ++erase_end;
+            } else {
+
+                Piece const right = _make_piece(piece.is_added, piece.start + remaining, piece.length - remaining);
+
+                _num_newlines -= piece.num_newlines - right.num_newlines;
+                remaining      = 0u;
+
+                piece = right;
+            }
+        }
+
+        _pieces.erase(_pieces.begin() + static_cast<std::ptrdiff_t>(index), _pieces.begin() + static_cast<std::ptrdiff_t>(erase_end));
+
+        _rebuild_trees();
+    }
+
+    void Piece_table::clear() {
+
+        // Assigning empty containers frees the memory, clear() would keep it.
+        _original          = std::string();
+        _added             = std::string();
+        _original_newlines = std::vector<std::size_t>();
+        _added_newlines    = std::vector<std::size_t>();
+
+        _pieces.clear();
+        _rebuild_trees();
+
+        _size         = 0u;
+        _num_newlines = 0u;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Piece_table::get_size() const {
+
+        return _size;
+    }
+
+    std::size_t Piece_table::get_num_lines() const {
+
+        return _num_newlines + 1u;
+    }
+
+    std::size_t Piece_table::get_num_pieces() const {
+
+        return _pieces.size();
+    }
+
+    char Piece_table::get_byte(
+        std::size_t const offset
+        ) const {
+
+        std::size_t       offset_in_piece = 0u;
+        std::size_t const index           = _find_piece(offset, offset_in_piece);
+
+        return _get_buffer(_pieces[index])[_pieces[index].start + offset_in_piece];
+    }
+
+    std::string Piece_table::get_text() const {
+
+        return get_text(0u, _size);
+    }
+
+    std::string Piece_table::get_text(
+        std::size_t const offset,
+        std::size_t const count
+        ) const {
+
+        std::size_t const first     = std::min(offset, _size);
+        std::size_t       remaining = std::min(count, _size - first);
+
+        std::string text;
+        text.reserve(remaining);
+
+        if (remaining == 0u) {
+
+            return text;
+        }
+
+        std::size_t offset_in_piece = 0u;
+        std::size_t index           = _find_piece(first, offset_in_piece);
+
+        while (remaining > 0u) {
+
+            Piece       const& piece  = _pieces[index];
+            std::size_t const  length = std::min(remaining, piece.length - offset_in_piece);
+
+            text.append(_get_buffer(piece), piece.start + offset_in_piece, length);
+
+            remaining       -= length;
+            offset_in_piece  = 0u;
+            ++index;
+        }
+
+        return text;
+    }
+
+    std::size_t Piece_table::get_line_start(
+        std::size_t const line
+        ) const {
+
+        std::size_t const clamped_line = std::min(line, _num_newlines);
+
+        if (clamped_line == 0u) {
+
+            return 0u;
+        }
+
+        // Descend to the last piece whose newlines, with all before it, are fewer than the line.
+        std::size_t const num_pieces = _pieces.size();
+        std::size_t       index      = 0u;
+        std::size_t       remaining  = clamped_line;
+
+        for (std::size_t step = std::bit_floor(num_pieces); step > 0u; step >>= 1u) {
+
+            if (index + step <= num_pieces && _newline_tree[index + step] < remaining) {
+
+                index     += step;
+                remaining -= _newline_tree[index];
+            }
+        }
+
+        // The line starts after the `remaining`-th newline of the piece at `index`.
+        Piece                    const& piece         = _pieces[index];
+        std::vector<std::size_t> const& newlines      = _get_newlines(piece);
+        auto                     const  first_newline = std::lower_bound(newlines.begin(), newlines.end(), piece.start);
+        std::size_t              const  newline_pos   = *(first_newline + static_cast<std::ptrdiff_t>(remaining - 1u));
+
+        return _get_prefix_sum(_length_tree, index) + (newline_pos - piece.start) + 1u;
+    }
+
+    std::size_t Piece_table::get_line_end(
+        std::size_t const line
+        ) const {
+
+        std::size_t const clamped_line = std::min(line, _num_newlines);
+
+        if (clamped_line < _num_newlines) {
+
+            return get_line_start(clamped_line + 1u) - 1u;
+        }
+
+        return _size;
+    }
+
+    std::size_t Piece_table::get_line_of(
+        std::size_t const offset
+        ) const {
+
+        std::size_t       offset_in_piece = 0u;
+        std::size_t const index           = _find_piece(std::min(offset, _size), offset_in_piece);
+
+        if (index == _pieces.size()) {
+
+            return _num_newlines;
+        }
+
+        Piece const& piece = _pieces[index];
+
+        return _get_prefix_sum(_newline_tree, index) + _count_newlines(piece, piece.start, offset_in_piece);
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::string const& Piece_table::_get_buffer(
+        Piece const& piece
+        ) const {
+
+        return piece.is_added ? _added : _original;
+    }
+
+    std::vector<std::size_t> const& Piece_table::_get_newlines(
+        Piece const& piece
+        ) const {
+
+        return piece.is_added ? _added_newlines : _original_newlines;
+    }
+
+    std::size_t Piece_table::_count_newlines(
+        Piece       const& piece,
+        std::size_t const  start,
+        std::size_t const  length
+        ) const {
+
+        std::vector<std::size_t> const& newlines = _get_newlines(piece);
+
+        auto const first = std::lower_bound(newlines.begin(), newlines.end(), start         );
+        auto const last  = std::lower_bound(first,            newlines.end(), start + length);
+
+        return static_cast<std::size_t>(std::distance(first, last));
+    }
+
+    Piece_table::Piece Piece_table::_make_piece(
+        bool        const is_added,
+        std::size_t const start,
+        std::size_t const length
+        ) const {
+
+        Piece piece{};
+        piece.is_added     = is_added;
+        piece.start        = start;
+        piece.length       = length;
+        piece.num_newlines = _count_newlines(piece, start, length);
+
+        return piece;
+    }
+
+    std::size_t Piece_table::_find_piece(
+        std::size_t const offset,
+        std::size_t&      offset_in_piece
+        ) const {
+
+        // Descend to the last piece that, with all before it, ends at or before the offset.
+        std::size_t const num_pieces = _pieces.size();
+        std::size_t       index      = 0u;
+        std::size_t       remaining  = offset;
+
+        for (std::size_t step = std::bit_floor(num_pieces); step > 0u; step >>= 1u) {
+
+            if (index + step <= num_pieces && _length_tree[index + step] <= remaining) {
+
+                index     += step;
+                remaining -= _length_tree[index];
+            }
+        }
+
+        // Callers only look up offsets below the size, past it `index` is the number of pieces.
+        offset_in_piece = index < num_pieces ? remaining : 0u;
+        return index;
+    }
+
+    void Piece_table::_rebuild_trees() {
+
+        std::size_t const num_pieces = _pieces.size();
+
+        _length_tree.assign (num_pieces + 1u, 0u);
+        _newline_tree.assign(num_pieces + 1u, 0u);
+
+        // Every node passes its sum on to its parent, building the trees in O(pieces).
+        for (std::size_t node = 1u; node <= num_pieces; ++node) {
+
+            _length_tree [node] += _pieces[node - 1u].length;
+            _newline_tree[node] += _pieces[node - 1u].num_newlines;
+
+            std::size_t const parent = node + (node & (~node + 1u));
+
+            if (parent <= num_pieces) {
+
+                _length_tree [parent] += _length_tree [node];
+                _newline_tree[parent] += _newline_tree[node];
+            }
+        }
+    }
+
+    void Piece_table::_update_trees(
+        std::size_t const  index,
+        Piece       const& before
+        ) {
+
+        Piece const& after = _pieces[index];
+
+        // Unsigned arithmetic wraps, so adding the difference also shrinks an entry.
+        std::size_t const length_delta  = after.length       - before.length;
+        std::size_t const newline_delta = after.num_newlines - before.num_newlines;
+
+        for (std::size_t node = index + 1u; node < _length_tree.size(); node += node & (~node + 1u)) {
+
+            _length_tree [node] += length_delta;
+            _newline_tree[node] += newline_delta;
+        }
+    }
+
+    std::size_t Piece_table::_get_prefix_sum(
+        std::vector<std::size_t> const& tree,
+        std::size_t              const  count
+        ) const {
+
+        std::size_t sum = 0u;
+
+        for (std::size_t node = count; node > 0u; node -= node & (~node + 1u)) {
+
+            sum += tree[node];
+        }
+
+        return sum;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,348 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/prefix_index.h"
+#include "widgets/log.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Prefix_index::Prefix_index(
+        std::vector<Entry> entries
+        ) :
+        _text     (),
+        _offsets  (),
+        _weights  (),
+        _block_max()
+    {
+
+        // std::string compares bytes as unsigned char, the same order narrow() searches in.
+        std::sort(entries.begin(), entries.end(), [](Entry const& first, Entry const& second) {
+
+            return first.text < second.text;
+        });
+
+        std::size_t num_bytes = 0u;
+
+        for (Entry const& entry : entries) {
+
+            num_bytes += entry.text.size();
+        }
+
+        if (num_bytes > std::numeric_limits<std::uint32_t>::max()) {
+
+            LOG(WARNING)                                        <<
+                "Prefix index entries hold " << num_bytes       <<
+                " bytes, only the first 4 GB of entries are indexed.";
+        }
+
+        _text.reserve   (std::min<std::size_t>(num_bytes, std::numeric_limits<std::uint32_t>::max()));
+        _offsets.reserve(entries.size() + 1u);
+        _weights.reserve(entries.size());
+
+        for (Entry const& entry : entries) {
+
+            bool const is_duplicate = !_weights.empty() && std::string_view(_text).substr(_offsets.back()) == entry.text;
+
+            if (is_duplicate) {
+
+                _weights.back() = std::max(_weights.back(), entry.weight);
+                continue;
+            }
+
+            if (_text.size() + entry.text.size() > std::numeric_limits<std::uint32_t>::max()) {
+
+                break;
+            }
+
+            _offsets.push_back(static_cast<std::uint32_t>(_text.size()));
+            _weights.push_back(entry.weight);
+            _text += entry.text;
+        }
+
+        _offsets.push_back(static_cast<std::uint32_t>(_text.size()));
+
+        // The entries are packed now, free them before building the table.
+        std::vector<Entry>().swap(entries);
+
+        _build_block_max();
+    }
+
+    std::future<std::shared_ptr<Prefix_index const>> Prefix_index::build_async(
+        std::vector<Entry> entries
+        ) {
+
+        return std::async(std::launch::async, [entries = std::move(entries)]() mutable {
+
+            return std::shared_ptr<Prefix_index const>(std::make_shared<Prefix_index>(std::move(entries)));
+        });
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    Prefix_index::Range Prefix_index::find(
+        std::string_view const prefix
+        ) const {
+
+        return narrow(get_all(), prefix);
+    }
+
+    Prefix_index::Range Prefix_index::narrow(
+        Range            const range,
+        std::string_view const prefix
+        ) const {
+
+        Range result = range;
+
+        for (std::size_t depth = range.depth; depth < prefix.size() && !result.is_empty(); ++depth) {
+
+            int const key = static_cast<unsigned char>(prefix[depth]);
+
+            // Entries of the range share `depth` bytes, so they are sorted by the byte at
+            // `depth`, entries that end there first.
+            auto const get_byte = [this, depth](std::uint32_t const index) {
+
+                std::size_t const size = _offsets[index + 1u] - _offsets[index];
+
+                return size > depth ? static_cast<int>(static_cast<unsigned char>(_text[_offsets[index] + depth])) : -1;
+            };
+
+            auto const search = [](std::uint32_t low, std::uint32_t high, auto const& is_before) {
+
+                while (low < high) {
+
+                    std::uint32_t const middle = low + (high - low) / 2u;
+
+                    if (is_before(middle)) {
+
+                        low = middle + 1u;
+                    } else {
+
+                        high = middle;
+                    }
+                }
+
+                return low;
+            };
+
+            std::uint32_t const first = search(result.first, result.last, [&](std::uint32_t const index) { return get_byte(index) <  key; });
+            std::uint32_t const last  = search(first,        result.last, [&](std::uint32_t const index) { return get_byte(index) <= key; });
+
+            result = {first, last, static_cast<std::uint32_t>(depth + 1u)};
+        }
+
+        result.depth = static_cast<std::uint32_t>(std::max<std::size_t>(range.depth, prefix.size()));
+
+        return result;
+    }
+
+    void Prefix_index::get_top(
+        Range                       const  range,
+        std::size_t                 const  count,
+        std::vector<std::uint32_t>&        result
+        ) const {
+
+        result.clear();
+
+        if (range.is_empty() || count == 0u) {
+
+            return;
+        }
+
+        struct Candidate {
+
+            std::uint32_t heaviest = 0u;
+            std::uint32_t first    = 0u;
+            std::uint32_t last     = 0u;
+        };
+
+        auto const is_lighter = [this](Candidate const& first, Candidate const& second) {
+
+            return first.heaviest != second.heaviest && _get_heavier(first.heaviest, second.heaviest) == second.heaviest;
+        };
+
+        std::vector<Candidate> heap;
+        heap.reserve(count * 2u);
+        heap.push_back({_find_heaviest(range.first, range.last), range.first, range.last});
+
+        // Each pick splits its range in two, the next pick is the heaviest of all the parts.
+        while (!heap.empty() && result.size() < count) {
+
+            std::pop_heap(heap.begin(), heap.end(), is_lighter);
+
+            Candidate const candidate = heap.back();
+            heap.pop_back();
+
+            result.push_back(candidate.heaviest);
+
+            if (candidate.first < candidate.heaviest) {
+
+                heap.push_back({_find_heaviest(candidate.first, candidate.heaviest), candidate.first, candidate.heaviest});
+                std::push_heap(heap.begin(), heap.end(), is_lighter);
+            }
+
+            if (candidate.heaviest + 1u < candidate.last) {
+
+                heap.push_back({_find_heaviest(candidate.heaviest + 1u, candidate.last), candidate.heaviest + 1u, candidate.last});
+                std::push_heap(heap.begin(), heap.end(), is_lighter);
+            }
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    Prefix_index::Range Prefix_index::get_all() const {
+
+        return {0u, static_cast<std::uint32_t>(_weights.size()), 0u};
+    }
+
+    std::string_view Prefix_index::get_text(
+        std::uint32_t const index
+        ) const {
+
+        return std::string_view(_text).substr(_offsets[index], _offsets[index + 1u] - _offsets[index]);
+    }
+
+    std::uint32_t Prefix_index::get_weight(
+        std::uint32_t const index
+        ) const {
+
+        return _weights[index];
+    }
+
+    std::size_t Prefix_index::get_num_entries() const {
+
+        return _weights.size();
+    }
+
+    std::size_t Prefix_index::get_num_bytes() const {
+
+        std::size_t num_bytes = _text.size() + (_offsets.size() + _weights.size()) * sizeof(std::uint32_t);
+
+        for (std::vector<std::uint32_t> const& level : _block_max) {
+
+            num_bytes += level.size() * sizeof(std::uint32_t);
+        }
+
+        return num_bytes;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::uint32_t Prefix_index::_get_heavier(
+        std::uint32_t const first,
+        std::uint32_t const second
+        ) const {
+
+        bool const is_second_heavier = _weights[second] > _weights[first] || (_weights[second] == _weights[first] && second < first);
+
+        return is_second_heavier ? second : first;
+    }
+
+    std::uint32_t Prefix_index::_find_heaviest(
+        std::uint32_t const first,
+        std::uint32_t const last
+        ) const {
+
+        std::uint32_t const first_block = first / BLOCK_SIZE;
+        std::uint32_t const last_block  = (last - 1u) / BLOCK_SIZE;
+
+        std::uint32_t heaviest = first;
+
+        auto const scan = [this, &heaviest](std::uint32_t const scan_first, std::uint32_t const scan_last) {
+
+            for (std::uint32_t i = scan_first; i < scan_last; ++i) {
+
+                heaviest = _get_heavier(heaviest, i);
+            }
+        };
+
+        if (last_block <= first_block + 1u) {
+
+            // At most two blocks, cheaper to scan than to split.
+            scan(first + 1u, last);
+            return heaviest;
+        }
+
+        scan(first + 1u,              (first_block + 1u) * BLOCK_SIZE);
+        scan(last_block * BLOCK_SIZE, last                           );
+
+        // Two runs of 2^level blocks, overlapping if need be, cover the whole blocks between.
+        std::uint32_t const inner_first = first_block + 1u;
+        std::uint32_t const num_inner   = last_block - inner_first;
+        std::uint32_t const level       = static_cast<std::uint32_t>(std::bit_width(num_inner) - 1u);
+
+        heaviest = _get_heavier(heaviest, _block_max[level][inner_first               ]);
+        heaviest = _get_heavier(heaviest, _block_max[level][last_block - (1u << level)]);
+
+        return heaviest;
+    }
+
+    void Prefix_index::_build_block_max() {
+
+        std::size_t const num_entries = _weights.size();
+        std::size_t const num_blocks  = (num_entries + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+
+        if (num_blocks == 0u) {
+
+            return;
+        }
+
+        std::vector<std::uint32_t> blocks(num_blocks);
+
+        for (std::size_t block = 0u; block < num_blocks; ++block) {
+
+            std::uint32_t const first = static_cast<std::uint32_t>(block * BLOCK_SIZE);
+            std::uint32_t const last  = static_cast<std::uint32_t>(std::min(num_entries, (block + 1u) * BLOCK_SIZE));
+
+            std::uint32_t heaviest = first;
+
+            for (std::uint32_t i = first + 1u; i < last; ++i) {
+
+                heaviest = _get_heavier(heaviest, i);
+            }
+
+            blocks[block] = heaviest;
+        }
+
+        _block_max.push_back(std::move(blocks));
+
+        for (std::size_t run = 2u; run <= num_blocks; run *= 2u) {
+
+            std::vector<std::uint32_t> const& previous = _block_max.back();
+            std::vector<std::uint32_t>        level(num_blocks - run + 1u);
+
+            for (std::size_t block = 0u; block < level.size(); ++block) {
+
+                level[block] = _get_heavier(previous[block], previous[block + run / 2u]);
+            }
+
+            _block_max.push_back(std::move(level));
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
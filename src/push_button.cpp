@@ -3,9 +3,12 @@
 Includes
 ------------------------------------------------------------------------------
 */
+#include "widgets/glyph_cache.h"
 #include "widgets/log.h"
+#include "widgets/render_queue.h"
 #include "widgets/push_button.h"
 #include "widgets/resources.h"
+#include "widgets/text_fit.h"
 #include "widgets/widget.h"
 /*
 ------------------------------------------------------------------------------
@@ -27,18 +30,28 @@ Construction / Destruction
 ------------------------------------------------------------------------------
 */
     Push_button::Push_button(
-        std::shared_ptr<sf::RenderWindow> parent_window
+        std::shared_ptr<sf::RenderTarget> parent_target
         ) :
-        Widget       (std::move(parent_window)),
-        Signals_slots(/*--------------------*/),
-        _btn_rect    (DEFAULT_WIDGET_SIZE     ),
-        _btn_text    (DEFAULT_WIDGET_FONT     )  // string = "", characterSize = 30
+        Widget          (std::move(parent_target)),
+        Signals_slots   (/*--------------------*/),
+        _btn_rect       (DEFAULT_WIDGET_SIZE     ),
+        _btn_text       (DEFAULT_WIDGET_FONT     ), // string = "", characterSize = 30
+        _btn_char_size  (30u                     ),
+        _btn_sdf_text   (nullptr                 ),
+        _is_layout_dirty(true                    )
     {
 
         _btn_rect.setPosition (DEFAULT_WIDGET_POS  );
         _btn_rect.setFillColor(DEFAULT_WIDGET_COLOR);
 
-        _btn_text.setFillColor(DEFAULT_TEXT_COLOR);
+        _btn_text.set_fill_color(DEFAULT_TEXT_COLOR);
+
+        _btn_text.set_char_size(DEFAULT_GLYPH_CACHE.request_size(_btn_text.get_char_size()));
+    }
+
+    Push_button::~Push_button() {
+
+        DEFAULT_GLYPH_CACHE.release_size(_btn_text.get_char_size());
     }
 /*
 ------------------------------------------------------------------------------
@@ -50,18 +63,54 @@ Functionality
         if (_current_state == STATE__HIDDEN) {
 
             // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
         } else {
 
             // Can call _update_widget() for final updating
             // of the widget before drawing to the window.
             _update_widget();
 
-            if (!_is_parent_window_nullptr()) {
+            if (!_is_parent_target_nullptr()) {
 
-                auto temp_ptr = _parent_window.lock();
+                auto temp_ptr = _parent_target.lock();
 
                 temp_ptr->draw(_btn_rect);
-                temp_ptr->draw(_btn_text);
+
+                if (_btn_sdf_text) {
+
+                    temp_ptr->draw(*_btn_sdf_text, _btn_text.getTransform());
+                } else {
+
+                    temp_ptr->draw(_btn_text);
+                }
+            }
+        }
+    }
+
+    void Push_button::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            queue.push(_layer, _btn_rect);
+
+            if (_btn_sdf_text) {
+
+                queue.push(_layer, *_btn_sdf_text, _btn_text.getTransform());
+            } else {
+
+                queue.push(_layer, _btn_text);
             }
         }
     }
@@ -72,6 +121,7 @@ Functionality
 
         _btn_rect.move(offset);
         _btn_text.move(offset);
+        _mark_dirty();
     }
 
     void Push_button::move(
@@ -81,6 +131,7 @@ Functionality
 
         _btn_rect.move({x, y});
         _btn_text.move({x, y});
+        _mark_dirty();
     }
 
     void Push_button::rotate(
@@ -89,11 +140,16 @@ Functionality
 
         _btn_rect.rotate(angle);
         _btn_text.rotate(angle);
+        _invalidate_layout();
     }
 
     void Push_button::_update_widget() {
 
-        _center_text_on_btn();
+        if (_is_layout_dirty) {
+
+            _center_text_on_btn();
+            _is_layout_dirty = false;
+        }
     }
 /*
 ------------------------------------------------------------------------------
@@ -105,7 +161,7 @@ Set Functions
         ) {
 
         _btn_rect.setSize(size);
-        _center_text_on_btn();
+        _invalidate_layout();
     }
 
     void Push_button::set_size(
@@ -114,15 +170,15 @@ Set Functions
         ) {
 
         _btn_rect.setSize({x, y});
-        _center_text_on_btn();
+        _invalidate_layout();
     }
 
     void Push_button::set_char_size(
         std::uint32_t const char_size
         ) {
 
-        _btn_text.setCharacterSize(char_size);
-        _center_text_on_btn();
+        _btn_char_size = char_size;
+        _invalidate_layout();
     }
 
     void Push_button::set_scale(
@@ -131,7 +187,7 @@ Set Functions
 
         _btn_rect.setScale(scale);
         _btn_text.setScale(scale);
-        _center_text_on_btn();
+        _invalidate_layout();
     }
 
     void Push_button::set_scale(
@@ -141,7 +197,7 @@ Set Functions
 
         _btn_rect.setScale({x, y});
         _btn_text.setScale({x, y});
-        _center_text_on_btn();
+        _invalidate_layout();
     }
 
     void Push_button::set_pos(
@@ -149,7 +205,7 @@ Set Functions
         ) {
 
         _btn_rect.setPosition(pos);
-        _center_text_on_btn();
+        _invalidate_layout();
     }
 
     void Push_button::set_pos(
@@ -158,7 +214,7 @@ Set Functions
         ) {
 
         _btn_rect.setPosition({x, y});
-        _center_text_on_btn();
+        _invalidate_layout();
     }
 
     void Push_button::set_origin(
@@ -167,6 +223,7 @@ Set Functions
 
         _btn_rect.setOrigin(origin);
         _btn_text.setOrigin(origin);
+        _invalidate_layout();
     }
 
     void Push_button::set_origin(
@@ -176,6 +233,7 @@ Set Functions
 
         _btn_rect.setOrigin({x, y});
         _btn_text.setOrigin({x, y});
+        _invalidate_layout();
     }
 
     void Push_button::set_rotation(
@@ -184,6 +242,7 @@ Set Functions
 
         _btn_rect.setRotation(angle);
         _btn_text.setRotation(angle);
+        _invalidate_layout();
     }
 
     void Push_button::set_color(
@@ -191,21 +250,35 @@ Set Functions
         ) {
 
         _btn_rect.setFillColor(color);
+        _mark_dirty();
     }
 
     void Push_button::set_text_color(
         sf::Color const color
         ) {
 
-        _btn_text.setFillColor(color);
+        _btn_text.set_fill_color(color);
+
+        if (_btn_sdf_text) {
+
+            _btn_sdf_text->set_fill_color(color);
+        }
+
+        _mark_dirty();
     }
 
     void Push_button::set_text_string(
         sf::String const string
         ) {
 
-        _btn_text.setString(string);
-        _center_text_on_btn();
+        _btn_text.set_string(string);
+
+        if (_btn_sdf_text) {
+
+            _btn_sdf_text->set_string(string);
+        }
+
+        _invalidate_layout();
     }
 
     void Push_button::set_text_style(
@@ -224,8 +297,8 @@ Set Functions
         // Is a valid style.
         if (style & valid_style_mask) {
 
-            _btn_text.setStyle(style);
-            _center_text_on_btn();
+            _btn_text.set_style(style);
+            _invalidate_layout();
         } else {
 
             LOG(WARNING)                            <<
@@ -235,6 +308,25 @@ Set Functions
         }
     }
 
+    void Push_button::set_sdf_font(
+        Sdf_font* font
+        ) {
+
+        if (font == nullptr) {
+
+            _btn_sdf_text.reset();
+        } else if (_btn_sdf_text) {
+
+            _btn_sdf_text->set_font(*font);
+        } else {
+
+            _btn_sdf_text = std::make_unique<Sdf_text>(*font, _btn_text.get_string(), static_cast<float>(_btn_char_size));
+            _btn_sdf_text->set_fill_color(_btn_text.get_fill_color());
+        }
+
+        _invalidate_layout();
+    }
+
     void Push_button::set_border_thickness(
         float const thickness
         ) {
@@ -251,6 +343,8 @@ Set Functions
 
             _btn_rect.setOutlineThickness(thickness);
         }
+
+        _invalidate_layout();
     }
 
     void Push_button::set_border_color(
@@ -258,20 +352,23 @@ Set Functions
         ) {
 
         _btn_rect.setOutlineColor(color);
+        _mark_dirty();
     }
 
     void Push_button::set_text_border_thickness(
         float const thickness
         ) {
 
-        _btn_text.setOutlineThickness(thickness);
+        _btn_text.set_outline_thickness(thickness);
+        _invalidate_layout();
     }
 
     void Push_button::set_text_border_color(
         sf::Color const color
         ) {
 
-        _btn_text.setOutlineColor(color);
+        _btn_text.set_outline_color(color);
+        _mark_dirty();
     }
 /*
 ------------------------------------------------------------------------------
@@ -295,7 +392,12 @@ Get Functions
 
     std::uint32_t Push_button::get_char_size() const {
 
-        return _btn_text.getCharacterSize();
+        if (_btn_sdf_text) {
+
+            return static_cast<std::uint32_t>(_btn_sdf_text->get_char_size());
+        }
+
+        return _btn_text.get_char_size();
     }
 
     sf::Vector2f Push_button::get_scale() const {
@@ -348,6 +450,11 @@ Get Functions
         return _btn_rect.getRotation();
     }
 
+    sf::FloatRect Push_button::get_global_bounds() const {
+
+        return _btn_rect.getGlobalBounds();
+    }
+
     sf::Color Push_button::get_color() const {
 
         return _btn_rect.getFillColor();
@@ -355,17 +462,22 @@ Get Functions
 
     sf::Color Push_button::get_text_color() const {
 
-        return _btn_text.getFillColor();
+        return _btn_text.get_fill_color();
     }
 
     sf::String Push_button::get_text_string() const {
 
-        return _btn_text.getString();
+        return _btn_text.get_string();
     }
 
     std::uint32_t Push_button::get_text_style() const {
 
-        return _btn_text.getStyle();
+        return _btn_text.get_style();
+    }
+
+    Sdf_font* Push_button::get_sdf_font() const {
+
+        return _btn_sdf_text ? &_btn_sdf_text->get_font() : nullptr;
     }
 
     float Push_button::get_border_thickness() const {
@@ -380,12 +492,12 @@ Get Functions
 
     float Push_button::get_text_border_thickness() const {
 
-        return _btn_text.getOutlineThickness();
+        return _btn_text.get_outline_thickness();
     }
 
     sf::Color Push_button::get_text_border_color() const {
 
-        return _btn_text.getOutlineColor();
+        return _btn_text.get_outline_color();
     }
 /*
 ------------------------------------------------------------------------------
@@ -427,12 +539,27 @@ Signals / slots
 Helper Functions
 ------------------------------------------------------------------------------
 */
+    void Push_button::_invalidate_layout() {
+
+        _is_layout_dirty = true;
+        _mark_dirty();
+    }
+
     void Push_button::_center_text_on_btn() {
 
         _fit_text_to_btn();
 
-        sf::FloatRect const btn_bounds  = _btn_rect.getGlobalBounds ();
-        sf::FloatRect const text_bounds = _btn_text.getGlobalBounds ();
+        sf::FloatRect const btn_bounds = _btn_rect.getGlobalBounds();
+        sf::FloatRect       text_bounds;
+
+        if (_btn_sdf_text) {
+
+            // The sdf text is drawn with the transform of `_btn_text`.
+            text_bounds = _btn_text.getTransform().transformRect(_btn_sdf_text->get_local_bounds());
+        } else {
+
+            text_bounds = _btn_text.get_global_bounds();
+        }
 
         // Center the text on the button.
         sf::Vector2f const btn_center  = btn_bounds.getCenter();
@@ -446,38 +573,28 @@ Helper Functions
 
     void Push_button::_fit_text_to_btn() {
 
-        // Variables relating to the widget.
-        sf::FloatRect btn_bounds  = _btn_rect.getGlobalBounds ();
-        sf::FloatRect text_bounds = _btn_text.getGlobalBounds ();
-        std::uint32_t char_size   = _btn_text.getCharacterSize();
-
-        // Flags for if the texts bounding rectangle is greater than
-        // the buttons bounding rectangle.
-        bool is_out_of_bounds_x = text_bounds.size.x > btn_bounds.size.x;
-        bool is_out_of_bounds_y = text_bounds.size.y > btn_bounds.size.y;
-        bool is_out_of_bounds   = is_out_of_bounds_x || is_out_of_bounds_y;
-
-        // Flag for if the current text character size is still a valid size.
-        bool is_valid_char_size = char_size >= 1u;
-
-        // While the text bounds is greater than the buttons bounding rectangle
-        // and the texts character size is still valid (we can decrease it).
-        while (is_out_of_bounds && is_valid_char_size) {
-
-            // Decrease the text character size.
-            _btn_text.setCharacterSize(char_size - 1u);
-
-            // Update variables.
-            btn_bounds  = _btn_rect.getGlobalBounds ();
-            text_bounds = _btn_text.getGlobalBounds ();
-            char_size   = _btn_text.getCharacterSize();
-
-            // Update flags.
-            is_out_of_bounds_x = text_bounds.size.x > btn_bounds.size.x;
-            is_out_of_bounds_y = text_bounds.size.y > btn_bounds.size.y;
-            is_out_of_bounds   = is_out_of_bounds_x || is_out_of_bounds_y;
-            is_valid_char_size = char_size >= 1u;
+        if (_btn_sdf_text) {
+
+            // Scaling the distance fields rasterizes nothing, so no cache size is requested.
+            _btn_sdf_text->fit(_btn_rect.getLocalBounds().size, static_cast<float>(_btn_char_size));
+            return;
         }
+
+        unsigned int const size_in_use = _btn_text.get_char_size();
+
+        // The fit measures its own run, the button draws shared geometry.
+        Glyph_run measure(_btn_text.get_font(), size_in_use);
+
+        measure.set_string           (_btn_text.get_string().toUtf32());
+        measure.set_style            (_btn_text.get_style           ());
+        measure.set_outline_thickness(_btn_text.get_outline_thickness());
+
+        // Fits from the requested size down, so text grows back when the button does.
+        unsigned int const size = DEFAULT_TEXT_FIT.fit(measure, _btn_rect.getLocalBounds().size, _btn_char_size);
+
+        // Request the new size before releasing the old one, so a size kept in use stays counted.
+        _btn_text.set_char_size(DEFAULT_GLYPH_CACHE.request_size(size));
+        DEFAULT_GLYPH_CACHE.release_size(size_in_use);
     }
 
     bool Push_button::_is_hovering() const {
@@ -486,6 +603,12 @@ Helper Functions
 
         auto temp_ptr = _parent_window.lock();
 
+        // Offscreen widgets have no window to read the mouse position from.
+        if (!temp_ptr) {
+
+            return false;
+        }
+
         sf::Vector2i  const mouse_pos_pixels = sf::Mouse::getPosition    (*temp_ptr       );
         sf::Vector2f  const mouse_pos_coords = temp_ptr->mapPixelToCoords(mouse_pos_pixels);
         sf::FloatRect const btn_bounds       = _btn_rect.getGlobalBounds (/*------------*/);
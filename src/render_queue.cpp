@@ -0,0 +1,583 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/render_queue.h"
+#include "widgets/log.h"
+#include "widgets/resources.h"
+#include "widgets/spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <numeric>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Render_queue::Render_queue() :
+        _items                 (     ),
+        _order                 (     ),
+        _blend_modes           (     ),
+        _depth_cells           (     ),
+        _large_items           (     ),
+        _sprite_batch          (     ),
+        _retained_sprites      (     ),
+        _retained_texts        (     ),
+        _retained_rectangles   (     ),
+        _retained_circles      (     ),
+        _retained_convexes     (     ),
+        _retained_vertex_arrays(     ),
+        _retained_sdf_texts    (     ),
+        _is_retained           (false),
+        _num_draw_calls        (0u   ),
+        _num_state_changes     (0u   )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Render_queue::push(
+        int              const  layer,
+        sf::Sprite       const& sprite,
+        sf::RenderStates const& states
+        ) {
+
+        sf::Sprite const& stored = _is_retained ? _retained_sprites.emplace_back(sprite) : sprite;
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = &stored.getTexture();
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        push(stored, key, states.transform.transformRect(stored.getGlobalBounds()), states);
+
+        _items.back().sprite = &stored;
+    }
+
+    void Render_queue::push(
+        int              const  layer,
+        sf::Text         const& text,
+        sf::RenderStates const& states
+        ) {
+
+        if (_is_retained) {
+
+            // Laid out through the glyph cache, so the copy never touches the font.
+            Glyph_run run(text.getFont(), text.getCharacterSize());
+
+            run.set_string           (text.getString().toUtf32());
+            run.set_style            (text.getStyle           ());
+            run.set_fill_color       (text.getFillColor       ());
+            run.set_outline_thickness(text.getOutlineThickness());
+            run.set_outline_color    (text.getOutlineColor    ());
+
+            run.setPosition(text.getPosition());
+            run.setRotation(text.getRotation());
+            run.setScale   (text.getScale   ());
+            run.setOrigin  (text.getOrigin  ());
+
+            _push_snapshot(layer, run, states, states.transform.transformRect(run.get_global_bounds()));
+            return;
+        }
+
+        Render_key key{};
+        key.layer      = layer;
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        sf::FloatRect bounds;
+
+        {
+            // sf::Text reads its font directly instead of through a Glyph_cache.
+            std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+            key.texture = &text.getFont().getTexture(text.getCharacterSize());
+            bounds      = text.getGlobalBounds();
+        }
+
+        push(text, key, states.transform.transformRect(bounds), states);
+    }
+
+    void Render_queue::push(
+        int              const  layer,
+        Glyph_run        const& run,
+        sf::RenderStates const& states
+        ) {
+
+        if (_is_retained) {
+
+            _push_snapshot(layer, run, states, states.transform.transformRect(run.get_global_bounds()));
+            return;
+        }
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = run.get_texture();
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        push(run, key, states.transform.transformRect(run.get_global_bounds()), states);
+    }
+
+    void Render_queue::push(
+        int              const  layer,
+        Shared_text      const& text,
+        sf::RenderStates const& states
+        ) {
+
+        if (_is_retained) {
+
+            // The shared geometry sits at the origin, the text's transform places it.
+            sf::RenderStates placed = states;
+            placed.transform *= text.getTransform();
+
+            _push_snapshot(layer, *text.get_geometry(), placed, states.transform.transformRect(text.get_global_bounds()));
+            return;
+        }
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = text.get_geometry()->get_texture();
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        push(text, key, states.transform.transformRect(text.get_global_bounds()), states);
+    }
+
+    void Render_queue::push(
+        int              const  layer,
+        Sdf_text         const& text,
+        sf::RenderStates const& states
+        ) {
+
+        // Laid out before copying, so drawing the copy only reads its own vertices.
+        sf::FloatRect const bounds = states.transform.transformRect(text.get_global_bounds());
+
+        Sdf_text const& stored = _is_retained ? _retained_sdf_texts.emplace_back(text) : text;
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = stored.get_texture();
+        key.shader     = stored.get_font().get_shader();
+        key.blend_mode = states.blendMode;
+
+        push(stored, key, bounds, states);
+    }
+
+    void Render_queue::push(
+        int              const  layer,
+        sf::VertexArray  const& vertices,
+        sf::RenderStates const& states,
+        Glyph_cache      const* glyph_cache
+        ) {
+
+        sf::VertexArray const& stored = _is_retained ? _retained_vertex_arrays.emplace_back(vertices) : vertices;
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = states.texture;
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        push(stored, key, states.transform.transformRect(stored.getBounds()), states);
+
+        if (_is_retained && glyph_cache != nullptr) {
+
+            _items.back().glyph_cache = glyph_cache;
+            _items.back().generation  = glyph_cache->get_generation();
+        }
+    }
+
+    void Render_queue::push(
+        int              const  layer,
+        sf::Shape        const& shape,
+        sf::RenderStates const& states
+        ) {
+
+        sf::Shape const* stored = &shape;
+
+        if (!_is_retained) {
+
+            // Dont copy since the caller keeps the shape alive.
+        } else if (auto const* rectangle = dynamic_cast<sf::RectangleShape const*>(&shape)) {
+
+            stored = &_retained_rectangles.emplace_back(*rectangle);
+        } else if (auto const* circle = dynamic_cast<sf::CircleShape const*>(&shape)) {
+
+            stored = &_retained_circles.emplace_back(*circle);
+        } else if (auto const* convex = dynamic_cast<sf::ConvexShape const*>(&shape)) {
+
+            stored = &_retained_convexes.emplace_back(*convex);
+        } else {
+
+            LOG(WARNING) << "Shape is not queued as a retained queue can only copy rectangle, circle and convex shapes.";
+            return;
+        }
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = stored->getTexture();
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        push(*stored, key, states.transform.transformRect(stored->getGlobalBounds()), states);
+    }
+
+    void Render_queue::push(
+        sf::Drawable     const& drawable,
+        Render_key       const& key,
+        sf::FloatRect    const& bounds,
+        sf::RenderStates const& states
+        ) {
+
+        Item item{};
+        item.key              = key;
+        item.states           = states;
+        item.states.texture   = key.texture;
+        item.states.shader    = key.shader;
+        item.states.blendMode = key.blend_mode;
+        item.drawable         = &drawable;
+        item.bounds           = bounds;
+        item.blend_index      = _get_blend_index(key.blend_mode);
+
+        _items.push_back(item);
+    }
+
+    void Render_queue::append(
+        Render_queue& other
+        ) {
+
+        if (other._is_retained) {
+
+            LOG(WARNING) << "Retained queue is not appended as its copies are freed when it is cleared.";
+            return;
+        }
+
+        _items.reserve(_items.size() + other._items.size());
+
+        for (Item const& item : other._items) {
+
+            _items.push_back(item);
+
+            // Blend indices are local to each queue.
+            _items.back().blend_index = _get_blend_index(other._blend_modes[item.blend_index]);
+        }
+
+        other.clear();
+    }
+
+    void Render_queue::submit(
+        sf::RenderTarget& target
+        ) {
+
+        _num_draw_calls    = 0u;
+        _num_state_changes = 0u;
+
+        _assign_depths();
+
+        _order.resize(_items.size());
+        std::iota(_order.begin(), _order.end(), std::size_t{0u});
+
+        std::sort(_order.begin(), _order.end(), [this](std::size_t const a, std::size_t const b) {
+
+            Item const& lhs = _items[a];
+            Item const& rhs = _items[b];
+
+            if (lhs.key.layer != rhs.key.layer) { return lhs.key.layer < rhs.key.layer; }
+            if (lhs.depth     != rhs.depth    ) { return lhs.depth     < rhs.depth;     }
+
+            if (lhs.key.shader  != rhs.key.shader ) { return std::less<>{}(lhs.key.shader,  rhs.key.shader ); }
+            if (lhs.key.texture != rhs.key.texture) { return std::less<>{}(lhs.key.texture, rhs.key.texture); }
+
+            if (lhs.blend_index != rhs.blend_index) { return lhs.blend_index < rhs.blend_index; }
+
+            // Push order breaks the remaining ties, which keeps the sort stable.
+            return a < b;
+        });
+
+        Item const*      previous = nullptr;
+        sf::RenderStates batch_states;
+
+        // Held only across consecutive items that sample a font page.
+        std::unique_lock<std::mutex> font_lock(resources::FONT_MUTEX, std::defer_lock);
+
+        for (std::size_t const index : _order) {
+
+            Item const& item = _items[index];
+
+            if (item.glyph_cache == nullptr) {
+
+                if (font_lock.owns_lock()) {
+
+                    font_lock.unlock();
+                }
+            } else {
+
+                if (!font_lock.owns_lock()) {
+
+                    font_lock.lock();
+                }
+
+                // The eviction freed the page the vertices sample.
+                if (item.generation != item.glyph_cache->get_generation()) {
+
+                    continue;
+                }
+            }
+
+            bool const is_state_change =
+                previous == nullptr                       ||
+                previous->key.texture != item.key.texture ||
+                previous->key.shader  != item.key.shader  ||
+                previous->blend_index != item.blend_index;
+
+            if (is_state_change) {
+
+                ++_num_state_changes;
+            }
+
+            // The batch bakes the sprite transforms, so only untransformed states can join it.
+            bool const can_batch = item.sprite != nullptr && item.states.transform == sf::Transform::Identity;
+
+            if (_sprite_batch.get_num_sprites() > 0u && (!can_batch || is_state_change)) {
+
+                _flush_sprites(target, batch_states);
+            }
+
+            if (can_batch) {
+
+                if (_sprite_batch.get_num_sprites() == 0u) {
+
+                    batch_states = item.states;
+                }
+
+                _sprite_batch.add(*item.sprite);
+            } else {
+
+                target.draw(*item.drawable, item.states);
+                ++_num_draw_calls;
+            }
+
+            previous = &item;
+        }
+
+        if (_sprite_batch.get_num_sprites() > 0u) {
+
+            _flush_sprites(target, batch_states);
+        }
+
+        if (!_is_retained) {
+
+            clear();
+        }
+    }
+
+    void Render_queue::clear() {
+
+        _items.clear();
+        _blend_modes.clear();
+
+        _retained_sprites.clear();
+        _retained_texts.clear();
+        _retained_rectangles.clear();
+        _retained_circles.clear();
+        _retained_convexes.clear();
+        _retained_vertex_arrays.clear();
+        _retained_sdf_texts.clear();
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Render_queue::set_retained(
+        bool const is_retained
+        ) {
+
+        clear();
+
+        _is_retained = is_retained;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Render_queue::get_num_items() const {
+
+        return _items.size();
+    }
+
+    std::size_t Render_queue::get_num_draw_calls() const {
+
+        return _num_draw_calls;
+    }
+
+    std::size_t Render_queue::get_num_state_changes() const {
+
+        return _num_state_changes;
+    }
+
+    bool Render_queue::is_retained() const {
+
+        return _is_retained;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    void Render_queue::Text_snapshot::draw(
+        sf::RenderTarget& target,
+        sf::RenderStates  states
+        ) const {
+
+        if (!vertices.empty()) {
+
+            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+    }
+
+    void Render_queue::_push_snapshot(
+        int              const  layer,
+        Glyph_run        const& run,
+        sf::RenderStates        states,
+        sf::FloatRect    const& bounds
+        ) {
+
+        Text_snapshot& snapshot = _retained_texts.emplace_back();
+        run.append_vertices(snapshot.vertices);
+
+        states.transform *= run.getTransform();
+
+        Render_key key{};
+        key.layer      = layer;
+        key.texture    = run.get_texture();
+        key.shader     = states.shader;
+        key.blend_mode = states.blendMode;
+
+        push(snapshot, key, bounds, states);
+
+        // Recording and trim() share the logic thread, so the vertices are of this generation.
+        _items.back().glyph_cache = &run.get_glyph_cache();
+        _items.back().generation  = run.get_glyph_cache().get_generation();
+    }
+
+    std::uint32_t Render_queue::_get_blend_index(
+        sf::BlendMode const& blend_mode
+        ) {
+
+        // Only a handful of blend modes are ever used, a linear search is fastest.
+        for (std::size_t i = 0u; i < _blend_modes.size(); ++i) {
+
+            if (_blend_modes[i] == blend_mode) {
+
+                return static_cast<std::uint32_t>(i);
+            }
+        }
+
+        _blend_modes.push_back(blend_mode);
+
+        return static_cast<std::uint32_t>(_blend_modes.size() - 1u);
+    }
+
+    void Render_queue::_assign_depths() {
+
+        // Cells only narrow down which earlier items need an exact overlap test.
+        float        const cell_size          = 128.0f;
+        std::int64_t const max_cells_per_item = 256;
+
+        _depth_cells.clear();
+        _large_items.clear();
+
+        for (std::size_t i = 0u; i < _items.size(); ++i) {
+
+            Item& item = _items[i];
+            item.depth = 0u;
+
+            auto const visit = [&](std::size_t const other_index) {
+
+                Item const& other = _items[other_index];
+
+                if (other.key.layer == item.key.layer &&
+                    other.depth >= item.depth         &&
+                    is_overlapping(other.bounds, item.bounds)) {
+
+                    item.depth = other.depth + 1u;
+                }
+            };
+
+            std::int32_t const min_x = static_cast<std::int32_t>(std::floor( item.bounds.position.x                      / cell_size));
+            std::int32_t const min_y = static_cast<std::int32_t>(std::floor( item.bounds.position.y                      / cell_size));
+            std::int32_t const max_x = static_cast<std::int32_t>(std::floor((item.bounds.position.x + item.bounds.size.x) / cell_size));
+            std::int32_t const max_y = static_cast<std::int32_t>(std::floor((item.bounds.position.y + item.bounds.size.y) / cell_size));
+
+            std::int64_t const num_cells =
+                (static_cast<std::int64_t>(max_x) - min_x + 1) *
+                (static_cast<std::int64_t>(max_y) - min_y + 1);
+
+            if (num_cells > max_cells_per_item) {
+
+                // Large items (backgrounds, panels) are tested against everything before them.
+                for (std::size_t j = 0u; j < i; ++j) {
+
+                    visit(j);
+                }
+
+                _large_items.push_back(i);
+                continue;
+            }
+
+            for (std::size_t const j : _large_items) {
+
+                visit(j);
+            }
+
+            for (std::int32_t y = min_y; y <= max_y; ++y) {
+
+                for (std::int32_t x = min_x; x <= max_x; ++x) {
+
+                    std::uint64_t const cell_key =
+                        (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32u) |
+                         static_cast<std::uint64_t>(static_cast<std::uint32_t>(y));
+
+                    std::vector<std::size_t>& cell = _depth_cells[cell_key];
+
+                    for (std::size_t const j : cell) {
+
+                        visit(j);
+                    }
+
+                    cell.push_back(i);
+                }
+            }
+        }
+    }
+
+    void Render_queue::_flush_sprites(
+        sf::RenderTarget&       target,
+        sf::RenderStates const& states
+        ) {
+
+        _sprite_batch.draw(target, states);
+        _num_draw_calls += _sprite_batch.get_num_draw_calls();
+        _sprite_batch.clear();
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,876 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_cache.h"
+#include "widgets/log.h"
+#include "widgets/render_queue.h"
+#include "widgets/resources.h"
+#include "widgets/rich_label.h"
+#include "widgets/widget.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Using namespaces
+------------------------------------------------------------------------------
+*/
+using namespace resources;
+using namespace signals_slots;
+using namespace widgets;
+/*
+------------------------------------------------------------------------------
+Bounds
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Grow a rectangle to cover another, an empty rectangle covers nothing
+    sf::FloatRect unite(
+        sf::FloatRect const first,
+        sf::FloatRect const second
+        ) {
+
+        if (first.size.x <= 0.0f && first.size.y <= 0.0f) {
+
+            return second;
+        }
+
+        if (second.size.x <= 0.0f && second.size.y <= 0.0f) {
+
+            return first;
+        }
+
+        sf::Vector2f const min_corner = {std::min(first.position.x, second.position.x), std::min(first.position.y, second.position.y)};
+        sf::Vector2f const max_corner = {
+            std::max(first.position.x + first.size.x, second.position.x + second.size.x),
+            std::max(first.position.y + first.size.y, second.position.y + second.size.y)
+        };
+
+        return sf::FloatRect(min_corner, max_corner - min_corner);
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Rich_label::Rich_label(
+        std::shared_ptr<sf::RenderTarget> parent_target,
+        std::vector<Span> spans
+        ) :
+        Widget               (std::move(parent_target)),
+        Signals_slots        (/*--------------------*/),
+        _rl_transform        (/*--------------------*/),
+        _rl_spans            (/*--------------------*/),
+        _rl_layouts          (/*--------------------*/),
+        _rl_pages            (/*--------------------*/),
+        _rl_local_bounds     (/*--------------------*/),
+        _rl_is_pages_dirty   (true                    ),
+        _rl_generation       (0u                      ),
+        _rl_num_glyph_updates(0u                      )
+    {
+
+        _rl_transform.setPosition(DEFAULT_WIDGET_POS);
+
+        // The spans below are built at the current generation.
+        DEFAULT_GLYPH_CACHE.update_generation(_rl_generation);
+
+        set_spans(std::move(spans));
+    }
+
+    Rich_label::~Rich_label() {
+
+        for (Span const& span : _rl_spans) {
+
+            DEFAULT_GLYPH_CACHE.release_size(span.char_size);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Rich_label::draw() {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
+        } else {
+
+            // Can call _update_widget() for final updating
+            // of the widget before drawing to the window.
+            _update_widget();
+
+            if (!_is_parent_target_nullptr()) {
+
+                auto temp_ptr = _parent_target.lock();
+
+                sf::RenderStates states(_rl_transform.getTransform());
+
+                // Outlines go under the glyphs of every span, like sf::Text.
+                for (Page const& page : _rl_pages) {
+
+                    if (page.outline_vertices.getVertexCount() > 0u) {
+
+                        states.texture = page.texture;
+                        temp_ptr->draw(page.outline_vertices, states);
+                    }
+                }
+
+                for (Page const& page : _rl_pages) {
+
+                    states.texture = page.texture;
+                    temp_ptr->draw(page.fill_vertices, states);
+                }
+            }
+        }
+    }
+
+    void Rich_label::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            sf::RenderStates states(_rl_transform.getTransform());
+
+            // Pushed first, the queue keeps overlapping items in push order.
+            for (Page const& page : _rl_pages) {
+
+                if (page.outline_vertices.getVertexCount() > 0u) {
+
+                    states.texture = page.texture;
+                    queue.push(_layer, page.outline_vertices, states, &DEFAULT_GLYPH_CACHE);
+                }
+            }
+
+            for (Page const& page : _rl_pages) {
+
+                states.texture = page.texture;
+                queue.push(_layer, page.fill_vertices, states, &DEFAULT_GLYPH_CACHE);
+            }
+        }
+    }
+
+    void Rich_label::move(
+        sf::Vector2f const offset
+        ) {
+
+        _rl_transform.move(offset);
+        _mark_dirty();
+    }
+
+    void Rich_label::move(
+        float const x,
+        float const y
+        ) {
+
+        _rl_transform.move({x, y});
+        _mark_dirty();
+    }
+
+    void Rich_label::rotate(
+        sf::Angle const angle
+        ) {
+
+        _rl_transform.rotate(angle);
+        _mark_dirty();
+    }
+
+    std::size_t Rich_label::add_span(
+        Span span
+        ) {
+
+        span.char_size = DEFAULT_GLYPH_CACHE.request_size(span.char_size);
+
+        _rl_spans.push_back(std::move(span));
+        _rl_layouts.emplace_back();
+
+        _build_span(_rl_spans.size() - 1u);
+        _place_spans();
+
+        _rl_is_pages_dirty = true;
+        _mark_dirty();
+
+        return _rl_spans.size() - 1u;
+    }
+
+    void Rich_label::clear_spans() {
+
+        for (Span const& span : _rl_spans) {
+
+            DEFAULT_GLYPH_CACHE.release_size(span.char_size);
+        }
+
+        _rl_spans.clear();
+        _rl_layouts.clear();
+
+        _place_spans();
+
+        _rl_is_pages_dirty = true;
+        _mark_dirty();
+    }
+
+    void Rich_label::_update_widget() {
+
+        // Texture coordinates of every quad are only valid for the page they were built on.
+        if (DEFAULT_GLYPH_CACHE.update_generation(_rl_generation)) {
+
+            for (std::size_t i = 0u; i < _rl_layouts.size(); ++i) {
+
+                _build_span(i);
+            }
+
+            _place_spans();
+            _rl_is_pages_dirty = true;
+        }
+
+        if (_rl_is_pages_dirty) {
+
+            _build_pages();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Rich_label::set_spans(
+        std::vector<Span> spans
+        ) {
+
+        std::size_t const num_kept = std::min(spans.size(), _rl_spans.size());
+
+        bool is_moved = spans.size() != _rl_spans.size();
+
+        // Spans past the new count are dropped, hand their sizes back.
+        for (std::size_t i = num_kept; i < _rl_spans.size(); ++i) {
+
+            DEFAULT_GLYPH_CACHE.release_size(_rl_spans[i].char_size);
+        }
+
+        _rl_spans.resize  (spans.size());
+        _rl_layouts.resize(spans.size());
+
+        for (std::size_t i = 0u; i < spans.size(); ++i) {
+
+            if (i < num_kept) {
+
+                is_moved = _replace_span(i, std::move(spans[i])) || is_moved;
+            } else {
+
+                spans[i].char_size = DEFAULT_GLYPH_CACHE.request_size(spans[i].char_size);
+
+                _rl_spans[i] = std::move(spans[i]);
+                _build_span(i);
+            }
+        }
+
+        if (is_moved) {
+
+            _place_spans();
+            _rl_is_pages_dirty = true;
+        }
+
+        _mark_dirty();
+    }
+
+    void Rich_label::set_span(
+        std::size_t const index,
+        Span              span
+        ) {
+
+        if (!_is_valid_span(index)) {
+
+            return;
+        }
+
+        Span_layout const& layout = _rl_layouts[index];
+
+        std::size_t const num_fill_vertices    = layout.fill_vertices.size   ();
+        std::size_t const num_outline_vertices = layout.outline_vertices.size();
+
+        if (!_replace_span(index, std::move(span))) {
+
+            _mark_dirty();
+            return;
+        }
+
+        _place_spans();
+
+        bool const is_same_page =
+            !_rl_is_pages_dirty                                            &&
+            layout.page != NO_PAGE                                         &&
+            _rl_pages[layout.page].char_size == _rl_spans[index].char_size &&
+            layout.fill_vertices.size   () == num_fill_vertices            &&
+            layout.outline_vertices.size() == num_outline_vertices;
+
+        if (is_same_page) {
+
+            // The span keeps its slots, so only it and the spans it moved are copied again.
+            for (std::size_t i = 0u; i < _rl_layouts.size(); ++i) {
+
+                if ((i == index || _rl_layouts[i].is_moved) && _rl_layouts[i].page != NO_PAGE) {
+
+                    _copy_span_to_page(i);
+                }
+            }
+        } else {
+
+            _rl_is_pages_dirty = true;
+        }
+
+        _mark_dirty();
+    }
+
+    void Rich_label::set_span_text(
+        std::size_t const  index,
+        sf::String  const& text
+        ) {
+
+        if (!_is_valid_span(index)) {
+
+            return;
+        }
+
+        Span span = _rl_spans[index];
+        span.text = text;
+
+        set_span(index, std::move(span));
+    }
+
+    void Rich_label::set_span_fill_color(
+        std::size_t const index,
+        sf::Color   const color
+        ) {
+
+        if (!_is_valid_span(index)) {
+
+            return;
+        }
+
+        _rl_spans[index].fill_color = color;
+        _recolor_span(index);
+        _mark_dirty();
+    }
+
+    void Rich_label::set_scale(
+        sf::Vector2f const scale
+        ) {
+
+        _rl_transform.setScale(scale);
+        _mark_dirty();
+    }
+
+    void Rich_label::set_scale(
+        float const x,
+        float const y
+        ) {
+
+        _rl_transform.setScale({x, y});
+        _mark_dirty();
+    }
+
+    void Rich_label::set_pos(
+        sf::Vector2f const pos
+        ) {
+
+        _rl_transform.setPosition(pos);
+        _mark_dirty();
+    }
+
+    void Rich_label::set_pos(
+        float const x,
+        float const y
+        ) {
+
+        _rl_transform.setPosition({x, y});
+        _mark_dirty();
+    }
+
+    void Rich_label::set_origin(
+        sf::Vector2f const origin
+        ) {
+
+        _rl_transform.setOrigin(origin);
+        _mark_dirty();
+    }
+
+    void Rich_label::set_origin(
+        float const x,
+        float const y
+        ) {
+
+        _rl_transform.setOrigin({x, y});
+        _mark_dirty();
+    }
+
+    void Rich_label::set_rotation(
+        sf::Angle const angle
+        ) {
+
+        _rl_transform.setRotation(angle);
+        _mark_dirty();
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::vector<Rich_label::Span> const& Rich_label::get_spans() const {
+
+        return _rl_spans;
+    }
+
+    std::size_t Rich_label::get_num_spans() const {
+
+        return _rl_spans.size();
+    }
+
+    std::size_t Rich_label::get_num_pages() const {
+
+        return _rl_pages.size();
+    }
+
+    std::size_t Rich_label::get_num_glyph_updates() const {
+
+        return _rl_num_glyph_updates;
+    }
+
+    sf::Vector2f Rich_label::get_scale() const {
+
+        return _rl_transform.getScale();
+    }
+
+    float Rich_label::get_scale_x() const {
+
+        return _rl_transform.getScale().x;
+    }
+
+    float Rich_label::get_scale_y() const {
+
+        return _rl_transform.getScale().y;
+    }
+
+    sf::Vector2f Rich_label::get_pos() const {
+
+        return _rl_transform.getPosition();
+    }
+
+    float Rich_label::get_pos_x() const {
+
+        return _rl_transform.getPosition().x;
+    }
+
+    float Rich_label::get_pos_y() const {
+
+        return _rl_transform.getPosition().y;
+    }
+
+    sf::Vector2f Rich_label::get_origin() const {
+
+        return _rl_transform.getOrigin();
+    }
+
+    float Rich_label::get_origin_x() const {
+
+        return _rl_transform.getOrigin().x;
+    }
+
+    float Rich_label::get_origin_y() const {
+
+        return _rl_transform.getOrigin().y;
+    }
+
+    sf::Angle Rich_label::get_rotation() const {
+
+        return _rl_transform.getRotation();
+    }
+
+    sf::FloatRect Rich_label::get_global_bounds() const {
+
+        return _rl_transform.getTransform().transformRect(_rl_local_bounds);
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    bool Rich_label::_replace_span(
+        std::size_t const index,
+        Span              span
+        ) {
+
+        Span& current = _rl_spans[index];
+
+        // Request the new size before releasing the old one, so a size kept in use stays counted.
+        span.char_size = DEFAULT_GLYPH_CACHE.request_size(span.char_size);
+        DEFAULT_GLYPH_CACHE.release_size(current.char_size);
+
+        bool const is_same_shape =
+            current.text              == span.text              &&
+            current.style             == span.style             &&
+            current.char_size         == span.char_size         &&
+            current.outline_thickness == span.outline_thickness;
+
+        bool const is_same_color =
+            current.fill_color    == span.fill_color &&
+            current.outline_color == span.outline_color;
+
+        current = std::move(span);
+
+        if (!is_same_shape) {
+
+            _build_span(index);
+            return true;
+        }
+
+        if (!is_same_color) {
+
+            _recolor_span(index);
+        }
+
+        return false;
+    }
+
+    void Rich_label::_build_span(
+        std::size_t const index
+        ) {
+
+        Span           const& span     = _rl_spans  [index];
+        Span_layout&          layout   = _rl_layouts[index];
+        std::u32string const  text     = span.text.toUtf32();
+        float          const  baseline = static_cast<float>(span.char_size);
+
+        // Each line of the span is a run of its own, the label places the lines.
+        std::size_t const num_segments = static_cast<std::size_t>(std::count(text.begin(), text.end(), U'\n')) + 1u;
+
+        if (layout.runs.size() > num_segments) {
+
+            layout.runs.erase(layout.runs.begin() + static_cast<std::ptrdiff_t>(num_segments), layout.runs.end());
+        }
+
+        while (layout.runs.size() < num_segments) {
+
+            layout.runs.emplace_back(DEFAULT_WIDGET_FONT, span.char_size);
+        }
+
+        layout.fill_vertices.clear   ();
+        layout.outline_vertices.clear();
+        layout.segments.clear        ();
+
+        std::size_t line_begin = 0u;
+
+        for (Glyph_run& run : layout.runs) {
+
+            std::size_t const line_end      = std::min(text.find(U'\n', line_begin), text.size());
+            std::size_t const fill_begin    = layout.fill_vertices.size   ();
+            std::size_t const outline_begin = layout.outline_vertices.size();
+            std::size_t const num_updates   = run.get_num_glyph_updates   ();
+
+            // The run diffs its string and only looks up the characters that changed.
+            run.set_char_size        (span.char_size                                                   );
+            run.set_style            (span.style                                                       );
+            run.set_outline_thickness(span.outline_thickness                                           );
+            run.set_fill_color       (span.fill_color                                                  );
+            run.set_outline_color    (span.outline_color                                               );
+            run.set_string           (std::u32string_view(text).substr(line_begin, line_end - line_begin));
+
+            run.append_vertices(layout.fill_vertices, layout.outline_vertices);
+
+            _rl_num_glyph_updates += run.get_num_glyph_updates() - num_updates;
+
+            // Runs put the baseline at the character size, segments at 0.
+            for (std::size_t v = fill_begin; v < layout.fill_vertices.size(); ++v) {
+
+                layout.fill_vertices[v].position.y -= baseline;
+            }
+
+            for (std::size_t v = outline_begin; v < layout.outline_vertices.size(); ++v) {
+
+                layout.outline_vertices[v].position.y -= baseline;
+            }
+
+            Segment segment;
+            segment.fill_end    = layout.fill_vertices.size   ();
+            segment.outline_end = layout.outline_vertices.size();
+            segment.width       = run.get_char_x(run.get_size());
+            segment.bounds      = run.get_local_bounds();
+
+            segment.bounds.position.y -= baseline;
+
+            layout.segments.push_back(segment);
+
+            line_begin = line_end + 1u;
+        }
+
+        layout.texture = DEFAULT_GLYPH_CACHE.get_metrics(span.char_size).texture;
+    }
+
+    void Rich_label::_recolor_span(
+        std::size_t const index
+        ) {
+
+        Span        const& span   = _rl_spans  [index];
+        Span_layout&       layout = _rl_layouts[index];
+
+        for (sf::Vertex& vertex : layout.fill_vertices) {
+
+            vertex.color = span.fill_color;
+        }
+
+        for (sf::Vertex& vertex : layout.outline_vertices) {
+
+            vertex.color = span.outline_color;
+        }
+
+        // Pages about to be filled again pick the colors up from the span.
+        if (_rl_is_pages_dirty || layout.page == NO_PAGE) {
+
+            return;
+        }
+
+        Page& page = _rl_pages[layout.page];
+
+        for (std::size_t v = 0u; v < layout.fill_vertices.size(); ++v) {
+
+            page.fill_vertices[layout.fill_offset + v].color = span.fill_color;
+        }
+
+        for (std::size_t v = 0u; v < layout.outline_vertices.size(); ++v) {
+
+            page.outline_vertices[layout.outline_offset + v].color = span.outline_color;
+        }
+    }
+
+    void Rich_label::_place_spans() {
+
+        Glyph_cache& cache = DEFAULT_GLYPH_CACHE;
+
+        struct Line {
+
+            float ascent   = 0.0f;
+            float spacing  = 0.0f;
+            float baseline = 0.0f;
+        };
+
+        std::vector<Line> lines(1u);
+
+        float       pen_x = 0.0f;
+        std::size_t line  = 0u;
+
+        // Every line is as tall as its largest span, so place across first.
+        for (std::size_t i = 0u; i < _rl_spans.size(); ++i) {
+
+            Span const& span = _rl_spans[i];
+
+            _rl_layouts[i].is_moved = false;
+
+            for (std::size_t s = 0u; s < _rl_layouts[i].segments.size(); ++s) {
+
+                Segment& segment = _rl_layouts[i].segments[s];
+
+                if (s > 0u) {
+
+                    lines.emplace_back();
+                    pen_x = 0.0f;
+                    ++line;
+                }
+
+                if (segment.origin.x != pen_x) {
+
+                    segment.origin.x        = pen_x;
+                    _rl_layouts[i].is_moved = true;
+                }
+
+                segment.line = line;
+
+                // An empty span takes no room, not even height.
+                if (!span.text.isEmpty()) {
+
+                    lines[line].ascent  = std::max(lines[line].ascent,  static_cast<float>(span.char_size));
+                    lines[line].spacing = std::max(lines[line].spacing, cache.get_metrics(span.char_size).line_spacing);
+                }
+
+                pen_x += segment.width;
+            }
+        }
+
+        float top = 0.0f;
+
+        for (Line& each_line : lines) {
+
+            each_line.baseline  = top + each_line.ascent;
+            top                += each_line.spacing;
+        }
+
+        _rl_local_bounds = sf::FloatRect();
+
+        for (Span_layout& layout : _rl_layouts) {
+
+            for (Segment& segment : layout.segments) {
+
+                if (segment.origin.y != lines[segment.line].baseline) {
+
+                    segment.origin.y = lines[segment.line].baseline;
+                    layout.is_moved  = true;
+                }
+
+                sf::FloatRect placed = segment.bounds;
+                placed.position += segment.origin;
+
+                _rl_local_bounds = unite(_rl_local_bounds, placed);
+            }
+        }
+    }
+
+    void Rich_label::_build_pages() {
+
+        for (Page& page : _rl_pages) {
+
+            page.fill_vertices.clear   ();
+            page.outline_vertices.clear();
+        }
+
+        auto const find_page = [this](std::uint32_t const char_size) {
+
+            auto const page = std::find_if(_rl_pages.begin(), _rl_pages.end(), [char_size](Page const& each_page) {
+
+                return each_page.char_size == char_size;
+            });
+
+            return static_cast<std::size_t>(page - _rl_pages.begin());
+        };
+
+        // Copy the quads of each span to where its segments are placed, no font lookups.
+        for (std::size_t i = 0u; i < _rl_spans.size(); ++i) {
+
+            Span_layout& layout = _rl_layouts[i];
+
+            if (layout.fill_vertices.empty() && layout.outline_vertices.empty()) {
+
+                layout.page = NO_PAGE;
+                continue;
+            }
+
+            std::size_t page_index = find_page(_rl_spans[i].char_size);
+
+            if (page_index == _rl_pages.size()) {
+
+                _rl_pages.push_back({_rl_spans[i].char_size, nullptr, sf::VertexArray(sf::PrimitiveType::Triangles), sf::VertexArray(sf::PrimitiveType::Triangles)});
+            }
+
+            Page& page = _rl_pages[page_index];
+
+            page.texture          = layout.texture;
+            layout.page           = page_index;
+            layout.fill_offset    = page.fill_vertices.getVertexCount();
+            layout.outline_offset = page.outline_vertices.getVertexCount();
+
+            page.fill_vertices.resize   (layout.fill_offset    + layout.fill_vertices.size   ());
+            page.outline_vertices.resize(layout.outline_offset + layout.outline_vertices.size());
+
+            _copy_span_to_page(i);
+        }
+
+        // Drop the pages of character sizes no span uses anymore.
+        auto const is_unused = [](Page const& page) {
+
+            return page.fill_vertices.getVertexCount() == 0u && page.outline_vertices.getVertexCount() == 0u;
+        };
+
+        if (std::any_of(_rl_pages.begin(), _rl_pages.end(), is_unused)) {
+
+            _rl_pages.erase(std::remove_if(_rl_pages.begin(), _rl_pages.end(), is_unused), _rl_pages.end());
+
+            for (std::size_t i = 0u; i < _rl_spans.size(); ++i) {
+
+                if (_rl_layouts[i].page != NO_PAGE) {
+
+                    _rl_layouts[i].page = find_page(_rl_spans[i].char_size);
+                }
+            }
+        }
+
+        _rl_is_pages_dirty = false;
+    }
+
+    void Rich_label::_copy_span_to_page(
+        std::size_t const index
+        ) {
+
+        Span_layout const& layout = _rl_layouts[index];
+        Page&              page   = _rl_pages  [layout.page];
+
+        std::size_t fill_begin    = 0u;
+        std::size_t outline_begin = 0u;
+
+        for (Segment const& segment : layout.segments) {
+
+            for (std::size_t v = fill_begin; v < segment.fill_end; ++v) {
+
+                sf::Vertex& vertex = page.fill_vertices[layout.fill_offset + v];
+
+                vertex           = layout.fill_vertices[v];
+                vertex.position += segment.origin;
+            }
+
+            for (std::size_t v = outline_begin; v < segment.outline_end; ++v) {
+
+                sf::Vertex& vertex = page.outline_vertices[layout.outline_offset + v];
+
+                vertex           = layout.outline_vertices[v];
+                vertex.position += segment.origin;
+            }
+
+            fill_begin    = segment.fill_end;
+            outline_begin = segment.outline_end;
+        }
+    }
+
+    bool Rich_label::_is_valid_span(
+        std::size_t const index
+        ) const {
+
+        if (index < _rl_spans.size()) {
+
+            return true;
+        }
+
+        LOG(WARNING)                                <<
+        "Span of rich label is not changed as ["    <<
+        index                                       <<
+        "] is past the last of its "                <<
+        _rl_spans.size()                            <<
+        " spans.";
+
+        return false;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,444 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/log.h"
+#include "widgets/resources.h"
+#include "widgets/sdf_font.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+/*
+------------------------------------------------------------------------------
+Distance transform
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Squared distance used for "no feature yet", large but safe to add to
+    float constexpr FAR_AWAY = 1.0e20f;
+
+    /// @brief Turns the distance stored in alpha back into an antialiased edge
+    /// @details fwidth() measures how fast the distance changes per screen pixel,
+    ///          so the edge stays one pixel wide at every size, scale and zoom.
+    char const* const SDF_FRAGMENT_SHADER = R"(
+        uniform sampler2D texture;
+
+        void main()
+        {
+            float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+            float width    = fwidth(distance) * 0.5;
+            float alpha    = smoothstep(0.5 - width, 0.5 + width, distance);
+
+            gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+        }
+    )";
+
+    /// @brief Exact 1D squared distance transform (Felzenszwalb and Huttenlocher)
+    /// @details Computes, for every sample, the lower envelope of the parabolas
+    ///          rooted at each sample in O(n).
+    void distance_transform_1d(
+        std::vector<float>&       values,
+        std::size_t         const first,
+        std::size_t         const stride,
+        std::size_t         const count,
+        std::vector<float>&       input,
+        std::vector<float>&       boundaries,
+        std::vector<int>&         parabolas
+        ) {
+
+        for (std::size_t i = 0u; i < count; ++i) {
+
+            input[i] = values[first + i * stride];
+        }
+
+        int k = 0;
+        parabolas [0] = 0;
+        boundaries[0] = -FAR_AWAY;
+        boundaries[1] =  FAR_AWAY;
+
+        auto const intersection = [&input](int const q, int const p) {
+
+            return ((input[q] + static_cast<float>(q * q)) - (input[p] + static_cast<float>(p * p))) / static_cast<float>(2 * q - 2 * p);
+        };
+
+        for (int q = 1; q < static_cast<int>(count); ++q) {
+
+            float s = intersection(q, parabolas[k]);
+
+            // The new parabola hides every earlier one that starts right of `s`.
+            while (s <= boundaries[k]) {
+
+                --k;
+                s = intersection(q, parabolas[k]);
+            }
+
+            ++k;
+            parabolas [k]     = q;
+            boundaries[k]     = s;
+            boundaries[k + 1] = FAR_AWAY;
+        }
+
+        k = 0;
+
+        for (int q = 0; q < static_cast<int>(count); ++q) {
+
+            while (boundaries[k + 1] < static_cast<float>(q)) {
+
+                ++k;
+            }
+
+            int const p = parabolas[k];
+            values[first + q * stride] = static_cast<float>((q - p) * (q - p)) + input[p];
+        }
+    }
+
+    /// @brief Exact 2D squared distance transform, 0 marks feature pixels
+    void distance_transform_2d(
+        std::vector<float>&       values,
+        std::size_t         const width,
+        std::size_t         const height
+        ) {
+
+        std::size_t const longest = std::max(width, height);
+
+        std::vector<float> input     (longest);
+        std::vector<float> boundaries(longest + 1u);
+        std::vector<int>   parabolas (longest);
+
+        for (std::size_t x = 0u; x < width; ++x) {
+
+            distance_transform_1d(values, x, width, height, input, boundaries, parabolas);
+        }
+
+        for (std::size_t y = 0u; y < height; ++y) {
+
+            distance_transform_1d(values, y * width, 1u, width, input, boundaries, parabolas);
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Sdf_font::Sdf_font(
+        sf::Font     const& font,
+        unsigned int const  base_size,
+        float        const  spread
+        ) :
+        _font           (font                          ),
+        _base_size      (std::max(base_size, 1u)       ),
+        _spread         (std::max(spread, 1.0f)        ),
+        _atlas          (sf::Vector2u{1024u, 1024u}, 1u),
+        _glyphs         (                              ),
+        _kernings       (                              ),
+        _lookup_mutex   (                              ),
+        _line_spacing   (0.0f                          ),
+        _shader         (                              ),
+        _is_using_shader(false                         )
+    {
+
+        {
+            std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+            _line_spacing = _font.getLineSpacing(_base_size);
+        }
+
+        // Both distance fields and the coverage fallback rely on linear filtering.
+        _atlas.set_smooth(true);
+
+        if (!sf::Shader::isAvailable()) {
+
+            LOG(WARNING) << "Shaders are not available, sdf text is drawn from coverage instead.";
+        } else if (!_shader.loadFromMemory(SDF_FRAGMENT_SHADER, sf::Shader::Type::Fragment)) {
+
+            LOG(WARNING) << "Sdf shader failed to compile, sdf text is drawn from coverage instead.";
+        } else {
+
+            _shader.setUniform("texture", sf::Shader::CurrentTexture);
+            _is_using_shader = true;
+        }
+
+        sf::String printable_ascii;
+
+        for (char32_t code_point = U' '; code_point <= U'~'; ++code_point) {
+
+            printable_ascii += code_point;
+        }
+
+        load_glyphs(printable_ascii);
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    bool Sdf_font::load_glyphs(
+        sf::String const& string
+        ) {
+
+        std::vector<char32_t> missing;
+
+        {
+            std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+            for (char32_t const code_point : string) {
+
+                bool const is_control = code_point == U'\n' || code_point == U'\r' || code_point == U'\t';
+
+                if (!is_control && !_glyphs.contains(code_point) &&
+                    std::find(missing.begin(), missing.end(), code_point) == missing.end()) {
+
+                    missing.push_back(code_point);
+                }
+            }
+        }
+
+        if (missing.empty()) {
+
+            return true;
+        }
+
+        std::unique_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        // Another text may have loaded some of them since the shared lock was released.
+        std::erase_if(missing, [this](char32_t const code_point) { return _glyphs.contains(code_point); });
+
+        if (missing.empty()) {
+
+            return true;
+        }
+
+        std::vector<sf::Glyph> font_glyphs;
+        font_glyphs.reserve(missing.size());
+
+        sf::Image page;
+
+        {
+            // The font is shared with widgets that may lay out text on other threads.
+            std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+            for (char32_t const code_point : missing) {
+
+                font_glyphs.push_back(_font.getGlyph(code_point, _base_size, false));
+            }
+
+            // Read the page back once, after every glyph is on it.
+            page = _font.getTexture(_base_size).copyToImage();
+        }
+
+        float const padding = std::ceil(_spread);
+
+        for (std::size_t i = 0u; i < missing.size(); ++i) {
+
+            sf::Vector2u const size(font_glyphs[i].textureRect.size);
+
+            if (size.x == 0u || size.y == 0u) {
+
+                // Whitespace only needs its advance.
+            } else {
+
+                sf::Image glyph_image(size, sf::Color::Transparent);
+
+                if (glyph_image.copy(page, {0u, 0u}, font_glyphs[i].textureRect)) {
+
+                    _atlas.add(std::to_string(static_cast<std::uint32_t>(missing[i])), _make_field(glyph_image));
+                }
+            }
+        }
+
+        bool const is_built = _atlas.build();
+
+        // Glyphs are stored complete, so texts reading one without the lock never see it change.
+        for (std::size_t i = 0u; i < missing.size(); ++i) {
+
+            sf::Glyph const& font_glyph = font_glyphs[i];
+
+            Sdf_glyph glyph{};
+            glyph.advance = font_glyph.advance;
+            glyph.bounds  = font_glyph.bounds;
+            glyph.quad    = sf::FloatRect(
+                font_glyph.bounds.position - sf::Vector2f{padding, padding},
+                font_glyph.bounds.size     + sf::Vector2f{padding, padding} * 2.0f
+                );
+
+            std::string const name = std::to_string(static_cast<std::uint32_t>(missing[i]));
+
+            if (_atlas.has_region(name)) {
+
+                glyph.region = _atlas.get_region(name);
+            }
+
+            _glyphs.emplace(missing[i], glyph);
+        }
+
+        if (!is_built) {
+
+            LOG(WARNING) << "Not every sdf glyph fitted the atlas, missing glyphs are drawn empty.";
+        }
+
+        return is_built;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    Sdf_glyph const* Sdf_font::get_glyph(
+        char32_t const code_point
+        ) const {
+
+        std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        auto const iter = _glyphs.find(code_point);
+
+        return iter == _glyphs.end() ? nullptr : &iter->second;
+    }
+
+    float Sdf_font::get_kerning(
+        char32_t const first,
+        char32_t const second,
+        float    const char_size
+        ) const {
+
+        float const         scale = char_size / static_cast<float>(_base_size);
+        std::uint64_t const key   = (static_cast<std::uint64_t>(first) << 32u) | static_cast<std::uint64_t>(second);
+
+        {
+            std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+            auto const iter = _kernings.find(key);
+
+            if (iter != _kernings.end()) {
+
+                return iter->second * scale;
+            }
+        }
+
+        float kerning = 0.0f;
+
+        {
+            // Kerning reads glyph metrics, which may load glyphs.
+            std::lock_guard<std::mutex> const font_lock(resources::FONT_MUTEX);
+
+            kerning = _font.getKerning(first, second, _base_size);
+        }
+
+        // Taken after the font lock is released, load_glyphs() takes the two the other way round.
+        std::unique_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        _kernings.emplace(key, kerning);
+
+        return kerning * scale;
+    }
+
+    float Sdf_font::get_line_spacing(
+        float const char_size
+        ) const {
+
+        return _line_spacing * char_size / static_cast<float>(_base_size);
+    }
+
+    sf::Shader const* Sdf_font::get_shader() const {
+
+        return _is_using_shader ? &_shader : nullptr;
+    }
+
+    sf::Font const& Sdf_font::get_font() const {
+
+        return _font;
+    }
+
+    unsigned int Sdf_font::get_base_size() const {
+
+        return _base_size;
+    }
+
+    std::size_t Sdf_font::get_num_glyphs() const {
+
+        std::shared_lock<std::shared_mutex> const lookup_lock(_lookup_mutex);
+
+        return _glyphs.size();
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    sf::Image Sdf_font::_make_field(
+        sf::Image const& glyph_image
+        ) const {
+
+        std::size_t const padding = static_cast<std::size_t>(std::ceil(_spread));
+
+        sf::Vector2u const glyph_size = glyph_image.getSize();
+
+        std::size_t const width  = glyph_size.x + 2u * padding;
+        std::size_t const height = glyph_size.y + 2u * padding;
+
+        // Squared distance to the nearest inside pixel, and to the nearest outside pixel.
+        std::vector<float> to_inside (width * height, FAR_AWAY);
+        std::vector<float> to_outside(width * height, 0.0f);
+
+        for (unsigned int y = 0u; y < glyph_size.y; ++y) {
+
+            for (unsigned int x = 0u; x < glyph_size.x; ++x) {
+
+                if (glyph_image.getPixel({x, y}).a >= 128u) {
+
+                    std::size_t const index = (y + padding) * width + (x + padding);
+
+                    to_inside [index] = 0.0f;
+                    to_outside[index] = FAR_AWAY;
+                }
+            }
+        }
+
+        distance_transform_2d(to_inside,  width, height);
+        distance_transform_2d(to_outside, width, height);
+
+        sf::Image field({static_cast<unsigned int>(width), static_cast<unsigned int>(height)}, sf::Color::Transparent);
+
+        for (std::size_t y = 0u; y < height; ++y) {
+
+            for (std::size_t x = 0u; x < width; ++x) {
+
+                std::size_t const index = y * width + x;
+
+                // Distances are between pixel centers, the edge lies half a pixel in.
+                bool  const is_inside = to_inside[index] == 0.0f;
+                float const distance  = is_inside ?
+                    -(std::sqrt(to_outside[index]) - 0.5f) :
+                     (std::sqrt(to_inside [index]) - 0.5f);
+
+                float const value = _is_using_shader ?
+                    std::clamp(0.5f - distance / (2.0f * _spread), 0.0f, 1.0f) :
+                    std::clamp(0.5f - distance,                    0.0f, 1.0f);
+
+                field.setPixel(
+                    {static_cast<unsigned int>(x), static_cast<unsigned int>(y)},
+                    sf::Color(255u, 255u, 255u, static_cast<std::uint8_t>(std::lround(value * 255.0f)))
+                    );
+            }
+        }
+
+        return field;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,349 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/sdf_text.h"
+
+#include <algorithm>
+#include <iterator>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Sdf_text::Sdf_text(
+        Sdf_font&         font,
+        sf::String const& string,
+        float      const  char_size
+        ) :
+        _font             (&font                    ),
+        _string           (string                   ),
+        _char_size        (std::max(char_size, 0.0f)),
+        _fill_color       (sf::Color::White         ),
+        _pages            (                         ),
+        _pen_x            (                         ),
+        _local_bounds     (                         ),
+        _is_geometry_dirty(true                     )
+    {
+        _font->load_glyphs(_string);
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Sdf_text::draw(
+        sf::RenderTarget& target,
+        sf::RenderStates  states
+        ) const {
+
+        _update_geometry();
+
+        states.transform *= getTransform();
+        states.shader     = _font->get_shader();
+
+        for (Page_vertices const& page : _pages) {
+
+            if (page.vertices.empty()) {
+
+                // Dont draw since no glyph of the string is on this page.
+                continue;
+            }
+
+            states.texture = page.texture;
+            target.draw(page.vertices.data(), page.vertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+    }
+
+    float Sdf_text::fit(
+        sf::Vector2f const box_size,
+        float        const max_size
+        ) {
+
+        set_char_size(max_size);
+
+        sf::Vector2f const size = get_local_bounds().size;
+
+        float scale = 1.0f;
+
+        if (size.x > box_size.x) {
+
+            scale = std::min(scale, box_size.x / size.x);
+        }
+
+        if (size.y > box_size.y) {
+
+            scale = std::min(scale, box_size.y / size.y);
+        }
+
+        if (scale < 1.0f) {
+
+            set_char_size(_char_size * scale);
+        }
+
+        return _char_size;
+    }
+
+    std::size_t Sdf_text::find_char_index(
+        float const local_x
+        ) const {
+
+        _update_geometry();
+
+        auto const iter = std::upper_bound(_pen_x.begin(), _pen_x.end(), local_x);
+
+        if (iter == _pen_x.begin()) {
+
+            return 0u;
+        }
+
+        if (iter == _pen_x.end()) {
+
+            return _string.getSize();
+        }
+
+        // Snap to whichever edge of the character under the point is closer.
+        std::size_t const after = static_cast<std::size_t>(std::distance(_pen_x.begin(), iter));
+
+        return local_x - _pen_x[after - 1u] <= _pen_x[after] - local_x ? after - 1u : after;
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Sdf_text::set_font(
+        Sdf_font& font
+        ) {
+
+        _font = &font;
+        _font->load_glyphs(_string);
+        _is_geometry_dirty = true;
+    }
+
+    void Sdf_text::set_string(
+        sf::String const& string
+        ) {
+
+        if (_string == string) {
+
+            // Same string so no need to lay it out again.
+            return;
+        }
+
+        _string = string;
+        _font->load_glyphs(_string);
+        _is_geometry_dirty = true;
+    }
+
+    void Sdf_text::set_char_size(
+        float const char_size
+        ) {
+
+        _char_size         = std::max(char_size, 0.0f);
+        _is_geometry_dirty = true;
+    }
+
+    void Sdf_text::set_fill_color(
+        sf::Color const color
+        ) {
+
+        _fill_color = color;
+
+        // Recoloring keeps the layout, only the vertex colors change.
+        for (Page_vertices& page : _pages) {
+
+            for (sf::Vertex& vertex : page.vertices) {
+
+                vertex.color = color;
+            }
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    sf::String const& Sdf_text::get_string() const {
+
+        return _string;
+    }
+
+    float Sdf_text::get_char_size() const {
+
+        return _char_size;
+    }
+
+    sf::Color Sdf_text::get_fill_color() const {
+
+        return _fill_color;
+    }
+
+    Sdf_font& Sdf_text::get_font() const {
+
+        return *_font;
+    }
+
+    sf::Texture const* Sdf_text::get_texture() const {
+
+        _update_geometry();
+
+        for (Page_vertices const& page : _pages) {
+
+            if (!page.vertices.empty()) {
+
+                return page.texture;
+            }
+        }
+
+        return nullptr;
+    }
+
+    float Sdf_text::get_char_x(
+        std::size_t const index
+        ) const {
+
+        _update_geometry();
+
+        return _pen_x[std::min(index, _string.getSize())];
+    }
+
+    sf::FloatRect Sdf_text::get_local_bounds() const {
+
+        _update_geometry();
+
+        return _local_bounds;
+    }
+
+    sf::FloatRect Sdf_text::get_global_bounds() const {
+
+        return getTransform().transformRect(get_local_bounds());
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    void Sdf_text::_update_geometry() const {
+
+        if (!_is_geometry_dirty) {
+
+            return;
+        }
+
+        _is_geometry_dirty = false;
+
+        for (Page_vertices& page : _pages) {
+
+            page.vertices.clear();
+        }
+
+        _pen_x.clear();
+        _pen_x.reserve(_string.getSize() + 1u);
+
+        float const scale        = _char_size / static_cast<float>(_font->get_base_size());
+        float const line_spacing = _font->get_line_spacing(_char_size);
+
+        sf::Vector2f pen       = {0.0f, _char_size};
+        char32_t     previous  = 0u;
+        bool         has_glyph = false;
+
+        sf::Vector2f min_corner = {0.0f, 0.0f};
+        sf::Vector2f max_corner = {0.0f, 0.0f};
+
+        for (char32_t const code_point : _string) {
+
+            _pen_x.push_back(pen.x);
+
+            if (code_point == U'\r') {
+
+                continue;
+            }
+
+            if (code_point == U'\n') {
+
+                pen      = {0.0f, pen.y + line_spacing};
+                previous = 0u;
+                continue;
+            }
+
+            Sdf_glyph const* const glyph = _font->get_glyph(code_point);
+
+            if (glyph == nullptr) {
+
+                // The atlas ran out of room for this glyph, Sdf_font already warned.
+                continue;
+            }
+
+            if (previous != 0u) {
+
+                pen.x += _font->get_kerning(previous, code_point, _char_size);
+            }
+
+            previous = code_point;
+
+            if (glyph->region.texture != nullptr) {
+
+                auto page = std::find_if(_pages.begin(), _pages.end(), [glyph](Page_vertices const& other) {
+
+                    return other.texture == glyph->region.texture;
+                });
+
+                if (page == _pages.end()) {
+
+                    _pages.push_back({glyph->region.texture, {}});
+                    page = std::prev(_pages.end());
+                }
+
+                sf::Vector2f const quad_min = pen + glyph->quad.position * scale;
+                sf::Vector2f const quad_max = quad_min + glyph->quad.size * scale;
+
+                sf::Vector2f const tex_min(glyph->region.rect.position);
+                sf::Vector2f const tex_max = tex_min + sf::Vector2f(glyph->region.rect.size);
+
+                sf::Vertex const top_left     {{quad_min.x, quad_min.y}, _fill_color, {tex_min.x, tex_min.y}};
+                sf::Vertex const top_right    {{quad_max.x, quad_min.y}, _fill_color, {tex_max.x, tex_min.y}};
+                sf::Vertex const bottom_left  {{quad_min.x, quad_max.y}, _fill_color, {tex_min.x, tex_max.y}};
+                sf::Vertex const bottom_right {{quad_max.x, quad_max.y}, _fill_color, {tex_max.x, tex_max.y}};
+
+                page->vertices.insert(page->vertices.end(), {
+                    top_left,  top_right,    bottom_left,
+                    top_right, bottom_right, bottom_left
+                });
+
+                // Bounds cover the visible glyph, not the distance field around it.
+                sf::Vector2f const glyph_min = pen + glyph->bounds.position * scale;
+                sf::Vector2f const glyph_max = glyph_min + glyph->bounds.size * scale;
+
+                if (!has_glyph) {
+
+                    min_corner = glyph_min;
+                    max_corner = glyph_max;
+                    has_glyph  = true;
+                } else {
+
+                    min_corner = {std::min(min_corner.x, glyph_min.x), std::min(min_corner.y, glyph_min.y)};
+                    max_corner = {std::max(max_corner.x, glyph_max.x), std::max(max_corner.y, glyph_max.y)};
+                }
+            }
+
+            pen.x += glyph->advance * scale;
+        }
+
+        _pen_x.push_back(pen.x);
+
+        _local_bounds = sf::FloatRect(min_corner, max_corner - min_corner);
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
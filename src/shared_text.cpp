@@ -0,0 +1,227 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/shared_text.h"
+
+#include <string_view>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Shared_text::Shared_text(
+        sf::Font            const& font,
+        unsigned int        const  char_size,
+        Text_geometry_cache&       cache
+        ) :
+        _cache            (&cache                  ),
+        _font             (&font                   ),
+        _string           (                        ),
+        _char_size        (char_size               ),
+        _style            (sf::Text::Style::Regular),
+        _fill_color       (sf::Color::White        ),
+        _outline_thickness(0.0f                    ),
+        _outline_color    (sf::Color::Black        ),
+        _geometry         (nullptr                 ),
+        _is_geometry_dirty(true                    )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Shared_text::draw(
+        sf::RenderTarget& target,
+        sf::RenderStates  states
+        ) const {
+
+        _update_geometry();
+
+        // The geometry sits at the origin, this text's transform places it.
+        states.transform *= getTransform();
+
+        target.draw(*_geometry, states);
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Shared_text::set_string(
+        sf::String const& string
+        ) {
+
+        std::u32string_view const view(string.getData(), string.getSize());
+
+        if (_string != view) {
+
+            _string            = view;
+            _is_geometry_dirty = true;
+        }
+    }
+
+    void Shared_text::set_font(
+        sf::Font const& font
+        ) {
+
+        if (_font != &font) {
+
+            _font              = &font;
+            _is_geometry_dirty = true;
+        }
+    }
+
+    void Shared_text::set_char_size(
+        unsigned int const char_size
+        ) {
+
+        if (_char_size != char_size) {
+
+            _char_size         = char_size;
+            _is_geometry_dirty = true;
+        }
+    }
+
+    void Shared_text::set_style(
+        std::uint32_t const style
+        ) {
+
+        if (_style != style) {
+
+            _style             = style;
+            _is_geometry_dirty = true;
+        }
+    }
+
+    void Shared_text::set_fill_color(
+        sf::Color const color
+        ) {
+
+        if (_fill_color != color) {
+
+            _fill_color        = color;
+            _is_geometry_dirty = true;
+        }
+    }
+
+    void Shared_text::set_outline_thickness(
+        float const thickness
+        ) {
+
+        if (_outline_thickness != thickness) {
+
+            _outline_thickness = thickness;
+            _is_geometry_dirty = true;
+        }
+    }
+
+    void Shared_text::set_outline_color(
+        sf::Color const color
+        ) {
+
+        if (_outline_color != color) {
+
+            _outline_color     = color;
+            _is_geometry_dirty = true;
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    sf::String Shared_text::get_string() const {
+
+        return sf::String(_string);
+    }
+
+    sf::Font const& Shared_text::get_font() const {
+
+        return *_font;
+    }
+
+    unsigned int Shared_text::get_char_size() const {
+
+        return _char_size;
+    }
+
+    std::uint32_t Shared_text::get_style() const {
+
+        return _style;
+    }
+
+    sf::Color Shared_text::get_fill_color() const {
+
+        return _fill_color;
+    }
+
+    float Shared_text::get_outline_thickness() const {
+
+        return _outline_thickness;
+    }
+
+    sf::Color Shared_text::get_outline_color() const {
+
+        return _outline_color;
+    }
+
+    sf::FloatRect Shared_text::get_local_bounds() const {
+
+        _update_geometry();
+
+        return _geometry->get_local_bounds();
+    }
+
+    sf::FloatRect Shared_text::get_global_bounds() const {
+
+        return getTransform().transformRect(get_local_bounds());
+    }
+
+    std::shared_ptr<Glyph_run const> Shared_text::get_geometry() const {
+
+        _update_geometry();
+
+        return _geometry;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    void Shared_text::_update_geometry() const {
+
+        // Frozen geometry is not laid out again when its font page is evicted.
+        if (!_is_geometry_dirty && !_geometry->is_stale()) {
+
+            return;
+        }
+
+        // Releasing the old geometry first lets the cache free it if this was its last text.
+        _geometry.reset();
+
+        _geometry = _cache->acquire(
+            *_font,
+            _char_size,
+            _style,
+            _fill_color,
+            _outline_thickness,
+            _outline_color,
+            _string
+            );
+
+        _is_geometry_dirty = false;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,101 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/snapshot_buffer.h"
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Snapshot_buffer::Snapshot_buffer() :
+        _queues       (  ),
+        _back_index   (0u),
+        _front_index  (1u),
+        _ready        (2u),
+        _num_published(0u),
+        _num_dropped  (0u)
+    {
+        for (Render_queue& queue : _queues) {
+
+            queue.set_retained(true);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    Render_queue& Snapshot_buffer::begin_frame() {
+
+        Render_queue& queue = _queues[_back_index];
+        queue.clear();
+
+        return queue;
+    }
+
+    void Snapshot_buffer::publish() {
+
+        // Release makes the recorded copies visible to the thread that acquires the index.
+        std::uint32_t const previous = _ready.exchange(_back_index | FRESH_BIT, std::memory_order_acq_rel);
+
+        if ((previous & FRESH_BIT) != 0u) {
+
+            _num_dropped.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        _back_index = previous & INDEX_MASK;
+        _num_published.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    bool Snapshot_buffer::acquire() {
+
+        if ((_ready.load(std::memory_order_relaxed) & FRESH_BIT) == 0u) {
+
+            return false;
+        }
+
+        std::uint32_t const previous = _ready.exchange(_front_index, std::memory_order_acq_rel);
+        _front_index = previous & INDEX_MASK;
+
+        return true;
+    }
+
+    void Snapshot_buffer::submit(
+        sf::RenderTarget& target
+        ) {
+
+        _queues[_front_index].submit(target);
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::uint64_t Snapshot_buffer::get_num_published() const {
+
+        return _num_published.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Snapshot_buffer::get_num_dropped() const {
+
+        return _num_dropped.load(std::memory_order_relaxed);
+    }
+
+    Render_queue const& Snapshot_buffer::get_front_queue() const {
+
+        return _queues[_front_index];
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,411 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/log.h"
+#include "widgets/spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Global functions
+------------------------------------------------------------------------------
+*/
+    sf::FloatRect get_view_bounds(
+        sf::View const& view
+        ) {
+
+        sf::Vector2f const center = view.getCenter();
+        sf::Vector2f const size   = view.getSize();
+
+        if (view.getRotation() == sf::Angle::Zero) {
+
+            return {center - size / 2.0f, size};
+        }
+
+        // The inverse view transform maps normalized device coordinates
+        // back to the world, so this covers any rotation.
+        sf::Transform const& inverse = view.getInverseTransform();
+
+        return inverse.transformRect({{-1.0f, -1.0f}, {2.0f, 2.0f}});
+    }
+
+    bool is_overlapping(
+        sf::FloatRect const& a,
+        sf::FloatRect const& b
+        ) {
+
+        bool const is_overlapping_x =
+            a.position.x <= b.position.x + b.size.x &&
+            b.position.x <= a.position.x + a.size.x;
+
+        bool const is_overlapping_y =
+            a.position.y <= b.position.y + b.size.y &&
+            b.position.y <= a.position.y + a.size.y;
+
+        return is_overlapping_x && is_overlapping_y;
+    }
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Spatial_grid::Spatial_grid(
+        float const cell_size
+        ) :
+        _cell_size     (cell_size),
+        _entries       (         ),
+        _free_slots    (         ),
+        _slot_lookup   (         ),
+        _cells         (         ),
+        _oversize_slots(         ),
+        _next_order    (0u       ),
+        _query_stamp   (0u       ),
+        _query_hits    (         ),
+        _query_result  (         )
+    {
+
+        if (_cell_size <= 0.0f) {
+
+            LOG(WARNING)                            <<
+            "Spatial grid cell size is not set to [" <<
+            cell_size                               <<
+            "] as only positive values are allowed, using 256.0f.";
+
+            _cell_size = 256.0f;
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Spatial_grid::insert(
+        Widget& widget
+        ) {
+
+        if (_slot_lookup.contains(&widget)) {
+
+            update(widget);
+            return;
+        }
+
+        std::size_t slot = 0u;
+
+        if (_free_slots.empty()) {
+
+            slot = _entries.size();
+            _entries.emplace_back();
+        } else {
+
+            slot = _free_slots.back();
+            _free_slots.pop_back();
+        }
+
+        Entry& entry = _entries[slot];
+        entry.widget      = &widget;
+        entry.order       = _next_order++;
+        entry.query_stamp = 0u;
+
+        _slot_lookup[&widget] = slot;
+        _bucket(slot);
+    }
+
+    void Spatial_grid::remove(
+        Widget& widget
+        ) {
+
+        auto const found = _slot_lookup.find(&widget);
+
+        if (found == _slot_lookup.end()) {
+
+            LOG(WARNING) << "Attempting to remove a widget that is not in the spatial grid.";
+            return;
+        }
+
+        std::size_t const slot = found->second;
+
+        _unbucket(slot);
+
+        _entries[slot] = Entry{};
+        _free_slots.push_back(slot);
+        _slot_lookup.erase(found);
+    }
+
+    void Spatial_grid::update(
+        Widget& widget
+        ) {
+
+        auto const found = _slot_lookup.find(&widget);
+
+        if (found == _slot_lookup.end()) {
+
+            LOG(WARNING) << "Attempting to update a widget that is not in the spatial grid.";
+            return;
+        }
+
+        std::size_t const slot = found->second;
+
+        _unbucket(slot);
+        _bucket  (slot);
+    }
+
+    void Spatial_grid::update_all() {
+
+        _cells.clear();
+        _oversize_slots.clear();
+
+        for (std::size_t slot = 0u; slot < _entries.size(); ++slot) {
+
+            if (_entries[slot].widget != nullptr) {
+
+                _bucket(slot);
+            }
+        }
+    }
+
+    void Spatial_grid::clear() {
+
+        _entries.clear();
+        _free_slots.clear();
+        _slot_lookup.clear();
+        _cells.clear();
+        _oversize_slots.clear();
+        _query_hits.clear();
+        _query_result.clear();
+    }
+
+    std::vector<Widget*> const& Spatial_grid::query(
+        sf::FloatRect const& area
+        ) {
+
+        _query_hits.clear();
+        _query_result.clear();
+        ++_query_stamp;
+
+        // Visits a slot once per query and keeps it if it really overlaps,
+        // the cells only narrow down the candidates.
+        auto const visit = [&](std::size_t const slot) {
+
+            Entry& entry = _entries[slot];
+
+            if (entry.query_stamp == _query_stamp) {
+
+                return;
+            }
+
+            entry.query_stamp = _query_stamp;
+
+            if (is_overlapping(area, entry.widget->get_global_bounds())) {
+
+                _query_hits.emplace_back(entry.order, slot);
+            }
+        };
+
+        Cell_range const range = _get_cell_range(area);
+
+        std::int64_t const num_area_cells =
+            (static_cast<std::int64_t>(range.max_x) - range.min_x + 1) *
+            (static_cast<std::int64_t>(range.max_y) - range.min_y + 1);
+
+        if (num_area_cells > static_cast<std::int64_t>(_cells.size())) {
+
+            // A zoomed out view covers more cells than are occupied, walk the
+            // occupied ones so the cost follows the widgets and not the area.
+            for (auto const& [key, slots] : _cells) {
+
+                std::int32_t const x = static_cast<std::int32_t>(static_cast<std::uint32_t>(key >> 32u));
+                std::int32_t const y = static_cast<std::int32_t>(static_cast<std::uint32_t>(key));
+
+                if (x >= range.min_x && x <= range.max_x && y >= range.min_y && y <= range.max_y) {
+
+                    for (std::size_t const slot : slots) {
+
+                        visit(slot);
+                    }
+                }
+            }
+        } else {
+
+            for (std::int32_t y = range.min_y; y <= range.max_y; ++y) {
+
+                for (std::int32_t x = range.min_x; x <= range.max_x; ++x) {
+
+                    auto const cell = _cells.find(_get_cell_key(x, y));
+
+                    if (cell != _cells.end()) {
+
+                        for (std::size_t const slot : cell->second) {
+
+                            visit(slot);
+                        }
+                    }
+                }
+            }
+        }
+
+        for (std::size_t const slot : _oversize_slots) {
+
+            visit(slot);
+        }
+
+        // Keep the application's drawing order, orders are unique so the slots never compare.
+        std::sort(_query_hits.begin(), _query_hits.end());
+
+        for (auto const& [order, slot] : _query_hits) {
+
+            _query_result.push_back(_entries[slot].widget);
+        }
+
+        return _query_result;
+    }
+
+    std::vector<Widget*> const& Spatial_grid::query_view(
+        sf::RenderTarget const& target
+        ) {
+
+        return query(get_view_bounds(target.getView()));
+    }
+
+    void Spatial_grid::draw_visible(
+        sf::RenderTarget const& target
+        ) {
+
+        for (Widget* const widget : query_view(target)) {
+
+            widget->draw();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Spatial_grid::get_size() const {
+
+        return _slot_lookup.size();
+    }
+
+    float Spatial_grid::get_cell_size() const {
+
+        return _cell_size;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    Spatial_grid::Cell_range Spatial_grid::_get_cell_range(
+        sf::FloatRect const& area
+        ) const {
+
+        Cell_range range{};
+        range.min_x = _get_cell_coord(area.position.x              );
+        range.min_y = _get_cell_coord(area.position.y              );
+        range.max_x = _get_cell_coord(area.position.x + area.size.x);
+        range.max_y = _get_cell_coord(area.position.y + area.size.y);
+
+        return range;
+    }
+
+    std::int32_t Spatial_grid::_get_cell_coord(
+        float const coord
+        ) const {
+
+        // Half the int32 range, so a full width times a full height still fits in int64.
+        double const max_cell = static_cast<double>(1 << 30);
+
+        double const cell = std::floor(static_cast<double>(coord) / static_cast<double>(_cell_size));
+
+        if (std::isnan(cell)) {
+
+            return 0;
+        }
+
+        return static_cast<std::int32_t>(std::clamp(cell, -max_cell, max_cell));
+    }
+
+    std::uint64_t Spatial_grid::_get_cell_key(
+        std::int32_t const x,
+        std::int32_t const y
+        ) {
+
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32u) |
+                static_cast<std::uint64_t>(static_cast<std::uint32_t>(y));
+    }
+
+    void Spatial_grid::_bucket(
+        std::size_t const slot
+        ) {
+
+        // Widgets covering more cells than this are cheaper to test directly.
+        std::int64_t const max_cells_per_widget = 64;
+
+        Entry& entry = _entries[slot];
+        entry.cells = _get_cell_range(entry.widget->get_global_bounds());
+
+        std::int64_t const num_cells =
+            (static_cast<std::int64_t>(entry.cells.max_x) - entry.cells.min_x + 1) *
+            (static_cast<std::int64_t>(entry.cells.max_y) - entry.cells.min_y + 1);
+
+        entry.is_oversize = num_cells > max_cells_per_widget;
+
+        if (entry.is_oversize) {
+
+            _oversize_slots.push_back(slot);
+            return;
+        }
+
+        for (std::int32_t y = entry.cells.min_y; y <= entry.cells.max_y; ++y) {
+
+            for (std::int32_t x = entry.cells.min_x; x <= entry.cells.max_x; ++x) {
+
+                _cells[_get_cell_key(x, y)].push_back(slot);
+            }
+        }
+    }
+
+    void Spatial_grid::_unbucket(
+        std::size_t const slot
+        ) {
+
+        Entry const& entry = _entries[slot];
+
+        if (entry.is_oversize) {
+
+            std::erase(_oversize_slots, slot);
+            return;
+        }
+
+        for (std::int32_t y = entry.cells.min_y; y <= entry.cells.max_y; ++y) {
+
+            for (std::int32_t x = entry.cells.min_x; x <= entry.cells.max_x; ++x) {
+
+                auto const cell = _cells.find(_get_cell_key(x, y));
+
+                if (cell != _cells.end()) {
+
+                    std::erase(cell->second, slot);
+
+                    if (cell->second.empty()) {
+
+                        _cells.erase(cell);
+                    }
+                }
+            }
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
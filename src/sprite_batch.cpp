@@ -0,0 +1,105 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/sprite_batch.h"
+
+#include <cmath>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Sprite_batch::Sprite_batch() :
+        _vertices(),
+        _runs    ()
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Sprite_batch::add(
+        sf::Sprite const& sprite
+        ) {
+
+        sf::Texture   const* texture   = &sprite.getTexture();
+        sf::Transform const& transform = sprite.getTransform();
+        sf::IntRect   const& rect      = sprite.getTextureRect();
+        sf::Color     const  color     = sprite.getColor();
+
+        // Same as sf::Sprite: a negative rectangle size flips the texture,
+        // the quad itself always has a positive size.
+        float const width  = std::abs(static_cast<float>(rect.size.x));
+        float const height = std::abs(static_cast<float>(rect.size.y));
+
+        float const left   = static_cast<float>(rect.position.x);
+        float const top    = static_cast<float>(rect.position.y);
+        float const right  = left + static_cast<float>(rect.size.x);
+        float const bottom = top  + static_cast<float>(rect.size.y);
+
+        sf::Vertex const top_left     = {transform.transformPoint({0.0f,  0.0f  }), color, {left,  top   }};
+        sf::Vertex const top_right    = {transform.transformPoint({width, 0.0f  }), color, {right, top   }};
+        sf::Vertex const bottom_left  = {transform.transformPoint({0.0f,  height}), color, {left,  bottom}};
+        sf::Vertex const bottom_right = {transform.transformPoint({width, height}), color, {right, bottom}};
+
+        if (_runs.empty() || _runs.back().texture != texture) {
+
+            _runs.push_back({texture, _vertices.size(), 0u});
+        }
+
+        _vertices.push_back(top_left    );
+        _vertices.push_back(top_right   );
+        _vertices.push_back(bottom_left );
+        _vertices.push_back(bottom_left );
+        _vertices.push_back(top_right   );
+        _vertices.push_back(bottom_right);
+
+        _runs.back().num_vertices += 6u;
+    }
+
+    void Sprite_batch::draw(
+        sf::RenderTarget& target,
+        sf::RenderStates  states
+        ) const {
+
+        for (Run const& run : _runs) {
+
+            states.texture = run.texture;
+
+            target.draw(&_vertices[run.first_vertex], run.num_vertices, sf::PrimitiveType::Triangles, states);
+        }
+    }
+
+    void Sprite_batch::clear() {
+
+        _vertices.clear();
+        _runs.clear();
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Sprite_batch::get_num_sprites() const {
+
+        return _vertices.size() / 6u;
+    }
+
+    std::size_t Sprite_batch::get_num_draw_calls() const {
+
+        return _runs.size();
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -4,6 +4,7 @@ Includes
 ------------------------------------------------------------------------------
 */
 #include "widgets/log.h"
+#include "widgets/render_queue.h"
 #include "widgets/resources.h"
 #include "widgets/sprite_button.h"
 #include "widgets/widget.h"
@@ -27,10 +28,10 @@ Construction / Destruction
 ------------------------------------------------------------------------------
 */
     Sprite_button::Sprite_button(
-        std::shared_ptr<sf::RenderWindow> parent_window,
+        std::shared_ptr<sf::RenderTarget> parent_target,
         sf::Texture const& texture
         ) :
-        Widget       (std::move(parent_window)),
+        Widget       (std::move(parent_target)),
         Signals_slots(/*--------------------*/),
         _btn_sprite  (texture                 )
     {
@@ -39,11 +40,11 @@ Construction / Destruction
     }
 
     Sprite_button::Sprite_button(
-        std::shared_ptr<sf::RenderWindow> parent_window,
+        std::shared_ptr<sf::RenderTarget> parent_target,
         sf::Texture const& texture,
         sf::IntRect const  texture_rect
         ) :
-        Widget       (std::move(parent_window)),
+        Widget       (std::move(parent_target)),
         Signals_slots(/*--------------------*/),
         _btn_sprite  (texture                 )
     {
@@ -51,6 +52,23 @@ Construction / Destruction
         _btn_sprite.setPosition   (DEFAULT_WIDGET_POS);
         _btn_sprite.setTextureRect(texture_rect      );
     }
+
+    Sprite_button::Sprite_button(
+        std::shared_ptr<sf::RenderTarget> parent_target,
+        Atlas_region const& region
+        ) :
+        Widget       (std::move(parent_target)                                                      ),
+        Signals_slots(/*--------------------------------------------------------------------------*/),
+        _btn_sprite  (region.texture != nullptr ? *region.texture : GET_EMPTY_TEXTURE(), region.rect)
+    {
+
+        if (region.texture == nullptr) {
+
+            LOG(WARNING) << "Sprite_button is built from an invalid atlas region and will be empty.";
+        }
+
+        _btn_sprite.setPosition(DEFAULT_WIDGET_POS);
+    }
 /*
 ------------------------------------------------------------------------------
 Functionality
@@ -61,25 +79,65 @@ Functionality
         if (_current_state == STATE__HIDDEN) {
 
             // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
         } else {
 
             // Can call _update_widget() for final updating
             // of the widget before drawing to the window.
             _update_widget();
 
-            if (!_is_parent_window_nullptr()) {
+            if (!_is_parent_target_nullptr()) {
 
-                auto temp_ptr = _parent_window.lock();
+                auto temp_ptr = _parent_target.lock();
                 temp_ptr->draw(_btn_sprite);
             }
         }
     }
 
+    void Sprite_button::batch_draw(
+        Sprite_batch& batch
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            batch.add(_btn_sprite);
+        }
+    }
+
+    void Sprite_button::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            queue.push(_layer, _btn_sprite);
+        }
+    }
+
     void Sprite_button::move(
         sf::Vector2f const offset
         ) {
 
         _btn_sprite.move(offset);
+        _mark_dirty();
     }
 
     void Sprite_button::move(
@@ -88,6 +146,7 @@ Functionality
         ) {
 
         _btn_sprite.move({x, y});
+        _mark_dirty();
     }
 
     void Sprite_button::rotate(
@@ -95,6 +154,7 @@ Functionality
         ) {
 
         _btn_sprite.rotate(angle);
+        _mark_dirty();
     }
 
     void Sprite_button::_update_widget() {
@@ -111,6 +171,7 @@ Set Functions
         ) {
 
         _btn_sprite.setScale(scale);
+        _mark_dirty();
     }
 
     void Sprite_button::set_scale(
@@ -119,6 +180,7 @@ Set Functions
         ) {
 
         _btn_sprite.setScale({x, y});
+        _mark_dirty();
     }
 
     void Sprite_button::set_pos(
@@ -126,6 +188,7 @@ Set Functions
         ) {
 
         _btn_sprite.setPosition(pos);
+        _mark_dirty();
     }
 
     void Sprite_button::set_pos(
@@ -134,6 +197,7 @@ Set Functions
         ) {
 
         _btn_sprite.setPosition({x, y});
+        _mark_dirty();
     }
 
     void Sprite_button::set_origin(
@@ -141,6 +205,7 @@ Set Functions
         ) {
 
         _btn_sprite.setOrigin(origin);
+        _mark_dirty();
     }
 
     void Sprite_button::set_origin(
@@ -149,6 +214,7 @@ Set Functions
         ) {
 
         _btn_sprite.setOrigin({x, y});
+        _mark_dirty();
     }
 
     void Sprite_button::set_rotation(
@@ -156,6 +222,7 @@ Set Functions
         ) {
 
         _btn_sprite.setRotation(angle);
+        _mark_dirty();
     }
 /*
 ------------------------------------------------------------------------------
@@ -211,6 +278,11 @@ Get Functions
 
         return _btn_sprite.getRotation();
     }
+
+    sf::FloatRect Sprite_button::get_global_bounds() const {
+
+        return _btn_sprite.getGlobalBounds();
+    }
 /*
 ------------------------------------------------------------------------------
 Signals / slots
@@ -257,6 +329,12 @@ Helper Functions
 
          auto temp_ptr = _parent_window.lock();
 
+        // Offscreen widgets have no window to read the mouse position from.
+        if (!temp_ptr) {
+
+            return false;
+        }
+
         sf::Vector2i  const mouse_pos_pixels = sf::Mouse::getPosition     (*temp_ptr       );
         sf::Vector2f  const mouse_pos_coords = temp_ptr->mapPixelToCoords (mouse_pos_pixels);
         sf::FloatRect const btn_bounds       = _btn_sprite.getGlobalBounds(/*------------*/);
@@ -0,0 +1,335 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/render_queue.h"
+#include "widgets/suggestion_list.h"
+
+#include <algorithm>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Anonymous namespace BEGIN
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Space between the left edge of the list and the row texts
+    float constexpr ROW_PADDING = 4.0f;
+}
+/*
+------------------------------------------------------------------------------
+Anonymous namespace END
+------------------------------------------------------------------------------
+*/
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Suggestion_list::Suggestion_list(
+        sf::Font const& font
+        ) :
+        _font           (&font           ),
+        _items          (/*------------*/),
+        _row_runs       (/*------------*/),
+        _background     (/*------------*/),
+        _highlight      (/*------------*/),
+        _position       (0.0f, 0.0f      ),
+        _width          (0.0f            ),
+        _char_size      (20u             ),
+        _num_rows       (0u              ),
+        _first_item     (0u              ),
+        _highlighted    (NO_ITEM         ),
+        _text_color     (sf::Color::Black),
+        _is_layout_dirty(true            )
+    {
+
+        _background.setFillColor(sf::Color(245u, 245u, 245u));
+        _highlight.setFillColor (sf::Color(0u, 120u, 215u, 90u));
+
+        set_num_rows(6u);
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Suggestion_list::draw(
+        sf::RenderTarget& target,
+        sf::RenderStates  states
+        ) const {
+
+        _update_layout();
+
+        std::size_t const num_visible = _get_num_visible();
+
+        if (num_visible == 0u) {
+
+            return;
+        }
+
+        target.draw(_background, states);
+
+        if (_highlighted != NO_ITEM && _highlighted >= _first_item && _highlighted < _first_item + num_visible) {
+
+            target.draw(_highlight, states);
+        }
+
+        for (std::size_t row = 0u; row < num_visible; ++row) {
+
+            target.draw(_row_runs[row], states);
+        }
+    }
+
+    void Suggestion_list::queue_draw(
+        Render_queue& queue,
+        int    const  layer
+        ) const {
+
+        _update_layout();
+
+        std::size_t const num_visible = _get_num_visible();
+
+        if (num_visible == 0u) {
+
+            return;
+        }
+
+        queue.push(layer, _background);
+
+        if (_highlighted != NO_ITEM && _highlighted >= _first_item && _highlighted < _first_item + num_visible) {
+
+            queue.push(layer, _highlight);
+        }
+
+        for (std::size_t row = 0u; row < num_visible; ++row) {
+
+            queue.push(layer, _row_runs[row]);
+        }
+    }
+
+    void Suggestion_list::move_highlight(
+        int const offset
+        ) {
+
+        if (_items.empty()) {
+
+            return;
+        }
+
+        long long const last = static_cast<long long>(_items.size()) - 1;
+
+        if (_highlighted == NO_ITEM) {
+
+            set_highlighted(offset > 0 ? 0u : static_cast<std::size_t>(last));
+        } else {
+
+            set_highlighted(static_cast<std::size_t>(std::clamp(static_cast<long long>(_highlighted) + offset, 0ll, last)));
+        }
+    }
+
+    std::size_t Suggestion_list::find_item_at(
+        sf::Vector2f const point
+        ) const {
+
+        if (!get_global_bounds().contains(point)) {
+
+            return NO_ITEM;
+        }
+
+        std::size_t const row  = static_cast<std::size_t>((point.y - _position.y) / _get_row_height());
+        std::size_t const item = _first_item + row;
+
+        return item < _items.size() ? item : NO_ITEM;
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Suggestion_list::set_items(
+        std::vector<std::string> items
+        ) {
+
+        _items           = std::move(items);
+        _first_item      = 0u;
+        _highlighted     = NO_ITEM;
+        _is_layout_dirty = true;
+    }
+
+    void Suggestion_list::set_highlighted(
+        std::size_t const item
+        ) {
+
+        _highlighted = item < _items.size() ? item : NO_ITEM;
+
+        // Scroll just far enough to show the highlighted row.
+        if (_highlighted == NO_ITEM) {
+
+            // Dont scroll since nothing is highlighted.
+        } else if (_highlighted < _first_item) {
+
+            _first_item = _highlighted;
+        } else if (_highlighted >= _first_item + _num_rows) {
+
+            _first_item = _highlighted + 1u - _num_rows;
+        }
+
+        _is_layout_dirty = true;
+    }
+
+    void Suggestion_list::set_position(
+        sf::Vector2f const position
+        ) {
+
+        if (_position != position) {
+
+            _position        = position;
+            _is_layout_dirty = true;
+        }
+    }
+
+    void Suggestion_list::set_width(
+        float const width
+        ) {
+
+        if (_width != width) {
+
+            _width           = width;
+            _is_layout_dirty = true;
+        }
+    }
+
+    void Suggestion_list::set_char_size(
+        unsigned int const char_size
+        ) {
+
+        if (_char_size != char_size) {
+
+            _char_size       = char_size;
+            _is_layout_dirty = true;
+        }
+    }
+
+    void Suggestion_list::set_num_rows(
+        std::size_t const num_rows
+        ) {
+
+        _num_rows = std::max<std::size_t>(num_rows, 1u);
+
+        // The pool only ever holds the visible rows, not one text per item.
+        _row_runs.assign(_num_rows, Glyph_run(*_font));
+
+        _first_item      = 0u;
+        _is_layout_dirty = true;
+
+        set_highlighted(_highlighted);
+    }
+
+    void Suggestion_list::set_text_color(
+        sf::Color const color
+        ) {
+
+        _text_color      = color;
+        _is_layout_dirty = true;
+    }
+
+    void Suggestion_list::set_background_color(
+        sf::Color const color
+        ) {
+
+        _background.setFillColor(color);
+    }
+
+    void Suggestion_list::set_highlight_color(
+        sf::Color const color
+        ) {
+
+        _highlight.setFillColor(color);
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::vector<std::string> const& Suggestion_list::get_items() const {
+
+        return _items;
+    }
+
+    std::size_t Suggestion_list::get_highlighted() const {
+
+        return _highlighted;
+    }
+
+    std::size_t Suggestion_list::get_num_rows() const {
+
+        return _num_rows;
+    }
+
+    sf::FloatRect Suggestion_list::get_global_bounds() const {
+
+        return {_position, {_width, _get_row_height() * static_cast<float>(_get_num_visible())}};
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    float Suggestion_list::_get_row_height() const {
+
+        return Glyph_cache::get(*_font).get_metrics(_char_size).line_spacing;
+    }
+
+    std::size_t Suggestion_list::_get_num_visible() const {
+
+        return std::min(_num_rows, _items.size());
+    }
+
+    void Suggestion_list::_update_layout() const {
+
+        if (!_is_layout_dirty) {
+
+            return;
+        }
+
+        float       const row_height  = _get_row_height();
+        std::size_t const num_visible = _get_num_visible();
+
+        _background.setPosition(_position);
+        _background.setSize    ({_width, row_height * static_cast<float>(num_visible)});
+
+        // Only the visible rows are laid out, scrolling lays out at most a screenful.
+        for (std::size_t row = 0u; row < num_visible; ++row) {
+
+            std::string const& item = _items[_first_item + row];
+            Glyph_run&         run  = _row_runs[row];
+
+            run.set_string    (sf::String::fromUtf8(item.begin(), item.end()).toUtf32());
+            run.set_char_size (_char_size);
+            run.set_fill_color(_text_color);
+            run.setPosition   ({_position.x + ROW_PADDING, _position.y + row_height * static_cast<float>(row)});
+        }
+
+        if (_highlighted != NO_ITEM) {
+
+            _highlight.setPosition({_position.x, _position.y + row_height * static_cast<float>(_highlighted - std::min(_highlighted, _first_item))});
+            _highlight.setSize    ({_width, row_height});
+        }
+
+        _is_layout_dirty = false;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
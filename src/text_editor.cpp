@@ -0,0 +1,1453 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/glyph_cache.h"
+#include "widgets/log.h"
+#include "widgets/render_queue.h"
+#include "widgets/resources.h"
+#include "widgets/text_editor.h"
+#include "widgets/widget.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <optional>
+#include <system_error>
+/*
+------------------------------------------------------------------------------
+Using namespaces
+------------------------------------------------------------------------------
+*/
+using namespace resources;
+using namespace signals_slots;
+using namespace widgets;
+/*
+------------------------------------------------------------------------------
+Layout constants and UTF-8
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Gap between the widget's left edge and the start of each line
+    float constexpr TEXT_PADDING = 4.0f;
+
+    /// @brief Fraction of the remaining scroll covered per second, higher eases faster
+    float constexpr SCROLL_EASE_RATE = 18.0f;
+
+    /// @brief Lines scrolled per notch of the mouse wheel
+    float constexpr WHEEL_LINES = 3.0f;
+
+    /// @brief Color of the highlight behind selected text
+    sf::Color constexpr SELECTION_COLOR(0u, 120u, 215u, 90u);
+
+    /// @brief Append the two triangles of a rectangle, cut to a clip rectangle
+    void append_clipped_rect(
+        sf::VertexArray&       vertices,
+        sf::FloatRect   const& rect,
+        sf::FloatRect   const& clip,
+        sf::Color       const  color
+        ) {
+
+        std::optional<sf::FloatRect> const visible = rect.findIntersection(clip);
+
+        if (!visible) {
+
+            return;
+        }
+
+        sf::Vector2f const min_corner = visible->position;
+        sf::Vector2f const max_corner = visible->position + visible->size;
+
+        vertices.append({{min_corner.x, min_corner.y}, color});
+        vertices.append({{max_corner.x, min_corner.y}, color});
+        vertices.append({{min_corner.x, max_corner.y}, color});
+        vertices.append({{min_corner.x, max_corner.y}, color});
+        vertices.append({{max_corner.x, min_corner.y}, color});
+        vertices.append({{max_corner.x, max_corner.y}, color});
+    }
+
+    /// @brief Append glyph quads moved by an offset and cut to a clip rectangle
+    /// @details Takes the six vertices per quad Glyph_run writes. The quads must be
+    ///          axis aligned, which they are for upright text. Texture coordinates
+    ///          are cut in proportion, so a glyph cut in half shows its half.
+    void append_clipped_quads(
+        sf::VertexArray&               vertices,
+        std::vector<sf::Vertex> const& quads,
+        sf::Vector2f            const  offset,
+        sf::FloatRect           const& clip
+        ) {
+
+        for (std::size_t i = 0u; i + 6u <= quads.size(); i += 6u) {
+
+            sf::Vertex   const& first     = quads[i     ];
+            sf::Vertex   const& last      = quads[i + 5u];
+            sf::Vector2f const  pos_min   = first.position + offset;
+            sf::Vector2f const  pos_size  = last.position - first.position;
+            sf::Vector2f const  tex_size  = last.texCoords - first.texCoords;
+
+            std::optional<sf::FloatRect> const visible = sf::FloatRect(pos_min, pos_size).findIntersection(clip);
+
+            if (!visible) {
+
+                continue;
+            }
+
+            auto const get_tex = [&](sf::Vector2f const pos) {
+
+                return sf::Vector2f(
+                    first.texCoords.x + (pos_size.x > 0.0f ? (pos.x - pos_min.x) / pos_size.x * tex_size.x : 0.0f),
+                    first.texCoords.y + (pos_size.y > 0.0f ? (pos.y - pos_min.y) / pos_size.y * tex_size.y : 0.0f)
+                    );
+            };
+
+            sf::Vector2f const min_corner = visible->position;
+            sf::Vector2f const max_corner = visible->position + visible->size;
+            sf::Vector2f const tex_min    = get_tex(min_corner);
+            sf::Vector2f const tex_max    = get_tex(max_corner);
+
+            vertices.append({{min_corner.x, min_corner.y}, first.color, {tex_min.x, tex_min.y}});
+            vertices.append({{max_corner.x, min_corner.y}, first.color, {tex_max.x, tex_min.y}});
+            vertices.append({{min_corner.x, max_corner.y}, first.color, {tex_min.x, tex_max.y}});
+            vertices.append({{min_corner.x, max_corner.y}, first.color, {tex_min.x, tex_max.y}});
+            vertices.append({{max_corner.x, min_corner.y}, first.color, {tex_max.x, tex_min.y}});
+            vertices.append({{max_corner.x, max_corner.y}, first.color, {tex_max.x, tex_max.y}});
+        }
+    }
+
+    /// @brief Whether a byte continues a UTF-8 sequence
+    bool is_continuation_byte(
+        char const byte
+        ) {
+
+        return (static_cast<unsigned char>(byte) & 0xC0u) == 0x80u;
+    }
+
+    /// @brief Get the number of bytes of the character starting at an index
+    /// @details Malformed or cut off sequences count as one byte, so every byte
+    ///          belongs to exactly one character and columns always add up.
+    std::size_t get_char_length(
+        std::string_view const text,
+        std::size_t      const index
+        ) {
+
+        unsigned char const lead = static_cast<unsigned char>(text[index]);
+
+        std::size_t length = 1u;
+
+        if      ((lead >> 5u) == 0x06u) { length = 2u; }
+        else if ((lead >> 4u) == 0x0Eu) { length = 3u; }
+        else if ((lead >> 3u) == 0x1Eu) { length = 4u; }
+
+        if (index + length > text.size()) {
+
+            return 1u;
+        }
+
+        for (std::size_t i = 1u; i < length; ++i) {
+
+            if (!is_continuation_byte(text[index + i])) {
+
+                return 1u;
+            }
+        }
+
+        return length;
+    }
+
+    /// @brief Decode UTF-8, malformed bytes become U+FFFD
+    std::u32string decode_utf8(
+        std::string_view const text
+        ) {
+
+        std::u32string decoded;
+        decoded.reserve(text.size());
+
+        for (std::size_t index = 0u; index < text.size();) {
+
+            std::size_t   const length = get_char_length(text, index);
+            unsigned char const lead   = static_cast<unsigned char>(text[index]);
+
+            if (length == 1u) {
+
+                decoded.push_back(lead < 0x80u ? static_cast<char32_t>(lead) : U'\uFFFD');
+            } else {
+
+                char32_t code_point = lead & (0x7Fu >> length);
+
+                for (std::size_t i = 1u; i < length; ++i) {
+
+                    code_point = (code_point << 6u) | (static_cast<unsigned char>(text[index + i]) & 0x3Fu);
+                }
+
+                decoded.push_back(code_point);
+            }
+
+            index += length;
+        }
+
+        return decoded;
+    }
+
+    /// @brief Encode one character as UTF-8
+    std::string encode_utf8(
+        char32_t const code_point
+        ) {
+
+        std::string encoded;
+
+        if (code_point < 0x80u) {
+
+            encoded.push_back(static_cast<char>(code_point));
+        } else if (code_point < 0x800u) {
+
+            encoded.push_back(static_cast<char>(0xC0u | (code_point >> 6u)));
+            encoded.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+        } else if (code_point < 0x10000u) {
+
+            encoded.push_back(static_cast<char>(0xE0u | (code_point >> 12u)));
+            encoded.push_back(static_cast<char>(0x80u | ((code_point >> 6u) & 0x3Fu)));
+            encoded.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+        } else {
+
+            encoded.push_back(static_cast<char>(0xF0u | (code_point >> 18u)));
+            encoded.push_back(static_cast<char>(0x80u | ((code_point >> 12u) & 0x3Fu)));
+            encoded.push_back(static_cast<char>(0x80u | ((code_point >> 6u) & 0x3Fu)));
+            encoded.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+        }
+
+        return encoded;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Text_editor::Text_editor(
+        std::shared_ptr<sf::RenderTarget> parent_target,
+        sf::Vector2f const size
+        ) :
+        Widget            (std::move(parent_target)             ),
+        Signals_slots     (/*---------------------------------*/),
+        _te_rect          (size                                 ),
+        _te_document      (/*---------------------------------*/),
+        _te_history       (/*---------------------------------*/),
+        _te_line_runs     (/*---------------------------------*/),
+        _te_selection     (sf::PrimitiveType::Triangles         ),
+        _te_text          (sf::PrimitiveType::Triangles         ),
+        _te_caret         (sf::PrimitiveType::Triangles         ),
+        _te_page          (nullptr                              ),
+        _te_generation    (0u                                   ),
+        _te_char_size     (DEFAULT_GLYPH_CACHE.request_size(20u)),
+        _te_text_color    (DEFAULT_TEXT_COLOR                   ),
+        _te_cursor        (0u                                   ),
+        _te_anchor        (0u                                   ),
+        _te_goal_column   (0u                                   ),
+        _has_goal_column  (false                                ),
+        _scroll_x         (0.0f                                 ),
+        _scroll_y         (0.0f                                 ),
+        _scroll_target_y  (0.0f                                 ),
+        _scroll_clock     (/*---------------------------------*/),
+        _is_selecting     (false                                ),
+        _is_view_dirty    (true                                 ),
+        _is_cursor_moved  (false                                )
+    {
+
+        _te_rect.setPosition (DEFAULT_WIDGET_POS);
+        _te_rect.setFillColor(sf::Color::White  );
+    }
+
+    Text_editor::~Text_editor() {
+
+        DEFAULT_GLYPH_CACHE.release_size(_te_char_size);
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Text_editor::draw() {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
+        } else {
+
+            _update_widget();
+            _update_view();
+
+            if (!_is_parent_target_nullptr()) {
+
+                auto temp_ptr = _parent_target.lock();
+
+                sf::RenderStates states(_te_rect.getTransform());
+
+                temp_ptr->draw(_te_rect);
+                temp_ptr->draw(_te_selection, states);
+
+                states.texture = _te_page;
+                temp_ptr->draw(_te_text, states);
+
+                states.texture = nullptr;
+                temp_ptr->draw(_te_caret, states);
+            }
+        }
+    }
+
+    void Text_editor::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+            _update_view();
+
+            sf::RenderStates states(_te_rect.getTransform());
+
+            // Pushed in drawing order, the queue keeps overlapping items in push order.
+            queue.push(_layer, _te_rect);
+            queue.push(_layer, _te_selection, states);
+
+            states.texture = _te_page;
+            queue.push(_layer, _te_text, states, &DEFAULT_GLYPH_CACHE);
+
+            states.texture = nullptr;
+            queue.push(_layer, _te_caret, states);
+        }
+    }
+
+    void Text_editor::move(
+        sf::Vector2f const offset
+        ) {
+
+        _te_rect.move(offset);
+        _mark_dirty();
+    }
+
+    void Text_editor::move(
+        float const x,
+        float const y
+        ) {
+
+        _te_rect.move({x, y});
+        _mark_dirty();
+    }
+
+    bool Text_editor::load_file(
+        std::filesystem::path const& path
+        ) {
+
+        std::error_code error;
+        std::uintmax_t const file_size = std::filesystem::file_size(path, error);
+
+        std::ifstream file(path, std::ios::binary);
+
+        if (error || !file) {
+
+            LOG(WARNING) << "Could not open text editor file [" << path.string() << "].";
+            return false;
+        }
+
+        // One read into a buffer of the final size, the piece table then takes it as is.
+        std::string text(static_cast<std::size_t>(file_size), '\0');
+
+        if (!file.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+
+            LOG(WARNING) << "Could not read text editor file [" << path.string() << "].";
+            return false;
+        }
+
+        _te_document.load(std::move(text));
+        _te_history.clear();
+
+        _te_cursor        = 0u;
+        _te_anchor        = 0u;
+        _has_goal_column  = false;
+        _scroll_x         = 0.0f;
+        _scroll_y         = 0.0f;
+        _scroll_target_y  = 0.0f;
+        _is_view_dirty    = true;
+        _mark_dirty();
+
+        return true;
+    }
+
+    bool Text_editor::save_file(
+        std::filesystem::path const& path
+        ) const {
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        std::string const text = _te_document.get_text();
+
+        if (!file || !file.write(text.data(), static_cast<std::streamsize>(text.size()))) {
+
+            LOG(WARNING) << "Could not write text editor file [" << path.string() << "].";
+            return false;
+        }
+
+        return true;
+    }
+
+    void Text_editor::insert_text(
+        std::string_view const text
+        ) {
+
+        // Replacing the selection is one step, undone together.
+        _te_history.begin_step();
+
+        _erase_selection();
+
+        _te_history.record_insert(_te_cursor, text);
+        _te_document.insert(_te_cursor, text);
+
+        _te_cursor       += text.size();
+        _te_anchor        = _te_cursor;
+        _has_goal_column  = false;
+
+        _on_edit();
+    }
+
+    void Text_editor::paste() {
+
+        sf::String const clipboard = sf::Clipboard::getString();
+
+        std::string text;
+        text.reserve(clipboard.getSize());
+
+        for (std::size_t i = 0u; i < clipboard.getSize(); ++i) {
+
+            char32_t const code_point = clipboard[i];
+
+            bool const is_printable_char = code_point >= 32u && code_point != 127u;
+            bool const is_layout_char    = code_point == U'\n' || code_point == U'\t';
+
+            // "\r\n" pastes as "\n", like Enter types it.
+            if (is_printable_char || is_layout_char) {
+
+                text += encode_utf8(code_point);
+            }
+        }
+
+        if (!text.empty()) {
+
+            insert_text(text);
+        }
+    }
+
+    void Text_editor::delete_char() {
+
+        _te_history.begin_step();
+
+        if (_erase_selection()) {
+
+            _on_edit();
+        } else if (_te_cursor > 0u) {
+
+            std::size_t const previous = _get_previous_offset(_te_cursor);
+
+            _te_history.record_erase(previous, _te_document.get_text(previous, _te_cursor - previous));
+            _te_document.erase(previous, _te_cursor - previous);
+
+            _te_cursor       = previous;
+            _te_anchor       = previous;
+            _has_goal_column = false;
+
+            _on_edit();
+        }
+    }
+
+    void Text_editor::delete_char_after() {
+
+        _te_history.begin_step();
+
+        if (_erase_selection()) {
+
+            _on_edit();
+        } else if (_te_cursor < _te_document.get_size()) {
+
+            std::size_t const count = _get_next_offset(_te_cursor) - _te_cursor;
+
+            _te_history.record_erase(_te_cursor, _te_document.get_text(_te_cursor, count));
+            _te_document.erase(_te_cursor, count);
+
+            _te_anchor       = _te_cursor;
+            _has_goal_column = false;
+
+            _on_edit();
+        }
+    }
+
+    void Text_editor::move_cursor(
+        int  const offset,
+        bool const is_extending
+        ) {
+
+        _has_goal_column = false;
+
+        if (!is_extending && has_selection()) {
+
+            // Collapse the selection to the side moved towards, like most editors.
+            auto const [first, last] = _get_selection_range();
+            _place_cursor(offset < 0 ? first : last, false);
+
+            return;
+        }
+
+        std::size_t cursor = _te_cursor;
+
+        for (int i = 0; i < std::abs(offset); ++i) {
+
+            if (offset < 0 && cursor > 0u) {
+
+                cursor = _get_previous_offset(cursor);
+            } else if (offset > 0 && cursor < _te_document.get_size()) {
+
+                cursor = _get_next_offset(cursor);
+            }
+        }
+
+        _place_cursor(cursor, is_extending);
+    }
+
+    void Text_editor::move_cursor_lines(
+        int  const offset,
+        bool const is_extending
+        ) {
+
+        std::size_t const line = _te_document.get_line_of(_te_cursor);
+
+        if (!_has_goal_column) {
+
+            _te_goal_column  = _get_column(_te_cursor, line);
+            _has_goal_column = true;
+        }
+
+        std::size_t const last_line   = _te_document.get_num_lines() - 1u;
+        std::size_t       target_line = 0u;
+
+        if (offset < 0) {
+
+            std::size_t const distance = static_cast<std::size_t>(-static_cast<long long>(offset));
+            target_line = line > distance ? line - distance : 0u;
+        } else {
+
+            target_line = std::min(line + static_cast<std::size_t>(offset), last_line);
+        }
+
+        _place_cursor(_get_offset_at_column(target_line, _te_goal_column), is_extending);
+    }
+
+    void Text_editor::select_all() {
+
+        _te_anchor        = 0u;
+        _te_cursor        = _te_document.get_size();
+        _has_goal_column  = false;
+        _is_view_dirty    = true;
+        _te_history.break_coalescing();
+        _mark_dirty();
+    }
+
+    void Text_editor::undo() {
+
+        auto const edits = _te_history.undo();
+
+        if (edits.empty()) {
+
+            return;
+        }
+
+        // Reverted newest first, each costs the size of its text, not of the document.
+        for (auto iter = edits.rbegin(); iter != edits.rend(); ++iter) {
+
+            if (iter->is_insert) {
+
+                _te_document.erase(iter->offset, iter->text.size());
+                _te_cursor = iter->offset;
+            } else {
+
+                _te_document.insert(iter->offset, iter->text);
+                _te_cursor = iter->offset + iter->text.size();
+            }
+        }
+
+        _te_anchor       = _te_cursor;
+        _has_goal_column = false;
+
+        _on_edit();
+    }
+
+    void Text_editor::redo() {
+
+        auto const edits = _te_history.redo();
+
+        if (edits.empty()) {
+
+            return;
+        }
+
+        for (auto const& edit : edits) {
+
+            if (edit.is_insert) {
+
+                _te_document.insert(edit.offset, edit.text);
+                _te_cursor = edit.offset + edit.text.size();
+            } else {
+
+                _te_document.erase(edit.offset, edit.text.size());
+                _te_cursor = edit.offset;
+            }
+        }
+
+        _te_anchor       = _te_cursor;
+        _has_goal_column = false;
+
+        _on_edit();
+    }
+
+    void Text_editor::scroll_by(
+        float const pixels
+        ) {
+
+        _scroll_target_y += pixels;
+        _clamp_scroll();
+
+        // Start easing from now, not from the last frame that scrolled.
+        _scroll_clock.restart();
+        _mark_dirty();
+    }
+
+    void Text_editor::scroll_to_line(
+        std::size_t const line
+        ) {
+
+        std::size_t const clamped_line = std::min(line, _te_document.get_num_lines() - 1u);
+
+        _scroll_target_y = static_cast<float>(clamped_line) * _get_line_height();
+        _clamp_scroll();
+
+        _scroll_y         = _scroll_target_y;
+        _is_view_dirty    = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::_update_widget() {
+
+        float const elapsed = _scroll_clock.restart().asSeconds();
+
+        if (_scroll_y == _scroll_target_y) {
+
+            return;
+        }
+
+        // Exponential easing, the same on any frame rate.
+        float const distance = _scroll_target_y - _scroll_y;
+        float const step     = 1.0f - std::exp(-SCROLL_EASE_RATE * elapsed);
+
+        _scroll_y += distance * step;
+
+        if (std::abs(_scroll_target_y - _scroll_y) < 0.5f) {
+
+            _scroll_y = _scroll_target_y;
+        }
+
+        // Keep a cached compositor layer redrawing until the scroll settles.
+        _is_view_dirty = true;
+        _mark_dirty();
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Text_editor::set_text(
+        std::string_view const text
+        ) {
+
+        _te_document.load(std::string(text));
+        _te_history.clear();
+
+        _te_cursor        = 0u;
+        _te_anchor        = 0u;
+        _has_goal_column  = false;
+        _scroll_x         = 0.0f;
+        _scroll_y         = 0.0f;
+        _scroll_target_y  = 0.0f;
+        _is_view_dirty    = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::set_cursor(
+        std::size_t const offset,
+        bool        const is_extending
+        ) {
+
+        std::size_t cursor = std::min(offset, _te_document.get_size());
+
+        // Never leave the cursor inside a character or between '\r' and '\n'.
+        while (cursor > 0u && cursor < _te_document.get_size() && _get_next_offset(_get_previous_offset(cursor)) != cursor) {
+
+            cursor = _get_previous_offset(cursor);
+        }
+
+        _has_goal_column = false;
+        _place_cursor(cursor, is_extending);
+    }
+
+    void Text_editor::set_size(
+        sf::Vector2f const size
+        ) {
+
+        _te_rect.setSize(size);
+        _clamp_scroll();
+
+        _is_view_dirty = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::set_size(
+        float const x,
+        float const y
+        ) {
+
+        set_size({x, y});
+    }
+
+    void Text_editor::set_pos(
+        sf::Vector2f const pos
+        ) {
+
+        _te_rect.setPosition(pos);
+        _mark_dirty();
+    }
+
+    void Text_editor::set_pos(
+        float const x,
+        float const y
+        ) {
+
+        _te_rect.setPosition({x, y});
+        _mark_dirty();
+    }
+
+    void Text_editor::set_char_size(
+        std::uint32_t const char_size
+        ) {
+
+        // Request the new size before releasing the old one, so a size kept in use stays counted.
+        std::uint32_t const size = DEFAULT_GLYPH_CACHE.request_size(char_size);
+        DEFAULT_GLYPH_CACHE.release_size(_te_char_size);
+
+        _te_char_size = size;
+
+        for (Glyph_run& run : _te_line_runs) {
+
+            run.set_char_size(_te_char_size);
+        }
+
+        _clamp_scroll();
+
+        _is_view_dirty = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::set_text_color(
+        sf::Color const color
+        ) {
+
+        _te_text_color = color;
+
+        for (Glyph_run& run : _te_line_runs) {
+
+            run.set_fill_color(_te_text_color);
+        }
+
+        _is_view_dirty = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::set_background_color(
+        sf::Color const color
+        ) {
+
+        _te_rect.setFillColor(color);
+        _mark_dirty();
+    }
+
+    void Text_editor::set_border_thickness(
+        float const thickness
+        ) {
+
+        if (thickness < 0.0f) {
+
+            _te_rect.setOutlineThickness(0.0f);
+
+            LOG(WARNING)                                  <<
+            "Border thickness for widget is not set to [" <<
+            thickness                                     <<
+            "] as only positive values are allowed.";
+        } else {
+
+            _te_rect.setOutlineThickness(thickness);
+        }
+
+        _mark_dirty();
+    }
+
+    void Text_editor::set_border_color(
+        sf::Color const color
+        ) {
+
+        _te_rect.setOutlineColor(color);
+        _mark_dirty();
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::string Text_editor::get_text() const {
+
+        return _te_document.get_text();
+    }
+
+    std::string Text_editor::get_selected_text() const {
+
+        auto const [first, last] = _get_selection_range();
+
+        return _te_document.get_text(first, last - first);
+    }
+
+    bool Text_editor::has_selection() const {
+
+        return _te_anchor != _te_cursor;
+    }
+
+    std::size_t Text_editor::get_cursor() const {
+
+        return _te_cursor;
+    }
+
+    std::size_t Text_editor::get_cursor_line() const {
+
+        return _te_document.get_line_of(_te_cursor);
+    }
+
+    std::size_t Text_editor::get_num_lines() const {
+
+        return _te_document.get_num_lines();
+    }
+
+    Piece_table const& Text_editor::get_document() const {
+
+        return _te_document;
+    }
+
+    std::uint32_t Text_editor::get_char_size() const {
+
+        return _te_char_size;
+    }
+
+    sf::Vector2f Text_editor::get_size() const {
+
+        return _te_rect.getSize();
+    }
+
+    float Text_editor::get_size_x() const {
+
+        return _te_rect.getSize().x;
+    }
+
+    float Text_editor::get_size_y() const {
+
+        return _te_rect.getSize().y;
+    }
+
+    sf::Vector2f Text_editor::get_pos() const {
+
+        return _te_rect.getPosition();
+    }
+
+    float Text_editor::get_pos_x() const {
+
+        return _te_rect.getPosition().x;
+    }
+
+    float Text_editor::get_pos_y() const {
+
+        return _te_rect.getPosition().y;
+    }
+
+    sf::FloatRect Text_editor::get_global_bounds() const {
+
+        return _te_rect.getGlobalBounds();
+    }
+/*
+------------------------------------------------------------------------------
+Signals / slots
+------------------------------------------------------------------------------
+*/
+    void Text_editor::_handle_hover(
+        sf::Event const& event
+        ) {
+
+        static_cast<void>(event);
+
+        // If we are typing, then dont change state depending on hovering.
+        if (_current_state == STATE__TYPING) {
+
+            return;
+        }
+
+        // Check if we are hovering and not in a hovering state.
+        if (_is_hovering() && _current_state != STATE__HOVERING) {
+
+            change_state (STATE__HOVERING);
+            _emit_signal (SIGNAL__HOVER  );
+        }
+
+        // Check if we are not hovering and in a hovering state.
+        if (!_is_hovering() && _current_state == STATE__HOVERING) {
+
+            change_state (STATE__DEFAULT    );
+            _emit_signal (SIGNAL__STOP_HOVER);
+        }
+    }
+
+    void Text_editor::_handle_text_entered_events(
+        sf::Event const& event
+        ) {
+
+        if (_current_state == STATE__TYPING) {
+
+            if (auto typed_char = event.getIf<sf::Event::TextEntered>()) {
+
+                // Enter arrives as '\r' on most platforms.
+                char32_t const code_point = typed_char->unicode == U'\r' ? U'\n' : typed_char->unicode;
+
+                bool const is_printable_char = code_point >= 32u && code_point != 127u;
+                bool const is_layout_char    = code_point == U'\n' || code_point == U'\t';
+
+                // Backspace and delete arrive here too, they are handled as key presses.
+                if (is_printable_char || is_layout_char) {
+
+                    insert_text(encode_utf8(code_point));
+                }
+            }
+        }
+
+        Signals_slots::_handle_text_entered_events(event);
+    }
+
+    void Text_editor::_handle_mouse_button_pressed_events(
+        sf::Event const& event
+        ) {
+
+        if (auto btn_press = event.getIf<sf::Event::MouseButtonPressed>()) {
+
+            if (btn_press->button == sf::Mouse::Button::Left) {
+
+                if (_is_hovering()) {
+
+                    bool const is_shift_held = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LShift) ||
+                                               sf::Keyboard::isKeyPressed(sf::Keyboard::Key::RShift);
+
+                    // Shift clicking extends a selection already being typed in.
+                    bool const is_extending = _current_state == STATE__TYPING && is_shift_held;
+
+                    change_state(STATE__TYPING);
+
+                    _has_goal_column = false;
+                    _place_cursor(_find_offset_at(btn_press->position), is_extending);
+                    _is_selecting = true;
+                } else {
+
+                    change_state(STATE__DEFAULT);
+
+                    _is_view_dirty = true;
+                    _mark_dirty();
+                }
+
+                _emit_signal(SIGNAL__MOUSE_BUTTON_LEFT_PRESS);
+                return;
+            }
+        }
+
+        Signals_slots::_handle_mouse_button_pressed_events(event);
+    }
+
+    void Text_editor::_handle_mouse_button_release_events(
+        sf::Event const& event
+        ) {
+
+        if (auto btn_release = event.getIf<sf::Event::MouseButtonReleased>()) {
+
+            if (btn_release->button == sf::Mouse::Button::Left) {
+
+                _is_selecting = false;
+            }
+        }
+
+        Signals_slots::_handle_mouse_button_release_events(event);
+    }
+
+    void Text_editor::_handle_mouse_moved_events(
+        sf::Event const& event
+        ) {
+
+        if (auto mouse_moved = event.getIf<sf::Event::MouseMoved>()) {
+
+            if (_is_selecting && _current_state == STATE__TYPING) {
+
+                std::size_t const offset = _find_offset_at(mouse_moved->position);
+
+                // Most moves stay over the same character, dont redraw for those.
+                if (offset != _te_cursor) {
+
+                    _has_goal_column = false;
+                    _place_cursor(offset, true);
+                }
+            }
+        }
+
+        Signals_slots::_handle_mouse_moved_events(event);
+    }
+
+    void Text_editor::_handle_mouse_wheel_events(
+        sf::Event const& event
+        ) {
+
+        if (auto wheel_scroll = event.getIf<sf::Event::MouseWheelScrolled>()) {
+
+            if (_is_hovering()) {
+
+                float const distance = -wheel_scroll->delta * WHEEL_LINES * _get_line_height();
+
+                if (wheel_scroll->wheel == sf::Mouse::Wheel::Horizontal) {
+
+                    _scroll_x = std::max(0.0f, _scroll_x + distance);
+
+                    _is_view_dirty = true;
+                    _mark_dirty();
+                } else {
+
+                    scroll_by(distance);
+                }
+            }
+        }
+
+        Signals_slots::_handle_mouse_wheel_events(event);
+    }
+
+    void Text_editor::_handle_key_pressed_events(
+        sf::Event const& event
+        ) {
+
+        if (auto const key_pressed = event.getIf<sf::Event::KeyPressed>()) {
+
+            if (_current_state == STATE__TYPING) {
+
+                bool const shift     = key_pressed->shift;
+                int  const page_size = static_cast<int>(std::max<std::size_t>(_get_num_visible_lines(), 3u)) - 2;
+
+                std::size_t const line = _te_document.get_line_of(_te_cursor);
+
+                switch (key_pressed->code) {
+
+                case sf::Keyboard::Key::Left     : move_cursor      (-1,         shift); break;
+                case sf::Keyboard::Key::Right    : move_cursor      ( 1,         shift); break;
+                case sf::Keyboard::Key::Up       : move_cursor_lines(-1,         shift); break;
+                case sf::Keyboard::Key::Down     : move_cursor_lines( 1,         shift); break;
+                case sf::Keyboard::Key::PageUp   : move_cursor_lines(-page_size, shift); break;
+                case sf::Keyboard::Key::PageDown : move_cursor_lines( page_size, shift); break;
+                case sf::Keyboard::Key::Backspace: delete_char();                        break;
+                case sf::Keyboard::Key::Delete   : delete_char_after();                  break;
+                case sf::Keyboard::Key::Home     :
+                    set_cursor(key_pressed->control ? 0u : _te_document.get_line_start(line), shift);
+                    break;
+                case sf::Keyboard::Key::End      :
+                    set_cursor(key_pressed->control ? _te_document.get_size() : _get_line_content_end(line), shift);
+                    break;
+                case sf::Keyboard::Key::A        : if (key_pressed->control) { select_all(); } break;
+                case sf::Keyboard::Key::V        : if (key_pressed->control) { paste();      } break;
+                case sf::Keyboard::Key::Y        : if (key_pressed->control) { redo();       } break;
+                case sf::Keyboard::Key::Z        :
+                    if (key_pressed->control) { shift ? redo() : undo(); }
+                    break;
+                default                          :                                              break;
+                }
+            }
+        }
+
+        Signals_slots::_handle_key_pressed_events(event);
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    bool Text_editor::_is_hovering() const {
+
+        auto temp_ptr = _parent_window.lock();
+
+        // Offscreen widgets have no window to read the mouse position from.
+        if (!temp_ptr) {
+
+            return false;
+        }
+
+        sf::Vector2i const mouse_pos_pixels = sf::Mouse::getPosition    (*temp_ptr       );
+        sf::Vector2f const mouse_pos_coords = temp_ptr->mapPixelToCoords(mouse_pos_pixels);
+
+        return _te_rect.getGlobalBounds().contains(mouse_pos_coords);
+    }
+
+    float Text_editor::_get_line_height() const {
+
+        return std::max(1.0f, DEFAULT_GLYPH_CACHE.get_metrics(_te_char_size).line_spacing);
+    }
+
+    std::size_t Text_editor::_get_num_visible_lines() const {
+
+        return static_cast<std::size_t>(std::ceil(_te_rect.getSize().y / _get_line_height())) + 1u;
+    }
+
+    std::size_t Text_editor::_get_line_content_end(
+        std::size_t const line
+        ) const {
+
+        std::size_t const start = _te_document.get_line_start(line);
+        std::size_t const end   = _te_document.get_line_end  (line);
+
+        if (end > start && _te_document.get_byte(end - 1u) == '\r') {
+
+            return end - 1u;
+        }
+
+        return end;
+    }
+
+    Glyph_run& Text_editor::_get_line_run(
+        std::size_t const line
+        ) {
+
+        std::size_t const num_runs = _get_num_visible_lines();
+
+        while (_te_line_runs.size() < num_runs) {
+
+            _te_line_runs.emplace_back(DEFAULT_WIDGET_FONT, _te_char_size);
+            _te_line_runs.back().set_fill_color(_te_text_color);
+        }
+
+        Glyph_run& run = _te_line_runs[line % num_runs];
+
+        std::size_t    const start  = _te_document.get_line_start(line);
+        std::u32string const string = decode_utf8(_te_document.get_text(start, _get_line_content_end(line) - start));
+
+        // Scrolling reuses the runs of lines still in view, only new lines lay out.
+        if (run.get_string() != string) {
+
+            run.set_string(string);
+        }
+
+        return run;
+    }
+
+    std::size_t Text_editor::_get_column(
+        std::size_t const offset,
+        std::size_t const line
+        ) const {
+
+        std::size_t const start = _te_document.get_line_start(line);
+        std::string const text  = _te_document.get_text(start, offset - start);
+
+        std::size_t column = 0u;
+
+        for (std::size_t index = 0u; index < text.size(); index += get_char_length(text, index)) {
+
+            ++column;
+        }
+
+        return column;
+    }
+
+    std::size_t Text_editor::_get_offset_at_column(
+        std::size_t const line,
+        std::size_t const column
+        ) const {
+
+        std::size_t const start = _te_document.get_line_start(line);
+        std::string const text  = _te_document.get_text(start, _get_line_content_end(line) - start);
+
+        std::size_t index = 0u;
+
+        for (std::size_t i = 0u; i < column && index < text.size(); ++i) {
+
+            index += get_char_length(text, index);
+        }
+
+        return start + index;
+    }
+
+    std::size_t Text_editor::_get_next_offset(
+        std::size_t const offset
+        ) const {
+
+        std::string const text = _te_document.get_text(offset, 4u);
+
+        if (text.size() >= 2u && text[0] == '\r' && text[1] == '\n') {
+
+            return offset + 2u;
+        }
+
+        return offset + get_char_length(text, 0u);
+    }
+
+    std::size_t Text_editor::_get_previous_offset(
+        std::size_t const offset
+        ) const {
+
+        std::size_t const first = offset > 4u ? offset - 4u : 0u;
+        std::string const text  = _te_document.get_text(first, offset - first);
+
+        std::size_t index = text.size() - 1u;
+
+        if (text[index] == '\n' && index > 0u && text[index - 1u] == '\r') {
+
+            return first + index - 1u;
+        }
+
+        // Back over continuation bytes to a lead byte whose sequence ends at the offset.
+        while (index > 0u && is_continuation_byte(text[index])) {
+
+            --index;
+        }
+
+        if (index + get_char_length(text, index) != text.size()) {
+
+            index = text.size() - 1u;
+        }
+
+        return first + index;
+    }
+
+    std::size_t Text_editor::_find_offset_at(
+        sf::Vector2i const pixel_pos
+        ) {
+
+        auto temp_ptr = _parent_window.lock();
+
+        // Offscreen widgets have no window to map the pixel with.
+        if (!temp_ptr) {
+
+            return _te_cursor;
+        }
+
+        sf::Vector2f const local_point = temp_ptr->mapPixelToCoords(pixel_pos) - _te_rect.getPosition();
+        float        const document_y  = std::max(0.0f, local_point.y + _scroll_y);
+
+        std::size_t const line = std::min(
+            static_cast<std::size_t>(document_y / _get_line_height()),
+            _te_document.get_num_lines() - 1u
+        );
+
+        std::size_t const column = _get_line_run(line).find_char_index(local_point.x - TEXT_PADDING + _scroll_x);
+
+        return _get_offset_at_column(line, column);
+    }
+
+    std::pair<std::size_t, std::size_t> Text_editor::_get_selection_range() const {
+
+        return {std::min(_te_cursor, _te_anchor), std::max(_te_cursor, _te_anchor)};
+    }
+
+    bool Text_editor::_erase_selection() {
+
+        if (!has_selection()) {
+
+            return false;
+        }
+
+        auto const [first, last] = _get_selection_range();
+
+        _te_history.record_erase(first, _te_document.get_text(first, last - first));
+        _te_document.erase(first, last - first);
+
+        _te_cursor       = first;
+        _te_anchor       = first;
+        _has_goal_column = false;
+
+        return true;
+    }
+
+    void Text_editor::_place_cursor(
+        std::size_t const offset,
+        bool        const is_extending
+        ) {
+
+        _te_cursor = offset;
+
+        if (!is_extending) {
+
+            _te_anchor = _te_cursor;
+        }
+
+        // Typing after moving the cursor is undone separately.
+        _te_history.break_coalescing();
+        _scroll_to_cursor();
+
+        _is_view_dirty = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::_on_edit() {
+
+        _clamp_scroll();
+        _scroll_to_cursor();
+
+        _is_view_dirty = true;
+        _mark_dirty();
+    }
+
+    void Text_editor::_clamp_scroll() {
+
+        float const document_height = static_cast<float>(_te_document.get_num_lines()) * _get_line_height();
+        float const max_scroll      = std::max(0.0f, document_height - _te_rect.getSize().y);
+
+        _scroll_target_y = std::clamp(_scroll_target_y, 0.0f, max_scroll);
+        _scroll_y        = std::clamp(_scroll_y,        0.0f, max_scroll);
+    }
+
+    void Text_editor::_scroll_to_cursor() {
+
+        float const line_height = _get_line_height();
+        float const line_top    = static_cast<float>(_te_document.get_line_of(_te_cursor)) * line_height;
+        float const view_height = _te_rect.getSize().y;
+
+        if (line_top < _scroll_target_y) {
+
+            _scroll_target_y = line_top;
+        } else if (line_top + line_height > _scroll_target_y + view_height) {
+
+            _scroll_target_y = line_top + line_height - view_height;
+        }
+
+        // Following the cursor snaps, easing would lag behind typing.
+        _clamp_scroll();
+        _scroll_y        = _scroll_target_y;
+        _is_cursor_moved = true;
+    }
+
+    void Text_editor::_update_view() {
+
+        // The glyph quads sample a page the eviction freed.
+        if (DEFAULT_GLYPH_CACHE.update_generation(_te_generation)) {
+
+            _is_view_dirty = true;
+        }
+
+        if (!_is_view_dirty) {
+
+            return;
+        }
+
+        _is_view_dirty = false;
+
+        _te_selection.clear();
+        _te_text.clear();
+        _te_caret.clear();
+
+        float         const line_height = _get_line_height();
+        float         const cs          = static_cast<float>(_te_char_size);
+        float         const text_width  = std::max(0.0f, _te_rect.getSize().x - TEXT_PADDING * 2.0f);
+        sf::FloatRect const clip        = {{0.0f, 0.0f}, _te_rect.getSize()};
+
+        std::size_t const cursor_line = _te_document.get_line_of(_te_cursor);
+        bool        const is_typing   = _current_state == STATE__TYPING;
+
+        // Bring the cursor into view horizontally, measured on its own line.
+        if (_is_cursor_moved) {
+
+            _is_cursor_moved = false;
+
+            float const caret_x = _get_line_run(cursor_line).get_char_x(_get_column(_te_cursor, cursor_line));
+
+            if (caret_x < _scroll_x) {
+
+                _scroll_x = caret_x;
+            } else if (caret_x > _scroll_x + text_width) {
+
+                _scroll_x = caret_x - text_width;
+            }
+        }
+
+        std::size_t const first_line = static_cast<std::size_t>(_scroll_y / line_height);
+        float       const first_y    = static_cast<float>(first_line) * line_height - _scroll_y;
+
+        auto const [select_first, select_last] = _get_selection_range();
+
+        std::size_t const select_first_line = has_selection() ? _te_document.get_line_of(select_first) : 0u;
+        std::size_t const select_last_line  = has_selection() ? _te_document.get_line_of(select_last ) : 0u;
+
+        std::vector<sf::Vertex> quads;
+
+        for (std::size_t i = 0u; i < _get_num_visible_lines(); ++i) {
+
+            std::size_t const line = first_line + i;
+
+            if (line >= _te_document.get_num_lines()) {
+
+                break;
+            }
+
+            Glyph_run&  run  = _get_line_run(line);
+            float const y    = first_y + static_cast<float>(i) * line_height;
+            float const left = TEXT_PADDING - _scroll_x;
+
+            if (has_selection() && line >= select_first_line && line <= select_last_line) {
+
+                // Selected line breaks show as a space wide highlight past the line end.
+                float const first_x = line == select_first_line ? run.get_char_x(_get_column(select_first, line)) : 0.0f;
+                float const last_x  = line == select_last_line  ? run.get_char_x(_get_column(select_last,  line)) : run.get_char_x(run.get_size()) + cs * 0.3f;
+
+                append_clipped_rect(_te_selection, {{left + first_x, y}, {last_x - first_x, line_height}}, clip, SELECTION_COLOR);
+            }
+
+            quads.clear();
+            run.append_vertices(quads);
+            append_clipped_quads(_te_text, quads, {left, y}, clip);
+
+            // Every line has the same size, so they share one page.
+            _te_page = run.get_texture();
+
+            if (is_typing && line == cursor_line) {
+
+                float const caret_x = run.get_char_x(_get_column(_te_cursor, line));
+
+                append_clipped_rect(_te_caret, {{left + caret_x, y}, {std::max(1.0f, cs / 16.0f), line_height}}, clip, _te_text_color);
+            }
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,268 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/text_fit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Text_fit::Text_fit(
+        Glyph_cache& glyph_cache
+        ) :
+        _glyph_cache(glyph_cache),
+        _fits       (           ),
+        _fits_mutex (           ),
+        _capacity   (1024u      ),
+        _num_hits   (0u         ),
+        _num_misses (0u         ),
+        _num_layouts(0u         )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    unsigned int Text_fit::fit(
+        Glyph_run&         run,
+        sf::Vector2f const box_size,
+        unsigned int const max_size
+        ) {
+
+        Fit_key key{};
+        key.string   = run.get_string();
+        key.font     = &run.get_font();
+        key.style    = run.get_style();
+        key.outline  = run.get_outline_thickness();
+        key.box_x    = box_size.x;
+        key.box_y    = box_size.y;
+        key.max_size = max_size;
+
+        {
+            std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+            auto const iter = _fits.find(key);
+
+            if (iter != _fits.end()) {
+
+                ++_num_hits;
+
+                // Only lays the run out again if its size actually changes.
+                if (run.get_char_size() != iter->second) {
+
+                    run.set_char_size(iter->second);
+                }
+
+                return iter->second;
+            }
+        }
+
+        unsigned int const size = _search(run, box_size, max_size);
+
+        std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+        ++_num_misses;
+
+        if (_capacity == 0u) {
+
+            // Memoization is disabled.
+        } else {
+
+            if (_fits.size() >= _capacity) {
+
+                _fits.clear();
+            }
+
+            _fits.emplace(std::move(key), size);
+        }
+
+        return size;
+    }
+
+    void Text_fit::clear() {
+
+        std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+        _fits.clear();
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Text_fit::set_capacity(
+        std::size_t const capacity
+        ) {
+
+        std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+        _capacity = capacity;
+
+        if (_fits.size() > _capacity) {
+
+            _fits.clear();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Text_fit::get_num_hits() const {
+
+        std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+        return _num_hits;
+    }
+
+    std::size_t Text_fit::get_num_misses() const {
+
+        std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+        return _num_misses;
+    }
+
+    std::size_t Text_fit::get_num_layouts() const {
+
+        std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+        return _num_layouts;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Text_fit::Fit_key_hash::operator()(
+        Fit_key const& key
+        ) const {
+
+        std::size_t hash = std::hash<std::u32string_view>{}(key.string);
+
+        auto const combine = [&hash](std::size_t const value) {
+
+            hash ^= value + 0x9e3779b97f4a7c15u + (hash << 6u) + (hash >> 2u);
+        };
+
+        combine(std::hash<sf::Font const*>{}(key.font    ));
+        combine(std::hash<std::uint32_t  >{}(key.style   ));
+        combine(std::hash<float          >{}(key.outline ));
+        combine(std::hash<float          >{}(key.box_x   ));
+        combine(std::hash<float          >{}(key.box_y   ));
+        combine(std::hash<unsigned int   >{}(key.max_size));
+
+        return hash;
+    }
+
+    unsigned int Text_fit::_search(
+        Glyph_run&         run,
+        sf::Vector2f const box_size,
+        unsigned int const max_size
+        ) {
+
+        std::vector<unsigned int> const steps = _glyph_cache.get_size_steps();
+
+        // Index of the largest step not above `max_size`.
+        auto        const top_iter  = std::upper_bound(steps.begin(), steps.end(), max_size);
+        std::size_t const top_index = top_iter == steps.begin() ? 0u : static_cast<std::size_t>(std::distance(steps.begin(), top_iter)) - 1u;
+
+        std::size_t  num_layouts = 0u;
+        sf::Vector2f measured    = {0.0f, 0.0f};
+
+        auto const fits_at = [&](std::size_t const index) {
+
+            run.set_char_size(steps[index]);
+            measured = run.get_local_bounds().size;
+            ++num_layouts;
+
+            return measured.x <= box_size.x && measured.y <= box_size.y;
+        };
+
+        std::size_t fitted_index = 0u;
+
+        if (fits_at(top_index)) {
+
+            fitted_index = top_index;
+        } else if (top_index > 0u) {
+
+            // Bounds scale close to linearly with the size, so the overflow at the
+            // largest size tells roughly how far down the fit is.
+            float ratio = 1.0f;
+
+            if (measured.x > box_size.x && measured.x > 0.0f) {
+
+                ratio = std::min(ratio, std::max(box_size.x, 0.0f) / measured.x);
+            }
+
+            if (measured.y > box_size.y && measured.y > 0.0f) {
+
+                ratio = std::min(ratio, std::max(box_size.y, 0.0f) / measured.y);
+            }
+
+            float        const guess_size = std::floor(static_cast<float>(steps[top_index]) * ratio);
+            auto         const guess_iter = std::upper_bound(steps.begin(), steps.begin() + top_index, static_cast<unsigned int>(guess_size));
+            std::size_t  const guess      = guess_iter == steps.begin() ? 0u : static_cast<std::size_t>(std::distance(steps.begin(), guess_iter)) - 1u;
+
+            // Largest fitting index lies in [low, high], `low` is only known to fit once probed.
+            std::size_t low  = 0u;
+            std::size_t high = top_index - 1u;
+
+            if (fits_at(guess)) {
+
+                low = guess;
+            } else {
+
+                high = guess == 0u ? 0u : guess - 1u;
+            }
+
+            while (low < high) {
+
+                std::size_t const middle = low + (high - low + 1u) / 2u;
+
+                if (fits_at(middle)) {
+
+                    low = middle;
+                } else {
+
+                    high = middle - 1u;
+                }
+            }
+
+            fitted_index = low;
+        }
+
+        // The last size laid out may have been one that did not fit.
+        if (run.get_char_size() != steps[fitted_index]) {
+
+            run.set_char_size(steps[fitted_index]);
+        }
+
+        {
+            std::lock_guard<std::mutex> const fits_lock(_fits_mutex);
+
+            _num_layouts += num_layouts;
+        }
+
+        return steps[fitted_index];
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,179 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/text_geometry_cache.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Text_geometry_cache::Text_geometry_cache() :
+        _entries      (   ),
+        _entries_mutex(   ),
+        _prune_size   (64u),
+        _num_hits     (0u ),
+        _num_misses   (0u )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    std::shared_ptr<Glyph_run const> Text_geometry_cache::acquire(
+        sf::Font            const& font,
+        unsigned int        const  char_size,
+        std::uint32_t       const  style,
+        sf::Color           const  fill_color,
+        float               const  outline_thickness,
+        sf::Color           const  outline_color,
+        std::u32string_view const  string
+        ) {
+
+        Geometry_key key{};
+        key.string            = std::u32string(string);
+        key.font              = &font;
+        key.char_size         = char_size;
+        key.style             = style;
+        key.fill_color        = fill_color;
+        key.outline_thickness = outline_thickness;
+        key.outline_color     = outline_color;
+
+        {
+            std::lock_guard<std::mutex> const entries_lock(_entries_mutex);
+
+            auto const iter = _entries.find(key);
+
+            if (iter != _entries.end()) {
+
+                std::shared_ptr<Glyph_run const> geometry = iter->second.lock();
+
+                // Geometry of an evicted page is replaced below, texts still using it keep it.
+                if (geometry != nullptr && !geometry->is_stale()) {
+
+                    ++_num_hits;
+                    return geometry;
+                }
+            }
+        }
+
+        // Laid out without the lock, other strings can be acquired meanwhile.
+        auto geometry = std::make_shared<Glyph_run>(font, char_size);
+
+        geometry->set_style            (style            );
+        geometry->set_fill_color       (fill_color       );
+        geometry->set_outline_thickness(outline_thickness);
+        geometry->set_outline_color    (outline_color    );
+        geometry->set_string           (string           );
+
+        // Shared between threads from here on, so it must never lay itself out again.
+        geometry->freeze();
+
+        std::lock_guard<std::mutex> const entries_lock(_entries_mutex);
+
+        ++_num_misses;
+
+        std::weak_ptr<Glyph_run const>& entry = _entries[std::move(key)];
+
+        std::shared_ptr<Glyph_run const> const existing = entry.lock();
+
+        // Another thread may have laid the same string out first, share its geometry.
+        if (existing != nullptr && !existing->is_stale()) {
+
+            return existing;
+        }
+
+        entry = geometry;
+
+        if (_entries.size() >= _prune_size) {
+
+            _prune();
+        }
+
+        return geometry;
+    }
+
+    void Text_geometry_cache::clear() {
+
+        std::lock_guard<std::mutex> const entries_lock(_entries_mutex);
+
+        _entries.clear();
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Text_geometry_cache::get_num_entries() const {
+
+        std::lock_guard<std::mutex> const entries_lock(_entries_mutex);
+
+        return _entries.size();
+    }
+
+    std::size_t Text_geometry_cache::get_num_hits() const {
+
+        std::lock_guard<std::mutex> const entries_lock(_entries_mutex);
+
+        return _num_hits;
+    }
+
+    std::size_t Text_geometry_cache::get_num_misses() const {
+
+        std::lock_guard<std::mutex> const entries_lock(_entries_mutex);
+
+        return _num_misses;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Text_geometry_cache::Geometry_key_hash::operator()(
+        Geometry_key const& key
+        ) const {
+
+        std::size_t hash = std::hash<std::u32string_view>{}(key.string);
+
+        auto const combine = [&hash](std::size_t const value) {
+
+            hash ^= value + 0x9e3779b97f4a7c15u + (hash << 6u) + (hash >> 2u);
+        };
+
+        combine(std::hash<sf::Font const*>{}(key.font                     ));
+        combine(std::hash<unsigned int   >{}(key.char_size                ));
+        combine(std::hash<std::uint32_t  >{}(key.style                    ));
+        combine(std::hash<std::uint32_t  >{}(key.fill_color.toInteger()   ));
+        combine(std::hash<float          >{}(key.outline_thickness        ));
+        combine(std::hash<std::uint32_t  >{}(key.outline_color.toInteger()));
+
+        return hash;
+    }
+
+    void Text_geometry_cache::_prune() {
+
+        std::erase_if(_entries, [](auto const& entry) {
+
+            return entry.second.expired();
+        });
+
+        // Doubling keeps pruning O(1) per acquire however many entries stay alive.
+        _prune_size = std::max<std::size_t>(64u, _entries.size() * 2u);
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,485 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/text_wrap.h"
+#include "widgets/glyph_cache.h"
+#include "widgets/unicode_table.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Anonymous namespace BEGIN
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief A line may break before the character, replacing the space before it
+    std::uint8_t constexpr BREAK_AT_SPACE = 1u << 0u;
+
+    /// @brief A line may break before the character, a newline is inserted
+    std::uint8_t constexpr BREAK_BEFORE = 1u << 1u;
+
+    /// @brief The character starts a grapheme cluster, an emergency break
+    std::uint8_t constexpr CLUSTER_START = 1u << 2u;
+
+    /// @brief Ranges of ideographs, kana, Hangul and other scripts that break between characters
+    std::array<std::pair<char32_t, char32_t>, 11u> constexpr IDEOGRAPHIC_RANGES = {{
+        {0x2E80u,  0x2FFFu }, // CJK and Kangxi radicals
+        {0x3040u,  0x30FFu }, // Hiragana and katakana
+        {0x3100u,  0x312Fu }, // Bopomofo
+        {0x3130u,  0x318Fu }, // Hangul compatibility jamo
+        {0x3400u,  0x4DBFu }, // CJK extension A
+        {0x4E00u,  0x9FFFu }, // CJK unified ideographs
+        {0xA000u,  0xA4CFu }, // Yi
+        {0xAC00u,  0xD7AFu }, // Hangul syllables
+        {0xF900u,  0xFAFFu }, // CJK compatibility ideographs
+        {0xFF66u,  0xFF9Fu }, // Halfwidth katakana
+        {0x20000u, 0x3FFFDu}  // CJK extensions B and up
+    }};
+
+    /// @brief Punctuation a line must not start with
+    std::u32string_view constexpr CLOSING_PUNCTUATION =
+        U"!),.:;?]}"
+        U"\u3001\u3002\u3005\u3009\u300B\u300D\u300F\u3011\u3015\u3017\u3019\u301B\u301E\u301F"
+        U"\u30FB\u30FC\uFF01\uFF09\uFF0C\uFF0E\uFF1A\uFF1B\uFF1F\uFF3D\uFF5D";
+
+    /// @brief Punctuation a line must not end with
+    std::u32string_view constexpr OPENING_PUNCTUATION =
+        U"([{"
+        U"\u3008\u300A\u300C\u300E\u3010\u3014\u3016\u3018\u301A\u301D\uFF08\uFF3B\uFF5B";
+
+    /// @brief Whether a character is laid out as blank space or a newline
+    bool is_whitespace(
+        char32_t const code_point
+        ) {
+
+        return code_point == U' ' || code_point == U'\t' || code_point == U'\n' || code_point == U'\r';
+    }
+
+    /// @brief Whether a character is a space a line may break after
+    bool is_space(
+        char32_t const code_point
+        ) {
+
+        return code_point == U' ' || code_point == U'\t';
+    }
+
+    /// @brief Whether a character is a hyphen a line may break after
+    bool is_hyphen(
+        char32_t const code_point
+        ) {
+
+        return code_point == U'-' || code_point == U'\u2010';
+    }
+
+    /// @brief Whether a line may break on either side of a character
+    bool is_ideographic(
+        char32_t const code_point
+        ) {
+
+        // Scripts below the first range break at spaces only.
+        if (code_point < IDEOGRAPHIC_RANGES.front().first) {
+
+            return false;
+        }
+
+        return std::any_of(IDEOGRAPHIC_RANGES.begin(), IDEOGRAPHIC_RANGES.end(), [code_point](auto const& range) {
+
+            return code_point >= range.first && code_point <= range.second;
+        });
+    }
+
+    /// @brief Advance of a character the way Glyph_run lays it out
+    float get_advance(
+        widgets::Glyph_cache& cache,
+        char32_t     const  code_point,
+        unsigned int const  char_size,
+        bool         const  is_bold,
+        float        const  whitespace_width
+        ) {
+
+        switch (code_point) {
+
+            case U'\n': return 0.0f;
+            case U'\t': return whitespace_width * 4.0f;
+            case U' ' :
+            case U'\r': return whitespace_width;
+            default   : return cache.get_glyph(code_point, char_size, is_bold).advance;
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Anonymous namespace END
+------------------------------------------------------------------------------
+*/
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Text_wrap::Text_wrap() :
+        _string        (/*-----*/),
+        _advances      (/*-----*/),
+        _kernings      (/*-----*/),
+        _breaks        (/*-----*/),
+        _ellipsis      (/*-----*/),
+        _ellipsis_width(0.0f     ),
+        _font          (nullptr  ),
+        _char_size     (0u       ),
+        _is_bold       (false    ),
+        _num_measured  (0u       )
+    {}
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Text_wrap::analyze(
+        std::u32string_view const string,
+        sf::Font            const& font,
+        unsigned int        const char_size,
+        std::uint32_t       const style
+        ) {
+
+        bool const is_bold      = (style & sf::Text::Style::Bold) != 0u;
+        bool const is_same_font = &font == _font && char_size == _char_size && is_bold == _is_bold;
+
+        if (is_same_font && string == _string) {
+
+            return;
+        }
+
+        // With the same font, the common prefix and suffix keep their measurements.
+        std::size_t prefix = 0u;
+        std::size_t suffix = 0u;
+
+        if (is_same_font) {
+
+            std::size_t const max_common = std::min(string.size(), _string.size());
+
+            while (prefix < max_common && string[prefix] == _string[prefix]) {
+
+                ++prefix;
+            }
+
+            while (suffix < max_common - prefix && string[string.size() - 1u - suffix] == _string[_string.size() - 1u - suffix]) {
+
+                ++suffix;
+            }
+        }
+
+        std::size_t const old_middle_end = _string.size() - suffix;
+        std::size_t const new_middle_end = string.size()  - suffix;
+
+        _advances.erase (_advances.begin() + prefix, _advances.begin() + old_middle_end);
+        _advances.insert(_advances.begin() + prefix, new_middle_end - prefix, 0.0f);
+        _kernings.erase (_kernings.begin() + prefix, _kernings.begin() + old_middle_end);
+        _kernings.insert(_kernings.begin() + prefix, new_middle_end - prefix, 0.0f);
+
+        _string.assign(string);
+
+        Glyph_cache& cache            = Glyph_cache::get(font);
+        float  const whitespace_width = cache.get_glyph(U' ', char_size, is_bold).advance;
+
+        if (!is_same_font) {
+
+            _font      = &font;
+            _char_size = char_size;
+            _is_bold   = is_bold;
+            _ellipsis  = cache.has_glyph(U'\u2026') ? U"\u2026" : U"...";
+
+            _ellipsis_width = 0.0f;
+
+            for (std::size_t i = 0u; i < _ellipsis.size(); ++i) {
+
+                if (i > 0u) {
+
+                    _ellipsis_width += cache.get_kerning(_ellipsis[i - 1u], _ellipsis[i], char_size, is_bold);
+                }
+
+                _ellipsis_width += get_advance(cache, _ellipsis[i], char_size, is_bold, whitespace_width);
+            }
+        }
+
+        // The character after the changed ones is measured too, its kerning pair changed.
+        std::size_t const measure_end = std::min(new_middle_end + 1u, _string.size());
+
+        for (std::size_t i = prefix; i < measure_end; ++i) {
+
+            char32_t const code_point = _string[i];
+
+            _kernings[i] = i == 0u ? 0.0f : cache.get_kerning(_string[i - 1u], code_point, char_size, is_bold);
+            _advances[i] = get_advance(cache, code_point, char_size, is_bold, whitespace_width);
+        }
+
+        _num_measured += measure_end - std::min(prefix, measure_end);
+
+        // Breaks are table lookups, cheap enough to find again for the whole string.
+        _find_breaks();
+    }
+
+    void Text_wrap::wrap(
+        float          const  max_width,
+        std::u32string&       result
+        ) const {
+
+        result.clear();
+        result.reserve(_string.size() + _string.size() / 8u + 1u);
+
+        std::size_t const size = _string.size();
+
+        std::size_t line_start        = 0u;
+        std::size_t num_copied        = 0u;
+        std::size_t word_break        = 0u;
+        std::size_t cluster_break     = 0u;
+        float       pen               = 0.0f;
+        float       word_break_pen    = 0.0f;
+        float       cluster_break_pen = 0.0f;
+
+        // Greedy fill, each line takes as much as fits and breaks at the last opportunity.
+        for (std::size_t i = 0u; i < size; ++i) {
+
+            char32_t const code_point = _string[i];
+
+            if (code_point == U'\n') {
+
+                line_start = i + 1u;
+                pen        = 0.0f;
+                continue;
+            }
+
+            if (i > line_start) {
+
+                if ((_breaks[i] & (BREAK_AT_SPACE | BREAK_BEFORE)) != 0u) {
+
+                    word_break     = i;
+                    word_break_pen = pen;
+                }
+
+                if ((_breaks[i] & CLUSTER_START) != 0u) {
+
+                    cluster_break     = i;
+                    cluster_break_pen = pen;
+                }
+
+                pen += _kernings[i];
+            }
+
+            pen += _advances[i];
+
+            // Spaces hang past the width, only a visible character can overflow.
+            while (pen > max_width && !is_whitespace(code_point)) {
+
+                std::size_t break_at  = 0u;
+                float       break_pen = 0.0f;
+
+                if (word_break > line_start) {
+
+                    break_at  = word_break;
+                    break_pen = word_break_pen;
+                } else if (cluster_break > line_start) {
+
+                    break_at  = cluster_break;
+                    break_pen = cluster_break_pen;
+                } else {
+
+                    // Dont break since a single cluster wider than the width keeps its line.
+                    break;
+                }
+
+                result.append(_string, num_copied, break_at - num_copied);
+
+                if ((_breaks[break_at] & BREAK_AT_SPACE) != 0u) {
+
+                    result.back() = U'\n';
+                } else {
+
+                    result.push_back(U'\n');
+                }
+
+                num_copied = break_at;
+                line_start = break_at;
+
+                // The new line starts without the kerning of its first character.
+                float const offset = break_pen + _kernings[break_at];
+
+                pen               -= offset;
+                word_break_pen    -= offset;
+                cluster_break_pen -= offset;
+            }
+        }
+
+        result.append(_string, num_copied);
+    }
+
+    void Text_wrap::elide(
+        float          const  max_width,
+        std::u32string&       result
+        ) const {
+
+        result.clear();
+        result.reserve(_string.size() + _ellipsis.size());
+
+        std::size_t const size = _string.size();
+        float       const room = max_width - _ellipsis_width;
+
+        std::size_t line_start = 0u;
+
+        while (true) {
+
+            std::size_t const line_end = std::min(_string.find(U'\n', line_start), size);
+
+            // Width of the line up to its last visible character.
+            float pen   = 0.0f;
+            float width = 0.0f;
+
+            for (std::size_t i = line_start; i < line_end; ++i) {
+
+                pen += (i > line_start ? _kernings[i] : 0.0f) + _advances[i];
+
+                if (!is_whitespace(_string[i])) {
+
+                    width = pen;
+                }
+            }
+
+            if (width <= max_width) {
+
+                result.append(_string, line_start, line_end - line_start);
+            } else {
+
+                // Keep the most whole clusters that leave room for the ellipsis.
+                std::size_t keep    = line_start;
+                float       visible = 0.0f;
+
+                pen = 0.0f;
+
+                for (std::size_t i = line_start; i < line_end; ++i) {
+
+                    if (i > line_start) {
+
+                        if ((_breaks[i] & CLUSTER_START) != 0u) {
+
+                            if (visible > room) {
+
+                                break;
+                            }
+
+                            keep = i;
+                        }
+
+                        pen += _kernings[i];
+                    }
+
+                    pen += _advances[i];
+
+                    if (!is_whitespace(_string[i])) {
+
+                        visible = pen;
+                    }
+                }
+
+                while (keep > line_start && is_whitespace(_string[keep - 1u])) {
+
+                    --keep;
+                }
+
+                result.append(_string, line_start, keep - line_start);
+                result += _ellipsis;
+            }
+
+            if (line_end == size) {
+
+                break;
+            }
+
+            result.push_back(U'\n');
+            line_start = line_end + 1u;
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::u32string const& Text_wrap::get_string() const {
+
+        return _string;
+    }
+
+    std::size_t Text_wrap::get_num_measured() const {
+
+        return _num_measured;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    void Text_wrap::_find_breaks() {
+
+        std::size_t const size = _string.size();
+
+        _breaks.assign(size, 0u);
+
+        for (std::size_t i = 0u; i < size; i = resources::UNICODE_TABLE.find_next_grapheme(_string, i)) {
+
+            _breaks[i] |= CLUSTER_START;
+        }
+
+        for (std::size_t i = 1u; i < size; ++i) {
+
+            char32_t const previous   = _string[i - 1u];
+            char32_t const code_point = _string[i];
+
+            if (previous == U'\n' || code_point == U'\n') {
+
+                // Dont mark a break since the newline already is one.
+            } else if (is_space(previous)) {
+
+                if (!is_whitespace(code_point)) {
+
+                    _breaks[i] |= BREAK_AT_SPACE;
+                }
+            } else if (is_whitespace(code_point) || (_breaks[i] & CLUSTER_START) == 0u) {
+
+                // Dont mark a break before a space or inside a cluster.
+            } else if (is_hyphen(previous)) {
+
+                // "well-known" breaks after the hyphen, "-5" and "--" do not.
+                bool const is_inside_word = i >= 2u && !is_whitespace(_string[i - 2u]) && !is_hyphen(_string[i - 2u]) && !is_hyphen(code_point);
+
+                if (is_inside_word) {
+
+                    _breaks[i] |= BREAK_BEFORE;
+                }
+            } else if (is_ideographic(previous) || is_ideographic(code_point)) {
+
+                bool const is_kept_together =
+                    CLOSING_PUNCTUATION.find(code_point) != std::u32string_view::npos ||
+                    OPENING_PUNCTUATION.find(previous  ) != std::u32string_view::npos;
+
+                if (!is_kept_together) {
+
+                    _breaks[i] |= BREAK_BEFORE;
+                }
+            }
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
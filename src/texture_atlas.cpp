@@ -0,0 +1,406 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/log.h"
+#include "widgets/texture_atlas.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Texture_atlas::Texture_atlas(
+        sf::Vector2u const page_size,
+        unsigned int const padding
+        ) :
+        _page_size(page_size),
+        _padding  (padding  ),
+        _is_smooth(false    ),
+        _pages    (         ),
+        _pending  (         ),
+        _regions  (         )
+    {
+
+        unsigned int const max_size = sf::Texture::getMaximumSize();
+
+        if (_page_size.x > max_size || _page_size.y > max_size) {
+
+            LOG(WARNING)                        <<
+            "Atlas page size ["                 <<
+            _page_size.x                        <<
+            "x"                                 <<
+            _page_size.y                        <<
+            "] is larger than the GPU allows, " <<
+            "clamping to ["                     <<
+            max_size                            <<
+            "].";
+
+            _page_size.x = std::min(_page_size.x, max_size);
+            _page_size.y = std::min(_page_size.y, max_size);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    bool Texture_atlas::add(
+        std::string const& name,
+        sf::Image   const& image
+        ) {
+
+        sf::Vector2u const size = image.getSize();
+
+        if (size.x == 0u || size.y == 0u) {
+
+            LOG(WARNING) << "Atlas image [" << name << "] is empty and is not added.";
+            return false;
+        }
+
+        if (size.x + 2u * _padding > _page_size.x || size.y + 2u * _padding > _page_size.y) {
+
+            LOG(WARNING)              <<
+            "Atlas image ["           <<
+            name                      <<
+            "] of size ["             <<
+            size.x                    <<
+            "x"                       <<
+            size.y                    <<
+            "] does not fit a page [" <<
+            _page_size.x              <<
+            "x"                       <<
+            _page_size.y              <<
+            "] and is not added.";
+
+            return false;
+        }
+
+        _pending.push_back({name, image});
+
+        return true;
+    }
+
+    bool Texture_atlas::add_from_file(
+        std::string           const& name,
+        std::filesystem::path const& path
+        ) {
+
+        sf::Image image;
+
+        if (!image.loadFromFile(path)) {
+
+            LOG(WARNING) << "Could not load atlas image [" << path.string() << "].";
+            return false;
+        }
+
+        return add(name, image);
+    }
+
+    bool Texture_atlas::build() {
+
+        // Placing tall images first leaves a flatter skyline, which packs tighter.
+        std::stable_sort(_pending.begin(), _pending.end(), [](Pending_image const& a, Pending_image const& b) {
+
+            return a.image.getSize().y > b.image.getSize().y;
+        });
+
+        bool is_all_packed = true;
+
+        for (Pending_image const& pending : _pending) {
+
+            sf::Vector2u const size        = pending.image.getSize();
+            sf::Vector2u const padded_size = {size.x + 2u * _padding, size.y + 2u * _padding};
+
+            Page*        page = nullptr;
+            std::size_t  node = 0u;
+            unsigned int y    = 0u;
+
+            for (Page& candidate : _pages) {
+
+                if (_find_position(candidate, padded_size, node, y)) {
+
+                    page = &candidate;
+                    break;
+                }
+            }
+
+            if (page == nullptr) {
+
+                if (_add_page() && _find_position(_pages.back(), padded_size, node, y)) {
+
+                    page = &_pages.back();
+                } else {
+
+                    LOG(ERROR) << "Could not pack atlas image [" << pending.name << "].";
+
+                    is_all_packed = false;
+                    continue;
+                }
+            }
+
+            sf::Vector2u const pos = {page->skyline[node].x, y};
+
+            _place(*page, node, pos, padded_size);
+            page->texture->update(_extrude(pending.image), pos);
+
+            Atlas_region region{};
+            region.texture = page->texture.get();
+            region.rect    = {
+                {static_cast<int>(pos.x + _padding), static_cast<int>(pos.y + _padding)},
+                {static_cast<int>(size.x),           static_cast<int>(size.y)          }
+                };
+
+            // Replaced names keep their old pixels packed, only the lookup changes.
+            _regions[pending.name] = region;
+        }
+
+        _pending.clear();
+
+        return is_all_packed;
+    }
+/*
+------------------------------------------------------------------------------
+Set Functions
+------------------------------------------------------------------------------
+*/
+    void Texture_atlas::set_smooth(
+        bool const is_smooth
+        ) {
+
+        _is_smooth = is_smooth;
+
+        for (Page& page : _pages) {
+
+            page.texture->setSmooth(_is_smooth);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    Atlas_region Texture_atlas::get_region(
+        std::string const& name
+        ) const {
+
+        auto const found = _regions.find(name);
+
+        if (found == _regions.end()) {
+
+            LOG(WARNING)           <<
+            "Atlas region ["       <<
+            name                   <<
+            "] does not exist, "   <<
+            "was build() called?";
+
+            return {};
+        }
+
+        return found->second;
+    }
+
+    bool Texture_atlas::has_region(
+        std::string const& name
+        ) const {
+
+        return _regions.contains(name);
+    }
+
+    std::size_t Texture_atlas::get_num_pages() const {
+
+        return _pages.size();
+    }
+
+    sf::Texture const* Texture_atlas::get_page_texture(
+        std::size_t const index
+        ) const {
+
+        if (index >= _pages.size()) {
+
+            LOG(WARNING) << "Atlas page [" << index << "] does not exist.";
+            return nullptr;
+        }
+
+        return _pages[index].texture.get();
+    }
+
+    sf::Vector2u Texture_atlas::get_page_size() const {
+
+        return _page_size;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    bool Texture_atlas::_add_page() {
+
+        Page page{};
+        page.texture = std::make_unique<sf::Texture>();
+
+        if (!page.texture->resize(_page_size)) {
+
+            LOG(ERROR)                              <<
+            "Could not create atlas page of size [" <<
+            _page_size.x                            <<
+            "x"                                     <<
+            _page_size.y                            <<
+            "].";
+
+            return false;
+        }
+
+        page.texture->setSmooth(_is_smooth);
+        page.skyline.push_back({0u, 0u, _page_size.x});
+
+        _pages.push_back(std::move(page));
+
+        return true;
+    }
+
+    bool Texture_atlas::_find_position(
+        Page         const& page,
+        sf::Vector2u const  size,
+        std::size_t&        out_node,
+        unsigned int&       out_y
+        ) const {
+
+        unsigned int best_y     = std::numeric_limits<unsigned int>::max();
+        unsigned int best_width = std::numeric_limits<unsigned int>::max();
+        bool         is_found   = false;
+
+        for (std::size_t i = 0u; i < page.skyline.size(); ++i) {
+
+            unsigned int const x = page.skyline[i].x;
+
+            if (x + size.x > _page_size.x) {
+
+                break;
+            }
+
+            // The rectangle rests on the highest node it spans.
+            unsigned int y          = 0u;
+            unsigned int width_left = size.x;
+
+            for (std::size_t j = i; width_left > 0u; ++j) {
+
+                y          = std::max(y, page.skyline[j].y);
+                width_left = width_left > page.skyline[j].width ? width_left - page.skyline[j].width : 0u;
+            }
+
+            if (y + size.y > _page_size.y) {
+
+                continue;
+            }
+
+            // Lowest position wins, ties go to the snuggest node.
+            if (y < best_y || (y == best_y && page.skyline[i].width < best_width)) {
+
+                best_y     = y;
+                best_width = page.skyline[i].width;
+                out_node   = i;
+                is_found   = true;
+            }
+        }
+
+        out_y = best_y;
+
+        return is_found;
+    }
+
+    void Texture_atlas::_place(
+        Page&              page,
+        std::size_t  const node,
+        sf::Vector2u const pos,
+        sf::Vector2u const size
+        ) {
+
+        std::vector<Skyline_node>& skyline = page.skyline;
+
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(node), {pos.x, pos.y + size.y, size.x});
+
+        // Trim or drop the nodes now covered by the new one.
+        for (std::size_t i = node + 1u; i < skyline.size();) {
+
+            unsigned int const covered_end = skyline[i - 1u].x + skyline[i - 1u].width;
+
+            if (skyline[i].x >= covered_end) {
+
+                break;
+            }
+
+            unsigned int const shrink = covered_end - skyline[i].x;
+
+            if (skyline[i].width <= shrink) {
+
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            } else {
+
+                skyline[i].x     += shrink;
+                skyline[i].width -= shrink;
+                break;
+            }
+        }
+
+        // Merge neighbours at the same height.
+        for (std::size_t i = 0u; i + 1u < skyline.size();) {
+
+            if (skyline[i].y == skyline[i + 1u].y) {
+
+                skyline[i].width += skyline[i + 1u].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1u));
+            } else {
+
+                ++i;
+            }
+        }
+    }
+
+    sf::Image Texture_atlas::_extrude(
+        sf::Image const& image
+        ) const {
+
+        sf::Vector2u const size        = image.getSize();
+        sf::Vector2u const padded_size = {size.x + 2u * _padding, size.y + 2u * _padding};
+
+        std::uint8_t const*       src = image.getPixelsPtr();
+        std::vector<std::uint8_t> dst(static_cast<std::size_t>(padded_size.x) * padded_size.y * 4u);
+
+        for (unsigned int y = 0u; y < padded_size.y; ++y) {
+
+            // Padding repeats the nearest edge pixel.
+            unsigned int const src_y = std::min(y > _padding ? y - _padding : 0u, size.y - 1u);
+
+            for (unsigned int x = 0u; x < padded_size.x; ++x) {
+
+                unsigned int const src_x = std::min(x > _padding ? x - _padding : 0u, size.x - 1u);
+
+                std::size_t const src_offset = (static_cast<std::size_t>(src_y) * size.x        + src_x) * 4u;
+                std::size_t const dst_offset = (static_cast<std::size_t>(y)     * padded_size.x + x    ) * 4u;
+
+                std::copy_n(src + src_offset, 4u, dst.data() + dst_offset);
+            }
+        }
+
+        sf::Image padded;
+        padded.resize(padded_size, dst.data());
+
+        return padded;
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
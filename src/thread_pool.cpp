@@ -0,0 +1,259 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/log.h"
+#include "widgets/thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+/*
+------------------------------------------------------------------------------
+Worker identification
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Pool the current thread works for, nullptr on non worker threads
+    thread_local widgets::Thread_pool const* t_worker_pool  = nullptr;
+
+    /// @brief Deque index of the current worker thread
+    thread_local std::size_t                 t_worker_index = 0u;
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Thread_pool::Thread_pool(
+        std::size_t const num_threads
+        ) :
+        _deques        (     ),
+        _threads       (     ),
+        _sleep_mutex   (     ),
+        _wake_condition(     ),
+        _num_queued    (0u   ),
+        _next_deque    (0u   ),
+        _is_stopping   (false)
+    {
+
+        std::size_t num_workers = num_threads;
+
+        if (num_workers == 0u) {
+
+            unsigned int const hardware_threads = std::thread::hardware_concurrency();
+            num_workers = hardware_threads > 1u ? hardware_threads - 1u : 0u;
+        }
+
+        // The calling thread always gets a deque too, for parallel_for().
+        for (std::size_t i = 0u; i <= num_workers; ++i) {
+
+            _deques.push_back(std::make_unique<Task_deque>());
+        }
+
+        for (std::size_t i = 0u; i < num_workers; ++i) {
+
+            _threads.emplace_back(&Thread_pool::_worker_loop, this, i);
+        }
+
+        LOG(TRACE) << "Thread pool started with [" << num_workers << "] workers.";
+    }
+
+    Thread_pool::~Thread_pool() {
+
+        {
+            std::lock_guard<std::mutex> const lock(_sleep_mutex);
+
+            _is_stopping = true;
+        }
+
+        _wake_condition.notify_all();
+
+        for (std::thread& thread : _threads) {
+
+            thread.join();
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    void Thread_pool::submit(
+        std::function<void()> task
+        ) {
+
+        std::size_t deque_index = 0u;
+
+        if (t_worker_pool == this) {
+
+            deque_index = t_worker_index;
+        } else {
+
+            deque_index = _next_deque.fetch_add(1u, std::memory_order_relaxed) % _deques.size();
+        }
+
+        {
+            std::lock_guard<std::mutex> const lock(_deques[deque_index]->mutex);
+
+            _deques[deque_index]->tasks.push_back(std::move(task));
+        }
+
+        _num_queued.fetch_add(1u, std::memory_order_release);
+
+        // Taking the sleep mutex orders this wake up after a worker's last check.
+        {
+            std::lock_guard<std::mutex> const lock(_sleep_mutex);
+        }
+
+        _wake_condition.notify_one();
+    }
+
+    void Thread_pool::parallel_for(
+        std::size_t                                   const  count,
+        std::size_t                                   const  grain_size,
+        std::function<void(std::size_t, std::size_t)> const& body
+        ) {
+
+        if (count == 0u) {
+
+            return;
+        }
+
+        std::size_t grain = grain_size;
+
+        if (grain == 0u) {
+
+            // A few chunks per thread lets fast threads steal from slow ones.
+            std::size_t const num_chunks = _deques.size() * 4u;
+            grain = std::max<std::size_t>(1u, (count + num_chunks - 1u) / num_chunks);
+        }
+
+        std::size_t const        num_chunks = (count + grain - 1u) / grain;
+        std::atomic<std::size_t> num_remaining(num_chunks);
+
+        if (_threads.empty() || num_chunks == 1u) {
+
+            body(0u, count);
+            return;
+        }
+
+        for (std::size_t chunk = 0u; chunk < num_chunks; ++chunk) {
+
+            std::size_t const begin = chunk * grain;
+            std::size_t const end   = std::min(begin + grain, count);
+
+            submit([&body, &num_remaining, begin, end]() {
+
+                body(begin, end);
+                num_remaining.fetch_sub(1u, std::memory_order_acq_rel);
+            });
+        }
+
+        // Help instead of blocking, the last deque belongs to non worker threads.
+        std::size_t const home_deque = t_worker_pool == this ? t_worker_index : _deques.size() - 1u;
+
+        while (num_remaining.load(std::memory_order_acquire) > 0u) {
+
+            if (!_try_run_one(home_deque)) {
+
+                std::this_thread::yield();
+            }
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    std::size_t Thread_pool::get_num_threads() const {
+
+        return _threads.size();
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    bool Thread_pool::_try_run_one(
+        std::size_t const home_deque
+        ) {
+
+        std::function<void()> task;
+
+        // Newest task of our own deque first.
+        {
+            Task_deque& own = *_deques[home_deque];
+            std::lock_guard<std::mutex> const lock(own.mutex);
+
+            if (!own.tasks.empty()) {
+
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+            }
+        }
+
+        // Otherwise steal the oldest task of another deque.
+        for (std::size_t offset = 1u; !task && offset < _deques.size(); ++offset) {
+
+            Task_deque& victim = *_deques[(home_deque + offset) % _deques.size()];
+            std::lock_guard<std::mutex> const lock(victim.mutex);
+
+            if (!victim.tasks.empty()) {
+
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+            }
+        }
+
+        if (!task) {
+
+            return false;
+        }
+
+        _num_queued.fetch_sub(1u, std::memory_order_acq_rel);
+        task();
+
+        return true;
+    }
+
+    void Thread_pool::_worker_loop(
+        std::size_t const index
+        ) {
+
+        t_worker_pool  = this;
+        t_worker_index = index;
+
+        while (true) {
+
+            if (_try_run_one(index)) {
+
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+
+            _wake_condition.wait(lock, [this]() {
+
+                return _is_stopping || _num_queued.load(std::memory_order_acquire) > 0u;
+            });
+
+            if (_is_stopping && _num_queued.load(std::memory_order_acquire) == 0u) {
+
+                return;
+            }
+        }
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -0,0 +1,763 @@
+/*
+------------------------------------------------------------------------------
+Includes
+------------------------------------------------------------------------------
+*/
+#include "widgets/unicode_table.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <unordered_map>
+/*
+------------------------------------------------------------------------------
+Anonymous namespace BEGIN
+------------------------------------------------------------------------------
+*/
+namespace {
+
+    /// @brief Code points from `first` up to the next run's share one properties byte
+    struct Property_run {
+
+        char32_t     first;
+        std::uint8_t properties;
+    };
+
+    /// @brief Every run of code points sharing properties, from U+0000 to U+10FFFF
+    ///
+    /// @details Derived from UnicodeData.txt, GraphemeBreakProperty.txt and the
+    ///          Extended_Pictographic property of emoji-data.txt, Unicode 14.0. The
+    ///          high nibble is the Unicode_table::Kind and the low nibble the
+    ///          Unicode_table::Grapheme_break, 0x34 is a combining mark that extends
+    ///          a cluster and 0x40 a plain printable character.
+    std::array<Property_run, 2955> constexpr PROPERTY_RUNS = {{
+        {0x00000u, 0x13u}, {0x0000Au, 0x12u}, {0x0000Bu, 0x13u}, {0x0000Du, 0x11u}, {0x0000Eu, 0x13u}, {0x00020u, 0x40u},
+        {0x0007Fu, 0x13u}, {0x000A0u, 0x40u}, {0x000A9u, 0x4Eu}, {0x000AAu, 0x40u}, {0x000ADu, 0x23u}, {0x000AEu, 0x4Eu},
+        {0x000AFu, 0x40u}, {0x00300u, 0x34u}, {0x00370u, 0x40u}, {0x00378u, 0x00u}, {0x0037Au, 0x40u}, {0x00380u, 0x00u},
+        {0x00384u, 0x40u}, {0x0038Bu, 0x00u}, {0x0038Cu, 0x40u}, {0x0038Du, 0x00u}, {0x0038Eu, 0x40u}, {0x003A2u, 0x00u},
+        {0x003A3u, 0x40u}, {0x00483u, 0x34u}, {0x0048Au, 0x40u}, {0x00530u, 0x00u}, {0x00531u, 0x40u}, {0x00557u, 0x00u},
+        {0x00559u, 0x40u}, {0x0058Bu, 0x00u}, {0x0058Du, 0x40u}, {0x00590u, 0x00u}, {0x00591u, 0x34u}, {0x005BEu, 0x40u},
+        {0x005BFu, 0x34u}, {0x005C0u, 0x40u}, {0x005C1u, 0x34u}, {0x005C3u, 0x40u}, {0x005C4u, 0x34u}, {0x005C6u, 0x40u},
+        {0x005C7u, 0x34u}, {0x005C8u, 0x00u}, {0x005D0u, 0x40u}, {0x005EBu, 0x00u}, {0x005EFu, 0x40u}, {0x005F5u, 0x00u},
+        {0x00600u, 0x27u}, {0x00606u, 0x40u}, {0x00610u, 0x34u}, {0x0061Bu, 0x40u}, {0x0061Cu, 0x23u}, {0x0061Du, 0x40u},
+        {0x0064Bu, 0x34u}, {0x00660u, 0x40u}, {0x00670u, 0x34u}, {0x00671u, 0x40u}, {0x006D6u, 0x34u}, {0x006DDu, 0x27u},
+        {0x006DEu, 0x40u}, {0x006DFu, 0x34u}, {0x006E5u, 0x40u}, {0x006E7u, 0x34u}, {0x006E9u, 0x40u}, {0x006EAu, 0x34u},
+        {0x006EEu, 0x40u}, {0x0070Eu, 0x00u}, {0x0070Fu, 0x27u}, {0x00710u, 0x40u}, {0x00711u, 0x34u}, {0x00712u, 0x40u},
+        {0x00730u, 0x34u}, {0x0074Bu, 0x00u}, {0x0074Du, 0x40u}, {0x007A6u, 0x34u}, {0x007B1u, 0x40u}, {0x007B2u, 0x00u},
+        {0x007C0u, 0x40u}, {0x007EBu, 0x34u}, {0x007F4u, 0x40u}, {0x007FBu, 0x00u}, {0x007FDu, 0x34u}, {0x007FEu, 0x40u},
+        {0x00816u, 0x34u}, {0x0081Au, 0x40u}, {0x0081Bu, 0x34u}, {0x00824u, 0x40u}, {0x00825u, 0x34u}, {0x00828u, 0x40u},
+        {0x00829u, 0x34u}, {0x0082Eu, 0x00u}, {0x00830u, 0x40u}, {0x0083Fu, 0x00u}, {0x00840u, 0x40u}, {0x00859u, 0x34u},
+        {0x0085Cu, 0x00u}, {0x0085Eu, 0x40u}, {0x0085Fu, 0x00u}, {0x00860u, 0x40u}, {0x0086Bu, 0x00u}, {0x00870u, 0x40u},
+        {0x0088Fu, 0x00u}, {0x00890u, 0x27u}, {0x00892u, 0x00u}, {0x00898u, 0x34u}, {0x008A0u, 0x40u}, {0x008CAu, 0x34u},
+        {0x008E2u, 0x27u}, {0x008E3u, 0x34u}, {0x00903u, 0x38u}, {0x00904u, 0x40u}, {0x0093Au, 0x34u}, {0x0093Bu, 0x38u},
+        {0x0093Cu, 0x34u}, {0x0093Du, 0x40u}, {0x0093Eu, 0x38u}, {0x00941u, 0x34u}, {0x00949u, 0x38u}, {0x0094Du, 0x34u},
+        {0x0094Eu, 0x38u}, {0x00950u, 0x40u}, {0x00951u, 0x34u}, {0x00958u, 0x40u}, {0x00962u, 0x34u}, {0x00964u, 0x40u},
+        {0x00981u, 0x34u}, {0x00982u, 0x38u}, {0x00984u, 0x00u}, {0x00985u, 0x40u}, {0x0098Du, 0x00u}, {0x0098Fu, 0x40u},
+        {0x00991u, 0x00u}, {0x00993u, 0x40u}, {0x009A9u, 0x00u}, {0x009AAu, 0x40u}, {0x009B1u, 0x00u}, {0x009B2u, 0x40u},
+        {0x009B3u, 0x00u}, {0x009B6u, 0x40u}, {0x009BAu, 0x00u}, {0x009BCu, 0x34u}, {0x009BDu, 0x40u}, {0x009BEu, 0x34u},
+        {0x009BFu, 0x38u}, {0x009C1u, 0x34u}, {0x009C5u, 0x00u}, {0x009C7u, 0x38u}, {0x009C9u, 0x00u}, {0x009CBu, 0x38u},
+        {0x009CDu, 0x34u}, {0x009CEu, 0x40u}, {0x009CFu, 0x00u}, {0x009D7u, 0x34u}, {0x009D8u, 0x00u}, {0x009DCu, 0x40u},
+        {0x009DEu, 0x00u}, {0x009DFu, 0x40u}, {0x009E2u, 0x34u}, {0x009E4u, 0x00u}, {0x009E6u, 0x40u}, {0x009FEu, 0x34u},
+        {0x009FFu, 0x00u}, {0x00A01u, 0x34u}, {0x00A03u, 0x38u}, {0x00A04u, 0x00u}, {0x00A05u, 0x40u}, {0x00A0Bu, 0x00u},
+        {0x00A0Fu, 0x40u}, {0x00A11u, 0x00u}, {0x00A13u, 0x40u}, {0x00A29u, 0x00u}, {0x00A2Au, 0x40u}, {0x00A31u, 0x00u},
+        {0x00A32u, 0x40u}, {0x00A34u, 0x00u}, {0x00A35u, 0x40u}, {0x00A37u, 0x00u}, {0x00A38u, 0x40u}, {0x00A3Au, 0x00u},
+        {0x00A3Cu, 0x34u}, {0x00A3Du, 0x00u}, {0x00A3Eu, 0x38u}, {0x00A41u, 0x34u}, {0x00A43u, 0x00u}, {0x00A47u, 0x34u},
+        {0x00A49u, 0x00u}, {0x00A4Bu, 0x34u}, {0x00A4Eu, 0x00u}, {0x00A51u, 0x34u}, {0x00A52u, 0x00u}, {0x00A59u, 0x40u},
+        {0x00A5Du, 0x00u}, {0x00A5Eu, 0x40u}, {0x00A5Fu, 0x00u}, {0x00A66u, 0x40u}, {0x00A70u, 0x34u}, {0x00A72u, 0x40u},
+        {0x00A75u, 0x34u}, {0x00A76u, 0x40u}, {0x00A77u, 0x00u}, {0x00A81u, 0x34u}, {0x00A83u, 0x38u}, {0x00A84u, 0x00u},
+        {0x00A85u, 0x40u}, {0x00A8Eu, 0x00u}, {0x00A8Fu, 0x40u}, {0x00A92u, 0x00u}, {0x00A93u, 0x40u}, {0x00AA9u, 0x00u},
+        {0x00AAAu, 0x40u}, {0x00AB1u, 0x00u}, {0x00AB2u, 0x40u}, {0x00AB4u, 0x00u}, {0x00AB5u, 0x40u}, {0x00ABAu, 0x00u},
+        {0x00ABCu, 0x34u}, {0x00ABDu, 0x40u}, {0x00ABEu, 0x38u}, {0x00AC1u, 0x34u}, {0x00AC6u, 0x00u}, {0x00AC7u, 0x34u},
+        {0x00AC9u, 0x38u}, {0x00ACAu, 0x00u}, {0x00ACBu, 0x38u}, {0x00ACDu, 0x34u}, {0x00ACEu, 0x00u}, {0x00AD0u, 0x40u},
+        {0x00AD1u, 0x00u}, {0x00AE0u, 0x40u}, {0x00AE2u, 0x34u}, {0x00AE4u, 0x00u}, {0x00AE6u, 0x40u}, {0x00AF2u, 0x00u},
+        {0x00AF9u, 0x40u}, {0x00AFAu, 0x34u}, {0x00B00u, 0x00u}, {0x00B01u, 0x34u}, {0x00B02u, 0x38u}, {0x00B04u, 0x00u},
+        {0x00B05u, 0x40u}, {0x00B0Du, 0x00u}, {0x00B0Fu, 0x40u}, {0x00B11u, 0x00u}, {0x00B13u, 0x40u}, {0x00B29u, 0x00u},
+        {0x00B2Au, 0x40u}, {0x00B31u, 0x00u}, {0x00B32u, 0x40u}, {0x00B34u, 0x00u}, {0x00B35u, 0x40u}, {0x00B3Au, 0x00u},
+        {0x00B3Cu, 0x34u}, {0x00B3Du, 0x40u}, {0x00B3Eu, 0x34u}, {0x00B40u, 0x38u}, {0x00B41u, 0x34u}, {0x00B45u, 0x00u},
+        {0x00B47u, 0x38u}, {0x00B49u, 0x00u}, {0x00B4Bu, 0x38u}, {0x00B4Du, 0x34u}, {0x00B4Eu, 0x00u}, {0x00B55u, 0x34u},
+        {0x00B58u, 0x00u}, {0x00B5Cu, 0x40u}, {0x00B5Eu, 0x00u}, {0x00B5Fu, 0x40u}, {0x00B62u, 0x34u}, {0x00B64u, 0x00u},
+        {0x00B66u, 0x40u}, {0x00B78u, 0x00u}, {0x00B82u, 0x34u}, {0x00B83u, 0x40u}, {0x00B84u, 0x00u}, {0x00B85u, 0x40u},
+        {0x00B8Bu, 0x00u}, {0x00B8Eu, 0x40u}, {0x00B91u, 0x00u}, {0x00B92u, 0x40u}, {0x00B96u, 0x00u}, {0x00B99u, 0x40u},
+        {0x00B9Bu, 0x00u}, {0x00B9Cu, 0x40u}, {0x00B9Du, 0x00u}, {0x00B9Eu, 0x40u}, {0x00BA0u, 0x00u}, {0x00BA3u, 0x40u},
+        {0x00BA5u, 0x00u}, {0x00BA8u, 0x40u}, {0x00BABu, 0x00u}, {0x00BAEu, 0x40u}, {0x00BBAu, 0x00u}, {0x00BBEu, 0x34u},
+        {0x00BBFu, 0x38u}, {0x00BC0u, 0x34u}, {0x00BC1u, 0x38u}, {0x00BC3u, 0x00u}, {0x00BC6u, 0x38u}, {0x00BC9u, 0x00u},
+        {0x00BCAu, 0x38u}, {0x00BCDu, 0x34u}, {0x00BCEu, 0x00u}, {0x00BD0u, 0x40u}, {0x00BD1u, 0x00u}, {0x00BD7u, 0x34u},
+        {0x00BD8u, 0x00u}, {0x00BE6u, 0x40u}, {0x00BFBu, 0x00u}, {0x00C00u, 0x34u}, {0x00C01u, 0x38u}, {0x00C04u, 0x34u},
+        {0x00C05u, 0x40u}, {0x00C0Du, 0x00u}, {0x00C0Eu, 0x40u}, {0x00C11u, 0x00u}, {0x00C12u, 0x40u}, {0x00C29u, 0x00u},
+        {0x00C2Au, 0x40u}, {0x00C3Au, 0x00u}, {0x00C3Cu, 0x34u}, {0x00C3Du, 0x40u}, {0x00C3Eu, 0x34u}, {0x00C41u, 0x38u},
+        {0x00C45u, 0x00u}, {0x00C46u, 0x34u}, {0x00C49u, 0x00u}, {0x00C4Au, 0x34u}, {0x00C4Eu, 0x00u}, {0x00C55u, 0x34u},
+        {0x00C57u, 0x00u}, {0x00C58u, 0x40u}, {0x00C5Bu, 0x00u}, {0x00C5Du, 0x40u}, {0x00C5Eu, 0x00u}, {0x00C60u, 0x40u},
+        {0x00C62u, 0x34u}, {0x00C64u, 0x00u}, {0x00C66u, 0x40u}, {0x00C70u, 0x00u}, {0x00C77u, 0x40u}, {0x00C81u, 0x34u},
+        {0x00C82u, 0x38u}, {0x00C84u, 0x40u}, {0x00C8Du, 0x00u}, {0x00C8Eu, 0x40u}, {0x00C91u, 0x00u}, {0x00C92u, 0x40u},
+        {0x00CA9u, 0x00u}, {0x00CAAu, 0x40u}, {0x00CB4u, 0x00u}, {0x00CB5u, 0x40u}, {0x00CBAu, 0x00u}, {0x00CBCu, 0x34u},
+        {0x00CBDu, 0x40u}, {0x00CBEu, 0x38u}, {0x00CBFu, 0x34u}, {0x00CC0u, 0x38u}, {0x00CC2u, 0x34u}, {0x00CC3u, 0x38u},
+        {0x00CC5u, 0x00u}, {0x00CC6u, 0x34u}, {0x00CC7u, 0x38u}, {0x00CC9u, 0x00u}, {0x00CCAu, 0x38u}, {0x00CCCu, 0x34u},
+        {0x00CCEu, 0x00u}, {0x00CD5u, 0x34u}, {0x00CD7u, 0x00u}, {0x00CDDu, 0x40u}, {0x00CDFu, 0x00u}, {0x00CE0u, 0x40u},
+        {0x00CE2u, 0x34u}, {0x00CE4u, 0x00u}, {0x00CE6u, 0x40u}, {0x00CF0u, 0x00u}, {0x00CF1u, 0x40u}, {0x00CF3u, 0x00u},
+        {0x00D00u, 0x34u}, {0x00D02u, 0x38u}, {0x00D04u, 0x40u}, {0x00D0Du, 0x00u}, {0x00D0Eu, 0x40u}, {0x00D11u, 0x00u},
+        {0x00D12u, 0x40u}, {0x00D3Bu, 0x34u}, {0x00D3Du, 0x40u}, {0x00D3Eu, 0x34u}, {0x00D3Fu, 0x38u}, {0x00D41u, 0x34u},
+        {0x00D45u, 0x00u}, {0x00D46u, 0x38u}, {0x00D49u, 0x00u}, {0x00D4Au, 0x38u}, {0x00D4Du, 0x34u}, {0x00D4Eu, 0x47u},
+        {0x00D4Fu, 0x40u}, {0x00D50u, 0x00u}, {0x00D54u, 0x40u}, {0x00D57u, 0x34u}, {0x00D58u, 0x40u}, {0x00D62u, 0x34u},
+        {0x00D64u, 0x00u}, {0x00D66u, 0x40u}, {0x00D80u, 0x00u}, {0x00D81u, 0x34u}, {0x00D82u, 0x38u}, {0x00D84u, 0x00u},
+        {0x00D85u, 0x40u}, {0x00D97u, 0x00u}, {0x00D9Au, 0x40u}, {0x00DB2u, 0x00u}, {0x00DB3u, 0x40u}, {0x00DBCu, 0x00u},
+        {0x00DBDu, 0x40u}, {0x00DBEu, 0x00u}, {0x00DC0u, 0x40u}, {0x00DC7u, 0x00u}, {0x00DCAu, 0x34u}, {0x00DCBu, 0x00u},
+        {0x00DCFu, 0x34u}, {0x00DD0u, 0x38u}, {0x00DD2u, 0x34u}, {0x00DD5u, 0x00u}, {0x00DD6u, 0x34u}, {0x00DD7u, 0x00u},
+        {0x00DD8u, 0x38u}, {0x00DDFu, 0x34u}, {0x00DE0u, 0x00u}, {0x00DE6u, 0x40u}, {0x00DF0u, 0x00u}, {0x00DF2u, 0x38u},
+        {0x00DF4u, 0x40u}, {0x00DF5u, 0x00u}, {0x00E01u, 0x40u}, {0x00E31u, 0x34u}, {0x00E32u, 0x40u}, {0x00E33u, 0x48u},
+        {0x00E34u, 0x34u}, {0x00E3Bu, 0x00u}, {0x00E3Fu, 0x40u}, {0x00E47u, 0x34u}, {0x00E4Fu, 0x40u}, {0x00E5Cu, 0x00u},
+        {0x00E81u, 0x40u}, {0x00E83u, 0x00u}, {0x00E84u, 0x40u}, {0x00E85u, 0x00u}, {0x00E86u, 0x40u}, {0x00E8Bu, 0x00u},
+        {0x00E8Cu, 0x40u}, {0x00EA4u, 0x00u}, {0x00EA5u, 0x40u}, {0x00EA6u, 0x00u}, {0x00EA7u, 0x40u}, {0x00EB1u, 0x34u},
+        {0x00EB2u, 0x40u}, {0x00EB3u, 0x48u}, {0x00EB4u, 0x34u}, {0x00EBDu, 0x40u}, {0x00EBEu, 0x00u}, {0x00EC0u, 0x40u},
+        {0x00EC5u, 0x00u}, {0x00EC6u, 0x40u}, {0x00EC7u, 0x00u}, {0x00EC8u, 0x34u}, {0x00ECEu, 0x00u}, {0x00ED0u, 0x40u},
+        {0x00EDAu, 0x00u}, {0x00EDCu, 0x40u}, {0x00EE0u, 0x00u}, {0x00F00u, 0x40u}, {0x00F18u, 0x34u}, {0x00F1Au, 0x40u},
+        {0x00F35u, 0x34u}, {0x00F36u, 0x40u}, {0x00F37u, 0x34u}, {0x00F38u, 0x40u}, {0x00F39u, 0x34u}, {0x00F3Au, 0x40u},
+        {0x00F3Eu, 0x38u}, {0x00F40u, 0x40u}, {0x00F48u, 0x00u}, {0x00F49u, 0x40u}, {0x00F6Du, 0x00u}, {0x00F71u, 0x34u},
+        {0x00F7Fu, 0x38u}, {0x00F80u, 0x34u}, {0x00F85u, 0x40u}, {0x00F86u, 0x34u}, {0x00F88u, 0x40u}, {0x00F8Du, 0x34u},
+        {0x00F98u, 0x00u}, {0x00F99u, 0x34u}, {0x00FBDu, 0x00u}, {0x00FBEu, 0x40u}, {0x00FC6u, 0x34u}, {0x00FC7u, 0x40u},
+        {0x00FCDu, 0x00u}, {0x00FCEu, 0x40u}, {0x00FDBu, 0x00u}, {0x01000u, 0x40u}, {0x0102Bu, 0x30u}, {0x0102Du, 0x34u},
+        {0x01031u, 0x38u}, {0x01032u, 0x34u}, {0x01038u, 0x30u}, {0x01039u, 0x34u}, {0x0103Bu, 0x38u}, {0x0103Du, 0x34u},
+        {0x0103Fu, 0x40u}, {0x01056u, 0x38u}, {0x01058u, 0x34u}, {0x0105Au, 0x40u}, {0x0105Eu, 0x34u}, {0x01061u, 0x40u},
+        {0x01062u, 0x30u}, {0x01065u, 0x40u}, {0x01067u, 0x30u}, {0x0106Eu, 0x40u}, {0x01071u, 0x34u}, {0x01075u, 0x40u},
+        {0x01082u, 0x34u}, {0x01083u, 0x30u}, {0x01084u, 0x38u}, {0x01085u, 0x34u}, {0x01087u, 0x30u}, {0x0108Du, 0x34u},
+        {0x0108Eu, 0x40u}, {0x0108Fu, 0x30u}, {0x01090u, 0x40u}, {0x0109Au, 0x30u}, {0x0109Du, 0x34u}, {0x0109Eu, 0x40u},
+        {0x010C6u, 0x00u}, {0x010C7u, 0x40u}, {0x010C8u, 0x00u}, {0x010CDu, 0x40u}, {0x010CEu, 0x00u}, {0x010D0u, 0x40u},
+        {0x01100u, 0x49u}, {0x01160u, 0x4Au}, {0x011A8u, 0x4Bu}, {0x01200u, 0x40u}, {0x01249u, 0x00u}, {0x0124Au, 0x40u},
+        {0x0124Eu, 0x00u}, {0x01250u, 0x40u}, {0x01257u, 0x00u}, {0x01258u, 0x40u}, {0x01259u, 0x00u}, {0x0125Au, 0x40u},
+        {0x0125Eu, 0x00u}, {0x01260u, 0x40u}, {0x01289u, 0x00u}, {0x0128Au, 0x40u}, {0x0128Eu, 0x00u}, {0x01290u, 0x40u},
+        {0x012B1u, 0x00u}, {0x012B2u, 0x40u}, {0x012B6u, 0x00u}, {0x012B8u, 0x40u}, {0x012BFu, 0x00u}, {0x012C0u, 0x40u},
+        {0x012C1u, 0x00u}, {0x012C2u, 0x40u}, {0x012C6u, 0x00u}, {0x012C8u, 0x40u}, {0x012D7u, 0x00u}, {0x012D8u, 0x40u},
+        {0x01311u, 0x00u}, {0x01312u, 0x40u}, {0x01316u, 0x00u}, {0x01318u, 0x40u}, {0x0135Bu, 0x00u}, {0x0135Du, 0x34u},
+        {0x01360u, 0x40u}, {0x0137Du, 0x00u}, {0x01380u, 0x40u}, {0x0139Au, 0x00u}, {0x013A0u, 0x40u}, {0x013F6u, 0x00u},
+        {0x013F8u, 0x40u}, {0x013FEu, 0x00u}, {0x01400u, 0x40u}, {0x0169Du, 0x00u}, {0x016A0u, 0x40u}, {0x016F9u, 0x00u},
+        {0x01700u, 0x40u}, {0x01712u, 0x34u}, {0x01715u, 0x38u}, {0x01716u, 0x00u}, {0x0171Fu, 0x40u}, {0x01732u, 0x34u},
+        {0x01734u, 0x38u}, {0x01735u, 0x40u}, {0x01737u, 0x00u}, {0x01740u, 0x40u}, {0x01752u, 0x34u}, {0x01754u, 0x00u},
+        {0x01760u, 0x40u}, {0x0176Du, 0x00u}, {0x0176Eu, 0x40u}, {0x01771u, 0x00u}, {0x01772u, 0x34u}, {0x01774u, 0x00u},
+        {0x01780u, 0x40u}, {0x017B4u, 0x34u}, {0x017B6u, 0x38u}, {0x017B7u, 0x34u}, {0x017BEu, 0x38u}, {0x017C6u, 0x34u},
+        {0x017C7u, 0x38u}, {0x017C9u, 0x34u}, {0x017D4u, 0x40u}, {0x017DDu, 0x34u}, {0x017DEu, 0x00u}, {0x017E0u, 0x40u},
+        {0x017EAu, 0x00u}, {0x017F0u, 0x40u}, {0x017FAu, 0x00u}, {0x01800u, 0x40u}, {0x0180Bu, 0x34u}, {0x0180Eu, 0x23u},
+        {0x0180Fu, 0x34u}, {0x01810u, 0x40u}, {0x0181Au, 0x00u}, {0x01820u, 0x40u}, {0x01879u, 0x00u}, {0x01880u, 0x40u},
+        {0x01885u, 0x34u}, {0x01887u, 0x40u}, {0x018A9u, 0x34u}, {0x018AAu, 0x40u}, {0x018ABu, 0x00u}, {0x018B0u, 0x40u},
+        {0x018F6u, 0x00u}, {0x01900u, 0x40u}, {0x0191Fu, 0x00u}, {0x01920u, 0x34u}, {0x01923u, 0x38u}, {0x01927u, 0x34u},
+        {0x01929u, 0x38u}, {0x0192Cu, 0x00u}, {0x01930u, 0x38u}, {0x01932u, 0x34u}, {0x01933u, 0x38u}, {0x01939u, 0x34u},
+        {0x0193Cu, 0x00u}, {0x01940u, 0x40u}, {0x01941u, 0x00u}, {0x01944u, 0x40u}, {0x0196Eu, 0x00u}, {0x01970u, 0x40u},
+        {0x01975u, 0x00u}, {0x01980u, 0x40u}, {0x019ACu, 0x00u}, {0x019B0u, 0x40u}, {0x019CAu, 0x00u}, {0x019D0u, 0x40u},
+        {0x019DBu, 0x00u}, {0x019DEu, 0x40u}, {0x01A17u, 0x34u}, {0x01A19u, 0x38u}, {0x01A1Bu, 0x34u}, {0x01A1Cu, 0x00u},
+        {0x01A1Eu, 0x40u}, {0x01A55u, 0x38u}, {0x01A56u, 0x34u}, {0x01A57u, 0x38u}, {0x01A58u, 0x34u}, {0x01A5Fu, 0x00u},
+        {0x01A60u, 0x34u}, {0x01A61u, 0x30u}, {0x01A62u, 0x34u}, {0x01A63u, 0x30u}, {0x01A65u, 0x34u}, {0x01A6Du, 0x38u},
+        {0x01A73u, 0x34u}, {0x01A7Du, 0x00u}, {0x01A7Fu, 0x34u}, {0x01A80u, 0x40u}, {0x01A8Au, 0x00u}, {0x01A90u, 0x40u},
+        {0x01A9Au, 0x00u}, {0x01AA0u, 0x40u}, {0x01AAEu, 0x00u}, {0x01AB0u, 0x34u}, {0x01ACFu, 0x00u}, {0x01B00u, 0x34u},
+        {0x01B04u, 0x38u}, {0x01B05u, 0x40u}, {0x01B34u, 0x34u}, {0x01B3Bu, 0x38u}, {0x01B3Cu, 0x34u}, {0x01B3Du, 0x38u},
+        {0x01B42u, 0x34u}, {0x01B43u, 0x38u}, {0x01B45u, 0x40u}, {0x01B4Du, 0x00u}, {0x01B50u, 0x40u}, {0x01B6Bu, 0x34u},
+        {0x01B74u, 0x40u}, {0x01B7Fu, 0x00u}, {0x01B80u, 0x34u}, {0x01B82u, 0x38u}, {0x01B83u, 0x40u}, {0x01BA1u, 0x38u},
+        {0x01BA2u, 0x34u}, {0x01BA6u, 0x38u}, {0x01BA8u, 0x34u}, {0x01BAAu, 0x38u}, {0x01BABu, 0x34u}, {0x01BAEu, 0x40u},
+        {0x01BE6u, 0x34u}, {0x01BE7u, 0x38u}, {0x01BE8u, 0x34u}, {0x01BEAu, 0x38u}, {0x01BEDu, 0x34u}, {0x01BEEu, 0x38u},
+        {0x01BEFu, 0x34u}, {0x01BF2u, 0x38u}, {0x01BF4u, 0x00u}, {0x01BFCu, 0x40u}, {0x01C24u, 0x38u}, {0x01C2Cu, 0x34u},
+        {0x01C34u, 0x38u}, {0x01C36u, 0x34u}, {0x01C38u, 0x00u}, {0x01C3Bu, 0x40u}, {0x01C4Au, 0x00u}, {0x01C4Du, 0x40u},
+        {0x01C89u, 0x00u}, {0x01C90u, 0x40u}, {0x01CBBu, 0x00u}, {0x01CBDu, 0x40u}, {0x01CC8u, 0x00u}, {0x01CD0u, 0x34u},
+        {0x01CD3u, 0x40u}, {0x01CD4u, 0x34u}, {0x01CE1u, 0x38u}, {0x01CE2u, 0x34u}, {0x01CE9u, 0x40u}, {0x01CEDu, 0x34u},
+        {0x01CEEu, 0x40u}, {0x01CF4u, 0x34u}, {0x01CF5u, 0x40u}, {0x01CF7u, 0x38u}, {0x01CF8u, 0x34u}, {0x01CFAu, 0x40u},
+        {0x01CFBu, 0x00u}, {0x01D00u, 0x40u}, {0x01DC0u, 0x34u}, {0x01E00u, 0x40u}, {0x01F16u, 0x00u}, {0x01F18u, 0x40u},
+        {0x01F1Eu, 0x00u}, {0x01F20u, 0x40u}, {0x01F46u, 0x00u}, {0x01F48u, 0x40u}, {0x01F4Eu, 0x00u}, {0x01F50u, 0x40u},
+        {0x01F58u, 0x00u}, {0x01F59u, 0x40u}, {0x01F5Au, 0x00u}, {0x01F5Bu, 0x40u}, {0x01F5Cu, 0x00u}, {0x01F5Du, 0x40u},
+        {0x01F5Eu, 0x00u}, {0x01F5Fu, 0x40u}, {0x01F7Eu, 0x00u}, {0x01F80u, 0x40u}, {0x01FB5u, 0x00u}, {0x01FB6u, 0x40u},
+        {0x01FC5u, 0x00u}, {0x01FC6u, 0x40u}, {0x01FD4u, 0x00u}, {0x01FD6u, 0x40u}, {0x01FDCu, 0x00u}, {0x01FDDu, 0x40u},
+        {0x01FF0u, 0x00u}, {0x01FF2u, 0x40u}, {0x01FF5u, 0x00u}, {0x01FF6u, 0x40u}, {0x01FFFu, 0x00u}, {0x02000u, 0x40u},
+        {0x0200Bu, 0x23u}, {0x0200Cu, 0x24u}, {0x0200Du, 0x25u}, {0x0200Eu, 0x23u}, {0x02010u, 0x40u}, {0x02028u, 0x13u},
+        {0x0202Au, 0x23u}, {0x0202Fu, 0x40u}, {0x0203Cu, 0x4Eu}, {0x0203Du, 0x40u}, {0x02049u, 0x4Eu}, {0x0204Au, 0x40u},
+        {0x02060u, 0x23u}, {0x02065u, 0x03u}, {0x02066u, 0x23u}, {0x02070u, 0x40u}, {0x02072u, 0x00u}, {0x02074u, 0x40u},
+        {0x0208Fu, 0x00u}, {0x02090u, 0x40u}, {0x0209Du, 0x00u}, {0x020A0u, 0x40u}, {0x020C1u, 0x00u}, {0x020D0u, 0x34u},
+        {0x020F1u, 0x00u}, {0x02100u, 0x40u}, {0x02122u, 0x4Eu}, {0x02123u, 0x40u}, {0x02139u, 0x4Eu}, {0x0213Au, 0x40u},
+        {0x0218Cu, 0x00u}, {0x02190u, 0x40u}, {0x02194u, 0x4Eu}, {0x0219Au, 0x40u}, {0x021A9u, 0x4Eu}, {0x021ABu, 0x40u},
+        {0x0231Au, 0x4Eu}, {0x0231Cu, 0x40u}, {0x02328u, 0x4Eu}, {0x02329u, 0x40u}, {0x02388u, 0x4Eu}, {0x02389u, 0x40u},
+        {0x023CFu, 0x4Eu}, {0x023D0u, 0x40u}, {0x023E9u, 0x4Eu}, {0x023F4u, 0x40u}, {0x023F8u, 0x4Eu}, {0x023FBu, 0x40u},
+        {0x02427u, 0x00u}, {0x02440u, 0x40u}, {0x0244Bu, 0x00u}, {0x02460u, 0x40u}, {0x024C2u, 0x4Eu}, {0x024C3u, 0x40u},
+        {0x025AAu, 0x4Eu}, {0x025ACu, 0x40u}, {0x025B6u, 0x4Eu}, {0x025B7u, 0x40u}, {0x025C0u, 0x4Eu}, {0x025C1u, 0x40u},
+        {0x025FBu, 0x4Eu}, {0x025FFu, 0x40u}, {0x02600u, 0x4Eu}, {0x02606u, 0x40u}, {0x02607u, 0x4Eu}, {0x02613u, 0x40u},
+        {0x02614u, 0x4Eu}, {0x02686u, 0x40u}, {0x02690u, 0x4Eu}, {0x02706u, 0x40u}, {0x02708u, 0x4Eu}, {0x02713u, 0x40u},
+        {0x02714u, 0x4Eu}, {0x02715u, 0x40u}, {0x02716u, 0x4Eu}, {0x02717u, 0x40u}, {0x0271Du, 0x4Eu}, {0x0271Eu, 0x40u},
+        {0x02721u, 0x4Eu}, {0x02722u, 0x40u}, {0x02728u, 0x4Eu}, {0x02729u, 0x40u}, {0x02733u, 0x4Eu}, {0x02735u, 0x40u},
+        {0x02744u, 0x4Eu}, {0x02745u, 0x40u}, {0x02747u, 0x4Eu}, {0x02748u, 0x40u}, {0x0274Cu, 0x4Eu}, {0x0274Du, 0x40u},
+        {0x0274Eu, 0x4Eu}, {0x0274Fu, 0x40u}, {0x02753u, 0x4Eu}, {0x02756u, 0x40u}, {0x02757u, 0x4Eu}, {0x02758u, 0x40u},
+        {0x02763u, 0x4Eu}, {0x02768u, 0x40u}, {0x02795u, 0x4Eu}, {0x02798u, 0x40u}, {0x027A1u, 0x4Eu}, {0x027A2u, 0x40u},
+        {0x027B0u, 0x4Eu}, {0x027B1u, 0x40u}, {0x027BFu, 0x4Eu}, {0x027C0u, 0x40u}, {0x02934u, 0x4Eu}, {0x02936u, 0x40u},
+        {0x02B05u, 0x4Eu}, {0x02B08u, 0x40u}, {0x02B1Bu, 0x4Eu}, {0x02B1Du, 0x40u}, {0x02B50u, 0x4Eu}, {0x02B51u, 0x40u},
+        {0x02B55u, 0x4Eu}, {0x02B56u, 0x40u}, {0x02B74u, 0x00u}, {0x02B76u, 0x40u}, {0x02B96u, 0x00u}, {0x02B97u, 0x40u},
+        {0x02CEFu, 0x34u}, {0x02CF2u, 0x40u}, {0x02CF4u, 0x00u}, {0x02CF9u, 0x40u}, {0x02D26u, 0x00u}, {0x02D27u, 0x40u},
+        {0x02D28u, 0x00u}, {0x02D2Du, 0x40u}, {0x02D2Eu, 0x00u}, {0x02D30u, 0x40u}, {0x02D68u, 0x00u}, {0x02D6Fu, 0x40u},
+        {0x02D71u, 0x00u}, {0x02D7Fu, 0x34u}, {0x02D80u, 0x40u}, {0x02D97u, 0x00u}, {0x02DA0u, 0x40u}, {0x02DA7u, 0x00u},
+        {0x02DA8u, 0x40u}, {0x02DAFu, 0x00u}, {0x02DB0u, 0x40u}, {0x02DB7u, 0x00u}, {0x02DB8u, 0x40u}, {0x02DBFu, 0x00u},
+        {0x02DC0u, 0x40u}, {0x02DC7u, 0x00u}, {0x02DC8u, 0x40u}, {0x02DCFu, 0x00u}, {0x02DD0u, 0x40u}, {0x02DD7u, 0x00u},
+        {0x02DD8u, 0x40u}, {0x02DDFu, 0x00u}, {0x02DE0u, 0x34u}, {0x02E00u, 0x40u}, {0x02E5Eu, 0x00u}, {0x02E80u, 0x40u},
+        {0x02E9Au, 0x00u}, {0x02E9Bu, 0x40u}, {0x02EF4u, 0x00u}, {0x02F00u, 0x40u}, {0x02FD6u, 0x00u}, {0x02FF0u, 0x40u},
+        {0x02FFCu, 0x00u}, {0x03000u, 0x40u}, {0x0302Au, 0x34u}, {0x03030u, 0x4Eu}, {0x03031u, 0x40u}, {0x0303Du, 0x4Eu},
+        {0x0303Eu, 0x40u}, {0x03040u, 0x00u}, {0x03041u, 0x40u}, {0x03097u, 0x00u}, {0x03099u, 0x34u}, {0x0309Bu, 0x40u},
+        {0x03100u, 0x00u}, {0x03105u, 0x40u}, {0x03130u, 0x00u}, {0x03131u, 0x40u}, {0x0318Fu, 0x00u}, {0x03190u, 0x40u},
+        {0x031E4u, 0x00u}, {0x031F0u, 0x40u}, {0x0321Fu, 0x00u}, {0x03220u, 0x40u}, {0x03297u, 0x4Eu}, {0x03298u, 0x40u},
+        {0x03299u, 0x4Eu}, {0x0329Au, 0x40u}, {0x0A48Du, 0x00u}, {0x0A490u, 0x40u}, {0x0A4C7u, 0x00u}, {0x0A4D0u, 0x40u},
+        {0x0A62Cu, 0x00u}, {0x0A640u, 0x40u}, {0x0A66Fu, 0x34u}, {0x0A673u, 0x40u}, {0x0A674u, 0x34u}, {0x0A67Eu, 0x40u},
+        {0x0A69Eu, 0x34u}, {0x0A6A0u, 0x40u}, {0x0A6F0u, 0x34u}, {0x0A6F2u, 0x40u}, {0x0A6F8u, 0x00u}, {0x0A700u, 0x40u},
+        {0x0A7CBu, 0x00u}, {0x0A7D0u, 0x40u}, {0x0A7D2u, 0x00u}, {0x0A7D3u, 0x40u}, {0x0A7D4u, 0x00u}, {0x0A7D5u, 0x40u},
+        {0x0A7DAu, 0x00u}, {0x0A7F2u, 0x40u}, {0x0A802u, 0x34u}, {0x0A803u, 0x40u}, {0x0A806u, 0x34u}, {0x0A807u, 0x40u},
+        {0x0A80Bu, 0x34u}, {0x0A80Cu, 0x40u}, {0x0A823u, 0x38u}, {0x0A825u, 0x34u}, {0x0A827u, 0x38u}, {0x0A828u, 0x40u},
+        {0x0A82Cu, 0x34u}, {0x0A82Du, 0x00u}, {0x0A830u, 0x40u}, {0x0A83Au, 0x00u}, {0x0A840u, 0x40u}, {0x0A878u, 0x00u},
+        {0x0A880u, 0x38u}, {0x0A882u, 0x40u}, {0x0A8B4u, 0x38u}, {0x0A8C4u, 0x34u}, {0x0A8C6u, 0x00u}, {0x0A8CEu, 0x40u},
+        {0x0A8DAu, 0x00u}, {0x0A8E0u, 0x34u}, {0x0A8F2u, 0x40u}, {0x0A8FFu, 0x34u}, {0x0A900u, 0x40u}, {0x0A926u, 0x34u},
+        {0x0A92Eu, 0x40u}, {0x0A947u, 0x34u}, {0x0A952u, 0x38u}, {0x0A954u, 0x00u}, {0x0A95Fu, 0x40u}, {0x0A960u, 0x49u},
+        {0x0A97Du, 0x00u}, {0x0A980u, 0x34u}, {0x0A983u, 0x38u}, {0x0A984u, 0x40u}, {0x0A9B3u, 0x34u}, {0x0A9B4u, 0x38u},
+        {0x0A9B6u, 0x34u}, {0x0A9BAu, 0x38u}, {0x0A9BCu, 0x34u}, {0x0A9BEu, 0x38u}, {0x0A9C1u, 0x40u}, {0x0A9CEu, 0x00u},
+        {0x0A9CFu, 0x40u}, {0x0A9DAu, 0x00u}, {0x0A9DEu, 0x40u}, {0x0A9E5u, 0x34u}, {0x0A9E6u, 0x40u}, {0x0A9FFu, 0x00u},
+        {0x0AA00u, 0x40u}, {0x0AA29u, 0x34u}, {0x0AA2Fu, 0x38u}, {0x0AA31u, 0x34u}, {0x0AA33u, 0x38u}, {0x0AA35u, 0x34u},
+        {0x0AA37u, 0x00u}, {0x0AA40u, 0x40u}, {0x0AA43u, 0x34u}, {0x0AA44u, 0x40u}, {0x0AA4Cu, 0x34u}, {0x0AA4Du, 0x38u},
+        {0x0AA4Eu, 0x00u}, {0x0AA50u, 0x40u}, {0x0AA5Au, 0x00u}, {0x0AA5Cu, 0x40u}, {0x0AA7Bu, 0x30u}, {0x0AA7Cu, 0x34u},
+        {0x0AA7Du, 0x30u}, {0x0AA7Eu, 0x40u}, {0x0AAB0u, 0x34u}, {0x0AAB1u, 0x40u}, {0x0AAB2u, 0x34u}, {0x0AAB5u, 0x40u},
+        {0x0AAB7u, 0x34u}, {0x0AAB9u, 0x40u}, {0x0AABEu, 0x34u}, {0x0AAC0u, 0x40u}, {0x0AAC1u, 0x34u}, {0x0AAC2u, 0x40u},
+        {0x0AAC3u, 0x00u}, {0x0AADBu, 0x40u}, {0x0AAEBu, 0x38u}, {0x0AAECu, 0x34u}, {0x0AAEEu, 0x38u}, {0x0AAF0u, 0x40u},
+        {0x0AAF5u, 0x38u}, {0x0AAF6u, 0x34u}, {0x0AAF7u, 0x00u}, {0x0AB01u, 0x40u}, {0x0AB07u, 0x00u}, {0x0AB09u, 0x40u},
+        {0x0AB0Fu, 0x00u}, {0x0AB11u, 0x40u}, {0x0AB17u, 0x00u}, {0x0AB20u, 0x40u}, {0x0AB27u, 0x00u}, {0x0AB28u, 0x40u},
+        {0x0AB2Fu, 0x00u}, {0x0AB30u, 0x40u}, {0x0AB6Cu, 0x00u}, {0x0AB70u, 0x40u}, {0x0ABE3u, 0x38u}, {0x0ABE5u, 0x34u},
+        {0x0ABE6u, 0x38u}, {0x0ABE8u, 0x34u}, {0x0ABE9u, 0x38u}, {0x0ABEBu, 0x40u}, {0x0ABECu, 0x38u}, {0x0ABEDu, 0x34u},
+        {0x0ABEEu, 0x00u}, {0x0ABF0u, 0x40u}, {0x0ABFAu, 0x00u}, {0x0AC00u, 0x4Cu}, {0x0AC01u, 0x4Du}, {0x0AC1Cu, 0x4Cu},
+        {0x0AC1Du, 0x4Du}, {0x0AC38u, 0x4Cu}, {0x0AC39u, 0x4Du}, {0x0AC54u, 0x4Cu}, {0x0AC55u, 0x4Du}, {0x0AC70u, 0x4Cu},
+        {0x0AC71u, 0x4Du}, {0x0AC8Cu, 0x4Cu}, {0x0AC8Du, 0x4Du}, {0x0ACA8u, 0x4Cu}, {0x0ACA9u, 0x4Du}, {0x0ACC4u, 0x4Cu},
+        {0x0ACC5u, 0x4Du}, {0x0ACE0u, 0x4Cu}, {0x0ACE1u, 0x4Du}, {0x0ACFCu, 0x4Cu}, {0x0ACFDu, 0x4Du}, {0x0AD18u, 0x4Cu},
+        {0x0AD19u, 0x4Du}, {0x0AD34u, 0x4Cu}, {0x0AD35u, 0x4Du}, {0x0AD50u, 0x4Cu}, {0x0AD51u, 0x4Du}, {0x0AD6Cu, 0x4Cu},
+        {0x0AD6Du, 0x4Du}, {0x0AD88u, 0x4Cu}, {0x0AD89u, 0x4Du}, {0x0ADA4u, 0x4Cu}, {0x0ADA5u, 0x4Du}, {0x0ADC0u, 0x4Cu},
+        {0x0ADC1u, 0x4Du}, {0x0ADDCu, 0x4Cu}, {0x0ADDDu, 0x4Du}, {0x0ADF8u, 0x4Cu}, {0x0ADF9u, 0x4Du}, {0x0AE14u, 0x4Cu},
+        {0x0AE15u, 0x4Du}, {0x0AE30u, 0x4Cu}, {0x0AE31u, 0x4Du}, {0x0AE4Cu, 0x4Cu}, {0x0AE4Du, 0x4Du}, {0x0AE68u, 0x4Cu},
+        {0x0AE69u, 0x4Du}, {0x0AE84u, 0x4Cu}, {0x0AE85u, 0x4Du}, {0x0AEA0u, 0x4Cu}, {0x0AEA1u, 0x4Du}, {0x0AEBCu, 0x4Cu},
+        {0x0AEBDu, 0x4Du}, {0x0AED8u, 0x4Cu}, {0x0AED9u, 0x4Du}, {0x0AEF4u, 0x4Cu}, {0x0AEF5u, 0x4Du}, {0x0AF10u, 0x4Cu},
+        {0x0AF11u, 0x4Du}, {0x0AF2Cu, 0x4Cu}, {0x0AF2Du, 0x4Du}, {0x0AF48u, 0x4Cu}, {0x0AF49u, 0x4Du}, {0x0AF64u, 0x4Cu},
+        {0x0AF65u, 0x4Du}, {0x0AF80u, 0x4Cu}, {0x0AF81u, 0x4Du}, {0x0AF9Cu, 0x4Cu}, {0x0AF9Du, 0x4Du}, {0x0AFB8u, 0x4Cu},
+        {0x0AFB9u, 0x4Du}, {0x0AFD4u, 0x4Cu}, {0x0AFD5u, 0x4Du}, {0x0AFF0u, 0x4Cu}, {0x0AFF1u, 0x4Du}, {0x0B00Cu, 0x4Cu},
+        {0x0B00Du, 0x4Du}, {0x0B028u, 0x4Cu}, {0x0B029u, 0x4Du}, {0x0B044u, 0x4Cu}, {0x0B045u, 0x4Du}, {0x0B060u, 0x4Cu},
+        {0x0B061u, 0x4Du}, {0x0B07Cu, 0x4Cu}, {0x0B07Du, 0x4Du}, {0x0B098u, 0x4Cu}, {0x0B099u, 0x4Du}, {0x0B0B4u, 0x4Cu},
+        {0x0B0B5u, 0x4Du}, {0x0B0D0u, 0x4Cu}, {0x0B0D1u, 0x4Du}, {0x0B0ECu, 0x4Cu}, {0x0B0EDu, 0x4Du}, {0x0B108u, 0x4Cu},
+        {0x0B109u, 0x4Du}, {0x0B124u, 0x4Cu}, {0x0B125u, 0x4Du}, {0x0B140u, 0x4Cu}, {0x0B141u, 0x4Du}, {0x0B15Cu, 0x4Cu},
+        {0x0B15Du, 0x4Du}, {0x0B178u, 0x4Cu}, {0x0B179u, 0x4Du}, {0x0B194u, 0x4Cu}, {0x0B195u, 0x4Du}, {0x0B1B0u, 0x4Cu},
+        {0x0B1B1u, 0x4Du}, {0x0B1CCu, 0x4Cu}, {0x0B1CDu, 0x4Du}, {0x0B1E8u, 0x4Cu}, {0x0B1E9u, 0x4Du}, {0x0B204u, 0x4Cu},
+        {0x0B205u, 0x4Du}, {0x0B220u, 0x4Cu}, {0x0B221u, 0x4Du}, {0x0B23Cu, 0x4Cu}, {0x0B23Du, 0x4Du}, {0x0B258u, 0x4Cu},
+        {0x0B259u, 0x4Du}, {0x0B274u, 0x4Cu}, {0x0B275u, 0x4Du}, {0x0B290u, 0x4Cu}, {0x0B291u, 0x4Du}, {0x0B2ACu, 0x4Cu},
+        {0x0B2ADu, 0x4Du}, {0x0B2C8u, 0x4Cu}, {0x0B2C9u, 0x4Du}, {0x0B2E4u, 0x4Cu}, {0x0B2E5u, 0x4Du}, {0x0B300u, 0x4Cu},
+        {0x0B301u, 0x4Du}, {0x0B31Cu, 0x4Cu}, {0x0B31Du, 0x4Du}, {0x0B338u, 0x4Cu}, {0x0B339u, 0x4Du}, {0x0B354u, 0x4Cu},
+        {0x0B355u, 0x4Du}, {0x0B370u, 0x4Cu}, {0x0B371u, 0x4Du}, {0x0B38Cu, 0x4Cu}, {0x0B38Du, 0x4Du}, {0x0B3A8u, 0x4Cu},
+        {0x0B3A9u, 0x4Du}, {0x0B3C4u, 0x4Cu}, {0x0B3C5u, 0x4Du}, {0x0B3E0u, 0x4Cu}, {0x0B3E1u, 0x4Du}, {0x0B3FCu, 0x4Cu},
+        {0x0B3FDu, 0x4Du}, {0x0B418u, 0x4Cu}, {0x0B419u, 0x4Du}, {0x0B434u, 0x4Cu}, {0x0B435u, 0x4Du}, {0x0B450u, 0x4Cu},
+        {0x0B451u, 0x4Du}, {0x0B46Cu, 0x4Cu}, {0x0B46Du, 0x4Du}, {0x0B488u, 0x4Cu}, {0x0B489u, 0x4Du}, {0x0B4A4u, 0x4Cu},
+        {0x0B4A5u, 0x4Du}, {0x0B4C0u, 0x4Cu}, {0x0B4C1u, 0x4Du}, {0x0B4DCu, 0x4Cu}, {0x0B4DDu, 0x4Du}, {0x0B4F8u, 0x4Cu},
+        {0x0B4F9u, 0x4Du}, {0x0B514u, 0x4Cu}, {0x0B515u, 0x4Du}, {0x0B530u, 0x4Cu}, {0x0B531u, 0x4Du}, {0x0B54Cu, 0x4Cu},
+        {0x0B54Du, 0x4Du}, {0x0B568u, 0x4Cu}, {0x0B569u, 0x4Du}, {0x0B584u, 0x4Cu}, {0x0B585u, 0x4Du}, {0x0B5A0u, 0x4Cu},
+        {0x0B5A1u, 0x4Du}, {0x0B5BCu, 0x4Cu}, {0x0B5BDu, 0x4Du}, {0x0B5D8u, 0x4Cu}, {0x0B5D9u, 0x4Du}, {0x0B5F4u, 0x4Cu},
+        {0x0B5F5u, 0x4Du}, {0x0B610u, 0x4Cu}, {0x0B611u, 0x4Du}, {0x0B62Cu, 0x4Cu}, {0x0B62Du, 0x4Du}, {0x0B648u, 0x4Cu},
+        {0x0B649u, 0x4Du}, {0x0B664u, 0x4Cu}, {0x0B665u, 0x4Du}, {0x0B680u, 0x4Cu}, {0x0B681u, 0x4Du}, {0x0B69Cu, 0x4Cu},
+        {0x0B69Du, 0x4Du}, {0x0B6B8u, 0x4Cu}, {0x0B6B9u, 0x4Du}, {0x0B6D4u, 0x4Cu}, {0x0B6D5u, 0x4Du}, {0x0B6F0u, 0x4Cu},
+        {0x0B6F1u, 0x4Du}, {0x0B70Cu, 0x4Cu}, {0x0B70Du, 0x4Du}, {0x0B728u, 0x4Cu}, {0x0B729u, 0x4Du}, {0x0B744u, 0x4Cu},
+        {0x0B745u, 0x4Du}, {0x0B760u, 0x4Cu}, {0x0B761u, 0x4Du}, {0x0B77Cu, 0x4Cu}, {0x0B77Du, 0x4Du}, {0x0B798u, 0x4Cu},
+        {0x0B799u, 0x4Du}, {0x0B7B4u, 0x4Cu}, {0x0B7B5u, 0x4Du}, {0x0B7D0u, 0x4Cu}, {0x0B7D1u, 0x4Du}, {0x0B7ECu, 0x4Cu},
+        {0x0B7EDu, 0x4Du}, {0x0B808u, 0x4Cu}, {0x0B809u, 0x4Du}, {0x0B824u, 0x4Cu}, {0x0B825u, 0x4Du}, {0x0B840u, 0x4Cu},
+        {0x0B841u, 0x4Du}, {0x0B85Cu, 0x4Cu}, {0x0B85Du, 0x4Du}, {0x0B878u, 0x4Cu}, {0x0B879u, 0x4Du}, {0x0B894u, 0x4Cu},
+        {0x0B895u, 0x4Du}, {0x0B8B0u, 0x4Cu}, {0x0B8B1u, 0x4Du}, {0x0B8CCu, 0x4Cu}, {0x0B8CDu, 0x4Du}, {0x0B8E8u, 0x4Cu},
+        {0x0B8E9u, 0x4Du}, {0x0B904u, 0x4Cu}, {0x0B905u, 0x4Du}, {0x0B920u, 0x4Cu}, {0x0B921u, 0x4Du}, {0x0B93Cu, 0x4Cu},
+        {0x0B93Du, 0x4Du}, {0x0B958u, 0x4Cu}, {0x0B959u, 0x4Du}, {0x0B974u, 0x4Cu}, {0x0B975u, 0x4Du}, {0x0B990u, 0x4Cu},
+        {0x0B991u, 0x4Du}, {0x0B9ACu, 0x4Cu}, {0x0B9ADu, 0x4Du}, {0x0B9C8u, 0x4Cu}, {0x0B9C9u, 0x4Du}, {0x0B9E4u, 0x4Cu},
+        {0x0B9E5u, 0x4Du}, {0x0BA00u, 0x4Cu}, {0x0BA01u, 0x4Du}, {0x0BA1Cu, 0x4Cu}, {0x0BA1Du, 0x4Du}, {0x0BA38u, 0x4Cu},
+        {0x0BA39u, 0x4Du}, {0x0BA54u, 0x4Cu}, {0x0BA55u, 0x4Du}, {0x0BA70u, 0x4Cu}, {0x0BA71u, 0x4Du}, {0x0BA8Cu, 0x4Cu},
+        {0x0BA8Du, 0x4Du}, {0x0BAA8u, 0x4Cu}, {0x0BAA9u, 0x4Du}, {0x0BAC4u, 0x4Cu}, {0x0BAC5u, 0x4Du}, {0x0BAE0u, 0x4Cu},
+        {0x0BAE1u, 0x4Du}, {0x0BAFCu, 0x4Cu}, {0x0BAFDu, 0x4Du}, {0x0BB18u, 0x4Cu}, {0x0BB19u, 0x4Du}, {0x0BB34u, 0x4Cu},
+        {0x0BB35u, 0x4Du}, {0x0BB50u, 0x4Cu}, {0x0BB51u, 0x4Du}, {0x0BB6Cu, 0x4Cu}, {0x0BB6Du, 0x4Du}, {0x0BB88u, 0x4Cu},
+        {0x0BB89u, 0x4Du}, {0x0BBA4u, 0x4Cu}, {0x0BBA5u, 0x4Du}, {0x0BBC0u, 0x4Cu}, {0x0BBC1u, 0x4Du}, {0x0BBDCu, 0x4Cu},
+        {0x0BBDDu, 0x4Du}, {0x0BBF8u, 0x4Cu}, {0x0BBF9u, 0x4Du}, {0x0BC14u, 0x4Cu}, {0x0BC15u, 0x4Du}, {0x0BC30u, 0x4Cu},
+        {0x0BC31u, 0x4Du}, {0x0BC4Cu, 0x4Cu}, {0x0BC4Du, 0x4Du}, {0x0BC68u, 0x4Cu}, {0x0BC69u, 0x4Du}, {0x0BC84u, 0x4Cu},
+        {0x0BC85u, 0x4Du}, {0x0BCA0u, 0x4Cu}, {0x0BCA1u, 0x4Du}, {0x0BCBCu, 0x4Cu}, {0x0BCBDu, 0x4Du}, {0x0BCD8u, 0x4Cu},
+        {0x0BCD9u, 0x4Du}, {0x0BCF4u, 0x4Cu}, {0x0BCF5u, 0x4Du}, {0x0BD10u, 0x4Cu}, {0x0BD11u, 0x4Du}, {0x0BD2Cu, 0x4Cu},
+        {0x0BD2Du, 0x4Du}, {0x0BD48u, 0x4Cu}, {0x0BD49u, 0x4Du}, {0x0BD64u, 0x4Cu}, {0x0BD65u, 0x4Du}, {0x0BD80u, 0x4Cu},
+        {0x0BD81u, 0x4Du}, {0x0BD9Cu, 0x4Cu}, {0x0BD9Du, 0x4Du}, {0x0BDB8u, 0x4Cu}, {0x0BDB9u, 0x4Du}, {0x0BDD4u, 0x4Cu},
+        {0x0BDD5u, 0x4Du}, {0x0BDF0u, 0x4Cu}, {0x0BDF1u, 0x4Du}, {0x0BE0Cu, 0x4Cu}, {0x0BE0Du, 0x4Du}, {0x0BE28u, 0x4Cu},
+        {0x0BE29u, 0x4Du}, {0x0BE44u, 0x4Cu}, {0x0BE45u, 0x4Du}, {0x0BE60u, 0x4Cu}, {0x0BE61u, 0x4Du}, {0x0BE7Cu, 0x4Cu},
+        {0x0BE7Du, 0x4Du}, {0x0BE98u, 0x4Cu}, {0x0BE99u, 0x4Du}, {0x0BEB4u, 0x4Cu}, {0x0BEB5u, 0x4Du}, {0x0BED0u, 0x4Cu},
+        {0x0BED1u, 0x4Du}, {0x0BEECu, 0x4Cu}, {0x0BEEDu, 0x4Du}, {0x0BF08u, 0x4Cu}, {0x0BF09u, 0x4Du}, {0x0BF24u, 0x4Cu},
+        {0x0BF25u, 0x4Du}, {0x0BF40u, 0x4Cu}, {0x0BF41u, 0x4Du}, {0x0BF5Cu, 0x4Cu}, {0x0BF5Du, 0x4Du}, {0x0BF78u, 0x4Cu},
+        {0x0BF79u, 0x4Du}, {0x0BF94u, 0x4Cu}, {0x0BF95u, 0x4Du}, {0x0BFB0u, 0x4Cu}, {0x0BFB1u, 0x4Du}, {0x0BFCCu, 0x4Cu},
+        {0x0BFCDu, 0x4Du}, {0x0BFE8u, 0x4Cu}, {0x0BFE9u, 0x4Du}, {0x0C004u, 0x4Cu}, {0x0C005u, 0x4Du}, {0x0C020u, 0x4Cu},
+        {0x0C021u, 0x4Du}, {0x0C03Cu, 0x4Cu}, {0x0C03Du, 0x4Du}, {0x0C058u, 0x4Cu}, {0x0C059u, 0x4Du}, {0x0C074u, 0x4Cu},
+        {0x0C075u, 0x4Du}, {0x0C090u, 0x4Cu}, {0x0C091u, 0x4Du}, {0x0C0ACu, 0x4Cu}, {0x0C0ADu, 0x4Du}, {0x0C0C8u, 0x4Cu},
+        {0x0C0C9u, 0x4Du}, {0x0C0E4u, 0x4Cu}, {0x0C0E5u, 0x4Du}, {0x0C100u, 0x4Cu}, {0x0C101u, 0x4Du}, {0x0C11Cu, 0x4Cu},
+        {0x0C11Du, 0x4Du}, {0x0C138u, 0x4Cu}, {0x0C139u, 0x4Du}, {0x0C154u, 0x4Cu}, {0x0C155u, 0x4Du}, {0x0C170u, 0x4Cu},
+        {0x0C171u, 0x4Du}, {0x0C18Cu, 0x4Cu}, {0x0C18Du, 0x4Du}, {0x0C1A8u, 0x4Cu}, {0x0C1A9u, 0x4Du}, {0x0C1C4u, 0x4Cu},
+        {0x0C1C5u, 0x4Du}, {0x0C1E0u, 0x4Cu}, {0x0C1E1u, 0x4Du}, {0x0C1FCu, 0x4Cu}, {0x0C1FDu, 0x4Du}, {0x0C218u, 0x4Cu},
+        {0x0C219u, 0x4Du}, {0x0C234u, 0x4Cu}, {0x0C235u, 0x4Du}, {0x0C250u, 0x4Cu}, {0x0C251u, 0x4Du}, {0x0C26Cu, 0x4Cu},
+        {0x0C26Du, 0x4Du}, {0x0C288u, 0x4Cu}, {0x0C289u, 0x4Du}, {0x0C2A4u, 0x4Cu}, {0x0C2A5u, 0x4Du}, {0x0C2C0u, 0x4Cu},
+        {0x0C2C1u, 0x4Du}, {0x0C2DCu, 0x4Cu}, {0x0C2DDu, 0x4Du}, {0x0C2F8u, 0x4Cu}, {0x0C2F9u, 0x4Du}, {0x0C314u, 0x4Cu},
+        {0x0C315u, 0x4Du}, {0x0C330u, 0x4Cu}, {0x0C331u, 0x4Du}, {0x0C34Cu, 0x4Cu}, {0x0C34Du, 0x4Du}, {0x0C368u, 0x4Cu},
+        {0x0C369u, 0x4Du}, {0x0C384u, 0x4Cu}, {0x0C385u, 0x4Du}, {0x0C3A0u, 0x4Cu}, {0x0C3A1u, 0x4Du}, {0x0C3BCu, 0x4Cu},
+        {0x0C3BDu, 0x4Du}, {0x0C3D8u, 0x4Cu}, {0x0C3D9u, 0x4Du}, {0x0C3F4u, 0x4Cu}, {0x0C3F5u, 0x4Du}, {0x0C410u, 0x4Cu},
+        {0x0C411u, 0x4Du}, {0x0C42Cu, 0x4Cu}, {0x0C42Du, 0x4Du}, {0x0C448u, 0x4Cu}, {0x0C449u, 0x4Du}, {0x0C464u, 0x4Cu},
+        {0x0C465u, 0x4Du}, {0x0C480u, 0x4Cu}, {0x0C481u, 0x4Du}, {0x0C49Cu, 0x4Cu}, {0x0C49Du, 0x4Du}, {0x0C4B8u, 0x4Cu},
+        {0x0C4B9u, 0x4Du}, {0x0C4D4u, 0x4Cu}, {0x0C4D5u, 0x4Du}, {0x0C4F0u, 0x4Cu}, {0x0C4F1u, 0x4Du}, {0x0C50Cu, 0x4Cu},
+        {0x0C50Du, 0x4Du}, {0x0C528u, 0x4Cu}, {0x0C529u, 0x4Du}, {0x0C544u, 0x4Cu}, {0x0C545u, 0x4Du}, {0x0C560u, 0x4Cu},
+        {0x0C561u, 0x4Du}, {0x0C57Cu, 0x4Cu}, {0x0C57Du, 0x4Du}, {0x0C598u, 0x4Cu}, {0x0C599u, 0x4Du}, {0x0C5B4u, 0x4Cu},
+        {0x0C5B5u, 0x4Du}, {0x0C5D0u, 0x4Cu}, {0x0C5D1u, 0x4Du}, {0x0C5ECu, 0x4Cu}, {0x0C5EDu, 0x4Du}, {0x0C608u, 0x4Cu},
+        {0x0C609u, 0x4Du}, {0x0C624u, 0x4Cu}, {0x0C625u, 0x4Du}, {0x0C640u, 0x4Cu}, {0x0C641u, 0x4Du}, {0x0C65Cu, 0x4Cu},
+        {0x0C65Du, 0x4Du}, {0x0C678u, 0x4Cu}, {0x0C679u, 0x4Du}, {0x0C694u, 0x4Cu}, {0x0C695u, 0x4Du}, {0x0C6B0u, 0x4Cu},
+        {0x0C6B1u, 0x4Du}, {0x0C6CCu, 0x4Cu}, {0x0C6CDu, 0x4Du}, {0x0C6E8u, 0x4Cu}, {0x0C6E9u, 0x4Du}, {0x0C704u, 0x4Cu},
+        {0x0C705u, 0x4Du}, {0x0C720u, 0x4Cu}, {0x0C721u, 0x4Du}, {0x0C73Cu, 0x4Cu}, {0x0C73Du, 0x4Du}, {0x0C758u, 0x4Cu},
+        {0x0C759u, 0x4Du}, {0x0C774u, 0x4Cu}, {0x0C775u, 0x4Du}, {0x0C790u, 0x4Cu}, {0x0C791u, 0x4Du}, {0x0C7ACu, 0x4Cu},
+        {0x0C7ADu, 0x4Du}, {0x0C7C8u, 0x4Cu}, {0x0C7C9u, 0x4Du}, {0x0C7E4u, 0x4Cu}, {0x0C7E5u, 0x4Du}, {0x0C800u, 0x4Cu},
+        {0x0C801u, 0x4Du}, {0x0C81Cu, 0x4Cu}, {0x0C81Du, 0x4Du}, {0x0C838u, 0x4Cu}, {0x0C839u, 0x4Du}, {0x0C854u, 0x4Cu},
+        {0x0C855u, 0x4Du}, {0x0C870u, 0x4Cu}, {0x0C871u, 0x4Du}, {0x0C88Cu, 0x4Cu}, {0x0C88Du, 0x4Du}, {0x0C8A8u, 0x4Cu},
+        {0x0C8A9u, 0x4Du}, {0x0C8C4u, 0x4Cu}, {0x0C8C5u, 0x4Du}, {0x0C8E0u, 0x4Cu}, {0x0C8E1u, 0x4Du}, {0x0C8FCu, 0x4Cu},
+        {0x0C8FDu, 0x4Du}, {0x0C918u, 0x4Cu}, {0x0C919u, 0x4Du}, {0x0C934u, 0x4Cu}, {0x0C935u, 0x4Du}, {0x0C950u, 0x4Cu},
+        {0x0C951u, 0x4Du}, {0x0C96Cu, 0x4Cu}, {0x0C96Du, 0x4Du}, {0x0C988u, 0x4Cu}, {0x0C989u, 0x4Du}, {0x0C9A4u, 0x4Cu},
+        {0x0C9A5u, 0x4Du}, {0x0C9C0u, 0x4Cu}, {0x0C9C1u, 0x4Du}, {0x0C9DCu, 0x4Cu}, {0x0C9DDu, 0x4Du}, {0x0C9F8u, 0x4Cu},
+        {0x0C9F9u, 0x4Du}, {0x0CA14u, 0x4Cu}, {0x0CA15u, 0x4Du}, {0x0CA30u, 0x4Cu}, {0x0CA31u, 0x4Du}, {0x0CA4Cu, 0x4Cu},
+        {0x0CA4Du, 0x4Du}, {0x0CA68u, 0x4Cu}, {0x0CA69u, 0x4Du}, {0x0CA84u, 0x4Cu}, {0x0CA85u, 0x4Du}, {0x0CAA0u, 0x4Cu},
+        {0x0CAA1u, 0x4Du}, {0x0CABCu, 0x4Cu}, {0x0CABDu, 0x4Du}, {0x0CAD8u, 0x4Cu}, {0x0CAD9u, 0x4Du}, {0x0CAF4u, 0x4Cu},
+        {0x0CAF5u, 0x4Du}, {0x0CB10u, 0x4Cu}, {0x0CB11u, 0x4Du}, {0x0CB2Cu, 0x4Cu}, {0x0CB2Du, 0x4Du}, {0x0CB48u, 0x4Cu},
+        {0x0CB49u, 0x4Du}, {0x0CB64u, 0x4Cu}, {0x0CB65u, 0x4Du}, {0x0CB80u, 0x4Cu}, {0x0CB81u, 0x4Du}, {0x0CB9Cu, 0x4Cu},
+        {0x0CB9Du, 0x4Du}, {0x0CBB8u, 0x4Cu}, {0x0CBB9u, 0x4Du}, {0x0CBD4u, 0x4Cu}, {0x0CBD5u, 0x4Du}, {0x0CBF0u, 0x4Cu},
+        {0x0CBF1u, 0x4Du}, {0x0CC0Cu, 0x4Cu}, {0x0CC0Du, 0x4Du}, {0x0CC28u, 0x4Cu}, {0x0CC29u, 0x4Du}, {0x0CC44u, 0x4Cu},
+        {0x0CC45u, 0x4Du}, {0x0CC60u, 0x4Cu}, {0x0CC61u, 0x4Du}, {0x0CC7Cu, 0x4Cu}, {0x0CC7Du, 0x4Du}, {0x0CC98u, 0x4Cu},
+        {0x0CC99u, 0x4Du}, {0x0CCB4u, 0x4Cu}, {0x0CCB5u, 0x4Du}, {0x0CCD0u, 0x4Cu}, {0x0CCD1u, 0x4Du}, {0x0CCECu, 0x4Cu},
+        {0x0CCEDu, 0x4Du}, {0x0CD08u, 0x4Cu}, {0x0CD09u, 0x4Du}, {0x0CD24u, 0x4Cu}, {0x0CD25u, 0x4Du}, {0x0CD40u, 0x4Cu},
+        {0x0CD41u, 0x4Du}, {0x0CD5Cu, 0x4Cu}, {0x0CD5Du, 0x4Du}, {0x0CD78u, 0x4Cu}, {0x0CD79u, 0x4Du}, {0x0CD94u, 0x4Cu},
+        {0x0CD95u, 0x4Du}, {0x0CDB0u, 0x4Cu}, {0x0CDB1u, 0x4Du}, {0x0CDCCu, 0x4Cu}, {0x0CDCDu, 0x4Du}, {0x0CDE8u, 0x4Cu},
+        {0x0CDE9u, 0x4Du}, {0x0CE04u, 0x4Cu}, {0x0CE05u, 0x4Du}, {0x0CE20u, 0x4Cu}, {0x0CE21u, 0x4Du}, {0x0CE3Cu, 0x4Cu},
+        {0x0CE3Du, 0x4Du}, {0x0CE58u, 0x4Cu}, {0x0CE59u, 0x4Du}, {0x0CE74u, 0x4Cu}, {0x0CE75u, 0x4Du}, {0x0CE90u, 0x4Cu},
+        {0x0CE91u, 0x4Du}, {0x0CEACu, 0x4Cu}, {0x0CEADu, 0x4Du}, {0x0CEC8u, 0x4Cu}, {0x0CEC9u, 0x4Du}, {0x0CEE4u, 0x4Cu},
+        {0x0CEE5u, 0x4Du}, {0x0CF00u, 0x4Cu}, {0x0CF01u, 0x4Du}, {0x0CF1Cu, 0x4Cu}, {0x0CF1Du, 0x4Du}, {0x0CF38u, 0x4Cu},
+        {0x0CF39u, 0x4Du}, {0x0CF54u, 0x4Cu}, {0x0CF55u, 0x4Du}, {0x0CF70u, 0x4Cu}, {0x0CF71u, 0x4Du}, {0x0CF8Cu, 0x4Cu},
+        {0x0CF8Du, 0x4Du}, {0x0CFA8u, 0x4Cu}, {0x0CFA9u, 0x4Du}, {0x0CFC4u, 0x4Cu}, {0x0CFC5u, 0x4Du}, {0x0CFE0u, 0x4Cu},
+        {0x0CFE1u, 0x4Du}, {0x0CFFCu, 0x4Cu}, {0x0CFFDu, 0x4Du}, {0x0D018u, 0x4Cu}, {0x0D019u, 0x4Du}, {0x0D034u, 0x4Cu},
+        {0x0D035u, 0x4Du}, {0x0D050u, 0x4Cu}, {0x0D051u, 0x4Du}, {0x0D06Cu, 0x4Cu}, {0x0D06Du, 0x4Du}, {0x0D088u, 0x4Cu},
+        {0x0D089u, 0x4Du}, {0x0D0A4u, 0x4Cu}, {0x0D0A5u, 0x4Du}, {0x0D0C0u, 0x4Cu}, {0x0D0C1u, 0x4Du}, {0x0D0DCu, 0x4Cu},
+        {0x0D0DDu, 0x4Du}, {0x0D0F8u, 0x4Cu}, {0x0D0F9u, 0x4Du}, {0x0D114u, 0x4Cu}, {0x0D115u, 0x4Du}, {0x0D130u, 0x4Cu},
+        {0x0D131u, 0x4Du}, {0x0D14Cu, 0x4Cu}, {0x0D14Du, 0x4Du}, {0x0D168u, 0x4Cu}, {0x0D169u, 0x4Du}, {0x0D184u, 0x4Cu},
+        {0x0D185u, 0x4Du}, {0x0D1A0u, 0x4Cu}, {0x0D1A1u, 0x4Du}, {0x0D1BCu, 0x4Cu}, {0x0D1BDu, 0x4Du}, {0x0D1D8u, 0x4Cu},
+        {0x0D1D9u, 0x4Du}, {0x0D1F4u, 0x4Cu}, {0x0D1F5u, 0x4Du}, {0x0D210u, 0x4Cu}, {0x0D211u, 0x4Du}, {0x0D22Cu, 0x4Cu},
+        {0x0D22Du, 0x4Du}, {0x0D248u, 0x4Cu}, {0x0D249u, 0x4Du}, {0x0D264u, 0x4Cu}, {0x0D265u, 0x4Du}, {0x0D280u, 0x4Cu},
+        {0x0D281u, 0x4Du}, {0x0D29Cu, 0x4Cu}, {0x0D29Du, 0x4Du}, {0x0D2B8u, 0x4Cu}, {0x0D2B9u, 0x4Du}, {0x0D2D4u, 0x4Cu},
+        {0x0D2D5u, 0x4Du}, {0x0D2F0u, 0x4Cu}, {0x0D2F1u, 0x4Du}, {0x0D30Cu, 0x4Cu}, {0x0D30Du, 0x4Du}, {0x0D328u, 0x4Cu},
+        {0x0D329u, 0x4Du}, {0x0D344u, 0x4Cu}, {0x0D345u, 0x4Du}, {0x0D360u, 0x4Cu}, {0x0D361u, 0x4Du}, {0x0D37Cu, 0x4Cu},
+        {0x0D37Du, 0x4Du}, {0x0D398u, 0x4Cu}, {0x0D399u, 0x4Du}, {0x0D3B4u, 0x4Cu}, {0x0D3B5u, 0x4Du}, {0x0D3D0u, 0x4Cu},
+        {0x0D3D1u, 0x4Du}, {0x0D3ECu, 0x4Cu}, {0x0D3EDu, 0x4Du}, {0x0D408u, 0x4Cu}, {0x0D409u, 0x4Du}, {0x0D424u, 0x4Cu},
+        {0x0D425u, 0x4Du}, {0x0D440u, 0x4Cu}, {0x0D441u, 0x4Du}, {0x0D45Cu, 0x4Cu}, {0x0D45Du, 0x4Du}, {0x0D478u, 0x4Cu},
+        {0x0D479u, 0x4Du}, {0x0D494u, 0x4Cu}, {0x0D495u, 0x4Du}, {0x0D4B0u, 0x4Cu}, {0x0D4B1u, 0x4Du}, {0x0D4CCu, 0x4Cu},
+        {0x0D4CDu, 0x4Du}, {0x0D4E8u, 0x4Cu}, {0x0D4E9u, 0x4Du}, {0x0D504u, 0x4Cu}, {0x0D505u, 0x4Du}, {0x0D520u, 0x4Cu},
+        {0x0D521u, 0x4Du}, {0x0D53Cu, 0x4Cu}, {0x0D53Du, 0x4Du}, {0x0D558u, 0x4Cu}, {0x0D559u, 0x4Du}, {0x0D574u, 0x4Cu},
+        {0x0D575u, 0x4Du}, {0x0D590u, 0x4Cu}, {0x0D591u, 0x4Du}, {0x0D5ACu, 0x4Cu}, {0x0D5ADu, 0x4Du}, {0x0D5C8u, 0x4Cu},
+        {0x0D5C9u, 0x4Du}, {0x0D5E4u, 0x4Cu}, {0x0D5E5u, 0x4Du}, {0x0D600u, 0x4Cu}, {0x0D601u, 0x4Du}, {0x0D61Cu, 0x4Cu},
+        {0x0D61Du, 0x4Du}, {0x0D638u, 0x4Cu}, {0x0D639u, 0x4Du}, {0x0D654u, 0x4Cu}, {0x0D655u, 0x4Du}, {0x0D670u, 0x4Cu},
+        {0x0D671u, 0x4Du}, {0x0D68Cu, 0x4Cu}, {0x0D68Du, 0x4Du}, {0x0D6A8u, 0x4Cu}, {0x0D6A9u, 0x4Du}, {0x0D6C4u, 0x4Cu},
+        {0x0D6C5u, 0x4Du}, {0x0D6E0u, 0x4Cu}, {0x0D6E1u, 0x4Du}, {0x0D6FCu, 0x4Cu}, {0x0D6FDu, 0x4Du}, {0x0D718u, 0x4Cu},
+        {0x0D719u, 0x4Du}, {0x0D734u, 0x4Cu}, {0x0D735u, 0x4Du}, {0x0D750u, 0x4Cu}, {0x0D751u, 0x4Du}, {0x0D76Cu, 0x4Cu},
+        {0x0D76Du, 0x4Du}, {0x0D788u, 0x4Cu}, {0x0D789u, 0x4Du}, {0x0D7A4u, 0x00u}, {0x0D7B0u, 0x4Au}, {0x0D7C7u, 0x00u},
+        {0x0D7CBu, 0x4Bu}, {0x0D7FCu, 0x00u}, {0x0D800u, 0x13u}, {0x0E000u, 0x40u}, {0x0FA6Eu, 0x00u}, {0x0FA70u, 0x40u},
+        {0x0FADAu, 0x00u}, {0x0FB00u, 0x40u}, {0x0FB07u, 0x00u}, {0x0FB13u, 0x40u}, {0x0FB18u, 0x00u}, {0x0FB1Du, 0x40u},
+        {0x0FB1Eu, 0x34u}, {0x0FB1Fu, 0x40u}, {0x0FB37u, 0x00u}, {0x0FB38u, 0x40u}, {0x0FB3Du, 0x00u}, {0x0FB3Eu, 0x40u},
+        {0x0FB3Fu, 0x00u}, {0x0FB40u, 0x40u}, {0x0FB42u, 0x00u}, {0x0FB43u, 0x40u}, {0x0FB45u, 0x00u}, {0x0FB46u, 0x40u},
+        {0x0FBC3u, 0x00u}, {0x0FBD3u, 0x40u}, {0x0FD90u, 0x00u}, {0x0FD92u, 0x40u}, {0x0FDC8u, 0x00u}, {0x0FDCFu, 0x40u},
+        {0x0FDD0u, 0x00u}, {0x0FDF0u, 0x40u}, {0x0FE00u, 0x34u}, {0x0FE10u, 0x40u}, {0x0FE1Au, 0x00u}, {0x0FE20u, 0x34u},
+        {0x0FE30u, 0x40u}, {0x0FE53u, 0x00u}, {0x0FE54u, 0x40u}, {0x0FE67u, 0x00u}, {0x0FE68u, 0x40u}, {0x0FE6Cu, 0x00u},
+        {0x0FE70u, 0x40u}, {0x0FE75u, 0x00u}, {0x0FE76u, 0x40u}, {0x0FEFDu, 0x00u}, {0x0FEFFu, 0x23u}, {0x0FF00u, 0x00u},
+        {0x0FF01u, 0x40u}, {0x0FF9Eu, 0x44u}, {0x0FFA0u, 0x40u}, {0x0FFBFu, 0x00u}, {0x0FFC2u, 0x40u}, {0x0FFC8u, 0x00u},
+        {0x0FFCAu, 0x40u}, {0x0FFD0u, 0x00u}, {0x0FFD2u, 0x40u}, {0x0FFD8u, 0x00u}, {0x0FFDAu, 0x40u}, {0x0FFDDu, 0x00u},
+        {0x0FFE0u, 0x40u}, {0x0FFE7u, 0x00u}, {0x0FFE8u, 0x40u}, {0x0FFEFu, 0x00u}, {0x0FFF0u, 0x03u}, {0x0FFF9u, 0x23u},
+        {0x0FFFCu, 0x40u}, {0x0FFFEu, 0x00u}, {0x10000u, 0x40u}, {0x1000Cu, 0x00u}, {0x1000Du, 0x40u}, {0x10027u, 0x00u},
+        {0x10028u, 0x40u}, {0x1003Bu, 0x00u}, {0x1003Cu, 0x40u}, {0x1003Eu, 0x00u}, {0x1003Fu, 0x40u}, {0x1004Eu, 0x00u},
+        {0x10050u, 0x40u}, {0x1005Eu, 0x00u}, {0x10080u, 0x40u}, {0x100FBu, 0x00u}, {0x10100u, 0x40u}, {0x10103u, 0x00u},
+        {0x10107u, 0x40u}, {0x10134u, 0x00u}, {0x10137u, 0x40u}, {0x1018Fu, 0x00u}, {0x10190u, 0x40u}, {0x1019Du, 0x00u},
+        {0x101A0u, 0x40u}, {0x101A1u, 0x00u}, {0x101D0u, 0x40u}, {0x101FDu, 0x34u}, {0x101FEu, 0x00u}, {0x10280u, 0x40u},
+        {0x1029Du, 0x00u}, {0x102A0u, 0x40u}, {0x102D1u, 0x00u}, {0x102E0u, 0x34u}, {0x102E1u, 0x40u}, {0x102FCu, 0x00u},
+        {0x10300u, 0x40u}, {0x10324u, 0x00u}, {0x1032Du, 0x40u}, {0x1034Bu, 0x00u}, {0x10350u, 0x40u}, {0x10376u, 0x34u},
+        {0x1037Bu, 0x00u}, {0x10380u, 0x40u}, {0x1039Eu, 0x00u}, {0x1039Fu, 0x40u}, {0x103C4u, 0x00u}, {0x103C8u, 0x40u},
+        {0x103D6u, 0x00u}, {0x10400u, 0x40u}, {0x1049Eu, 0x00u}, {0x104A0u, 0x40u}, {0x104AAu, 0x00u}, {0x104B0u, 0x40u},
+        {0x104D4u, 0x00u}, {0x104D8u, 0x40u}, {0x104FCu, 0x00u}, {0x10500u, 0x40u}, {0x10528u, 0x00u}, {0x10530u, 0x40u},
+        {0x10564u, 0x00u}, {0x1056Fu, 0x40u}, {0x1057Bu, 0x00u}, {0x1057Cu, 0x40u}, {0x1058Bu, 0x00u}, {0x1058Cu, 0x40u},
+        {0x10593u, 0x00u}, {0x10594u, 0x40u}, {0x10596u, 0x00u}, {0x10597u, 0x40u}, {0x105A2u, 0x00u}, {0x105A3u, 0x40u},
+        {0x105B2u, 0x00u}, {0x105B3u, 0x40u}, {0x105BAu, 0x00u}, {0x105BBu, 0x40u}, {0x105BDu, 0x00u}, {0x10600u, 0x40u},
+        {0x10737u, 0x00u}, {0x10740u, 0x40u}, {0x10756u, 0x00u}, {0x10760u, 0x40u}, {0x10768u, 0x00u}, {0x10780u, 0x40u},
+        {0x10786u, 0x00u}, {0x10787u, 0x40u}, {0x107B1u, 0x00u}, {0x107B2u, 0x40u}, {0x107BBu, 0x00u}, {0x10800u, 0x40u},
+        {0x10806u, 0x00u}, {0x10808u, 0x40u}, {0x10809u, 0x00u}, {0x1080Au, 0x40u}, {0x10836u, 0x00u}, {0x10837u, 0x40u},
+        {0x10839u, 0x00u}, {0x1083Cu, 0x40u}, {0x1083Du, 0x00u}, {0x1083Fu, 0x40u}, {0x10856u, 0x00u}, {0x10857u, 0x40u},
+        {0x1089Fu, 0x00u}, {0x108A7u, 0x40u}, {0x108B0u, 0x00u}, {0x108E0u, 0x40u}, {0x108F3u, 0x00u}, {0x108F4u, 0x40u},
+        {0x108F6u, 0x00u}, {0x108FBu, 0x40u}, {0x1091Cu, 0x00u}, {0x1091Fu, 0x40u}, {0x1093Au, 0x00u}, {0x1093Fu, 0x40u},
+        {0x10940u, 0x00u}, {0x10980u, 0x40u}, {0x109B8u, 0x00u}, {0x109BCu, 0x40u}, {0x109D0u, 0x00u}, {0x109D2u, 0x40u},
+        {0x10A01u, 0x34u}, {0x10A04u, 0x00u}, {0x10A05u, 0x34u}, {0x10A07u, 0x00u}, {0x10A0Cu, 0x34u}, {0x10A10u, 0x40u},
+        {0x10A14u, 0x00u}, {0x10A15u, 0x40u}, {0x10A18u, 0x00u}, {0x10A19u, 0x40u}, {0x10A36u, 0x00u}, {0x10A38u, 0x34u},
+        {0x10A3Bu, 0x00u}, {0x10A3Fu, 0x34u}, {0x10A40u, 0x40u}, {0x10A49u, 0x00u}, {0x10A50u, 0x40u}, {0x10A59u, 0x00u},
+        {0x10A60u, 0x40u}, {0x10AA0u, 0x00u}, {0x10AC0u, 0x40u}, {0x10AE5u, 0x34u}, {0x10AE7u, 0x00u}, {0x10AEBu, 0x40u},
+        {0x10AF7u, 0x00u}, {0x10B00u, 0x40u}, {0x10B36u, 0x00u}, {0x10B39u, 0x40u}, {0x10B56u, 0x00u}, {0x10B58u, 0x40u},
+        {0x10B73u, 0x00u}, {0x10B78u, 0x40u}, {0x10B92u, 0x00u}, {0x10B99u, 0x40u}, {0x10B9Du, 0x00u}, {0x10BA9u, 0x40u},
+        {0x10BB0u, 0x00u}, {0x10C00u, 0x40u}, {0x10C49u, 0x00u}, {0x10C80u, 0x40u}, {0x10CB3u, 0x00u}, {0x10CC0u, 0x40u},
+        {0x10CF3u, 0x00u}, {0x10CFAu, 0x40u}, {0x10D24u, 0x34u}, {0x10D28u, 0x00u}, {0x10D30u, 0x40u}, {0x10D3Au, 0x00u},
+        {0x10E60u, 0x40u}, {0x10E7Fu, 0x00u}, {0x10E80u, 0x40u}, {0x10EAAu, 0x00u}, {0x10EABu, 0x34u}, {0x10EADu, 0x40u},
+        {0x10EAEu, 0x00u}, {0x10EB0u, 0x40u}, {0x10EB2u, 0x00u}, {0x10F00u, 0x40u}, {0x10F28u, 0x00u}, {0x10F30u, 0x40u},
+        {0x10F46u, 0x34u}, {0x10F51u, 0x40u}, {0x10F5Au, 0x00u}, {0x10F70u, 0x40u}, {0x10F82u, 0x34u}, {0x10F86u, 0x40u},
+        {0x10F8Au, 0x00u}, {0x10FB0u, 0x40u}, {0x10FCCu, 0x00u}, {0x10FE0u, 0x40u}, {0x10FF7u, 0x00u}, {0x11000u, 0x38u},
+        {0x11001u, 0x34u}, {0x11002u, 0x38u}, {0x11003u, 0x40u}, {0x11038u, 0x34u}, {0x11047u, 0x40u}, {0x1104Eu, 0x00u},
+        {0x11052u, 0x40u}, {0x11070u, 0x34u}, {0x11071u, 0x40u}, {0x11073u, 0x34u}, {0x11075u, 0x40u}, {0x11076u, 0x00u},
+        {0x1107Fu, 0x34u}, {0x11082u, 0x38u}, {0x11083u, 0x40u}, {0x110B0u, 0x38u}, {0x110B3u, 0x34u}, {0x110B7u, 0x38u},
+        {0x110B9u, 0x34u}, {0x110BBu, 0x40u}, {0x110BDu, 0x27u}, {0x110BEu, 0x40u}, {0x110C2u, 0x34u}, {0x110C3u, 0x00u},
+        {0x110CDu, 0x27u}, {0x110CEu, 0x00u}, {0x110D0u, 0x40u}, {0x110E9u, 0x00u}, {0x110F0u, 0x40u}, {0x110FAu, 0x00u},
+        {0x11100u, 0x34u}, {0x11103u, 0x40u}, {0x11127u, 0x34u}, {0x1112Cu, 0x38u}, {0x1112Du, 0x34u}, {0x11135u, 0x00u},
+        {0x11136u, 0x40u}, {0x11145u, 0x38u}, {0x11147u, 0x40u}, {0x11148u, 0x00u}, {0x11150u, 0x40u}, {0x11173u, 0x34u},
+        {0x11174u, 0x40u}, {0x11177u, 0x00u}, {0x11180u, 0x34u}, {0x11182u, 0x38u}, {0x11183u, 0x40u}, {0x111B3u, 0x38u},
+        {0x111B6u, 0x34u}, {0x111BFu, 0x38u}, {0x111C1u, 0x40u}, {0x111C2u, 0x47u}, {0x111C4u, 0x40u}, {0x111C9u, 0x34u},
+        {0x111CDu, 0x40u}, {0x111CEu, 0x38u}, {0x111CFu, 0x34u}, {0x111D0u, 0x40u}, {0x111E0u, 0x00u}, {0x111E1u, 0x40u},
+        {0x111F5u, 0x00u}, {0x11200u, 0x40u}, {0x11212u, 0x00u}, {0x11213u, 0x40u}, {0x1122Cu, 0x38u}, {0x1122Fu, 0x34u},
+        {0x11232u, 0x38u}, {0x11234u, 0x34u}, {0x11235u, 0x38u}, {0x11236u, 0x34u}, {0x11238u, 0x40u}, {0x1123Eu, 0x34u},
+        {0x1123Fu, 0x00u}, {0x11280u, 0x40u}, {0x11287u, 0x00u}, {0x11288u, 0x40u}, {0x11289u, 0x00u}, {0x1128Au, 0x40u},
+        {0x1128Eu, 0x00u}, {0x1128Fu, 0x40u}, {0x1129Eu, 0x00u}, {0x1129Fu, 0x40u}, {0x112AAu, 0x00u}, {0x112B0u, 0x40u},
+        {0x112DFu, 0x34u}, {0x112E0u, 0x38u}, {0x112E3u, 0x34u}, {0x112EBu, 0x00u}, {0x112F0u, 0x40u}, {0x112FAu, 0x00u},
+        {0x11300u, 0x34u}, {0x11302u, 0x38u}, {0x11304u, 0x00u}, {0x11305u, 0x40u}, {0x1130Du, 0x00u}, {0x1130Fu, 0x40u},
+        {0x11311u, 0x00u}, {0x11313u, 0x40u}, {0x11329u, 0x00u}, {0x1132Au, 0x40u}, {0x11331u, 0x00u}, {0x11332u, 0x40u},
+        {0x11334u, 0x00u}, {0x11335u, 0x40u}, {0x1133Au, 0x00u}, {0x1133Bu, 0x34u}, {0x1133Du, 0x40u}, {0x1133Eu, 0x34u},
+        {0x1133Fu, 0x38u}, {0x11340u, 0x34u}, {0x11341u, 0x38u}, {0x11345u, 0x00u}, {0x11347u, 0x38u}, {0x11349u, 0x00u},
+        {0x1134Bu, 0x38u}, {0x1134Eu, 0x00u}, {0x11350u, 0x40u}, {0x11351u, 0x00u}, {0x11357u, 0x34u}, {0x11358u, 0x00u},
+        {0x1135Du, 0x40u}, {0x11362u, 0x38u}, {0x11364u, 0x00u}, {0x11366u, 0x34u}, {0x1136Du, 0x00u}, {0x11370u, 0x34u},
+        {0x11375u, 0x00u}, {0x11400u, 0x40u}, {0x11435u, 0x38u}, {0x11438u, 0x34u}, {0x11440u, 0x38u}, {0x11442u, 0x34u},
+        {0x11445u, 0x38u}, {0x11446u, 0x34u}, {0x11447u, 0x40u}, {0x1145Cu, 0x00u}, {0x1145Du, 0x40u}, {0x1145Eu, 0x34u},
+        {0x1145Fu, 0x40u}, {0x11462u, 0x00u}, {0x11480u, 0x40u}, {0x114B0u, 0x34u}, {0x114B1u, 0x38u}, {0x114B3u, 0x34u},
+        {0x114B9u, 0x38u}, {0x114BAu, 0x34u}, {0x114BBu, 0x38u}, {0x114BDu, 0x34u}, {0x114BEu, 0x38u}, {0x114BFu, 0x34u},
+        {0x114C1u, 0x38u}, {0x114C2u, 0x34u}, {0x114C4u, 0x40u}, {0x114C8u, 0x00u}, {0x114D0u, 0x40u}, {0x114DAu, 0x00u},
+        {0x11580u, 0x40u}, {0x115AFu, 0x34u}, {0x115B0u, 0x38u}, {0x115B2u, 0x34u}, {0x115B6u, 0x00u}, {0x115B8u, 0x38u},
+        {0x115BCu, 0x34u}, {0x115BEu, 0x38u}, {0x115BFu, 0x34u}, {0x115C1u, 0x40u}, {0x115DCu, 0x34u}, {0x115DEu, 0x00u},
+        {0x11600u, 0x40u}, {0x11630u, 0x38u}, {0x11633u, 0x34u}, {0x1163Bu, 0x38u}, {0x1163Du, 0x34u}, {0x1163Eu, 0x38u},
+        {0x1163Fu, 0x34u}, {0x11641u, 0x40u}, {0x11645u, 0x00u}, {0x11650u, 0x40u}, {0x1165Au, 0x00u}, {0x11660u, 0x40u},
+        {0x1166Du, 0x00u}, {0x11680u, 0x40u}, {0x116ABu, 0x34u}, {0x116ACu, 0x38u}, {0x116ADu, 0x34u}, {0x116AEu, 0x38u},
+        {0x116B0u, 0x34u}, {0x116B6u, 0x38u}, {0x116B7u, 0x34u}, {0x116B8u, 0x40u}, {0x116BAu, 0x00u}, {0x116C0u, 0x40u},
+        {0x116CAu, 0x00u}, {0x11700u, 0x40u}, {0x1171Bu, 0x00u}, {0x1171Du, 0x34u}, {0x11720u, 0x30u}, {0x11722u, 0x34u},
+        {0x11726u, 0x38u}, {0x11727u, 0x34u}, {0x1172Cu, 0x00u}, {0x11730u, 0x40u}, {0x11747u, 0x00u}, {0x11800u, 0x40u},
+        {0x1182Cu, 0x38u}, {0x1182Fu, 0x34u}, {0x11838u, 0x38u}, {0x11839u, 0x34u}, {0x1183Bu, 0x40u}, {0x1183Cu, 0x00u},
+        {0x118A0u, 0x40u}, {0x118F3u, 0x00u}, {0x118FFu, 0x40u}, {0x11907u, 0x00u}, {0x11909u, 0x40u}, {0x1190Au, 0x00u},
+        {0x1190Cu, 0x40u}, {0x11914u, 0x00u}, {0x11915u, 0x40u}, {0x11917u, 0x00u}, {0x11918u, 0x40u}, {0x11930u, 0x34u},
+        {0x11931u, 0x38u}, {0x11936u, 0x00u}, {0x11937u, 0x38u}, {0x11939u, 0x00u}, {0x1193Bu, 0x34u}, {0x1193Du, 0x38u},
+        {0x1193Eu, 0x34u}, {0x1193Fu, 0x47u}, {0x11940u, 0x38u}, {0x11941u, 0x47u}, {0x11942u, 0x38u}, {0x11943u, 0x34u},
+        {0x11944u, 0x40u}, {0x11947u, 0x00u}, {0x11950u, 0x40u}, {0x1195Au, 0x00u}, {0x119A0u, 0x40u}, {0x119A8u, 0x00u},
+        {0x119AAu, 0x40u}, {0x119D1u, 0x38u}, {0x119D4u, 0x34u}, {0x119D8u, 0x00u}, {0x119DAu, 0x34u}, {0x119DCu, 0x38u},
+        {0x119E0u, 0x34u}, {0x119E1u, 0x40u}, {0x119E4u, 0x38u}, {0x119E5u, 0x00u}, {0x11A00u, 0x40u}, {0x11A01u, 0x34u},
+        {0x11A0Bu, 0x40u}, {0x11A33u, 0x34u}, {0x11A39u, 0x38u}, {0x11A3Au, 0x47u}, {0x11A3Bu, 0x34u}, {0x11A3Fu, 0x40u},
+        {0x11A47u, 0x34u}, {0x11A48u, 0x00u}, {0x11A50u, 0x40u}, {0x11A51u, 0x34u}, {0x11A57u, 0x38u}, {0x11A59u, 0x34u},
+        {0x11A5Cu, 0x40u}, {0x11A84u, 0x47u}, {0x11A8Au, 0x34u}, {0x11A97u, 0x38u}, {0x11A98u, 0x34u}, {0x11A9Au, 0x40u},
+        {0x11AA3u, 0x00u}, {0x11AB0u, 0x40u}, {0x11AF9u, 0x00u}, {0x11C00u, 0x40u}, {0x11C09u, 0x00u}, {0x11C0Au, 0x40u},
+        {0x11C2Fu, 0x38u}, {0x11C30u, 0x34u}, {0x11C37u, 0x00u}, {0x11C38u, 0x34u}, {0x11C3Eu, 0x38u}, {0x11C3Fu, 0x34u},
+        {0x11C40u, 0x40u}, {0x11C46u, 0x00u}, {0x11C50u, 0x40u}, {0x11C6Du, 0x00u}, {0x11C70u, 0x40u}, {0x11C90u, 0x00u},
+        {0x11C92u, 0x34u}, {0x11CA8u, 0x00u}, {0x11CA9u, 0x38u}, {0x11CAAu, 0x34u}, {0x11CB1u, 0x38u}, {0x11CB2u, 0x34u},
+        {0x11CB4u, 0x38u}, {0x11CB5u, 0x34u}, {0x11CB7u, 0x00u}, {0x11D00u, 0x40u}, {0x11D07u, 0x00u}, {0x11D08u, 0x40u},
+        {0x11D0Au, 0x00u}, {0x11D0Bu, 0x40u}, {0x11D31u, 0x34u}, {0x11D37u, 0x00u}, {0x11D3Au, 0x34u}, {0x11D3Bu, 0x00u},
+        {0x11D3Cu, 0x34u}, {0x11D3Eu, 0x00u}, {0x11D3Fu, 0x34u}, {0x11D46u, 0x47u}, {0x11D47u, 0x34u}, {0x11D48u, 0x00u},
+        {0x11D50u, 0x40u}, {0x11D5Au, 0x00u}, {0x11D60u, 0x40u}, {0x11D66u, 0x00u}, {0x11D67u, 0x40u}, {0x11D69u, 0x00u},
+        {0x11D6Au, 0x40u}, {0x11D8Au, 0x38u}, {0x11D8Fu, 0x00u}, {0x11D90u, 0x34u}, {0x11D92u, 0x00u}, {0x11D93u, 0x38u},
+        {0x11D95u, 0x34u}, {0x11D96u, 0x38u}, {0x11D97u, 0x34u}, {0x11D98u, 0x40u}, {0x11D99u, 0x00u}, {0x11DA0u, 0x40u},
+        {0x11DAAu, 0x00u}, {0x11EE0u, 0x40u}, {0x11EF3u, 0x34u}, {0x11EF5u, 0x38u}, {0x11EF7u, 0x40u}, {0x11EF9u, 0x00u},
+        {0x11FB0u, 0x40u}, {0x11FB1u, 0x00u}, {0x11FC0u, 0x40u}, {0x11FF2u, 0x00u}, {0x11FFFu, 0x40u}, {0x1239Au, 0x00u},
+        {0x12400u, 0x40u}, {0x1246Fu, 0x00u}, {0x12470u, 0x40u}, {0x12475u, 0x00u}, {0x12480u, 0x40u}, {0x12544u, 0x00u},
+        {0x12F90u, 0x40u}, {0x12FF3u, 0x00u}, {0x13000u, 0x40u}, {0x1342Fu, 0x00u}, {0x13430u, 0x23u}, {0x13439u, 0x00u},
+        {0x14400u, 0x40u}, {0x14647u, 0x00u}, {0x16800u, 0x40u}, {0x16A39u, 0x00u}, {0x16A40u, 0x40u}, {0x16A5Fu, 0x00u},
+        {0x16A60u, 0x40u}, {0x16A6Au, 0x00u}, {0x16A6Eu, 0x40u}, {0x16ABFu, 0x00u}, {0x16AC0u, 0x40u}, {0x16ACAu, 0x00u},
+        {0x16AD0u, 0x40u}, {0x16AEEu, 0x00u}, {0x16AF0u, 0x34u}, {0x16AF5u, 0x40u}, {0x16AF6u, 0x00u}, {0x16B00u, 0x40u},
+        {0x16B30u, 0x34u}, {0x16B37u, 0x40u}, {0x16B46u, 0x00u}, {0x16B50u, 0x40u}, {0x16B5Au, 0x00u}, {0x16B5Bu, 0x40u},
+        {0x16B62u, 0x00u}, {0x16B63u, 0x40u}, {0x16B78u, 0x00u}, {0x16B7Du, 0x40u}, {0x16B90u, 0x00u}, {0x16E40u, 0x40u},
+        {0x16E9Bu, 0x00u}, {0x16F00u, 0x40u}, {0x16F4Bu, 0x00u}, {0x16F4Fu, 0x34u}, {0x16F50u, 0x40u}, {0x16F51u, 0x38u},
+        {0x16F88u, 0x00u}, {0x16F8Fu, 0x34u}, {0x16F93u, 0x40u}, {0x16FA0u, 0x00u}, {0x16FE0u, 0x40u}, {0x16FE4u, 0x34u},
+        {0x16FE5u, 0x00u}, {0x16FF0u, 0x38u}, {0x16FF2u, 0x00u}, {0x17000u, 0x40u}, {0x187F8u, 0x00u}, {0x18800u, 0x40u},
+        {0x18CD6u, 0x00u}, {0x18D00u, 0x40u}, {0x18D09u, 0x00u}, {0x1AFF0u, 0x40u}, {0x1AFF4u, 0x00u}, {0x1AFF5u, 0x40u},
+        {0x1AFFCu, 0x00u}, {0x1AFFDu, 0x40u}, {0x1AFFFu, 0x00u}, {0x1B000u, 0x40u}, {0x1B123u, 0x00u}, {0x1B150u, 0x40u},
+        {0x1B153u, 0x00u}, {0x1B164u, 0x40u}, {0x1B168u, 0x00u}, {0x1B170u, 0x40u}, {0x1B2FCu, 0x00u}, {0x1BC00u, 0x40u},
+        {0x1BC6Bu, 0x00u}, {0x1BC70u, 0x40u}, {0x1BC7Du, 0x00u}, {0x1BC80u, 0x40u}, {0x1BC89u, 0x00u}, {0x1BC90u, 0x40u},
+        {0x1BC9Au, 0x00u}, {0x1BC9Cu, 0x40u}, {0x1BC9Du, 0x34u}, {0x1BC9Fu, 0x40u}, {0x1BCA0u, 0x23u}, {0x1BCA4u, 0x00u},
+        {0x1CF00u, 0x34u}, {0x1CF2Eu, 0x00u}, {0x1CF30u, 0x34u}, {0x1CF47u, 0x00u}, {0x1CF50u, 0x40u}, {0x1CFC4u, 0x00u},
+        {0x1D000u, 0x40u}, {0x1D0F6u, 0x00u}, {0x1D100u, 0x40u}, {0x1D127u, 0x00u}, {0x1D129u, 0x40u}, {0x1D165u, 0x34u},
+        {0x1D166u, 0x38u}, {0x1D167u, 0x34u}, {0x1D16Au, 0x40u}, {0x1D16Du, 0x38u}, {0x1D16Eu, 0x34u}, {0x1D173u, 0x23u},
+        {0x1D17Bu, 0x34u}, {0x1D183u, 0x40u}, {0x1D185u, 0x34u}, {0x1D18Cu, 0x40u}, {0x1D1AAu, 0x34u}, {0x1D1AEu, 0x40u},
+        {0x1D1EBu, 0x00u}, {0x1D200u, 0x40u}, {0x1D242u, 0x34u}, {0x1D245u, 0x40u}, {0x1D246u, 0x00u}, {0x1D2E0u, 0x40u},
+        {0x1D2F4u, 0x00u}, {0x1D300u, 0x40u}, {0x1D357u, 0x00u}, {0x1D360u, 0x40u}, {0x1D379u, 0x00u}, {0x1D400u, 0x40u},
+        {0x1D455u, 0x00u}, {0x1D456u, 0x40u}, {0x1D49Du, 0x00u}, {0x1D49Eu, 0x40u}, {0x1D4A0u, 0x00u}, {0x1D4A2u, 0x40u},
+        {0x1D4A3u, 0x00u}, {0x1D4A5u, 0x40u}, {0x1D4A7u, 0x00u}, {0x1D4A9u, 0x40u}, {0x1D4ADu, 0x00u}, {0x1D4AEu, 0x40u},
+        {0x1D4BAu, 0x00u}, {0x1D4BBu, 0x40u}, {0x1D4BCu, 0x00u}, {0x1D4BDu, 0x40u}, {0x1D4C4u, 0x00u}, {0x1D4C5u, 0x40u},
+        {0x1D506u, 0x00u}, {0x1D507u, 0x40u}, {0x1D50Bu, 0x00u}, {0x1D50Du, 0x40u}, {0x1D515u, 0x00u}, {0x1D516u, 0x40u},
+        {0x1D51Du, 0x00u}, {0x1D51Eu, 0x40u}, {0x1D53Au, 0x00u}, {0x1D53Bu, 0x40u}, {0x1D53Fu, 0x00u}, {0x1D540u, 0x40u},
+        {0x1D545u, 0x00u}, {0x1D546u, 0x40u}, {0x1D547u, 0x00u}, {0x1D54Au, 0x40u}, {0x1D551u, 0x00u}, {0x1D552u, 0x40u},
+        {0x1D6A6u, 0x00u}, {0x1D6A8u, 0x40u}, {0x1D7CCu, 0x00u}, {0x1D7CEu, 0x40u}, {0x1DA00u, 0x34u}, {0x1DA37u, 0x40u},
+        {0x1DA3Bu, 0x34u}, {0x1DA6Du, 0x40u}, {0x1DA75u, 0x34u}, {0x1DA76u, 0x40u}, {0x1DA84u, 0x34u}, {0x1DA85u, 0x40u},
+        {0x1DA8Cu, 0x00u}, {0x1DA9Bu, 0x34u}, {0x1DAA0u, 0x00u}, {0x1DAA1u, 0x34u}, {0x1DAB0u, 0x00u}, {0x1DF00u, 0x40u},
+        {0x1DF1Fu, 0x00u}, {0x1E000u, 0x34u}, {0x1E007u, 0x00u}, {0x1E008u, 0x34u}, {0x1E019u, 0x00u}, {0x1E01Bu, 0x34u},
+        {0x1E022u, 0x00u}, {0x1E023u, 0x34u}, {0x1E025u, 0x00u}, {0x1E026u, 0x34u}, {0x1E02Bu, 0x00u}, {0x1E100u, 0x40u},
+        {0x1E12Du, 0x00u}, {0x1E130u, 0x34u}, {0x1E137u, 0x40u}, {0x1E13Eu, 0x00u}, {0x1E140u, 0x40u}, {0x1E14Au, 0x00u},
+        {0x1E14Eu, 0x40u}, {0x1E150u, 0x00u}, {0x1E290u, 0x40u}, {0x1E2AEu, 0x34u}, {0x1E2AFu, 0x00u}, {0x1E2C0u, 0x40u},
+        {0x1E2ECu, 0x34u}, {0x1E2F0u, 0x40u}, {0x1E2FAu, 0x00u}, {0x1E2FFu, 0x40u}, {0x1E300u, 0x00u}, {0x1E7E0u, 0x40u},
+        {0x1E7E7u, 0x00u}, {0x1E7E8u, 0x40u}, {0x1E7ECu, 0x00u}, {0x1E7EDu, 0x40u}, {0x1E7EFu, 0x00u}, {0x1E7F0u, 0x40u},
+        {0x1E7FFu, 0x00u}, {0x1E800u, 0x40u}, {0x1E8C5u, 0x00u}, {0x1E8C7u, 0x40u}, {0x1E8D0u, 0x34u}, {0x1E8D7u, 0x00u},
+        {0x1E900u, 0x40u}, {0x1E944u, 0x34u}, {0x1E94Bu, 0x40u}, {0x1E94Cu, 0x00u}, {0x1E950u, 0x40u}, {0x1E95Au, 0x00u},
+        {0x1E95Eu, 0x40u}, {0x1E960u, 0x00u}, {0x1EC71u, 0x40u}, {0x1ECB5u, 0x00u}, {0x1ED01u, 0x40u}, {0x1ED3Eu, 0x00u},
+        {0x1EE00u, 0x40u}, {0x1EE04u, 0x00u}, {0x1EE05u, 0x40u}, {0x1EE20u, 0x00u}, {0x1EE21u, 0x40u}, {0x1EE23u, 0x00u},
+        {0x1EE24u, 0x40u}, {0x1EE25u, 0x00u}, {0x1EE27u, 0x40u}, {0x1EE28u, 0x00u}, {0x1EE29u, 0x40u}, {0x1EE33u, 0x00u},
+        {0x1EE34u, 0x40u}, {0x1EE38u, 0x00u}, {0x1EE39u, 0x40u}, {0x1EE3Au, 0x00u}, {0x1EE3Bu, 0x40u}, {0x1EE3Cu, 0x00u},
+        {0x1EE42u, 0x40u}, {0x1EE43u, 0x00u}, {0x1EE47u, 0x40u}, {0x1EE48u, 0x00u}, {0x1EE49u, 0x40u}, {0x1EE4Au, 0x00u},
+        {0x1EE4Bu, 0x40u}, {0x1EE4Cu, 0x00u}, {0x1EE4Du, 0x40u}, {0x1EE50u, 0x00u}, {0x1EE51u, 0x40u}, {0x1EE53u, 0x00u},
+        {0x1EE54u, 0x40u}, {0x1EE55u, 0x00u}, {0x1EE57u, 0x40u}, {0x1EE58u, 0x00u}, {0x1EE59u, 0x40u}, {0x1EE5Au, 0x00u},
+        {0x1EE5Bu, 0x40u}, {0x1EE5Cu, 0x00u}, {0x1EE5Du, 0x40u}, {0x1EE5Eu, 0x00u}, {0x1EE5Fu, 0x40u}, {0x1EE60u, 0x00u},
+        {0x1EE61u, 0x40u}, {0x1EE63u, 0x00u}, {0x1EE64u, 0x40u}, {0x1EE65u, 0x00u}, {0x1EE67u, 0x40u}, {0x1EE6Bu, 0x00u},
+        {0x1EE6Cu, 0x40u}, {0x1EE73u, 0x00u}, {0x1EE74u, 0x40u}, {0x1EE78u, 0x00u}, {0x1EE79u, 0x40u}, {0x1EE7Du, 0x00u},
+        {0x1EE7Eu, 0x40u}, {0x1EE7Fu, 0x00u}, {0x1EE80u, 0x40u}, {0x1EE8Au, 0x00u}, {0x1EE8Bu, 0x40u}, {0x1EE9Cu, 0x00u},
+        {0x1EEA1u, 0x40u}, {0x1EEA4u, 0x00u}, {0x1EEA5u, 0x40u}, {0x1EEAAu, 0x00u}, {0x1EEABu, 0x40u}, {0x1EEBCu, 0x00u},
+        {0x1EEF0u, 0x40u}, {0x1EEF2u, 0x00u}, {0x1F000u, 0x4Eu}, {0x1F02Cu, 0x0Eu}, {0x1F030u, 0x4Eu}, {0x1F094u, 0x0Eu},
+        {0x1F0A0u, 0x4Eu}, {0x1F0AFu, 0x0Eu}, {0x1F0B1u, 0x4Eu}, {0x1F0C0u, 0x0Eu}, {0x1F0C1u, 0x4Eu}, {0x1F0D0u, 0x0Eu},
+        {0x1F0D1u, 0x4Eu}, {0x1F0F6u, 0x0Eu}, {0x1F100u, 0x40u}, {0x1F10Du, 0x4Eu}, {0x1F110u, 0x40u}, {0x1F12Fu, 0x4Eu},
+        {0x1F130u, 0x40u}, {0x1F16Cu, 0x4Eu}, {0x1F172u, 0x40u}, {0x1F17Eu, 0x4Eu}, {0x1F180u, 0x40u}, {0x1F18Eu, 0x4Eu},
+        {0x1F18Fu, 0x40u}, {0x1F191u, 0x4Eu}, {0x1F19Bu, 0x40u}, {0x1F1ADu, 0x4Eu}, {0x1F1AEu, 0x0Eu}, {0x1F1E6u, 0x46u},
+        {0x1F200u, 0x40u}, {0x1F201u, 0x4Eu}, {0x1F203u, 0x0Eu}, {0x1F210u, 0x40u}, {0x1F21Au, 0x4Eu}, {0x1F21Bu, 0x40u},
+        {0x1F22Fu, 0x4Eu}, {0x1F230u, 0x40u}, {0x1F232u, 0x4Eu}, {0x1F23Bu, 0x40u}, {0x1F23Cu, 0x0Eu}, {0x1F240u, 0x40u},
+        {0x1F249u, 0x0Eu}, {0x1F250u, 0x4Eu}, {0x1F252u, 0x0Eu}, {0x1F260u, 0x4Eu}, {0x1F266u, 0x0Eu}, {0x1F300u, 0x4Eu},
+        {0x1F3FBu, 0x44u}, {0x1F400u, 0x4Eu}, {0x1F53Eu, 0x40u}, {0x1F546u, 0x4Eu}, {0x1F650u, 0x40u}, {0x1F680u, 0x4Eu},
+        {0x1F6D8u, 0x0Eu}, {0x1F6DDu, 0x4Eu}, {0x1F6EDu, 0x0Eu}, {0x1F6F0u, 0x4Eu}, {0x1F6FDu, 0x0Eu}, {0x1F700u, 0x40u},
+        {0x1F774u, 0x0Eu}, {0x1F780u, 0x40u}, {0x1F7D5u, 0x4Eu}, {0x1F7D9u, 0x0Eu}, {0x1F7E0u, 0x4Eu}, {0x1F7ECu, 0x0Eu},
+        {0x1F7F0u, 0x4Eu}, {0x1F7F1u, 0x0Eu}, {0x1F800u, 0x40u}, {0x1F80Cu, 0x0Eu}, {0x1F810u, 0x40u}, {0x1F848u, 0x0Eu},
+        {0x1F850u, 0x40u}, {0x1F85Au, 0x0Eu}, {0x1F860u, 0x40u}, {0x1F888u, 0x0Eu}, {0x1F890u, 0x40u}, {0x1F8AEu, 0x0Eu},
+        {0x1F8B0u, 0x4Eu}, {0x1F8B2u, 0x0Eu}, {0x1F900u, 0x40u}, {0x1F90Cu, 0x4Eu}, {0x1F93Bu, 0x40u}, {0x1F93Cu, 0x4Eu},
+        {0x1F946u, 0x40u}, {0x1F947u, 0x4Eu}, {0x1FA54u, 0x0Eu}, {0x1FA60u, 0x4Eu}, {0x1FA6Eu, 0x0Eu}, {0x1FA70u, 0x4Eu},
+        {0x1FA75u, 0x0Eu}, {0x1FA78u, 0x4Eu}, {0x1FA7Du, 0x0Eu}, {0x1FA80u, 0x4Eu}, {0x1FA87u, 0x0Eu}, {0x1FA90u, 0x4Eu},
+        {0x1FAADu, 0x0Eu}, {0x1FAB0u, 0x4Eu}, {0x1FABBu, 0x0Eu}, {0x1FAC0u, 0x4Eu}, {0x1FAC6u, 0x0Eu}, {0x1FAD0u, 0x4Eu},
+        {0x1FADAu, 0x0Eu}, {0x1FAE0u, 0x4Eu}, {0x1FAE8u, 0x0Eu}, {0x1FAF0u, 0x4Eu}, {0x1FAF7u, 0x0Eu}, {0x1FB00u, 0x40u},
+        {0x1FB93u, 0x00u}, {0x1FB94u, 0x40u}, {0x1FBCBu, 0x00u}, {0x1FBF0u, 0x40u}, {0x1FBFAu, 0x00u}, {0x1FC00u, 0x0Eu},
+        {0x1FFFEu, 0x00u}, {0x20000u, 0x40u}, {0x2A6E0u, 0x00u}, {0x2A700u, 0x40u}, {0x2B739u, 0x00u}, {0x2B740u, 0x40u},
+        {0x2B81Eu, 0x00u}, {0x2B820u, 0x40u}, {0x2CEA2u, 0x00u}, {0x2CEB0u, 0x40u}, {0x2EBE1u, 0x00u}, {0x2F800u, 0x40u},
+        {0x2FA1Eu, 0x00u}, {0x30000u, 0x40u}, {0x3134Bu, 0x00u}, {0xE0000u, 0x03u}, {0xE0001u, 0x23u}, {0xE0002u, 0x03u},
+        {0xE0020u, 0x24u}, {0xE0080u, 0x03u}, {0xE0100u, 0x34u}, {0xE01F0u, 0x03u}, {0xE1000u, 0x00u}, {0xF0000u, 0x40u},
+        {0xFFFFEu, 0x00u}, {0x100000u, 0x40u}, {0x10FFFEu, 0x00u}
+    }};
+}
+/*
+------------------------------------------------------------------------------
+Anonymous namespace END
+------------------------------------------------------------------------------
+*/
+/*
+------------------------------------------------------------------------------
+Namespace widgets BEGIN
+------------------------------------------------------------------------------
+*/
+namespace widgets {
+/*
+------------------------------------------------------------------------------
+Construction / Destruction
+------------------------------------------------------------------------------
+*/
+    Unicode_table::Unicode_table() :
+        _block_index(),
+        _blocks     ()
+    {
+
+        _block_index.reserve(NUM_CODE_POINTS / BLOCK_SIZE);
+
+        std::unordered_map<std::string, std::uint16_t> block_ids;
+        std::string                                    block(BLOCK_SIZE, '\0');
+        std::size_t                                    run = 0u;
+
+        for (std::size_t block_first = 0u; block_first < NUM_CODE_POINTS; block_first += BLOCK_SIZE) {
+
+            std::size_t const block_last = block_first + BLOCK_SIZE;
+
+            // Fill the block a run at a time, most blocks lie inside a single run.
+            for (std::size_t first = block_first; first < block_last; ) {
+
+                while (run + 1u < PROPERTY_RUNS.size() && PROPERTY_RUNS[run + 1u].first <= first) {
+
+                    ++run;
+                }
+
+                std::size_t const run_last = run + 1u < PROPERTY_RUNS.size() ? PROPERTY_RUNS[run + 1u].first : NUM_CODE_POINTS;
+                std::size_t const last     = std::min(run_last, block_last);
+
+                std::fill(block.begin() + (first - block_first), block.begin() + (last - block_first), static_cast<char>(PROPERTY_RUNS[run].properties));
+
+                first = last;
+            }
+
+            // Most blocks repeat, unassigned planes and runs of letters, store each once.
+            auto const [iter, is_new] = block_ids.try_emplace(block, static_cast<std::uint16_t>(block_ids.size()));
+
+            if (is_new) {
+
+                _blocks.insert(_blocks.end(), block.begin(), block.end());
+            }
+
+            _block_index.push_back(iter->second);
+        }
+    }
+/*
+------------------------------------------------------------------------------
+Functionality
+------------------------------------------------------------------------------
+*/
+    std::size_t Unicode_table::find_previous_grapheme(
+        std::u32string_view const text,
+        std::size_t         const index
+        ) const {
+
+        std::size_t start = std::min(index, text.size());
+
+        if (start == 0u) {
+
+            return 0u;
+        }
+
+        --start;
+
+        while (start > 0u && !_is_grapheme_boundary(text, start)) {
+
+            --start;
+        }
+
+        return start;
+    }
+
+    std::size_t Unicode_table::find_next_grapheme(
+        std::u32string_view const text,
+        std::size_t         const index
+        ) const {
+
+        if (index >= text.size()) {
+
+            return text.size();
+        }
+
+        std::size_t end = index + 1u;
+
+        while (end < text.size() && !_is_grapheme_boundary(text, end)) {
+
+            ++end;
+        }
+
+        return end;
+    }
+/*
+------------------------------------------------------------------------------
+Get Functions
+------------------------------------------------------------------------------
+*/
+    Unicode_table::Kind Unicode_table::get_kind(
+        char32_t const code_point
+        ) const {
+
+        return static_cast<Kind>(_get_properties(code_point) >> 4u);
+    }
+
+    Unicode_table::Grapheme_break Unicode_table::get_grapheme_break(
+        char32_t const code_point
+        ) const {
+
+        return static_cast<Grapheme_break>(_get_properties(code_point) & 0x0Fu);
+    }
+
+    bool Unicode_table::is_printable(
+        char32_t const code_point
+        ) const {
+
+        Kind const kind = get_kind(code_point);
+
+        return kind == Kind::PRINTABLE || kind == Kind::COMBINING;
+    }
+
+    bool Unicode_table::is_combining(
+        char32_t const code_point
+        ) const {
+
+        return get_kind(code_point) == Kind::COMBINING;
+    }
+
+    bool Unicode_table::is_control(
+        char32_t const code_point
+        ) const {
+
+        return get_kind(code_point) == Kind::CONTROL;
+    }
+
+    bool Unicode_table::is_insertable(
+        char32_t const code_point
+        ) const {
+
+        return is_printable(code_point) || get_kind(code_point) == Kind::FORMAT;
+    }
+/*
+------------------------------------------------------------------------------
+Helper Functions
+------------------------------------------------------------------------------
+*/
+    std::uint8_t Unicode_table::_get_properties(
+        char32_t const code_point
+        ) const {
+
+        if (code_point >= NUM_CODE_POINTS) {
+
+            return 0u;
+        }
+
+        return _blocks[_block_index[code_point / BLOCK_SIZE] * BLOCK_SIZE + code_point % BLOCK_SIZE];
+    }
+
+    bool Unicode_table::_is_grapheme_boundary(
+        std::u32string_view const text,
+        std::size_t         const index
+        ) const {
+
+        using Gb = Grapheme_break;
+
+        Gb const before = get_grapheme_break(text[index - 1u]);
+        Gb const after  = get_grapheme_break(text[index     ]);
+
+        auto const is_control_break = [](Gb const value) {
+
+            return value == Gb::CR || value == Gb::LF || value == Gb::CONTROL;
+        };
+
+        // The rules of UAX #29 in order, the first that applies decides.
+        if (before == Gb::CR && after == Gb::LF) {
+
+            return false;                                                                      // GB3
+        } else if (is_control_break(before) || is_control_break(after)) {
+
+            return true;                                                                       // GB4, GB5
+        } else if (before == Gb::L && (after == Gb::L || after == Gb::V || after == Gb::LV || after == Gb::LVT)) {
+
+            return false;                                                                      // GB6
+        } else if ((before == Gb::LV || before == Gb::V) && (after == Gb::V || after == Gb::T)) {
+
+            return false;                                                                      // GB7
+        } else if ((before == Gb::LVT || before == Gb::T) && after == Gb::T) {
+
+            return false;                                                                      // GB8
+        } else if (after == Gb::EXTEND || after == Gb::ZWJ || after == Gb::SPACING_MARK || before == Gb::PREPEND) {
+
+            return false;                                                                      // GB9, GB9a, GB9b
+        } else if (before == Gb::ZWJ && after == Gb::EXTENDED_PICTOGRAPHIC) {
+
+            // Joined only if the joiner follows a pictograph and its extenders.
+            std::size_t i = index - 1u;
+
+            while (i > 0u && get_grapheme_break(text[i - 1u]) == Gb::EXTEND) {
+
+                --i;
+            }
+
+            return i == 0u || get_grapheme_break(text[i - 1u]) != Gb::EXTENDED_PICTOGRAPHIC;  // GB11
+        } else if (before == Gb::REGIONAL_INDICATOR && after == Gb::REGIONAL_INDICATOR) {
+
+            // Flags pair up from the start of a run of regional indicators.
+            std::size_t num_indicators = 0u;
+
+            for (std::size_t i = index; i > 0u && get_grapheme_break(text[i - 1u]) == Gb::REGIONAL_INDICATOR; --i) {
+
+                ++num_indicators;
+            }
+
+            return num_indicators % 2u == 0u;                                                  // GB12, GB13
+        }
+
+        return true;                                                                           // GB999
+    }
+}
+/*
+------------------------------------------------------------------------------
+Namespace widgets END
+------------------------------------------------------------------------------
+*/
@@ -4,6 +4,8 @@ Includes
 ------------------------------------------------------------------------------
 */
 #include "widgets/log.h"
+#include "widgets/render_queue.h"
+#include "widgets/spatial_grid.h"
 #include "widgets/widget.h"
 
 #include <string>
@@ -19,10 +21,13 @@ Construction / Destruction
 ------------------------------------------------------------------------------
 */
     Widget::Widget(
-        std::shared_ptr<sf::RenderWindow> parent_window
+        std::shared_ptr<sf::RenderTarget> parent_target
         ) :
-        _parent_window(std::move(parent_window)),
-        _current_state(STATE__DEFAULT          )
+        _parent_target        (parent_target                                             ),
+        _parent_window        (std::dynamic_pointer_cast<sf::RenderWindow>(parent_target)),
+        _current_state        (STATE__DEFAULT                                            ),
+        _layer                (0                                                         ),
+        _compositor_dirty_flag(nullptr                                                   )
     {}
 /*
 ------------------------------------------------------------------------------
@@ -63,6 +68,7 @@ State management
             "].";
 
             _current_state = state_to_change_to;
+            _mark_dirty();
         }
     }
 /*
@@ -75,6 +81,9 @@ Functionality
         if (_current_state == STATE__HIDDEN) {
 
             // Dont draw since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or draw since widget is outside the current view.
         } else {
 
             // Can call _update_widget() for final updating
@@ -89,6 +98,33 @@ Functionality
         }
     }
 
+    void Widget::queue_draw(
+        Render_queue& queue
+        ) {
+
+        if (_current_state == STATE__HIDDEN) {
+
+            // Dont queue since widget is hidden.
+        } else if (_is_outside_view()) {
+
+            // Dont update or queue since widget is outside the current view.
+        } else {
+
+            _update_widget();
+
+            // Push drawables to the queue here.
+            LOG(WARNING)                              <<
+            "Widget is not queued for drawing, "      <<
+            "queue_draw() base class function needs " <<
+            "to be overridden and this log removed.";
+        }
+    }
+
+    bool Widget::poll() {
+
+        return false;
+    }
+
     void Widget::move(
         sf::Vector2f const offset
         ) {
@@ -249,6 +285,14 @@ Set Functions
         angle.asRadians()                 <<
         "]-radians, as this function is not implemented.";
     }
+
+    void Widget::set_layer(
+        int const layer
+        ) {
+
+        _layer = layer;
+        _mark_dirty();
+    }
 /*
 ------------------------------------------------------------------------------
 Get Functions
@@ -383,6 +427,21 @@ Get Functions
 
         return sf::degrees(0.0f);
     }
+
+    int Widget::get_layer() const {
+
+        return _layer;
+    }
+
+    sf::FloatRect Widget::get_global_bounds() const {
+
+        LOG(WARNING)                             <<
+        "Cannot get the global bounds as this " <<
+        "function is not implemented. "          <<
+        "returning {{0.0f, 0.0f}, {0.0f, 0.0f}}.";
+
+        return {};
+    }
 /*
 ------------------------------------------------------------------------------
 Helper Functions
@@ -399,6 +458,42 @@ Helper Functions
             return false;
         }
     }
+
+    bool Widget::_is_parent_target_nullptr() const {
+
+        if (_parent_target.expired()) {
+
+            LOG(WARNING) << "_parent_target is nullptr";
+            return true;
+        } else {
+
+            return false;
+        }
+    }
+
+    bool Widget::_is_outside_view() const {
+
+        auto temp_ptr = _parent_target.lock();
+
+        // Without a target there is no view, draw() reports the missing target.
+        if (!temp_ptr) {
+
+            return false;
+        }
+
+        sf::FloatRect const view_bounds   = get_view_bounds(temp_ptr->getView());
+        sf::FloatRect const widget_bounds = get_global_bounds();
+
+        return !is_overlapping(view_bounds, widget_bounds);
+    }
+
+    void Widget::_mark_dirty() {
+
+        if (_compositor_dirty_flag != nullptr) {
+
+            *_compositor_dirty_flag = true;
+        }
+    }
 }
 /*
 ------------------------------------------------------------------------------